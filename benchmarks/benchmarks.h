@@ -0,0 +1,75 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Collection of utility functions that are useful in benchmarks.
+
+#ifndef included_ibamr_benchmarks_h
+#define included_ibamr_benchmarks_h
+
+#include <ibamr/config.h>
+
+#include <ibtk/IBTK_MPI.h>
+
+#include <tbox/PIO.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <string>
+
+// Time @p kernel, which is called @p n_warmup times before @p n_reps timed
+// calls. All processes must call this function. The returned value is the
+// wall-clock time per call, in seconds, of the slowest process.
+template <typename Kernel>
+inline double
+time_kernel(Kernel kernel, const int n_warmup, const int n_reps)
+{
+    for (int k = 0; k < n_warmup; ++k) kernel();
+    IBTK::IBTK_MPI::barrier();
+    const auto start = std::chrono::steady_clock::now();
+    for (int k = 0; k < n_reps; ++k) kernel();
+    const auto stop = std::chrono::steady_clock::now();
+    double time = std::chrono::duration<double>(stop - start).count() / std::max(n_reps, 1);
+    time = IBTK::IBTK_MPI::maxReduction(time);
+    return time;
+} // time_kernel
+
+// Print the header of the table written by print_benchmark_result().
+inline void
+print_benchmark_header()
+{
+    using namespace SAMRAI::tbox;
+    pout << std::left << std::setw(32) << "kernel" << std::right << std::setw(14) << "points" << std::setw(14)
+         << "time (s)" << std::setw(14) << "points/s" << std::setw(14) << "GB/s" << '\n';
+    return;
+} // print_benchmark_header
+
+// Print the throughput of a kernel that processes @p n_points points and moves
+// @p n_bytes bytes (both summed over all processes) per call in @p time
+// seconds. All processes must call this function.
+inline void
+print_benchmark_result(const std::string& name, double n_points, double n_bytes, const double time)
+{
+    using namespace SAMRAI::tbox;
+    n_points = IBTK::IBTK_MPI::sumReduction(n_points);
+    n_bytes = IBTK::IBTK_MPI::sumReduction(n_bytes);
+    const double points_per_second = time > 0.0 ? n_points / time : 0.0;
+    const double gb_per_second = time > 0.0 ? 1.0e-9 * n_bytes / time : 0.0;
+    pout << std::left << std::setw(32) << name << std::right << std::setw(14) << static_cast<long long>(n_points)
+         << std::setw(14) << std::scientific << std::setprecision(4) << time << std::setw(14) << points_per_second
+         << std::setw(14) << std::fixed << std::setprecision(3) << gb_per_second << '\n';
+    pout.unsetf(std::ios_base::floatfield);
+    return;
+} // print_benchmark_result
+
+#endif // included_ibamr_benchmarks_h
@@ -0,0 +1,326 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Throughput benchmark for FEDataManager::spread() and
+// FEDataManager::interpWeighted().
+//
+// The structure is a square (or cube) of side length L, centered in the
+// computational domain, that is meshed with elements of size MFAC * dx. The
+// number of points is the number of quadrature points at which the kernels
+// evaluate regularized delta functions. As in the ib_kernels benchmark, the
+// byte counts are based on a simple model that counts the values at each
+// quadrature point and the Eulerian values in the support of each regularized
+// delta function, and ignores the cost of evaluating the finite element fields.
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/FEDataManager.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/libmesh_utilities.h>
+
+#include <libmesh/elem.h>
+#include <libmesh/equation_systems.h>
+#include <libmesh/explicit_system.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/petsc_vector.h>
+#include <libmesh/quadrature.h>
+#include <libmesh/string_to_enum.h>
+
+#include <petscsys.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SAMRAI_config.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitStrategy.h>
+#include <StandardTagAndInitialize.h>
+
+#include <boost/multi_array.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <set>
+
+#include <ibamr/app_namespaces.h>
+
+#include "benchmarks.h"
+
+namespace
+{
+// The benchmark uses a single uniform patch level, so the tagging and
+// initialization strategy has nothing to do.
+class UniformGridStrategy : public StandardTagAndInitStrategy<NDIM>
+{
+public:
+    void initializeLevelData(const Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
+                             const int /*level_number*/,
+                             const double /*init_data_time*/,
+                             const bool /*can_be_refined*/,
+                             const bool /*initial_time*/,
+                             const Pointer<BasePatchLevel<NDIM> > /*old_level*/ = nullptr,
+                             const bool /*allocate_data*/ = true) override
+    {
+    }
+
+    void resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM> > /*hierarchy*/,
+                                     const int /*coarsest_level*/,
+                                     const int /*finest_level*/) override
+    {
+    }
+};
+
+// Count the quadrature points used by the spreading or interpolation kernels on
+// the elements that are local to this process.
+double
+count_quadrature_points(FEDataManager* fe_data_manager,
+                        const Pointer<PatchLevel<NDIM> >& level,
+                        const QuadratureType quad_type,
+                        const Order quad_order,
+                        const bool use_adaptive_quadrature,
+                        const double point_density,
+                        const bool allow_rules_with_negative_weights)
+{
+    const std::vector<std::vector<Elem*> >& active_patch_elem_map = fe_data_manager->getActivePatchElementMap();
+    std::set<const Elem*> counted_elems;
+    std::unique_ptr<QBase> qrule;
+    double n_qp = 0.0;
+    int local_patch_num = 0;
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* const patch_dx = patch_geom->getDx();
+        const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
+        for (const Elem* const elem : active_patch_elem_map[local_patch_num])
+        {
+            if (!counted_elems.insert(elem).second) continue;
+            boost::multi_array<double, 2> X_node(boost::extents[elem->n_nodes()][NDIM]);
+            for (unsigned int k = 0; k < elem->n_nodes(); ++k)
+            {
+                for (unsigned int d = 0; d < NDIM; ++d) X_node[k][d] = elem->point(k)(d);
+            }
+            FEDataManager::updateQuadratureRule(qrule,
+                                                quad_type,
+                                                quad_order,
+                                                use_adaptive_quadrature,
+                                                point_density,
+                                                allow_rules_with_negative_weights,
+                                                elem,
+                                                X_node,
+                                                patch_dx_min);
+            n_qp += qrule->n_points();
+        }
+    }
+    return n_qp;
+} // count_quadrature_points
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "fe_kernels.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const std::string kernel_fcn = input_db->getStringWithDefault("IB_DELTA_FUNCTION", "IB_4");
+        const bool use_cell = input_db->getStringWithDefault("var_type", "SIDE") == "CELL";
+        const int n_warmup = input_db->getIntegerWithDefault("NUM_WARMUP", 2);
+        const int n_reps = input_db->getIntegerWithDefault("NUM_REPETITIONS", 10);
+        const auto elem_type = Utility::string_to_enum<ElemType>(input_db->getString("ELEM_TYPE"));
+        const auto fe_order = Utility::string_to_enum<Order>(input_db->getStringWithDefault("FE_ORDER", "FIRST"));
+        const auto quad_type =
+            Utility::string_to_enum<QuadratureType>(input_db->getStringWithDefault("QUAD_TYPE", "QGAUSS"));
+        const auto quad_order = Utility::string_to_enum<Order>(input_db->getStringWithDefault("QUAD_ORDER", "FIFTH"));
+        const bool use_adaptive_quadrature = input_db->getBoolWithDefault("USE_ADAPTIVE_QUADRATURE", true);
+        const double point_density = input_db->getDoubleWithDefault("POINT_DENSITY", 2.0);
+
+        Pointer<Database> gridding_db = app_initializer->getComponentDatabase("GriddingAlgorithm");
+        if (gridding_db->getInteger("max_levels") != 1)
+        {
+            TBOX_ERROR("fe_kernels: GriddingAlgorithm::max_levels must be 1" << std::endl);
+        }
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+
+        // Mesh a square (or cube) centered in the domain.
+        const double* const x_lower = grid_geometry->getXLower();
+        const double* const x_upper = grid_geometry->getXUpper();
+        const double dx = (x_upper[0] - x_lower[0]) / grid_geometry->getPhysicalDomain()[0].numberCells(0);
+        const double L = input_db->getDouble("L");
+        const int n_elems = std::max(1, static_cast<int>(std::round(L / (input_db->getDouble("MFAC") * dx))));
+        std::array<double, NDIM> center;
+        for (unsigned int d = 0; d < NDIM; ++d) center[d] = 0.5 * (x_lower[d] + x_upper[d]);
+        ReplicatedMesh mesh(init.comm(), NDIM);
+#if (NDIM == 2)
+        MeshTools::Generation::build_square(mesh,
+                                            n_elems,
+                                            n_elems,
+                                            center[0] - 0.5 * L,
+                                            center[0] + 0.5 * L,
+                                            center[1] - 0.5 * L,
+                                            center[1] + 0.5 * L,
+                                            elem_type);
+#endif
+#if (NDIM == 3)
+        MeshTools::Generation::build_cube(mesh,
+                                          n_elems,
+                                          n_elems,
+                                          n_elems,
+                                          center[0] - 0.5 * L,
+                                          center[0] + 0.5 * L,
+                                          center[1] - 0.5 * L,
+                                          center[1] + 0.5 * L,
+                                          center[2] - 0.5 * L,
+                                          center[2] + 0.5 * L,
+                                          elem_type);
+#endif
+
+        // Set up the position and force systems.
+        EquationSystems equation_systems(mesh);
+        auto& X_system = equation_systems.add_system<ExplicitSystem>("X");
+        auto& F_system = equation_systems.add_system<ExplicitSystem>("F");
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            X_system.add_variable("X_" + std::to_string(d), fe_order, LAGRANGE);
+            F_system.add_variable("F_" + std::to_string(d), fe_order, LAGRANGE);
+        }
+        equation_systems.init();
+        const unsigned int X_sys_num = X_system.number();
+        for (auto node_it = mesh.local_nodes_begin(); node_it != mesh.local_nodes_end(); ++node_it)
+        {
+            const Node* const node = *node_it;
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                X_system.solution->set(node->dof_number(X_sys_num, d, 0), (*node)(d));
+            }
+        }
+        X_system.solution->close();
+        *F_system.solution = 1.0;
+        F_system.solution->close();
+
+        // Set up the FE data manager.
+        auto fe_data = std::make_shared<FEData>("FEData", equation_systems, /*register_for_restart*/ false);
+        const FEDataManager::InterpSpec interp_spec(kernel_fcn,
+                                                    quad_type,
+                                                    quad_order,
+                                                    use_adaptive_quadrature,
+                                                    point_density,
+                                                    /*use_consistent_mass_matrix*/ true,
+                                                    /*use_nodal_quadrature*/ false);
+        const FEDataManager::SpreadSpec spread_spec(
+            kernel_fcn, quad_type, quad_order, use_adaptive_quadrature, point_density, /*use_nodal_quadrature*/ false);
+        const IntVector<NDIM> gcw(LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        Pointer<Database> fe_data_manager_db = app_initializer->getComponentDatabase("FEDataManager");
+        FEDataManager* fe_data_manager = FEDataManager::getManager(fe_data,
+                                                                   "FEDataManager",
+                                                                   fe_data_manager_db,
+                                                                   /*max_levels*/ 1,
+                                                                   interp_spec,
+                                                                   spread_spec,
+                                                                   FEDataManager::WorkloadSpec(),
+                                                                   gcw,
+                                                                   nullptr,
+                                                                   /*register_for_restart*/ false);
+        fe_data_manager->setCurrentCoordinatesSystemName("X");
+
+        // Set up the grid.
+        UniformGridStrategy uniform_grid_strategy;
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               &uniform_grid_strategy,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm = new GriddingAlgorithm<NDIM>(
+            "GriddingAlgorithm", gridding_db, error_detector, box_generator, load_balancer);
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        fe_data_manager->setPatchHierarchy(patch_hierarchy);
+        fe_data_manager->reinitElementMappings();
+
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        auto f_var = use_cell ? Pointer<hier::Variable<NDIM> >(new CellVariable<NDIM, double>("f", NDIM)) :
+                                Pointer<hier::Variable<NDIM> >(new SideVariable<NDIM, double>("f"));
+        const int f_idx = var_db->registerVariableAndContext(f_var, ctx, gcw);
+        level->allocatePatchData(f_idx, 0.0);
+
+        std::unique_ptr<PetscVector<double> > X_ghost_vec = fe_data_manager->buildIBGhostedVector("X");
+        std::unique_ptr<PetscVector<double> > F_ghost_vec = fe_data_manager->buildIBGhostedVector("F");
+        copy_and_synch(*X_system.solution, *X_ghost_vec);
+        copy_and_synch(*F_system.solution, *F_ghost_vec);
+        std::unique_ptr<NumericVector<double> > U_vec = F_system.solution->clone();
+
+        // Bytes moved per quadrature point: the position and value at the
+        // quadrature point, and the Eulerian values in the kernel support.
+        int stencil_values = NDIM;
+        for (unsigned int d = 0; d < NDIM; ++d) stencil_values *= LEInteractor::getStencilSize(kernel_fcn);
+        const double lagrangian_bytes = 2 * NDIM * sizeof(double);
+        const double spread_bytes = lagrangian_bytes + 2 * stencil_values * sizeof(double);
+        const double interp_bytes = lagrangian_bytes + stencil_values * sizeof(double);
+
+        pout << "FE kernel benchmark: NDIM = " << NDIM << ", kernel = " << kernel_fcn
+             << ", elements = " << mesh.n_elem() << ", element type = " << Utility::enum_to_string(elem_type)
+             << ", variable type = " << (use_cell ? "CELL" : "SIDE") << ", patches = " << level->getNumberOfPatches()
+             << ", processes = " << IBTK_MPI::getNodes() << "\n\n";
+        print_benchmark_header();
+
+        // FEDataManager::spread().
+        const double n_spread_qp = count_quadrature_points(fe_data_manager,
+                                                           level,
+                                                           spread_spec.quad_type,
+                                                           spread_spec.quad_order,
+                                                           spread_spec.use_adaptive_quadrature,
+                                                           spread_spec.point_density,
+                                                           spread_spec.allow_rules_with_negative_weights);
+        auto spread = [&]() { fe_data_manager->spread(f_idx, *F_ghost_vec, *X_ghost_vec, "F"); };
+        double time = time_kernel(spread, n_warmup, n_reps);
+        print_benchmark_result("FEDataManager::spread", n_spread_qp, n_spread_qp * spread_bytes, time);
+
+        // FEDataManager::interpWeighted().
+        const double n_interp_qp = count_quadrature_points(fe_data_manager,
+                                                           level,
+                                                           interp_spec.quad_type,
+                                                           interp_spec.quad_order,
+                                                           interp_spec.use_adaptive_quadrature,
+                                                           interp_spec.point_density,
+                                                           interp_spec.allow_rules_with_negative_weights);
+        auto interp = [&]() {
+            fe_data_manager->interpWeighted(f_idx,
+                                            *U_vec,
+                                            *X_ghost_vec,
+                                            "F",
+                                            std::vector<Pointer<RefineSchedule<NDIM> > >(),
+                                            0.0,
+                                            /*close_F*/ true,
+                                            /*close_X*/ false);
+        };
+        time = time_kernel(interp, n_warmup, n_reps);
+        print_benchmark_result("FEDataManager::interpWeighted", n_interp_qp, n_interp_qp * interp_bytes, time);
+    }
+} // main
@@ -0,0 +1,385 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Throughput benchmark for the kernels used by the IB method with a point
+// (i.e., non-FE) structural discretization:
+//
+// - LEInteractor::spread() and LEInteractor::interpolate(),
+// - IBStandardForceGen::computeLagrangianForce(), and
+// - SAMRAIGhostDataAccumulator::accumulateGhostData().
+//
+// The markers are placed on a randomly perturbed lattice with MARKERS_PER_CELL
+// markers per Cartesian grid cell. The markers used by IBStandardForceGen are
+// connected by springs along the x-axis. The time per call, the number of
+// points processed per second, and an estimate of the number of bytes moved per
+// second are printed for each kernel. The byte counts are based on a simple
+// model: they count the Lagrangian data read and written and the Eulerian
+// values in the support of each regularized delta function (which are read and,
+// for spreading, written) and ignore any cache reuse.
+
+#include <ibamr/IBRedundantInitializer.h>
+#include <ibamr/IBStandardForceGen.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/SAMRAIGhostDataAccumulator.h>
+
+#include <petscsys.h>
+
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <SAMRAI_config.h>
+#include <SideData.h>
+#include <SideGeometry.h>
+#include <SideVariable.h>
+#include <StandardTagAndInitialize.h>
+
+#include <array>
+#include <cmath>
+#include <random>
+
+#include <ibamr/app_namespaces.h>
+
+#include "benchmarks.h"
+
+namespace
+{
+// Specification of the lattice of markers used by the force generator.
+struct LatticeSpec
+{
+    std::array<int, NDIM> n_markers;
+    std::array<double, NDIM> x_lower, dX;
+    double jitter = 0.0;
+    double spring_stiffness = 1.0;
+    unsigned int seed = 0;
+};
+
+void
+generate_lattice(const unsigned int& /*strct_num*/,
+                 const int& ln,
+                 int& num_vertices,
+                 std::vector<IBTK::Point>& vertex_posn,
+                 void* ctx)
+{
+    const auto& spec = *static_cast<const LatticeSpec*>(ctx);
+    num_vertices = 0;
+    vertex_posn.clear();
+    if (ln != 0) return;
+
+    // All processes generate the same structure.
+    std::mt19937 rng(spec.seed);
+    std::uniform_real_distribution<double> jitter(-spec.jitter, spec.jitter);
+    num_vertices = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) num_vertices *= spec.n_markers[d];
+    vertex_posn.resize(num_vertices);
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        int idx = k;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int i = idx % spec.n_markers[d];
+            idx /= spec.n_markers[d];
+            vertex_posn[k][d] = spec.x_lower[d] + (i + 0.5 + jitter(rng)) * spec.dX[d];
+        }
+    }
+    return;
+} // generate_lattice
+
+using SpringSpecMap =
+    std::map<IBRedundantInitializer::Edge, IBRedundantInitializer::SpringSpec, IBRedundantInitializer::EdgeComp>;
+
+void
+generate_springs(const unsigned int& /*strct_num*/,
+                 const int& ln,
+                 std::multimap<int, IBRedundantInitializer::Edge>& spring_map,
+                 SpringSpecMap& spring_spec,
+                 void* ctx)
+{
+    const auto& spec = *static_cast<const LatticeSpec*>(ctx);
+    if (ln != 0) return;
+
+    // Connect each marker to its neighbor along the x-axis.
+    int num_vertices = 1;
+    for (unsigned int d = 0; d < NDIM; ++d) num_vertices *= spec.n_markers[d];
+    for (int k = 0; k < num_vertices; ++k)
+    {
+        if ((k + 1) % spec.n_markers[0] == 0) continue;
+        const IBRedundantInitializer::Edge e(k, k + 1);
+        IBRedundantInitializer::SpringSpec spec_data;
+        spec_data.parameters = { spec.spring_stiffness / spec.dX[0], 0.0 };
+        spec_data.force_fcn_idx = 0;
+        spring_map.insert(std::make_pair(e.first, e));
+        spring_spec.insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // generate_springs
+
+// Generate randomly perturbed lattice positions and random values for the
+// markers located in the patch.
+void
+generate_patch_markers(std::vector<double>& X,
+                       std::vector<double>& Q,
+                       const Pointer<Patch<NDIM> >& patch,
+                       const double markers_per_cell,
+                       std::mt19937& rng)
+{
+    Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+    const double* const patch_x_lower = patch_geom->getXLower();
+    const double* const patch_dx = patch_geom->getDx();
+    const Box<NDIM>& patch_box = patch->getBox();
+    const double markers_per_dx = std::pow(markers_per_cell, 1.0 / NDIM);
+
+    std::array<int, NDIM> n_markers;
+    std::array<double, NDIM> dX;
+    int num_markers = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        n_markers[d] = std::max(1, static_cast<int>(std::round(patch_box.numberCells(d) * markers_per_dx)));
+        dX[d] = patch_box.numberCells(d) * patch_dx[d] / n_markers[d];
+        num_markers *= n_markers[d];
+    }
+
+    std::uniform_real_distribution<double> jitter(-0.25, 0.25);
+    std::uniform_real_distribution<double> value(-1.0, 1.0);
+    X.resize(NDIM * num_markers);
+    Q.resize(NDIM * num_markers);
+    for (int k = 0; k < num_markers; ++k)
+    {
+        int idx = k;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const int i = idx % n_markers[d];
+            idx /= n_markers[d];
+            X[NDIM * k + d] = patch_x_lower[d] + (i + 0.5 + jitter(rng)) * dX[d];
+            Q[NDIM * k + d] = value(rng);
+        }
+    }
+    return;
+} // generate_patch_markers
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "ib_kernels.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        const std::string kernel_fcn = input_db->getStringWithDefault("IB_DELTA_FUNCTION", "IB_4");
+        const double markers_per_cell = input_db->getDoubleWithDefault("MARKERS_PER_CELL", 1.0);
+        const bool use_cell = input_db->getStringWithDefault("var_type", "SIDE") == "CELL";
+        const int n_warmup = input_db->getIntegerWithDefault("NUM_WARMUP", 2);
+        const int n_reps = input_db->getIntegerWithDefault("NUM_REPETITIONS", 10);
+        const auto seed = static_cast<unsigned int>(input_db->getIntegerWithDefault("SEED", 42));
+
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+
+        // Set up the Lagrangian data manager and the lattice of markers used
+        // by the force generator.
+        LDataManager* l_data_manager = LDataManager::getManager("LDataManager",
+                                                                kernel_fcn,
+                                                                kernel_fcn,
+                                                                /*error_if_points_leave_domain*/ false,
+                                                                IntVector<NDIM>(0),
+                                                                /*register_for_restart*/ false);
+        // NOTE: The benchmark uses a single uniform patch level.
+        Pointer<Database> gridding_db = app_initializer->getComponentDatabase("GriddingAlgorithm");
+        if (gridding_db->getInteger("max_levels") != 1)
+        {
+            TBOX_ERROR("ib_kernels: GriddingAlgorithm::max_levels must be 1" << std::endl);
+        }
+        LatticeSpec lattice_spec;
+        lattice_spec.jitter = 0.25;
+        lattice_spec.spring_stiffness = input_db->getDoubleWithDefault("K", 1.0);
+        lattice_spec.seed = seed;
+        {
+            const double* const x_lower = grid_geometry->getXLower();
+            const double* const x_upper = grid_geometry->getXUpper();
+            const Box<NDIM> domain_box = grid_geometry->getPhysicalDomain()[0];
+            const double markers_per_dx = std::pow(markers_per_cell, 1.0 / NDIM);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                const int n_cells = domain_box.numberCells(d);
+                lattice_spec.n_markers[d] = std::max(1, static_cast<int>(std::round(n_cells * markers_per_dx)));
+                lattice_spec.x_lower[d] = x_lower[d];
+                lattice_spec.dX[d] = (x_upper[d] - x_lower[d]) / lattice_spec.n_markers[d];
+            }
+        }
+        Pointer<IBRedundantInitializer> ib_initializer = new IBRedundantInitializer(
+            "IBRedundantInitializer", app_initializer->getComponentDatabase("IBRedundantInitializer"));
+        ib_initializer->setStructureNamesOnLevel(0, { "lattice" });
+        ib_initializer->registerInitStructureFunction(generate_lattice, &lattice_spec);
+        ib_initializer->registerInitSpringDataFunction(generate_springs, &lattice_spec);
+        l_data_manager->registerLInitStrategy(ib_initializer);
+        l_data_manager->setPatchHierarchy(patch_hierarchy);
+        l_data_manager->setPatchLevels(0, 0);
+
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               l_data_manager,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm = new GriddingAlgorithm<NDIM>(
+            "GriddingAlgorithm", gridding_db, error_detector, box_generator, load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        const IntVector<NDIM> gcw(LEInteractor::getMinimumGhostWidth(kernel_fcn));
+        auto u_var = use_cell ? Pointer<hier::Variable<NDIM> >(new CellVariable<NDIM, double>("u", NDIM)) :
+                                Pointer<hier::Variable<NDIM> >(new SideVariable<NDIM, double>("u"));
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, gcw);
+
+        // Set up the grid.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(finest_ln);
+        level->allocatePatchData(u_idx, 0.0);
+
+        // Generate the per-patch markers used by LEInteractor.
+        std::mt19937 rng(seed + IBTK_MPI::getRank());
+        std::vector<std::vector<double> > X_patch, Q_patch;
+        double n_patch_markers = 0.0, n_ghost_values = 0.0;
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            X_patch.emplace_back();
+            Q_patch.emplace_back();
+            generate_patch_markers(X_patch.back(), Q_patch.back(), patch, markers_per_cell, rng);
+            n_patch_markers += X_patch.back().size() / NDIM;
+
+            const Box<NDIM>& patch_box = patch->getBox();
+            if (use_cell)
+            {
+                n_ghost_values += NDIM * (Box<NDIM>::grow(patch_box, gcw).size() - patch_box.size());
+            }
+            else
+            {
+                for (unsigned int axis = 0; axis < NDIM; ++axis)
+                {
+                    const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+                    n_ghost_values += Box<NDIM>::grow(side_box, gcw).size() - side_box.size();
+                }
+            }
+        }
+
+        // Bytes moved per marker by spreading and interpolation: the marker
+        // positions and values, and the Eulerian values in the kernel support.
+        int stencil_values = NDIM;
+        for (unsigned int d = 0; d < NDIM; ++d) stencil_values *= LEInteractor::getStencilSize(kernel_fcn);
+        const double lagrangian_bytes = 2 * NDIM * sizeof(double);
+        const double spread_bytes = lagrangian_bytes + 2 * stencil_values * sizeof(double);
+        const double interp_bytes = lagrangian_bytes + stencil_values * sizeof(double);
+
+        pout << "IB kernel benchmark: NDIM = " << NDIM << ", kernel = " << kernel_fcn
+             << ", markers per cell = " << markers_per_cell << ", variable type = " << (use_cell ? "CELL" : "SIDE")
+             << ", patches = " << level->getNumberOfPatches() << ", processes = " << IBTK_MPI::getNodes() << "\n\n";
+        print_benchmark_header();
+
+        // LEInteractor::spread().
+        auto spread = [&]() {
+            int local_patch_num = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const std::vector<double>& X = X_patch[local_patch_num];
+                std::vector<double>& Q = Q_patch[local_patch_num];
+                if (use_cell)
+                {
+                    Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+                    LEInteractor::spread(u_data, Q, NDIM, X, NDIM, patch, patch_box, kernel_fcn);
+                }
+                else
+                {
+                    Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+                    LEInteractor::spread(u_data, Q, NDIM, X, NDIM, patch, patch_box, kernel_fcn);
+                }
+            }
+        };
+        double time = time_kernel(spread, n_warmup, n_reps);
+        print_benchmark_result("LEInteractor::spread", n_patch_markers, n_patch_markers * spread_bytes, time);
+
+        // LEInteractor::interpolate().
+        auto interpolate = [&]() {
+            int local_patch_num = 0;
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++local_patch_num)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                const Box<NDIM>& patch_box = patch->getBox();
+                const std::vector<double>& X = X_patch[local_patch_num];
+                std::vector<double>& Q = Q_patch[local_patch_num];
+                if (use_cell)
+                {
+                    Pointer<CellData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+                    LEInteractor::interpolate(Q, NDIM, X, NDIM, u_data, patch, patch_box, kernel_fcn);
+                }
+                else
+                {
+                    Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+                    LEInteractor::interpolate(Q, NDIM, X, NDIM, u_data, patch, patch_box, kernel_fcn);
+                }
+            }
+        };
+        time = time_kernel(interpolate, n_warmup, n_reps);
+        print_benchmark_result("LEInteractor::interpolate", n_patch_markers, n_patch_markers * interp_bytes, time);
+
+        // SAMRAIGhostDataAccumulator::accumulateGhostData(). Each ghost value
+        // is read and added to the value owned by the patch containing it.
+        SAMRAIGhostDataAccumulator accumulator(patch_hierarchy, u_var, gcw, finest_ln, finest_ln);
+        auto accumulate = [&]() { accumulator.accumulateGhostData(u_idx); };
+        time = time_kernel(accumulate, n_warmup, n_reps);
+        print_benchmark_result(
+            "SAMRAIGhostDataAccumulator", n_ghost_values, n_ghost_values * 3 * sizeof(double), time);
+
+        // IBStandardForceGen::computeLagrangianForce(). Each spring reads the
+        // positions of its endpoints and its parameters and updates the forces
+        // of its endpoints.
+        Pointer<IBStandardForceGen> force_gen = new IBStandardForceGen();
+        force_gen->initializeLevelData(patch_hierarchy, finest_ln, 0.0, true, l_data_manager);
+        Pointer<LData> X_data = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, finest_ln);
+        Pointer<LData> U_data = l_data_manager->getLData(LDataManager::VEL_DATA_NAME, finest_ln);
+        Pointer<LData> F_data = l_data_manager->createLData("F", finest_ln, NDIM);
+        auto compute_force = [&]() {
+            force_gen->computeLagrangianForce(F_data, X_data, U_data, patch_hierarchy, finest_ln, 0.0, l_data_manager);
+        };
+        time = time_kernel(compute_force, n_warmup, n_reps);
+        double n_springs = 1.0;
+        for (unsigned int d = 0; d < NDIM; ++d)
+            n_springs *= d == 0 ? lattice_spec.n_markers[d] - 1 : lattice_spec.n_markers[d];
+        const double spring_bytes = (4 * NDIM + 2) * sizeof(double) + 2 * sizeof(int);
+        const bool is_root = IBTK_MPI::getRank() == 0;
+        print_benchmark_result("IBStandardForceGen",
+                               is_root ? l_data_manager->getNumberOfNodes(finest_ln) : 0.0,
+                               is_root ? n_springs * spring_bytes : 0.0,
+                               time);
+    }
+} // main
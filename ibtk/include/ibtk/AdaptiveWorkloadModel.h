@@ -0,0 +1,126 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_AdaptiveWorkloadModel
+#define included_IBTK_AdaptiveWorkloadModel
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <deque>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class AdaptiveWorkloadModel fits the cost of cell-based and
+ * particle-based work from timings measured over a sliding window of time
+ * steps.
+ *
+ * Once per time step, each process records the time it spent computing in
+ * cell-based (Eulerian) and particle-based (Lagrangian) phases along with the
+ * amount of each kind of work it owns, e.g., the number of local cells and the
+ * local Lagrangian workload estimate. The model assumes that the time spent in
+ * each phase is proportional to the amount of work and computes the cost per
+ * unit of work of each phase as a least-squares fit over all processes and all
+ * samples in the window. The ratio of the two costs is the weight that should
+ * be given to one unit of particle-based work relative to one cell when
+ * estimating workloads for load balancing.
+ *
+ * The recorded times should exclude the time spent in collective operations:
+ * otherwise, every process records the time of the slowest one and the fit is
+ * biased by the very imbalance it is meant to remove.
+ */
+class AdaptiveWorkloadModel
+{
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param window_size The maximum number of samples retained by the model.
+     */
+    explicit AdaptiveWorkloadModel(unsigned int window_size = 10);
+
+    /*!
+     * \brief Record the timings of one time step on this process. If the
+     * window is full then the oldest sample is discarded.
+     *
+     * \param cell_time Time spent computing in cell-based phases.
+     * \param num_cells Amount of cell-based work owned by this process.
+     * \param particle_time Time spent computing in particle-based phases.
+     * \param num_particles Amount of particle-based work owned by this process.
+     */
+    void addSample(double cell_time, double num_cells, double particle_time, double num_particles);
+
+    /*!
+     * \brief Fit the per-cell and per-particle costs to the samples of all
+     * processes.
+     *
+     * \return Whether or not the samples determine both costs. If not, the
+     * previously computed costs are left unchanged.
+     *
+     * @note This function is collective and all processes must have recorded
+     * the same number of samples.
+     */
+    bool computeCosts();
+
+    /*!
+     * \brief Return the fitted time per unit of cell-based work.
+     */
+    double getCellCost() const;
+
+    /*!
+     * \brief Return the fitted time per unit of particle-based work.
+     */
+    double getParticleCost() const;
+
+    /*!
+     * \brief Return the cost of one unit of particle-based work relative to
+     * one unit of cell-based work, or 1 if no costs have been fitted yet.
+     */
+    double getRelativeParticleWeight() const;
+
+    /*!
+     * \brief Return the number of samples currently stored by the model.
+     */
+    unsigned int getNumberOfSamples() const;
+
+    /*!
+     * \brief Discard all stored samples.
+     */
+    void clear();
+
+private:
+    struct Sample
+    {
+        double cell_time;
+        double num_cells;
+        double particle_time;
+        double num_particles;
+    };
+
+    unsigned int d_window_size;
+
+    std::deque<Sample> d_samples;
+
+    double d_cell_cost = 0.0, d_particle_cost = 0.0;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_AdaptiveWorkloadModel
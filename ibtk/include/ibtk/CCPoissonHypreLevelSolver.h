@@ -112,6 +112,8 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by PFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ reuse_hypre_data = FALSE       // see setReuseHypreData()
+ solver_setup_reuse_tol = 0.0   // see setSolverSetupReuseTolerance()
  \endverbatim
  *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
@@ -243,6 +245,35 @@ public:
 
     //\}
 
+    /*!
+     * \brief Indicate whether the hypre grid, matrices, vectors, and solvers
+     * are to be retained by deallocateSolverState() so that they can be reused
+     * by the next call to initializeSolverState().
+     *
+     * The retained data are reused only if the patch level has the same layout
+     * (i.e., the same patch boxes on each process) as the level for which they
+     * were created.  In this case, only the values of the matrix coefficients
+     * are recomputed, which avoids rebuilding the hypre grid and matrix
+     * structures when the solver is reinitialized because the time step size or
+     * the problem coefficients have changed.
+     */
+    void setReuseHypreData(bool reuse_hypre_data);
+
+    /*!
+     * \brief Set the tolerance on the relative change in the matrix
+     * coefficients, measured in the max norm, below which the existing hypre
+     * solver setup (e.g., the PFMG or SMG multigrid hierarchy) is kept when the
+     * hypre data are reused.
+     *
+     * When the setup is kept, the solver is applied to the updated matrix but
+     * uses coarse-grid operators computed from the previous coefficients.  A
+     * tolerance of zero reuses the setup only when the coefficients are
+     * unchanged, and a negative tolerance always recomputes the setup.
+     *
+     * \see setReuseHypreData
+     */
+    void setSolverSetupReuseTolerance(double solver_setup_reuse_tol);
+
 private:
     /*!
      * \brief Default constructor.
@@ -282,6 +313,7 @@ private:
     bool solveSystem(int x_idx, int b_idx);
     void destroyHypreSolver();
     void deallocateHypreData();
+    void releaseHypreData();
 
     /*!
      * \brief Associated hierarchy.
@@ -321,6 +353,18 @@ private:
     int d_skip_relax = 1;
     int d_two_norm = 1;
     //\}
+
+    /*!
+     * \name Data used to reuse the hypre data structures between successive
+     * solver initializations.
+     */
+    //\{
+    bool d_reuse_hypre_data = false;
+    double d_solver_setup_reuse_tol = 0.0;
+    bool d_hypre_data_retained = false;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_hypre_boxes;
+    std::vector<std::vector<double> > d_matrix_vals;
+    //\}
 };
 } // namespace IBTK
 
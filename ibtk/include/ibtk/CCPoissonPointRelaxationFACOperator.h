@@ -95,6 +95,7 @@ namespace IBTK
  coarse_solver_rel_residual_tol = 1.0e-5      // see setCoarseSolverRelativeTolerance()
  coarse_solver_abs_residual_tol = 1.0e-50     // see setCoarseSolverAbsoluteTolerance()
  coarse_solver_max_iterations = 1             // see setCoarseSolverMaxIterations()
+ use_single_precision_smoother = FALSE        // see setUseSinglePrecisionSmoother()
  coarse_solver_db {                           // SAMRAI::tbox::Database for initializing coarse
  level solver
     solver_type = "PFMG"
@@ -151,6 +152,40 @@ public:
      */
     void setCoarseSolverType(const std::string& coarse_solver_type) override;
 
+    /*!
+     * \brief Specify whether the smoother performs its sweeps on single
+     * precision copies of the error and residual.
+     *
+     * The error and residual are converted to single precision once per call
+     * to smoothError(), and only the values near patch boundaries are copied
+     * back to double precision between sweeps to fill ghost cells.  The update
+     * itself is computed in double precision.  This reduces the memory traffic
+     * of the sweeps and is most effective when several sweeps are performed
+     * per call, e.g., when a smoother is used as the coarse level solver.
+     *
+     * \note The single-precision smoother is only used for problems with
+     * constant coefficients \f$ C \f$ and \f$ D \f$.
+     */
+    void setUseSinglePrecisionSmoother(bool use_single_precision_smoother);
+
+    /*!
+     * \brief Set the SAMRAI::solv::PoissonSpecifications object used to specify
+     * the coefficients for the scalar-valued or vector-valued Laplace operator.
+     *
+     * The specifications are also passed to the strategy object used on the
+     * coarsened levels, if any.
+     */
+    void setPoissonSpecifications(const SAMRAI::solv::PoissonSpecifications& poisson_spec) override;
+
+    /*!
+     * \brief Set the SAMRAI::solv::RobinBcCoefStrategy objects used to specify
+     * physical boundary conditions.
+     *
+     * The boundary condition objects are also passed to the strategy object
+     * used on the coarsened levels, if any.
+     */
+    void setPhysicalBcCoefs(const std::vector<SAMRAI::solv::RobinBcCoefStrategy<NDIM>*>& bc_coefs) override;
+
     //\}
 
     /*!
@@ -206,6 +241,17 @@ public:
                          int coarsest_level_num,
                          int finest_level_num) override;
 
+    /*!
+     * \brief Create an operator with the same configuration as this object for
+     * use on the coarsened levels built by class FACPreconditioner.
+     *
+     * \note Coarsened levels are only supported for problems with constant
+     * coefficients \f$ C \f$ and \f$ D \f$; otherwise, this function returns a
+     * null pointer.
+     */
+    SAMRAI::tbox::Pointer<FACPreconditionerStrategy>
+    createCoarsenedLevelStrategy(const std::string& object_name) override;
+
     //\}
 
 protected:
@@ -256,6 +302,17 @@ private:
     SAMRAI::tbox::Pointer<PoissonSolver> d_coarse_solver;
     SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> d_coarse_solver_db;
 
+    /*
+     * Operator used on the coarsened levels, if any.
+     */
+    SAMRAI::tbox::Pointer<CCPoissonPointRelaxationFACOperator> d_coarsened_level_op;
+
+    /*
+     * Single-precision smoother configuration and scratch data.
+     */
+    bool d_use_single_precision_smoother = false;
+    int d_error_sp_idx = IBTK::invalid_index, d_residual_sp_idx = IBTK::invalid_index;
+
     /*
      * Patch overlap data.
      */
@@ -68,7 +68,23 @@ namespace IBTK
  num_pre_sweeps = 0      // see setNumPreSmoothingSweeps()
  num_post_sweeps = 2     // see setNumPostSmoothingSweeps()
  enable_logging = FALSE  // see setLoggingEnabled()
+ max_num_coarsened_levels = 0  // see setMaxNumCoarsenedLevels()
+ min_coarsened_box_size = 4    // see setMinCoarsenedBoxSize()
+ num_coarsest_level_procs = 0  // see setNumCoarsestLevelProcessors()
  \endverbatim
+ *
+ * When the coarsest level of the solver is level 0 of the patch hierarchy, the
+ * preconditioner may continue the multigrid recursion below level 0 rather
+ * than handing the coarsest level problem to the coarse level solver of the
+ * FACPreconditionerStrategy.  In this case, the preconditioner builds an
+ * auxiliary patch hierarchy whose finest level has the same patches as level 0
+ * and whose coarser levels are obtained by successively coarsening those
+ * patches by a factor of two, and it solves the coarsest level problem by
+ * applying an FAC cycle on that hierarchy with a strategy object obtained from
+ * FACPreconditionerStrategy::createCoarsenedLevelStrategy().  The coarse level
+ * solver of that strategy is only used on the coarsest level of the auxiliary
+ * hierarchy.  Optionally, the patches of the coarsest auxiliary level are
+ * agglomerated onto a smaller number of processors.
 */
 class FACPreconditioner : public LinearSolver
 {
@@ -254,6 +270,38 @@ public:
      */
     int getNumPostSmoothingSweeps() const;
 
+    /*!
+     * \brief Set the maximum number of temporary levels to create below level
+     * 0 of the patch hierarchy.  A value of zero (the default) disables the use
+     * of coarsened levels.
+     *
+     * \note Levels are only created when the coarsest level of the solver is
+     * level 0, when the strategy object supports
+     * FACPreconditionerStrategy::createCoarsenedLevelStrategy(), and for as long
+     * as all of the patches of the coarsest level can be coarsened exactly.
+     */
+    void setMaxNumCoarsenedLevels(int max_num_coarsened_levels);
+
+    /*!
+     * \brief Set the minimum number of cells in each coordinate direction of
+     * the patches of the coarsened levels.
+     */
+    void setMinCoarsenedBoxSize(int min_coarsened_box_size);
+
+    /*!
+     * \brief Set the number of processors onto which the patches of the
+     * coarsest coarsened level are agglomerated.  A value of zero (the default)
+     * disables agglomeration.
+     */
+    void setNumCoarsestLevelProcessors(int num_coarsest_level_procs);
+
+    /*!
+     * \brief Get the number of coarsened levels used by the preconditioner.
+     * This value is zero if the solver is not initialized or if coarsened levels
+     * are not being used.
+     */
+    int getNumCoarsenedLevels() const;
+
     //\}
 
     /*!
@@ -281,6 +329,14 @@ protected:
                   int level_num,
                   int mu);
 
+    /*!
+     * \brief Solve the system of equations on the coarsest level, either on the
+     * coarsened levels (when present) or by the strategy object.
+     */
+    void solveCoarsestLevel(SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& u,
+                            SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& f,
+                            int level_num);
+
     SAMRAI::tbox::Pointer<FACPreconditionerStrategy> d_fac_strategy;
     SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_hierarchy;
     int d_coarsest_ln = 0;
@@ -289,6 +345,17 @@ protected:
     int d_num_pre_sweeps = 0, d_num_post_sweeps = 2;
     SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_f, d_r;
 
+    /*
+     * Coarsened level configuration and data: the auxiliary patch hierarchy,
+     * the preconditioner applied on that hierarchy, and the solution and
+     * right-hand-side vectors defined on that hierarchy.
+     */
+    int d_max_num_coarsened_levels = 0, d_min_coarsened_box_size = 4, d_num_coarsest_level_procs = 0;
+    int d_num_coarsened_levels = 0;
+    SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > d_coarsened_hierarchy;
+    SAMRAI::tbox::Pointer<FACPreconditioner> d_coarsened_level_solver;
+    SAMRAI::tbox::Pointer<SAMRAI::solv::SAMRAIVectorReal<NDIM, double> > d_coarsened_u, d_coarsened_f;
+
 private:
     /*!
      * \brief Default constructor.
@@ -317,6 +384,18 @@ private:
      */
     FACPreconditioner& operator=(const FACPreconditioner& that) = delete;
 
+    /*!
+     * \brief Build the coarsened levels and the preconditioner that is applied
+     * on them.
+     */
+    void initializeCoarsenedLevels(const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& solution,
+                                   const SAMRAI::solv::SAMRAIVectorReal<NDIM, double>& rhs);
+
+    /*!
+     * \brief Deallocate the coarsened levels.
+     */
+    void deallocateCoarsenedLevels();
+
     void getFromInput(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 };
 } // namespace IBTK
@@ -216,6 +216,17 @@ public:
      */
     virtual void deallocateScratchData();
 
+    /*!
+     * \brief Create a strategy object with the same configuration as this
+     * object for use on the temporary levels that class FACPreconditioner
+     * builds below level 0 of the patch hierarchy.
+     *
+     * The default implementation returns a null pointer, which indicates that
+     * the strategy does not support coarsened levels.
+     */
+    virtual SAMRAI::tbox::Pointer<FACPreconditionerStrategy>
+    createCoarsenedLevelStrategy(const std::string& object_name);
+
     /*!
      * \name Logging functions.
      */
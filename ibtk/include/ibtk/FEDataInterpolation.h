@@ -303,6 +303,21 @@ public:
      */
     void collectDataForInterpolation(const libMesh::Elem* elem);
 
+    /*!
+     * \brief Acquire read access to the local arrays of all interpolated system vectors. Until
+     * restoreLocalSolutionArrays() is called, collectDataForInterpolation() reads directly from these arrays instead
+     * of acquiring and restoring them on every element, and the system vectors must not be modified.
+     *
+     * NOTE: Several FEDataInterpolation objects that share system vectors may be used concurrently from different
+     * threads only when all of them have acquired their arrays (from a single thread) before the threads start.
+     */
+    void getLocalSolutionArrays();
+
+    /*!
+     * \brief Release the arrays acquired by getLocalSolutionArrays().
+     */
+    void restoreLocalSolutionArrays();
+
     /*!
      * \brief Provide the elemental data associated with the given system index and element.
      */
@@ -369,6 +384,9 @@ private:
     const libMesh::Elem* d_current_elem = nullptr;
     unsigned int d_current_side = std::numeric_limits<unsigned int>::max();
     std::vector<boost::multi_array<double, 2> > d_system_elem_data;
+
+    // Local arrays of the interpolated system vectors acquired by getLocalSolutionArrays().
+    std::vector<const double*> d_system_local_solns;
     unsigned int d_n_qp = std::numeric_limits<unsigned int>::max();
 };
 } // namespace IBTK
@@ -51,6 +51,7 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include <boost/multi_array.hpp>
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include <array>
 #include <map>
 #include <memory>
 #include <string>
@@ -1181,6 +1182,103 @@ private:
      */
     FEDataManager& operator=(const FEDataManager& that) = delete;
 
+    /*!
+     * \brief Struct PatchQuadratureData stores the quadrature data of the
+     * active elements of a single patch that are used when spreading or
+     * interpolating without nodal quadrature.
+     *
+     * With the exception of the quadrature keys of adaptive quadrature rules,
+     * these values depend only on the reference configuration of the mesh and
+     * on the association between elements and patches, and are therefore
+     * reused until the next call to reinitElementMappings().
+     */
+    struct PatchQuadratureData
+    {
+        /// The quadrature key of each element.
+        std::vector<quadrature_key_type> quad_keys;
+
+        /// The index of the first quadrature point of each element in the
+        /// patch quadrature point arrays. The last entry is the total number
+        /// of quadrature points on the patch.
+        std::vector<unsigned int> qp_offsets;
+
+        /// The JxW values of each element.
+        std::vector<std::vector<double> > JxW;
+
+        /// The shape function values of each element, indexed by shape
+        /// function and then by quadrature point. The pointers refer to
+        /// entries of QuadratureDataCache::phi_F and QuadratureDataCache::phi_X.
+        std::vector<const std::vector<std::vector<double> >*> phi_F, phi_X;
+
+        /// The local (i.e., ghosted) indices of the DoFs of each element,
+        /// stored node by node. Empty vectors have not yet been computed.
+        std::vector<std::vector<libMesh::dof_id_type> > F_local_dofs, X_local_dofs;
+    };
+
+    /*!
+     * \brief Struct QuadratureDataCache stores the quadrature data of all
+     * local patches for one system and one choice of quadrature parameters.
+     */
+    struct QuadratureDataCache
+    {
+        /// The quadrature parameters used to compute the quadrature keys.
+        libMesh::QuadratureType quad_type = libMesh::INVALID_Q_RULE;
+        libMesh::Order quad_order = libMesh::INVALID_ORDER;
+        bool use_adaptive_quadrature = false;
+        double point_density = 0.0;
+        bool allow_rules_with_negative_weights = true;
+
+        /// The finite element types of the system and of the coordinates
+        /// system.
+        libMesh::FEType F_fe_type, X_fe_type;
+
+        /// Signatures of the maps between global and local indices of the
+        /// vectors used to compute the cached local DoF indices.
+        std::array<std::size_t, 4> F_index_signature{}, X_index_signature{};
+
+        /// The shape function values of each quadrature rule. For the
+        /// Lagrange elements supported by this class these values do not
+        /// depend on the element.
+        std::map<quadrature_key_type, std::vector<std::vector<double> > > phi_F, phi_X;
+
+        /// The quadrature data of the local patches, indexed by level number
+        /// and then by local patch number.
+        std::vector<std::vector<PatchQuadratureData> > patch_data;
+    };
+
+    /*!
+     * Get the cached quadrature data for the specified system and quadrature
+     * parameters. The cached data are discarded if the quadrature parameters
+     * have changed, and the cached local DoF indices are discarded if the
+     * local index layout of the provided vectors has changed.
+     *
+     * @note F_vec may be nullptr when local DoF indices of the system are not
+     * needed.
+     */
+    QuadratureDataCache& getQuadratureDataCache(std::map<std::string, QuadratureDataCache>& caches,
+                                                const std::string& system_name,
+                                                libMesh::QuadratureType quad_type,
+                                                libMesh::Order quad_order,
+                                                bool use_adaptive_quadrature,
+                                                double point_density,
+                                                bool allow_rules_with_negative_weights,
+                                                libMesh::PetscVector<double>* F_vec,
+                                                libMesh::PetscVector<double>& X_vec);
+
+    /*!
+     * Gather the nodal positions of the active elements of a patch and update
+     * the quadrature keys, quadrature point offsets, JxW values, and shape
+     * function values of the cached quadrature data of that patch. Only the
+     * data of elements whose quadrature keys have changed are recomputed.
+     */
+    void updatePatchQuadratureData(PatchQuadratureData& patch_data,
+                                   QuadratureDataCache& cache,
+                                   const std::vector<libMesh::Elem*>& patch_elems,
+                                   std::vector<boost::multi_array<double, 2> >& X_nodes,
+                                   const libMesh::PetscVector<double>& X_vec,
+                                   const double* X_local_soln,
+                                   double patch_dx_min);
+
     /*!
      * Compute the quadrature point counts in each cell of the level in which
      * the FE mesh is embedded.  Also zeros out node count data for other levels
@@ -1375,6 +1473,12 @@ private:
      * buildIBGhostedVector.
      */
     std::map<std::string, std::unique_ptr<libMesh::PetscVector<double> > > d_system_ib_ghost_vec;
+
+    /*!
+     * Quadrature data used by spread() and interpWeighted(), indexed by
+     * system name.
+     */
+    std::map<std::string, QuadratureDataCache> d_spread_quadrature_data, d_interp_quadrature_data;
 };
 } // namespace IBTK
 
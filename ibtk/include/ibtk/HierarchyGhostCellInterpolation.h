@@ -333,6 +333,10 @@ public:
     /*!
      * \brief Fill coarse-fine boundary and physical boundary ghost cells on all
      * levels of the patch hierarchy.
+     *
+     * \note All communication is performed by SAMRAI refine and coarsen
+     * schedules, which are blocking, and is complete when this function
+     * returns.
      */
     void fillData(double fill_time);
 
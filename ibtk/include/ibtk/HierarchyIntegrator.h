@@ -370,6 +370,10 @@ public:
      *
      * \note Subclasses are allowed to require that this function be called
      * immediately before writing visualization data.
+     *
+     * \note This function also waits for any Lagrangian data that are being
+     * written asynchronously by an LSiloDataWriter, since Silo cannot be used
+     * concurrently by the VisIt data writer.
      */
     void setupPlotData();
 
@@ -1003,6 +1003,40 @@ public:
                  int src2_idx = invalid_index,
                  SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src2_var = NULL);
 
+    /*!
+     * \brief Compute the Laplacian of a side-centered quantity plus the
+     * gradient of a cell-centered quantity using centered differences.
+     *
+     * Sets dst = C src1 + div D grad src1 + gamma grad src2.
+     *
+     * This is equivalent to computing the gradient of src2 (without
+     * synchronizing the coarse-fine interface) followed by the side-centered
+     * Laplacian of src1 with dst passed as the additional term, but each
+     * component of dst is computed in a single sweep over the patch data.
+     * Coarse values of dst on each coarse-fine interface are synchronized
+     * after performing the differencing.
+     *
+     * \note The present implementation of this operator \em requires that
+     * damping factor C and diffusivity D be spatially constant and
+     * scalar-valued.
+     *
+     * \see setPatchHierarchy
+     * \see resetLevels
+     */
+    void laplaceGrad(int dst_idx,
+                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > dst_var,
+                     const SAMRAI::solv::PoissonSpecifications& poisson_spec,
+                     int src1_idx,
+                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideVariable<NDIM, double> > src1_var,
+                     SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src1_ghost_fill,
+                     double src1_ghost_fill_time,
+                     double gamma,
+                     int src2_idx,
+                     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > src2_var,
+                     SAMRAI::tbox::Pointer<HierarchyGhostCellInterpolation> src2_ghost_fill,
+                     double src2_ghost_fill_time,
+                     int src2_depth = 0);
+
     /*!
      * \brief Compute dst = alpha div coef1 ((grad src1) + (grad src1)^T) + beta coef2
      * src1 + gamma src2, the variable coefficient generalized Laplacian of
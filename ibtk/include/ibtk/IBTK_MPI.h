@@ -22,6 +22,7 @@
 
 #include <mpi.h>
 
+#include <chrono>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -134,6 +135,14 @@ struct IBTK_MPI
      */
     static void barrier();
 
+    /**
+     * Return the total wall-clock time, in seconds, that this processor has
+     * spent in the collective operations of this class (barriers, reductions,
+     * broadcasts, and gathers), including the time spent waiting for other
+     * processors to reach them.
+     */
+    static double getCollectiveTime();
+
     //@{
     /**
      * Perform a min reduction on a data structure of type double, int, or float. Each processor
@@ -278,7 +287,80 @@ struct IBTK_MPI
 
     //@}
 
+    /**
+     * @brief Class SumReductionBatch fuses several sum reductions of arrays of
+     * doubles into a single non-blocking reduction.
+     *
+     * Arrays containing the local contributions are registered with add().
+     * start() concatenates them and begins one MPI_Iallreduce on the current
+     * communicator. wait() completes the reduction and writes the sums back
+     * into the registered arrays, after which the batch may be reused. To
+     * overlap the reduction with work that does not depend on its results,
+     * callers should call start() as soon as all local contributions are
+     * available and call wait() only before the first read of any of the
+     * registered arrays. wait() starts the reduction if start() has not been
+     * called, in which case the batch is a single blocking reduction, and the
+     * destructor calls wait() if results are still pending.
+     *
+     * All processes must register arrays of the same lengths in the same order
+     * and must start several pending batches in the same order.
+     */
+    class SumReductionBatch
+    {
+    public:
+        SumReductionBatch() = default;
+
+        SumReductionBatch(const SumReductionBatch&) = delete;
+
+        SumReductionBatch& operator=(const SumReductionBatch&) = delete;
+
+        ~SumReductionBatch();
+
+        /**
+         * Register the array @p x of length @p n. The array must not be
+         * accessed until wait() returns.
+         */
+        void add(double* x, int n);
+
+        /**
+         * Begin the reduction of all registered arrays.
+         */
+        void start();
+
+        /**
+         * Complete the reduction and write the sums into the registered
+         * arrays.
+         */
+        void wait();
+
+    private:
+        std::vector<std::pair<double*, int> > d_arrays;
+        std::vector<double> d_payload;
+        MPI_Request d_request = MPI_REQUEST_NULL;
+        bool d_started = false;
+    };
+
 private:
+    /**
+     * Adds the wall-clock time between its construction and its destruction to
+     * the total time spent in collective operations.
+     */
+    class CollectiveTimer
+    {
+    public:
+        CollectiveTimer() : d_start(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~CollectiveTimer()
+        {
+            s_collective_time += std::chrono::duration<double>(std::chrono::steady_clock::now() - d_start).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point d_start;
+    };
+
     /**
      * Performs common functions needed by some of the allToAll methods.
      */
@@ -288,6 +370,8 @@ private:
     static void minMaxReduction(T* x, const int n, int* rank, MPI_Op op);
 
     static MPI_Comm s_communicator;
+
+    static double s_collective_time;
 };
 
 } // namespace IBTK
@@ -20,6 +20,7 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/LEInteractor.h"
 #include "ibtk/LInitStrategy.h"
 #include "ibtk/LNodeSet.h"
 #include "ibtk/LNodeSetVariable.h"
@@ -51,6 +52,7 @@
 #include <map>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -543,6 +545,31 @@ public:
                 int coarsest_ln = invalid_level_number,
                 int finest_ln = invalid_level_number);
 
+    /*!
+     * \brief Enable or disable caching of the interpolation and spreading
+     * kernel weights. Caching is disabled by default.
+     *
+     * When caching is enabled, spread() and interp() compute the kernel weights
+     * on each patch once and reuse them for as long as the Lagrangian
+     * positions, the patch layout, and the kernel function do not change
+     * (e.g., over the iterations of an implicit solver). The stored weights are
+     * validated against the current positions before each use, so caching never
+     * changes which weights are used. See LEInteractor::setWeightCache() for
+     * the kernels that can be cached.
+     */
+    void setUseInteractionWeightCache(bool use_cache);
+
+    /*!
+     * \brief Return whether or not interpolation and spreading kernel weights
+     * are cached.
+     */
+    bool getUseInteractionWeightCache() const;
+
+    /*!
+     * \brief Free all cached interpolation and spreading kernel weights.
+     */
+    void clearInteractionWeightCache();
+
     /*!
      * Register a concrete strategy object with the integrator that specifies
      * the initial configuration of the curvilinear mesh nodes.
@@ -1135,6 +1162,14 @@ private:
      */
     SAMRAIDataCache d_cached_eulerian_data;
 
+    /*
+     * Cached interpolation and spreading kernel weights, keyed on the level
+     * number, the patch number, the Eulerian patch data index, and whether the
+     * weights are used for spreading (true) or interpolation (false).
+     */
+    bool d_use_interaction_weight_cache = false;
+    std::map<std::tuple<int, int, int, bool>, LEInteractor::WeightCache> d_interaction_weight_cache;
+
     /*
      * We cache a pointer to the visualization data writers to register plot
      * variables.
@@ -20,12 +20,15 @@
 
 #include <ibtk/config.h>
 
+#include "ibtk/ibtk_enums.h"
+
 #include "Box.h"
 #include "IntVector.h"
 #include "tbox/Pointer.h"
 
 #include <array>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace IBTK
@@ -78,8 +81,109 @@ public:
     static double (*s_kernel_fcn)(double r);
     static int s_kernel_fcn_stencil_size;
 
+    /*!
+     * \brief Number of threads used to spread and interpolate the Lagrangian
+     * points of a single patch. Defaults to 1 (i.e., no threading).
+     *
+     * Interpolation is split into contiguous chunks of points. Spreading bins
+     * points into slabs wider than the kernel stencil and processes alternating
+     * slabs concurrently, so no two threads ever update the same grid value.
+     * Threads are taken from the process-wide ThreadPool.
+     *
+     * \note A user-defined kernel (see s_kernel_fcn) must be safe to call from
+     * several threads at once when threading is enabled.
+     */
+    static int s_num_threads;
+
+    /*!
+     * \brief Order in which the contributions of Lagrangian points to spread
+     * values are summed when s_num_threads > 1. Defaults to
+     * SLAB_SUMMATION_ORDER.
+     *
+     * With SLAB_SUMMATION_ORDER, spreading is threaded and each grid value sums
+     * the points of the even slabs before those of the odd slabs, each in their
+     * original order. The result does not depend on the number of threads but
+     * may differ from the unthreaded result by roundoff. With
+     * INPUT_SUMMATION_ORDER, points are summed in their original order, which
+     * reproduces the unthreaded result exactly; spreading is then done by the
+     * calling thread and only interpolation is threaded.
+     */
+    static LEInteractorSummationOrder s_spread_summation_order;
+
+    /*!
+     * \brief Minimum number of Lagrangian points on a patch before threading
+     * is used. Smaller batches are always processed by the calling thread.
+     */
+    static int s_min_threaded_batch_size;
+
+    /*!
+     * \brief Implementation used to evaluate the interaction kernels. Defaults
+     * to FORTRAN_KERNEL_BACKEND.
+     *
+     * CXX_KERNEL_BACKEND selects templated C++ implementations in which the
+     * stencil width is a compile-time constant. These are available for the
+     * IB_4, IB_6, and BSPLINE_3 through BSPLINE_6 kernels and for user-defined
+     * kernels with stencils of up to eight points; all other kernels always use
+     * the Fortran implementations.
+     */
+    static LEInteractorKernelBackend s_kernel_backend;
+
+    /*!
+     * \brief Precomputed kernel stencils of the Lagrangian points on a single
+     * patch.
+     *
+     * Each entry stores, for one data axis (e.g., one component of side- or
+     * edge-centered data), the one-dimensional kernel weights of each point and
+     * the corresponding offsets into the patch data array, along with the
+     * positions and data layout for which they were computed. An entry is
+     * recomputed whenever any of these change. The slab coloring used for
+     * threaded spreading (see s_num_threads) is computed the first time it is
+     * needed and is stored alongside the weights.
+     */
+    struct WeightCache
+    {
+        struct Entry
+        {
+            std::string kernel_fcn;
+            SAMRAI::hier::Box<NDIM> q_data_box;
+            SAMRAI::hier::IntVector<NDIM> q_gcw;
+            std::array<double, NDIM> x_lower, dx;
+            std::vector<int> local_indices;
+            std::vector<double> X;
+            int stencil_width = 0, depth_stride = 0;
+            std::vector<double> weights;
+            std::vector<int> offsets;
+            std::vector<int> slab_order;
+            std::array<std::vector<std::pair<int, int> >, 2> slab_ranges;
+        };
+
+        std::array<Entry, NDIM> entries;
+    };
+
+    /*!
+     * \brief Set the weight cache used by subsequent interpolation and
+     * spreading operations, or disable caching if \a weight_cache is nullptr.
+     *
+     * While a cache is set, all operations must act on the same patch. If the
+     * C++ kernel backend is selected (see s_kernel_backend), the weights of
+     * kernels with C++ implementations are computed once and reused for as
+     * long as the Lagrangian positions do not change. Other kernels, and all
+     * kernels evaluated by the Fortran backend, are not cached. Cached
+     * interpolation and spreading are threaded in the same way as uncached
+     * ones.
+     */
+    static void setWeightCache(WeightCache* weight_cache);
+
     /*!
      * \brief Set configuration options from a user-supplied database.
+     *
+     * The following keys are read:
+     * - <code>num_threads</code>: sets s_num_threads.
+     * - <code>min_threaded_batch_size</code>: sets s_min_threaded_batch_size.
+     * - <code>kernel_backend</code>: sets s_kernel_backend (either
+     *   <code>"FORTRAN"</code> or <code>"CXX"</code>).
+     * - <code>spread_summation_order</code>: sets s_spread_summation_order
+     *   (either <code>"SLAB"</code> or <code>"INPUT"</code>).
      */
     static void setFromDatabase(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> db);
 
@@ -1270,6 +1374,45 @@ private:
                        const std::string& spread_fcn,
                        int axis = 0);
 
+    /*!
+     * Apply the IB interpolation kernel to a contiguous batch of Lagrangian
+     * points.
+     */
+    static void interpolateBatch(double* Q_data,
+                                 int Q_depth,
+                                 const double* X_data,
+                                 const double* q_data,
+                                 const SAMRAI::hier::Box<NDIM>& q_data_box,
+                                 const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                                 int q_depth,
+                                 const double* x_lower,
+                                 const double* x_upper,
+                                 const double* dx,
+                                 const int* local_indices,
+                                 const double* periodic_shifts,
+                                 int num_local_indices,
+                                 const std::string& interp_fcn,
+                                 int axis);
+
+    /*!
+     * Apply the IB spreading kernel to a contiguous batch of Lagrangian points.
+     */
+    static void spreadBatch(double* q_data,
+                            const SAMRAI::hier::Box<NDIM>& q_data_box,
+                            const SAMRAI::hier::IntVector<NDIM>& q_gcw,
+                            int q_depth,
+                            const double* Q_data,
+                            int Q_depth,
+                            const double* X_data,
+                            const double* x_lower,
+                            const double* x_upper,
+                            const double* dx,
+                            const int* local_indices,
+                            const double* periodic_shifts,
+                            int num_local_indices,
+                            const std::string& spread_fcn,
+                            int axis);
+
     /*!
      * \brief Compute the local PETSc indices located within the provided box
      * based on the LNodeIndexSetData values.
@@ -1327,6 +1470,11 @@ private:
                                   const int* local_indices,
                                   const double* X_shift,
                                   int num_local_indices);
+
+    /*!
+     * The weight cache set by setWeightCache().
+     */
+    static WeightCache* s_weight_cache;
 };
 } // namespace IBTK
 
@@ -28,13 +28,23 @@
 
 #include <vector>
 
+namespace IBTK
+{
+class LNodeTransferBuffer;
+} // namespace IBTK
 namespace SAMRAI
 {
 namespace hier
 {
 template <int DIM>
+class BoxOverlap;
+template <int DIM>
 class Patch;
 } // namespace hier
+namespace tbox
+{
+class AbstractStream;
+} // namespace tbox
 } // namespace SAMRAI
 
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
@@ -143,6 +153,30 @@ public:
      */
     const std::vector<double>& getGhostPeriodicShifts() const;
 
+    /*!
+     * \brief Return the amount of space required to pack the nodes located in
+     * the specified overlap region to a buffer.
+     */
+    int getDataStreamSize(const SAMRAI::hier::BoxOverlap<NDIM>& overlap) const override;
+
+    /*!
+     * \brief Pack the nodes located in the specified overlap region into the
+     * output stream.
+     *
+     * \note Unlike the default implementation provided by class
+     * SAMRAI::pdat::IndexData, the nodes are packed via class
+     * LNodeTransferBuffer, so that the indexing data of all of the nodes are
+     * packed in bulk.
+     */
+    void packStream(SAMRAI::tbox::AbstractStream& stream, const SAMRAI::hier::BoxOverlap<NDIM>& overlap) const override;
+
+    /*!
+     * \brief Unpack the nodes located in the specified overlap region from the
+     * input stream.  Any nodes already located in the overlap region are
+     * removed.
+     */
+    void unpackStream(SAMRAI::tbox::AbstractStream& stream, const SAMRAI::hier::BoxOverlap<NDIM>& overlap) override;
+
 private:
     /*!
      * \brief Default constructor.
@@ -171,6 +205,12 @@ private:
      */
     LIndexSetData& operator=(const LIndexSetData<T>& that) = delete;
 
+    /*!
+     * \brief Add the nodes located in the source region of the specified
+     * overlap to the transfer buffer.
+     */
+    void gatherOverlapNodes(LNodeTransferBuffer& transfer_buffer, const SAMRAI::hier::BoxOverlap<NDIM>& overlap) const;
+
     std::vector<int> d_lag_indices, d_interior_lag_indices, d_ghost_lag_indices;
     std::vector<int> d_global_petsc_indices, d_interior_global_petsc_indices, d_ghost_global_petsc_indices;
     std::vector<int> d_local_petsc_indices, d_interior_local_petsc_indices, d_ghost_local_petsc_indices;
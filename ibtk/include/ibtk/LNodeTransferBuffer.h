@@ -0,0 +1,202 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_LNodeTransferBuffer
+#define included_IBTK_LNodeTransferBuffer
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include "ibtk/Streamable.h"
+
+#include "Box.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "tbox/Pointer.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace IBTK
+{
+template <class T>
+class LSetData;
+} // namespace IBTK
+namespace SAMRAI
+{
+namespace tbox
+{
+class AbstractStream;
+} // namespace tbox
+} // namespace SAMRAI
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class LNodeTransferBuffer is a structure-of-arrays message buffer
+ * used to communicate the Lagrangian nodes located in a collection of
+ * Cartesian grid cells between processors.
+ *
+ * The nodes are grouped into bins, one bin per cell: the nodes of bin k are
+ * the nodes numbered <tt>[getBinOffsets()[k], getBinOffsets()[k + 1])</tt>
+ * and the index of the corresponding cell is returned by getCellIndex(k).  The
+ * indexing data of the nodes (i.e., the data stored by class LNodeIndex) are
+ * stored in contiguous arrays, which are packed to and unpacked from streams
+ * in bulk rather than node by node.  Additional node data items (see
+ * LNode::getNodeData()) are stored in a single flat array and are streamed via
+ * class StreamableManager.
+ *
+ * This class is used by class LIndexSetData during data redistribution: the
+ * indexing data of all of the nodes in a message are packed and unpacked with
+ * a fixed number of stream operations.  It only exists for the duration of a
+ * transfer.  LSet and LNode remain the in-memory representation of the nodes,
+ * so scatterNodes() still allocates each received node individually.
+ */
+class LNodeTransferBuffer
+{
+public:
+    /*!
+     * \brief Default constructor.
+     */
+    LNodeTransferBuffer();
+
+    /*!
+     * \brief Remove all nodes from the buffer.
+     */
+    void clear();
+
+    /*!
+     * \brief Append the nodes of the specified patch data object that are
+     * located in the specified box.  Nodes are added cell by cell, and each
+     * nonempty cell is added as a new bin.
+     *
+     * \note Class T must be either LNode or LNodeIndex.
+     */
+    template <class T>
+    void gatherNodes(const LSetData<T>& data, const SAMRAI::hier::Box<NDIM>& box);
+
+    /*!
+     * \brief Create the nodes stored in each bin and add them to the specified
+     * patch data object at the cell index of the bin shifted by the specified
+     * offset.  Any existing nodes in those cells are replaced.
+     *
+     * \note Class T must be either LNode or LNodeIndex.
+     */
+    template <class T>
+    void scatterNodes(LSetData<T>& data, const SAMRAI::hier::IntVector<NDIM>& offset) const;
+
+    /*!
+     * \return The number of bins (i.e., nonempty cells) in the buffer.
+     */
+    std::size_t getNumberOfBins() const;
+
+    /*!
+     * \return The number of nodes in the buffer.
+     */
+    std::size_t getNumberOfNodes() const;
+
+    /*!
+     * \return The cell index associated with the specified bin.
+     */
+    SAMRAI::hier::Index<NDIM> getCellIndex(std::size_t bin) const;
+
+    /*!
+     * \return The offsets of the first node of each bin.  The last entry is
+     * the total number of nodes in the buffer.
+     */
+    const std::vector<int>& getBinOffsets() const;
+
+    /*!
+     * \return The Lagrangian indices of the nodes.
+     */
+    const std::vector<int>& getLagrangianIndices() const;
+
+    /*!
+     * \return The global PETSc indices of the nodes.
+     */
+    const std::vector<int>& getGlobalPETScIndices() const;
+
+    /*!
+     * \return The local PETSc indices of the nodes.
+     */
+    const std::vector<int>& getLocalPETScIndices() const;
+
+    /*!
+     * \brief Return an upper bound on the amount of space required to pack the
+     * object to a buffer.
+     */
+    std::size_t getDataStreamSize() const;
+
+    /*!
+     * \brief Pack data into the output stream.
+     */
+    void packStream(SAMRAI::tbox::AbstractStream& stream) const;
+
+    /*!
+     * \brief Unpack data from the input stream, replacing the present contents
+     * of the buffer.
+     */
+    void unpackStream(SAMRAI::tbox::AbstractStream& stream, const SAMRAI::hier::IntVector<NDIM>& offset);
+
+private:
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    LNodeTransferBuffer(const LNodeTransferBuffer& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    LNodeTransferBuffer& operator=(const LNodeTransferBuffer& that) = delete;
+
+    /*!
+     * Cell indices of the bins (NDIM values per bin) and the offsets of the
+     * first node of each bin.
+     */
+    std::vector<int> d_cell_idxs, d_bin_offsets;
+
+    /*!
+     * Indexing data of the nodes.  Periodic offsets and displacements are
+     * stored with NDIM values per node.
+     */
+    std::vector<int> d_lag_idxs, d_global_petsc_idxs, d_local_petsc_idxs;
+    std::vector<int> d_periodic_offsets_0, d_periodic_offsets;
+    std::vector<double> d_periodic_displacements_0, d_periodic_displacements;
+
+    /*!
+     * Additional data items of the nodes: the items of node k are
+     * <tt>[d_node_data_offsets[k], d_node_data_offsets[k + 1])</tt>.
+     */
+    std::vector<int> d_node_data_offsets;
+    std::vector<SAMRAI::tbox::Pointer<Streamable> > d_node_data;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_LNodeTransferBuffer
@@ -28,9 +28,12 @@
 #include "petscao.h"
 #include "petscvec.h"
 
+#include <exception>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -57,6 +60,24 @@ namespace IBTK
  *
  * For more information about Silo, see the Silo manual <A
  * HREF="http://www.llnl.gov/bdiv/meshtv/manuals/silo.pdf">here</A>.
+ *
+ * By default, each MPI process writes its own Silo file.  When the number of
+ * processors per file is set to a value larger than one, the data of each
+ * consecutive group of that many MPI processes are gathered to the first
+ * process of the group, which writes a single file for the group.  Data may
+ * also be written asynchronously: once the data have been gathered, the files
+ * are written by a background thread, and writePlotData() returns without
+ * waiting for the output to complete.
+ *
+ * Silo is not thread safe.  Background output holds the process-wide lock
+ * returned by getSiloMutex(), which other IBAMR code that calls Silo also
+ * acquires.  SAMRAI::appu::VisItDataWriter cannot acquire this lock, so all
+ * pending output must be completed before it is used:
+ * HierarchyIntegrator::setupPlotData() calls waitForAllPendingOutput(), and
+ * applications that write VisIt data without calling setupPlotData() must call
+ * waitForAllPendingOutput() themselves.  Errors that occur while writing data
+ * in the background are reported by the next call to waitForPendingOutput(),
+ * which is also made by writePlotData() and by the destructor.
  */
 class LSiloDataWriter : public SAMRAI::tbox::Serializable
 {
@@ -183,11 +204,48 @@ public:
      */
     void registerLagrangianAO(std::vector<AO>& ao, int coarsest_ln, int finest_ln);
 
+    /*!
+     * \brief Set the number of MPI processes whose data are written to each
+     * Silo file.  The default is one file per MPI process.
+     */
+    void setNumberOfProcessorsPerFile(int procs_per_file);
+
+    /*!
+     * \brief Set whether the plot data should be written by a background
+     * thread.  The default is to write data synchronously.
+     *
+     * \note Only one dump is written at a time: writePlotData() first waits for
+     * any previous dump to be completed.
+     */
+    void setAsynchronousOutput(bool async_output);
+
     /*!
      * \brief Write the plot data to disk.
      */
     void writePlotData(int time_step_number, double simulation_time);
 
+    /*!
+     * \brief Wait until any plot data that are being written asynchronously
+     * have been written to disk, and abort if writing the data failed.
+     */
+    void waitForPendingOutput();
+
+    /*!
+     * \brief Wait until the plot data of all LSiloDataWriter objects that are
+     * being written asynchronously have been written to disk.
+     *
+     * \note This function must be called before running any code that calls
+     * Silo without acquiring the lock returned by getSiloMutex(), such as
+     * SAMRAI::appu::VisItDataWriter.
+     */
+    static void waitForAllPendingOutput();
+
+    /*!
+     * \brief Return the process-wide lock that must be held by any code that
+     * calls Silo while asynchronous output may be in progress.
+     */
+    static std::mutex& getSiloMutex();
+
     /*!
      * Write out object state to the given database.
      *
@@ -263,6 +321,15 @@ private:
      */
     int d_time_step_number = -1;
 
+    /*
+     * Output options, the thread used to write data asynchronously, and any
+     * error that occurred while writing data.
+     */
+    int d_procs_per_file = 1;
+    bool d_async_output = false;
+    std::thread d_output_thread;
+    std::exception_ptr d_output_exception;
+
     /*
      * Grid hierarchy information.
      */
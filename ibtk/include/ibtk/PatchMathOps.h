@@ -431,6 +431,23 @@ public:
                  int m = 0,
                  int n = 0) const;
 
+    /*!
+     * \brief Computes dst = alpha L src1 + beta src1 + gamma grad src2_m.
+     *
+     * Uses the standard 5 point stencil in 2D (7 point stencil in 3D) for the
+     * side-centered Laplacian of src1 and centered differences for the
+     * side-centered gradient of the cell-centered quantity src2.  Each
+     * component of dst is computed in a single sweep over the patch data.
+     */
+    void laplaceGrad(SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > dst,
+                     double alpha,
+                     double beta,
+                     SAMRAI::tbox::Pointer<SAMRAI::pdat::SideData<NDIM, double> > src1,
+                     double gamma,
+                     SAMRAI::tbox::Pointer<SAMRAI::pdat::CellData<NDIM, double> > src2,
+                     SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                     int m = 0) const;
+
     /*!
      * \brief Computes dst_l = div alpha grad src1_m + beta src1_m + gamma
      * src2_n.
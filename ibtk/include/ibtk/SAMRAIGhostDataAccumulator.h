@@ -24,12 +24,12 @@
 
 #include <tbox/Pointer.h>
 
-#include <petscvec.h>
-
 #include <BasePatchHierarchy.h>
 #include <RefineSchedule.h>
 #include <Variable.h>
 
+#include <mpi.h>
+
 #include <vector>
 
 namespace IBTK
@@ -37,6 +37,15 @@ namespace IBTK
 /*!
  * \brief Class that can accumulate data summed into ghost regions on a patch
  * hierarchy into their correct locations.
+ *
+ * All communication patterns are computed in the constructor: on each level
+ * the values of ghost degrees of freedom are stored contiguously and grouped
+ * by owning processor, and persistent MPI requests (see MPI_Send_init() and
+ * MPI_Recv_init()) are created for both exchanges performed by
+ * accumulateGhostData(). Hence, accumulating ghost data only requires packing
+ * patch data into a buffer, starting and completing the persistent requests,
+ * and unpacking the buffer. Since the plan depends on the patch layout, a new
+ * object must be created whenever the hierarchy is regridded.
  */
 class SAMRAIGhostDataAccumulator
 {
@@ -50,6 +59,17 @@ public:
                                const int coarsest_ln,
                                const int finest_ln);
 
+    /*!
+     * Deleted copy constructor: the persistent requests refer to buffers
+     * owned by this object.
+     */
+    SAMRAIGhostDataAccumulator(const SAMRAIGhostDataAccumulator& from) = delete;
+
+    /*!
+     * Deleted assignment operator.
+     */
+    SAMRAIGhostDataAccumulator& operator=(const SAMRAIGhostDataAccumulator& that) = delete;
+
     /*!
      * Accumulate data by summing values in ghost positions into the entry on
      * the owning processor associated with the same degree of freedom.
@@ -92,6 +112,12 @@ protected:
      */
     bool d_cc_data = true;
 
+    /*!
+     * Duplicate of IBTK_MPI::getCommunicator() used by the persistent
+     * requests.
+     */
+    MPI_Comm d_communicator = MPI_COMM_NULL;
+
     /*!
      * Index into d_hierarchy that contains the dof numbering.
      */
@@ -99,14 +125,57 @@ protected:
 
     /*!
      * Index into d_hierarchy that contains the local (i.e., the indices
-     * directly into the buffer owned by each Vec in d_vecs) dof numbering.
+     * directly into CommunicationPlan::values on each level) dof numbering.
      */
     int d_local_dof_idx = IBTK::invalid_index;
 
     /*!
-     * PETSc Vec objects storing the global ordering on each level.
+     * Persistent communication plan for a single patch level.
+     */
+    struct CommunicationPlan
+    {
+        /*!
+         * Values of all locally owned degrees of freedom followed by the
+         * values of all ghost degrees of freedom. Ghost values are sorted by
+         * global index and are therefore grouped by owning processor.
+         */
+        std::vector<double> values;
+
+        /*!
+         * Number of locally owned degrees of freedom.
+         */
+        int n_local_dofs = 0;
+
+        /*!
+         * Indices into values of the locally owned degrees of freedom which
+         * other processors store as ghosts, grouped by the processor that
+         * requested them.
+         */
+        std::vector<int> shared_dofs;
+
+        /*!
+         * Buffer used to receive ghost contributions to and to send updated
+         * values of the degrees of freedom in shared_dofs.
+         */
+        std::vector<double> shared_buffer;
+
+        /*!
+         * Persistent requests that send ghost values to their owners and
+         * receive contributions to shared_dofs.
+         */
+        std::vector<MPI_Request> accumulate_requests;
+
+        /*!
+         * Persistent requests that send the accumulated values of shared_dofs
+         * and receive updated ghost values.
+         */
+        std::vector<MPI_Request> update_requests;
+    };
+
+    /*!
+     * Communication plans for each level, indexed by level number.
      */
-    std::vector<Vec> d_vecs;
+    std::vector<CommunicationPlan> d_plans;
 };
 } // namespace IBTK
 
@@ -108,6 +108,8 @@ namespace IBTK
  skip_relax = 1                 // see hypre User's Manual (only used by SysPFMG solver or
  preconditioner)
  two_norm = 1                   // see hypre User's Manual (only used by PCG solver)
+ reuse_hypre_data = FALSE       // see setReuseHypreData()
+ solver_setup_reuse_tol = 0.0   // see setSolverSetupReuseTolerance()
  \endverbatim
  *
  * \em hypre is developed in the Center for Applied Scientific Computing (CASC)
@@ -239,6 +241,30 @@ public:
 
     //\}
 
+    /*!
+     * \brief Indicate whether the hypre grid, graph, matrix, vectors, and
+     * solver are to be retained by deallocateSolverState() so that they can be
+     * reused by the next call to initializeSolverState().
+     *
+     * The retained data are reused only if the patch level has the same layout
+     * (i.e., the same patch boxes on each process) as the level for which they
+     * were created.  In this case, only the values of the matrix coefficients
+     * are recomputed.
+     */
+    void setReuseHypreData(bool reuse_hypre_data);
+
+    /*!
+     * \brief Set the tolerance on the relative change in the matrix
+     * coefficients, measured in the max norm, below which the existing hypre
+     * solver setup is kept when the hypre data are reused.
+     *
+     * A tolerance of zero reuses the setup only when the coefficients are
+     * unchanged, and a negative tolerance always recomputes the setup.
+     *
+     * \see setReuseHypreData
+     */
+    void setSolverSetupReuseTolerance(double solver_setup_reuse_tol);
+
 private:
     /*!
      * \brief Default constructor.
@@ -277,6 +303,7 @@ private:
     bool solveSystem(int x_idx, int b_idx);
     void destroyHypreSolver();
     void deallocateHypreData();
+    void releaseHypreData();
 
     /*!
      * \brief Associated hierarchy.
@@ -316,6 +343,18 @@ private:
     int d_skip_relax = 1;
     int d_two_norm = 1;
     //\}
+
+    /*!
+     * \name Data used to reuse the hypre data structures between successive
+     * solver initializations.
+     */
+    //\{
+    bool d_reuse_hypre_data = false;
+    double d_solver_setup_reuse_tol = 0.0;
+    bool d_hypre_data_retained = false;
+    std::vector<SAMRAI::hier::Box<NDIM> > d_hypre_boxes;
+    std::vector<double> d_matrix_vals;
+    //\}
 };
 } // namespace IBTK
 
@@ -53,6 +53,16 @@ namespace IBTK
  *
  * This class stores snapshots in a list ordered by increasing time values. Iterators to the stored snapshots are
  * provided via the begin(), end(), and getSnapshot() methods.
+ *
+ * <h2>Paging snapshot data</h2>
+ * By default, the patch data of every snapshot remains allocated. Optionally, this class can keep only the most
+ * recently used snapshots resident in memory and page out the patch data of the others, either by compressing it in
+ * memory or by writing it to files on local disk (or both). The structure of the snapshot hierarchies is always kept in
+ * memory. Snapshots are paged in transparently by getSnapshot() and, hence, by the functions in snapshot_utilities.h.
+ * Compression is lossless: each patch data array is encoded as the bitwise difference (XOR) of consecutive values, from
+ * which leading zero bytes are dropped. The result is not entropy coded, so data whose consecutive values differ in
+ * their leading bytes, e.g. noisy data, compresses poorly. Arrays that this encoding would not shrink are stored
+ * uncompressed. Paging is only supported for patch data of type double.
  */
 class SnapshotCache : public SAMRAI::tbox::Serializable
 {
@@ -66,11 +76,18 @@ public:
      * databases, and registers a variable/context pair with the VariableDatabase. Can optionally set up this class for
      * restarts.
      *
-     * The optional input database is searched for the following key:
+     * The optional input database is searched for the following keys:
      * - 'gcw' : Integer array that is the ghost cell width with which the internal variable is set up.
+     * - 'compress_snapshots' : Whether to compress the patch data of snapshots that are paged out. Default is FALSE.
+     * - 'spill_directory' : Directory in which each process writes the patch data of snapshots that are paged out. This
+     *   should be node-local storage. Default is empty, in which case paged out data is kept in memory.
+     * - 'max_resident_snapshots' : Maximum number of snapshots whose patch data is kept allocated when compression or
+     *   spilling is enabled. Must be at least 2, since fill_snapshot_at_time() interpolates between two snapshots that
+     *   must be resident at the same time. Default is 2.
      *
-     * If the input database is an invalid pointer, the ghost cell width is 1. Note that this value should be set as the
-     * maximum ghost cell width needed to perform any needed refinement operation upon snapshot retrieval.
+     * If the input database is an invalid pointer, the ghost cell width is 1 and all snapshots remain allocated. Note
+     * that the ghost cell width should be set as the maximum ghost cell width needed to perform any needed refinement
+     * operation upon snapshot retrieval.
      */
     SnapshotCache(std::string object_name,
                   SAMRAI::tbox::Pointer<SAMRAI::hier::Variable<NDIM> > var,
@@ -99,6 +116,9 @@ public:
     /*!
      * Get a copy of the snapshot time and patch hierarchy pair. If a snapshot is not present within the provided
      * tolerance, a pair of NaN and nullptr is returned.
+     *
+     * If paging is enabled, the patch data of the returned snapshot is paged in if needed. It remains allocated until a
+     * subsequent call to getSnapshot() or storeSnapshot() pages it out.
      */
     value_type getSnapshot(double time, double tol = 1.0e-8);
 
@@ -107,6 +127,9 @@ public:
      * snapshot time and patch hierarchy.
      *
      * \note This iterator is invalid if the number of snapshots changes.
+     *
+     * \note If paging is enabled, the patch data of the snapshot hierarchies accessed through iterators may not be
+     * allocated. Use getSnapshot() to access patch data.
      */
     //@{
     inline iterator begin()
@@ -184,6 +207,32 @@ private:
      */
     SnapshotCache& operator=(const SnapshotCache& that) = delete;
 
+    /*!
+     * Whether snapshots are paged out, i.e., whether compression or spilling to disk is enabled.
+     */
+    bool pagingEnabled() const;
+
+    /*!
+     * Mark the snapshot as most recently used, page it in if needed, and then page out the least recently used
+     * snapshots in excess of the maximum number of resident snapshots.
+     */
+    void useSnapshot(const value_type& snapshot);
+
+    /*!
+     * Allocate the patch data of a snapshot and fill it from the paged out data.
+     */
+    void pageInSnapshot(const value_type& snapshot);
+
+    /*!
+     * Encode the patch data of a snapshot, deallocate it, and optionally write the encoded data to disk.
+     */
+    void pageOutSnapshot(const value_type& snapshot);
+
+    /*!
+     * Get the name of the file to which this process spills the given snapshot.
+     */
+    std::string getSpillFileName(unsigned int snapshot_id) const;
+
     std::string d_object_name;
 
     /*
@@ -201,6 +250,30 @@ private:
     std::vector<value_type> d_snapshots;
 
     bool d_registered_for_restart = false;
+
+    /*
+     * Data for paging out snapshots.
+     */
+    bool d_compress_snapshots = false;
+    std::string d_spill_directory;
+    int d_max_resident_snapshots = 2;
+
+    /*!
+     * Paging state of a snapshot. The encoded data is indexed by level number and patch number and is only stored for
+     * local patches. If the snapshot is spilled to disk, only the sizes of the encoded data are kept in memory.
+     */
+    struct PagedSnapshot
+    {
+        unsigned int id = 0;
+        unsigned long last_use = 0;
+        bool resident = true;
+        std::vector<std::vector<std::vector<char> > > patch_data;
+        std::vector<std::vector<std::size_t> > patch_data_size;
+    };
+
+    std::map<const SAMRAI::hier::PatchHierarchy<NDIM>*, PagedSnapshot> d_paged_snapshots;
+    unsigned int d_next_snapshot_id = 0;
+    unsigned long d_use_counter = 0;
 };
 } // namespace IBTK
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBTK_ThreadPool
+#define included_IBTK_ThreadPool
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibtk/config.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBTK
+{
+/*!
+ * \brief Class ThreadPool runs independent tasks on a process-wide pool of
+ * persistent worker threads.
+ *
+ * The worker threads are created the first time they are needed and are
+ * reused by all subsequent calls to run(), so that the cost of creating
+ * threads is not paid every time a patch is processed. Only one set of tasks
+ * is executed at a time: concurrent calls to run() from different threads are
+ * serialized, and calls to run() made from inside a task are executed by the
+ * calling thread.
+ */
+class ThreadPool
+{
+public:
+    /*!
+     * \brief Call task(i) for each i in [0, num_tasks) on up to num_threads
+     * threads, including the calling thread, and return once all tasks have
+     * completed. Tasks are handed out dynamically and may be executed in any
+     * order.
+     *
+     * If a task throws an exception then the remaining tasks that have not yet
+     * started are skipped and the first exception is rethrown by the calling
+     * thread.
+     */
+    static void run(int num_tasks, int num_threads, const std::function<void(int)>& task);
+
+    /*!
+     * \brief Destructor. Stops and joins all worker threads.
+     */
+    ~ThreadPool();
+
+private:
+    /*!
+     * \brief Default constructor. Worker threads are created on demand.
+     */
+    ThreadPool() = default;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    ThreadPool(const ThreadPool& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    ThreadPool& operator=(const ThreadPool& that) = delete;
+
+    /*!
+     * \brief Return the process-wide pool.
+     */
+    static ThreadPool& getPool();
+
+    /*!
+     * \brief Run a set of tasks, see run().
+     */
+    void runTasks(int num_tasks, int num_threads, const std::function<void(int)>& task);
+
+    /*!
+     * \brief Execute tasks of the current set until none are left.
+     */
+    void executeTasks();
+
+    /*!
+     * \brief Main loop of the worker threads.
+     */
+    void workerLoop();
+
+    std::vector<std::thread> d_workers;
+
+    /*
+     * Serializes calls to runTasks().
+     */
+    std::mutex d_run_mutex;
+
+    /*
+     * Data describing the current set of tasks, protected by d_mutex.
+     */
+    std::mutex d_mutex;
+    std::condition_variable d_work_cv, d_done_cv;
+    const std::function<void(int)>* d_task = nullptr;
+    int d_num_tasks = 0;
+    std::atomic<int> d_next_task{ 0 };
+    unsigned long d_generation = 0;
+    int d_num_open_slots = 0, d_num_active_workers = 0;
+    std::exception_ptr d_exception;
+    bool d_shutdown = false;
+};
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBTK_ThreadPool
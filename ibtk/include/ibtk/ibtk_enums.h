@@ -207,6 +207,64 @@ enum_to_string<NodeOutsidePatchCheckType>(NodeOutsidePatchCheckType val)
     return "UNKNOWN_NODE_OUTSIDE_PATCH_CHECK_TYPE";
 } // enum_to_string
 
+/*!
+ * \brief Enumerated type for the implementations of the Lagrangian-Eulerian
+ * interaction kernels used by LEInteractor.
+ */
+enum LEInteractorKernelBackend
+{
+    FORTRAN_KERNEL_BACKEND = 1,
+    CXX_KERNEL_BACKEND = 2,
+    UNKNOWN_KERNEL_BACKEND = -1
+};
+
+template <>
+inline LEInteractorKernelBackend
+string_to_enum<LEInteractorKernelBackend>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "FORTRAN") == 0) return FORTRAN_KERNEL_BACKEND;
+    if (strcasecmp(val.c_str(), "CXX") == 0) return CXX_KERNEL_BACKEND;
+    return UNKNOWN_KERNEL_BACKEND;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<LEInteractorKernelBackend>(LEInteractorKernelBackend val)
+{
+    if (val == FORTRAN_KERNEL_BACKEND) return "FORTRAN";
+    if (val == CXX_KERNEL_BACKEND) return "CXX";
+    return "UNKNOWN_KERNEL_BACKEND";
+} // enum_to_string
+
+/*!
+ * \brief Enumerated type for the order in which LEInteractor sums the
+ * contributions of Lagrangian points to spread values.
+ */
+enum LEInteractorSummationOrder
+{
+    SLAB_SUMMATION_ORDER = 1,
+    INPUT_SUMMATION_ORDER = 2,
+    UNKNOWN_SUMMATION_ORDER = -1
+};
+
+template <>
+inline LEInteractorSummationOrder
+string_to_enum<LEInteractorSummationOrder>(const std::string& val)
+{
+    if (strcasecmp(val.c_str(), "SLAB") == 0) return SLAB_SUMMATION_ORDER;
+    if (strcasecmp(val.c_str(), "INPUT") == 0) return INPUT_SUMMATION_ORDER;
+    return UNKNOWN_SUMMATION_ORDER;
+} // string_to_enum
+
+template <>
+inline std::string
+enum_to_string<LEInteractorSummationOrder>(LEInteractorSummationOrder val)
+{
+    if (val == SLAB_SUMMATION_ORDER) return "SLAB";
+    if (val == INPUT_SUMMATION_ORDER) return "INPUT";
+    return "UNKNOWN_SUMMATION_ORDER";
+} // enum_to_string
+
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
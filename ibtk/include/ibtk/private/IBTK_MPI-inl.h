@@ -35,6 +35,7 @@ inline void
 IBTK_MPI::minReduction(T* x, const int n, int* rank_of_min)
 {
     if (n == 0) return;
+    CollectiveTimer timer;
     if (rank_of_min == nullptr)
     {
         MPI_Allreduce(MPI_IN_PLACE, x, n, mpi_type_id(x[0]), MPI_MIN, IBTK_MPI::getCommunicator());
@@ -58,6 +59,7 @@ inline void
 IBTK_MPI::maxReduction(T* x, const int n, int* rank_of_max)
 {
     if (n == 0) return;
+    CollectiveTimer timer;
     if (rank_of_max == nullptr)
     {
         MPI_Allreduce(MPI_IN_PLACE, x, n, mpi_type_id(x[0]), MPI_MAX, IBTK_MPI::getCommunicator());
@@ -86,6 +88,7 @@ inline void
 IBTK_MPI::sumReduction(T* x, const int n)
 {
     if (n == 0 || getNodes() < 2) return;
+    CollectiveTimer timer;
     MPI_Allreduce(MPI_IN_PLACE, x, n, mpi_type_id(x[0]), MPI_SUM, IBTK_MPI::getCommunicator());
 } // sumReduction
 
@@ -105,6 +108,7 @@ IBTK_MPI::bcast(T* x, int& length, const int root)
 {
     if (getNodes() > 1)
     {
+        CollectiveTimer timer;
         MPI_Bcast(x, length, mpi_type_id(x[0]), root, IBTK_MPI::getCommunicator());
     }
 } // bcast
@@ -142,6 +146,7 @@ IBTK_MPI::allGather(const T* x_in, int size_in, T* x_out, int size_out)
     std::vector<int> rcounts, disps;
     allGatherSetup(size_in, size_out, rcounts, disps);
 
+    CollectiveTimer timer;
     MPI_Allgatherv(x_in,
                    size_in,
                    mpi_type_id(x_in[0]),
@@ -156,6 +161,7 @@ template <typename T>
 inline void
 IBTK_MPI::allGather(T x_in, T* x_out)
 {
+    CollectiveTimer timer;
     MPI_Allgather(&x_in, 1, mpi_type_id(x_in), x_out, 1, mpi_type_id(x_in), IBTK_MPI::getCommunicator());
 } // allGather
 
@@ -30,6 +30,7 @@ IBTK_DISABLE_EXTRA_WARNINGS
 #include "HYPRE_struct_mv.h"
 IBTK_ENABLE_EXTRA_WARNINGS
 
+#include "Box.h"
 #include "CellData.h"
 #include "SideData.h"
 
@@ -106,6 +107,26 @@ void copyToHypre(const std::vector<HYPRE_StructVector>& vectors,
 void copyToHypre(HYPRE_SStructVector& vector,
                  SAMRAI::pdat::SideData<NDIM, double>& src_data,
                  const SAMRAI::hier::Box<NDIM>& box);
+
+/*!
+ * \brief Determine whether hypre data structures that were created for a patch
+ * level with local patch boxes \a old_boxes may be reused for a patch level with
+ * local patch boxes \a new_boxes.
+ *
+ * \note This is a collective operation: the boxes are compared on each process,
+ * and the result is true only if the boxes are identical on every process.
+ */
+bool hypreLayoutUnchanged(const std::vector<SAMRAI::hier::Box<NDIM> >& old_boxes,
+                          const std::vector<SAMRAI::hier::Box<NDIM> >& new_boxes);
+
+/*!
+ * \brief Compute the relative change max |new - old| / max |old| between two
+ * sets of matrix coefficients that are stored in the same order.
+ *
+ * \note This is a collective operation.  The result is infinite if the sizes of
+ * the two sets of values differ on any process.
+ */
+double hypreMatrixRelativeChange(const std::vector<double>& old_vals, const std::vector<double>& new_vals);
 } // namespace IBTK
 
 //////////////////////////////////////////////////////////////////////////////
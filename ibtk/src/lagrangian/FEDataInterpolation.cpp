@@ -20,6 +20,7 @@
 #include "libmesh/compare_types.h"
 #include "libmesh/dof_map.h"
 #include "libmesh/equation_systems.h"
+#include "libmesh/petsc_vector.h"
 #include "libmesh/quadrature.h"
 #include "libmesh/system.h"
 #include "libmesh/type_vector.h"
@@ -392,8 +393,44 @@ FEDataInterpolation::collectDataForInterpolation(const Elem* const elem)
         NumericVector<double>* system_vec = d_system_vecs[system_idx];
         const auto& dof_indices = system_dof_map_cache->dof_indices(d_current_elem);
         boost::multi_array<double, 2>& elem_data = d_system_elem_data[system_idx];
-        get_values_for_interpolation(elem_data, *system_vec, dof_indices);
+        if (d_system_local_solns.empty())
+        {
+            get_values_for_interpolation(elem_data, *system_vec, dof_indices);
+        }
+        else
+        {
+            const auto& system_petsc_vec = static_cast<const PetscVector<double>&>(*system_vec);
+            get_values_for_interpolation(elem_data, system_petsc_vec, d_system_local_solns[system_idx], dof_indices);
+        }
+    }
+    return;
+}
+
+void
+FEDataInterpolation::getLocalSolutionArrays()
+{
+    TBOX_ASSERT(d_initialized);
+    TBOX_ASSERT(d_system_local_solns.empty());
+    const size_t num_systems = d_systems.size();
+    d_system_local_solns.resize(num_systems);
+    for (size_t system_idx = 0; system_idx < num_systems; ++system_idx)
+    {
+        auto system_petsc_vec = dynamic_cast<PetscVector<double>*>(d_system_vecs[system_idx]);
+        TBOX_ASSERT(system_petsc_vec);
+        d_system_local_solns[system_idx] = system_petsc_vec->get_array_read();
+    }
+    return;
+}
+
+void
+FEDataInterpolation::restoreLocalSolutionArrays()
+{
+    const size_t num_systems = d_system_local_solns.size();
+    for (size_t system_idx = 0; system_idx < num_systems; ++system_idx)
+    {
+        static_cast<PetscVector<double>*>(d_system_vecs[system_idx])->restore_array();
     }
+    d_system_local_solns.clear();
     return;
 }
 
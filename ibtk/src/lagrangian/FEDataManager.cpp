@@ -224,6 +224,125 @@ get_JxW(quadrature_key_type key,
     }
 }
 
+/**
+ * Compute a signature of the map between global and local (i.e., ghosted)
+ * indices of a vector: local indices computed with one vector may be reused
+ * with any other vector with the same signature.
+ */
+std::array<std::size_t, 4>
+get_local_index_signature(PetscVector<double>& vec)
+{
+    std::array<std::size_t, 4> signature = { vec.first_local_index(), vec.local_size(), 0, 0 };
+    if (vec.type() == GHOSTED)
+    {
+        ISLocalToGlobalMapping ltog = nullptr;
+        int ierr = VecGetLocalToGlobalMapping(vec.vec(), &ltog);
+        IBTK_CHKERRQ(ierr);
+        if (ltog)
+        {
+            PetscInt n_local = 0;
+            const PetscInt* indices = nullptr;
+            ierr = ISLocalToGlobalMappingGetSize(ltog, &n_local);
+            IBTK_CHKERRQ(ierr);
+            ierr = ISLocalToGlobalMappingGetIndices(ltog, &indices);
+            IBTK_CHKERRQ(ierr);
+            signature[2] = n_local;
+            for (PetscInt i = static_cast<PetscInt>(vec.local_size()); i < n_local; ++i)
+            {
+                signature[3] = 31 * signature[3] + static_cast<std::size_t>(indices[i]);
+            }
+            ierr = ISLocalToGlobalMappingRestoreIndices(ltog, &indices);
+            IBTK_CHKERRQ(ierr);
+        }
+    }
+    return signature;
+}
+
+/**
+ * Get the local (i.e., ghosted) indices of the DoFs of an element, stored node
+ * by node, computing them if @p local_dofs is empty.
+ */
+const std::vector<dof_id_type>&
+get_local_dof_indices(std::vector<dof_id_type>& local_dofs,
+                      const PetscVector<double>& petsc_vec,
+                      const boost::multi_array<dof_id_type, 2>& dof_indices)
+{
+    const std::size_t n_vars = dof_indices.size();
+    const std::size_t n_nodes = dof_indices[0].size();
+    if (local_dofs.empty())
+    {
+        local_dofs.resize(n_vars * n_nodes);
+        for (std::size_t k = 0; k < n_nodes; ++k)
+        {
+            for (std::size_t i = 0; i < n_vars; ++i)
+            {
+                local_dofs[n_vars * k + i] = petsc_vec.map_global_to_local_index(dof_indices[i][k]);
+            }
+        }
+    }
+#ifndef NDEBUG
+    TBOX_ASSERT(local_dofs.size() == n_vars * n_nodes);
+    for (std::size_t k = 0; k < n_nodes; ++k)
+    {
+        for (std::size_t i = 0; i < n_vars; ++i)
+        {
+            TBOX_ASSERT(local_dofs[n_vars * k + i] == petsc_vec.map_global_to_local_index(dof_indices[i][k]));
+        }
+    }
+#endif
+    return local_dofs;
+}
+
+/**
+ * Populate @p U_node with the finite element solution coefficients on an
+ * element using the local DoF indices computed by get_local_dof_indices().
+ */
+void
+get_cached_values_for_interpolation(boost::multi_array<double, 2>& U_node,
+                                    const double* const U_local_soln,
+                                    const std::vector<dof_id_type>& local_dofs,
+                                    const std::size_t n_vars)
+{
+    const std::size_t n_nodes = local_dofs.size() / n_vars;
+    if (U_node.shape()[0] != n_nodes || U_node.shape()[1] != n_vars)
+    {
+        boost::multi_array<double, 2>::extent_gen extents;
+        U_node.resize(extents[n_nodes][n_vars]);
+    }
+    for (std::size_t k = 0; k < n_nodes; ++k)
+    {
+        for (std::size_t i = 0; i < n_vars; ++i)
+        {
+            U_node[k][i] = U_local_soln[local_dofs[n_vars * k + i]];
+        }
+    }
+    return;
+}
+
+/**
+ * Get the values of the shape functions of the given type at the points of a
+ * quadrature rule, computing them if necessary.
+ */
+const std::vector<std::vector<double> >&
+get_cached_phi(std::map<quadrature_key_type, std::vector<std::vector<double> > >& phi_cache,
+               const quadrature_key_type& key,
+               const unsigned int dim,
+               const FEType& fe_type,
+               QBase& qrule,
+               const Elem* const elem)
+{
+    auto it = phi_cache.find(key);
+    if (it == phi_cache.end())
+    {
+        std::unique_ptr<FEBase> fe = FEBase::build(dim, fe_type);
+        const std::vector<std::vector<double> >& phi = fe->get_phi();
+        fe->attach_quadrature_rule(&qrule);
+        fe->reinit(elem);
+        it = phi_cache.emplace(key, phi).first;
+    }
+    return it->second;
+}
+
 #if LIBMESH_VERSION_LESS_THAN(1, 6, 0)
 // libMesh's box intersection code is slow and not in a header (i.e., cannot be
 // inlined). This is problematic for us since we presently call this function
@@ -594,6 +713,8 @@ FEDataManager::reinitElementMappings()
     d_active_elems.clear();
     d_system_ghost_vec.clear();
     d_system_ib_ghost_vec.clear();
+    d_spread_quadrature_data.clear();
+    d_interp_quadrature_data.clear();
 
     // Reset the mappings between grid patches and active mesh
     // elements.
@@ -984,18 +1105,13 @@ FEDataManager::spread(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || sc_data);
 
-    // Extract the mesh.
-    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
-    const unsigned int dim = mesh.mesh_dimension();
-
-    // Extract the FE systems and DOF maps, and setup the FECache objects.
+    // Extract the FE systems and DOF maps.
     System& F_system = d_fe_data->d_es->get_system(system_name);
     const unsigned int n_vars = F_system.n_vars();
     const DofMap& F_dof_map = F_system.get_dof_map();
     FEData::SystemDofMapCache& F_dof_map_cache = *getDofMapCache(system_name);
     System& X_system = d_fe_data->d_es->get_system(getCurrentCoordinatesSystemName());
     const DofMap& X_dof_map = X_system.get_dof_map();
-    FEData::SystemDofMapCache& X_dof_map_cache = *getDofMapCache(getCurrentCoordinatesSystemName());
     FEType F_fe_type = F_dof_map.variable_type(0);
     Order F_order = F_dof_map.variable_order(0);
     for (unsigned i = 0; i < n_vars; ++i)
@@ -1011,16 +1127,6 @@ FEDataManager::spread(const int f_data_idx,
         TBOX_ASSERT(X_dof_map.variable_order(d) == X_order);
     }
 
-    // convenience alias for the quadrature key type used by FECache and FEMappingCache
-    using quad_key_type = quadrature_key_type;
-    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
-    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-
-    // We have to support both volumetric and surface meshes based on runtime data
-    FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
-    FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
-    const bool is_volume_mesh = dim == NDIM;
-
     // Check to see if we are using nodal quadrature.
     const bool use_nodal_quadrature = spread_spec.use_nodal_quadrature;
     if (use_nodal_quadrature) TBOX_ASSERT(F_fe_type == X_fe_type && F_order == X_order);
@@ -1139,10 +1245,24 @@ FEDataManager::spread(const int f_data_idx,
         auto X_petsc_vec = static_cast<PetscVector<double>*>(&X_vec);
         const double* const X_local_soln = X_petsc_vec->get_array_read();
 
+        // The quadrature keys, JxW values, shape function values, and local
+        // DoF indices are cached until the next call to
+        // reinitElementMappings().
+        QuadratureDataCache& qp_cache = getQuadratureDataCache(d_spread_quadrature_data,
+                                                               system_name,
+                                                               spread_spec.quad_type,
+                                                               spread_spec.quad_order,
+                                                               spread_spec.use_adaptive_quadrature,
+                                                               spread_spec.point_density,
+                                                               spread_spec.allow_rules_with_negative_weights,
+                                                               F_petsc_vec,
+                                                               *X_petsc_vec);
+
         // Loop over the patches to interpolate nodal values on the FE mesh to
         // the element quadrature points, then spread those values onto the
         // Eulerian grid.
         boost::multi_array<double, 2> F_node;
+        std::vector<boost::multi_array<double, 2> > X_nodes;
         std::vector<double> F_JxW_qp, X_qp;
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
@@ -1161,60 +1281,41 @@ FEDataManager::spread(const int f_data_idx,
                 const double* const patch_dx = patch_geom->getDx();
                 const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-                // Determining which quadrature rule should be used on which
-                // processor is surprisingly expensive, so cache the keys:
-                std::vector<quad_key_type> quad_keys(num_active_patch_elems);
+#ifndef NDEBUG
+                for (const Elem* const elem : patch_elems) TBOX_ASSERT(getPatchLevel(elem) == ln);
+#endif // ifndef NDEBUG
 
-                // Cache interpolated positions too:
-                std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
+                // Gather the nodal positions and update the cached quadrature
+                // data.
+                PatchQuadratureData& patch_qp_data = qp_cache.patch_data[ln][local_patch_num];
+                updatePatchQuadratureData(
+                    patch_qp_data, qp_cache, patch_elems, X_nodes, *X_petsc_vec, X_local_soln, patch_dx_min);
+                patch_qp_data.F_local_dofs.resize(num_active_patch_elems);
 
                 // Setup vectors to store the values of F_JxW and X at the
                 // quadrature points.
-                unsigned int n_qp_patch = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-                {
-                    Elem* const elem = patch_elems[e_idx];
-#ifndef NDEBUG
-                    TBOX_ASSERT(getPatchLevel(elem) == ln);
-#endif // ifndef NDEBUG
-                    const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
-                    get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                    const quad_key_type key = getQuadratureKey(spread_spec.quad_type,
-                                                               spread_spec.quad_order,
-                                                               spread_spec.use_adaptive_quadrature,
-                                                               spread_spec.point_density,
-                                                               spread_spec.allow_rules_with_negative_weights,
-                                                               elem,
-                                                               X_nodes[e_idx],
-                                                               patch_dx_min);
-                    quad_keys[e_idx] = key;
-                    QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    n_qp_patch += qrule.n_points();
-                }
+                const unsigned int n_qp_patch = patch_qp_data.qp_offsets.back();
                 if (!n_qp_patch) continue;
                 F_JxW_qp.resize(n_vars * n_qp_patch);
                 X_qp.resize(NDIM * n_qp_patch);
 
                 // Loop over the elements and compute the values to be spread and
                 // the positions of the quadrature points.
-                int qp_offset = 0;
                 for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
                 {
                     Elem* const elem = patch_elems[e_idx];
                     const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-                    get_values_for_interpolation(F_node, *F_petsc_vec, F_local_soln, F_dof_indices);
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const FEBase& X_fe = X_fe_cache(key, elem);
-                    const FEBase& F_fe = F_fe_cache(key, elem);
-                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
+                    const std::vector<dof_id_type>& F_local_dofs =
+                        get_local_dof_indices(patch_qp_data.F_local_dofs[e_idx], *F_petsc_vec, F_dof_indices);
+                    get_cached_values_for_interpolation(F_node, F_local_soln, F_local_dofs, n_vars);
 
                     // JxW depends on the element
-                    const std::vector<double>& JxW_F =
-                        get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
-                    const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
-                    const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
+                    const std::vector<double>& JxW_F = patch_qp_data.JxW[e_idx];
+                    const std::vector<std::vector<double> >& phi_F = *patch_qp_data.phi_F[e_idx];
+                    const std::vector<std::vector<double> >& phi_X = *patch_qp_data.phi_X[e_idx];
 
-                    const unsigned int n_qp = qrule.n_points();
+                    const unsigned int qp_offset = patch_qp_data.qp_offsets[e_idx];
+                    const unsigned int n_qp = patch_qp_data.qp_offsets[e_idx + 1] - qp_offset;
                     TBOX_ASSERT(n_qp == phi_F[0].size());
                     TBOX_ASSERT(n_qp == phi_X[0].size());
                     TBOX_ASSERT(n_qp == JxW_F.size());
@@ -1227,7 +1328,6 @@ FEDataManager::spread(const int f_data_idx,
                         n_vars, F_dof_indices[0].size(), qp_offset, phi_F, JxW_F, F_node, F_JxW_qp);
                     sum_weighted_elem_solution</*weights_are_unity*/ true>(
                         NDIM, phi_X.size(), qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                    qp_offset += n_qp;
                 }
 
                 zeroExteriorValues(*patch_geom, X_qp, F_JxW_qp, n_vars);
@@ -1733,18 +1833,13 @@ FEDataManager::interpWeighted(const int f_data_idx,
     const bool sc_data = f_sc_var;
     TBOX_ASSERT(cc_data || sc_data);
 
-    // Extract the mesh.
-    const MeshBase& mesh = d_fe_data->d_es->get_mesh();
-    const unsigned int dim = mesh.mesh_dimension();
-
-    // Extract the FE systems and DOF maps, and setup the FECache objects.
+    // Extract the FE systems and DOF maps.
     System& F_system = d_fe_data->d_es->get_system(system_name);
     const unsigned int n_vars = F_system.n_vars();
     const DofMap& F_dof_map = F_system.get_dof_map();
     FEData::SystemDofMapCache& F_dof_map_cache = *getDofMapCache(system_name);
     System& X_system = d_fe_data->d_es->get_system(getCurrentCoordinatesSystemName());
     const DofMap& X_dof_map = X_system.get_dof_map();
-    FEData::SystemDofMapCache& X_dof_map_cache = *getDofMapCache(getCurrentCoordinatesSystemName());
     FEType F_fe_type = F_dof_map.variable_type(0);
     Order F_order = F_dof_map.variable_order(0);
     for (unsigned i = 0; i < n_vars; ++i)
@@ -1760,14 +1855,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
         TBOX_ASSERT(X_dof_map.variable_order(d) == X_order);
     }
 
-    // convenience alias for the quadrature key type used by FECache and FEMappingCache
-    using quad_key_type = quadrature_key_type;
-    FECache F_fe_cache(dim, F_fe_type, FEUpdateFlags::update_phi);
-    FECache X_fe_cache(dim, X_fe_type, FEUpdateFlags::update_phi);
-    FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
-    FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
-    const bool is_volume_mesh = dim == NDIM;
-
     // Communicate any unsynchronized ghost data.
     for (const auto& f_refine_sched : f_refine_scheds)
     {
@@ -1928,6 +2015,19 @@ FEDataManager::interpWeighted(const int f_data_idx,
     }
     else
     {
+        // The quadrature keys, JxW values, shape function values, and local
+        // DoF indices are cached until the next call to
+        // reinitElementMappings().
+        QuadratureDataCache& qp_cache = getQuadratureDataCache(d_interp_quadrature_data,
+                                                               system_name,
+                                                               interp_spec.quad_type,
+                                                               interp_spec.quad_order,
+                                                               interp_spec.use_adaptive_quadrature,
+                                                               interp_spec.point_density,
+                                                               interp_spec.allow_rules_with_negative_weights,
+                                                               is_ghosted ? F_petsc_vec : nullptr,
+                                                               *X_petsc_vec);
+
         // Loop over the patches to interpolate values to the element quadrature
         // points from the grid, then use these values to compute the projection
         // of the interpolated velocity field onto the FE basis functions.
@@ -1935,6 +2035,7 @@ FEDataManager::interpWeighted(const int f_data_idx,
         // Assemble F_rhs_e's vectors in an interleaved format (see the implementation):
         std::vector<double> F_rhs_concatenated;
         std::vector<double> F_qp, X_qp;
+        std::vector<boost::multi_array<double, 2> > X_nodes;
         std::vector<libMesh::dof_id_type> dof_id_scratch;
         for (int ln = 0; ln <= d_hierarchy->getFinestLevelNumber(); ++ln)
         {
@@ -1952,33 +2053,16 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 const double* const patch_dx = patch_geom->getDx();
                 const double patch_dx_min = *std::min_element(patch_dx, patch_dx + NDIM);
 
-                // Determining which quadrature rule should be used on which
-                // processor is surprisingly expensive, so cache the keys:
-                std::vector<quad_key_type> quad_keys(num_active_patch_elems);
-
-                // Cache interpolated positions too:
-                std::vector<boost::multi_array<double, 2> > X_nodes(num_active_patch_elems);
+                // Gather the nodal positions and update the cached quadrature
+                // data.
+                PatchQuadratureData& patch_qp_data = qp_cache.patch_data[ln][local_patch_num];
+                updatePatchQuadratureData(
+                    patch_qp_data, qp_cache, patch_elems, X_nodes, *X_petsc_vec, X_local_soln, patch_dx_min);
+                if (is_ghosted) patch_qp_data.F_local_dofs.resize(num_active_patch_elems);
 
                 // Setup vectors to store the values of F and X at the quadrature
                 // points.
-                unsigned int n_qp_patch = 0;
-                for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
-                {
-                    Elem* const elem = patch_elems[e_idx];
-                    const auto& X_dof_indices = X_dof_map_cache.dof_indices(elem);
-                    get_values_for_interpolation(X_nodes[e_idx], *X_petsc_vec, X_local_soln, X_dof_indices);
-                    const quad_key_type key = getQuadratureKey(interp_spec.quad_type,
-                                                               interp_spec.quad_order,
-                                                               interp_spec.use_adaptive_quadrature,
-                                                               interp_spec.point_density,
-                                                               interp_spec.allow_rules_with_negative_weights,
-                                                               elem,
-                                                               X_nodes[e_idx],
-                                                               patch_dx_min);
-                    QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    n_qp_patch += qrule.n_points();
-                    quad_keys[e_idx] = key;
-                }
+                const unsigned int n_qp_patch = patch_qp_data.qp_offsets.back();
                 if (!n_qp_patch) continue;
                 F_qp.resize(n_vars * n_qp_patch);
                 X_qp.resize(NDIM * n_qp_patch);
@@ -1986,23 +2070,18 @@ FEDataManager::interpWeighted(const int f_data_idx,
 
                 // Loop over the elements and compute the positions of the
                 // quadrature points.
-                int qp_offset = 0;
                 for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
                 {
-                    Elem* const elem = patch_elems[e_idx];
-                    TBOX_ASSERT(elem->active());
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
-                    const FEBase& X_fe = X_fe_cache(key, elem);
-                    const std::vector<std::vector<double> >& phi_X = X_fe.get_phi();
+                    TBOX_ASSERT(patch_elems[e_idx]->active());
+                    const std::vector<std::vector<double> >& phi_X = *patch_qp_data.phi_X[e_idx];
 
-                    const unsigned int n_node = elem->n_nodes();
-                    const unsigned int n_qp = qrule.n_points();
+                    const unsigned int n_node = patch_elems[e_idx]->n_nodes();
+                    const unsigned int qp_offset = patch_qp_data.qp_offsets[e_idx];
+                    const unsigned int n_qp = patch_qp_data.qp_offsets[e_idx + 1] - qp_offset;
                     TBOX_ASSERT(n_qp == phi_X[0].size());
                     double* X_begin = &X_qp[NDIM * qp_offset];
                     std::fill(X_begin, X_begin + NDIM * n_qp, 0.0);
                     sum_weighted_elem_solution<true>(NDIM, n_node, qp_offset, phi_X, {}, X_nodes[e_idx], X_qp);
-                    qp_offset += n_qp;
                 }
 
                 // Interpolate values from the Cartesian grid patch to the
@@ -2026,7 +2105,6 @@ FEDataManager::interpWeighted(const int f_data_idx,
                 }
 
                 // Loop over the elements and accumulate the right-hand-side values.
-                qp_offset = 0;
                 for (unsigned int e_idx = 0; e_idx < num_active_patch_elems; ++e_idx)
                 {
                     Elem* const elem = patch_elems[e_idx];
@@ -2040,49 +2118,50 @@ FEDataManager::interpWeighted(const int f_data_idx,
 #endif
                     F_rhs_concatenated.resize(n_vars * F_dof_indices[0].size());
                     std::fill(F_rhs_concatenated.begin(), F_rhs_concatenated.end(), 0.0);
-                    const quad_key_type& key = quad_keys[e_idx];
-                    const FEBase& F_fe = F_fe_cache(key, elem);
-                    const QBase& qrule = d_fe_data->d_quadrature_cache[key];
 
                     // JxW depends on the element
-                    const std::vector<double>& JxW_F =
-                        get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
-                    const std::vector<std::vector<double> >& phi_F = F_fe.get_phi();
+                    const std::vector<double>& JxW_F = patch_qp_data.JxW[e_idx];
+                    const std::vector<std::vector<double> >& phi_F = *patch_qp_data.phi_F[e_idx];
 
-                    const unsigned int n_qp = qrule.n_points();
+                    const unsigned int qp_offset = patch_qp_data.qp_offsets[e_idx];
+                    const unsigned int n_qp = patch_qp_data.qp_offsets[e_idx + 1] - qp_offset;
                     TBOX_ASSERT(n_qp == phi_F[0].size());
                     TBOX_ASSERT(n_qp == JxW_F.size());
                     const size_t n_basis = F_dof_indices[0].size();
                     integrate_elem_rhs(n_vars, n_basis, qp_offset, phi_F, JxW_F, F_qp, F_rhs_concatenated);
 
-                    for (unsigned int var_n = 0; var_n < n_vars; ++var_n)
+                    // We do *not* apply constraints here. See the note in the
+                    // documentation of this function for an explanation.
+                    if (is_ghosted)
                     {
-                        F_rhs.resize(F_dof_indices[var_n].size());
-                        std::copy(F_rhs_concatenated.begin() + var_n * n_basis,
-                                  F_rhs_concatenated.begin() + (var_n + 1) * n_basis,
-                                  F_rhs.get_values().begin());
-
-                        // We do *not* apply constraints here. See the note in the
-                        // documentation of this function for an explanation.
-                        if (is_ghosted)
+                        // Local DoF indices are stored node by node.
+                        const std::vector<dof_id_type>& F_local_dofs =
+                            get_local_dof_indices(patch_qp_data.F_local_dofs[e_idx], *F_petsc_vec, F_dof_indices);
+                        for (unsigned int var_n = 0; var_n < n_vars; ++var_n)
                         {
-                            for (unsigned int i = 0; i < F_dof_indices[var_n].size(); ++i)
+                            for (unsigned int i = 0; i < n_basis; ++i)
                             {
-                                const PetscInt index = F_petsc_vec->map_global_to_local_index(F_dof_indices[var_n][i]);
+                                const PetscInt index = F_local_dofs[n_vars * i + var_n];
 #ifndef NDEBUG
                                 TBOX_ASSERT(0 <= index);
                                 TBOX_ASSERT(index < F_local_size);
 #endif
-                                F_local_soln[index] += F_rhs(i);
+                                F_local_soln[index] += F_rhs_concatenated[var_n * n_basis + i];
                             }
                         }
-                        else
+                    }
+                    else
+                    {
+                        for (unsigned int var_n = 0; var_n < n_vars; ++var_n)
                         {
+                            F_rhs.resize(F_dof_indices[var_n].size());
+                            std::copy(F_rhs_concatenated.begin() + var_n * n_basis,
+                                      F_rhs_concatenated.begin() + (var_n + 1) * n_basis,
+                                      F_rhs.get_values().begin());
                             copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
                             F_vec.add_vector(F_rhs, dof_id_scratch);
                         }
                     }
-                    qp_offset += n_qp;
                 }
             }
         }
@@ -3245,6 +3324,130 @@ FEDataManager::collectActivePatchNodes(std::vector<std::vector<Node*> >& active_
     return;
 }
 
+FEDataManager::QuadratureDataCache&
+FEDataManager::getQuadratureDataCache(std::map<std::string, QuadratureDataCache>& caches,
+                                      const std::string& system_name,
+                                      const QuadratureType quad_type,
+                                      const Order quad_order,
+                                      const bool use_adaptive_quadrature,
+                                      const double point_density,
+                                      const bool allow_rules_with_negative_weights,
+                                      PetscVector<double>* const F_vec,
+                                      PetscVector<double>& X_vec)
+{
+    const std::array<std::size_t, 4> F_index_signature =
+        F_vec ? get_local_index_signature(*F_vec) : std::array<std::size_t, 4>{ { 0, 0, 0, 0 } };
+    const std::array<std::size_t, 4> X_index_signature = get_local_index_signature(X_vec);
+
+    QuadratureDataCache& cache = caches[system_name];
+    if (cache.patch_data.size() != d_active_patch_elem_map.size() || cache.quad_type != quad_type ||
+        cache.quad_order != quad_order || cache.use_adaptive_quadrature != use_adaptive_quadrature ||
+        cache.point_density != point_density ||
+        cache.allow_rules_with_negative_weights != allow_rules_with_negative_weights)
+    {
+        cache = QuadratureDataCache();
+        cache.quad_type = quad_type;
+        cache.quad_order = quad_order;
+        cache.use_adaptive_quadrature = use_adaptive_quadrature;
+        cache.point_density = point_density;
+        cache.allow_rules_with_negative_weights = allow_rules_with_negative_weights;
+        cache.F_fe_type = d_fe_data->d_es->get_system(system_name).get_dof_map().variable_type(0);
+        cache.X_fe_type =
+            d_fe_data->d_es->get_system(getCurrentCoordinatesSystemName()).get_dof_map().variable_type(0);
+        cache.F_index_signature = F_index_signature;
+        cache.X_index_signature = X_index_signature;
+        cache.patch_data.resize(d_active_patch_elem_map.size());
+        for (unsigned int ln = 0; ln < d_active_patch_elem_map.size(); ++ln)
+        {
+            cache.patch_data[ln].resize(d_active_patch_elem_map[ln].size());
+        }
+    }
+
+    // Local DoF indices are computed with respect to a particular ghost layout
+    // and must be recomputed if the vectors use a different one.
+    const bool reset_F_local_dofs = F_vec && F_index_signature != cache.F_index_signature;
+    const bool reset_X_local_dofs = X_index_signature != cache.X_index_signature;
+    for (std::vector<PatchQuadratureData>& level_data : cache.patch_data)
+    {
+        for (PatchQuadratureData& patch_data : level_data)
+        {
+            if (reset_F_local_dofs) patch_data.F_local_dofs.clear();
+            if (reset_X_local_dofs) patch_data.X_local_dofs.clear();
+        }
+    }
+    if (reset_F_local_dofs) cache.F_index_signature = F_index_signature;
+    if (reset_X_local_dofs) cache.X_index_signature = X_index_signature;
+    return cache;
+} // getQuadratureDataCache
+
+void
+FEDataManager::updatePatchQuadratureData(PatchQuadratureData& patch_data,
+                                         QuadratureDataCache& cache,
+                                         const std::vector<Elem*>& patch_elems,
+                                         std::vector<boost::multi_array<double, 2> >& X_nodes,
+                                         const PetscVector<double>& X_vec,
+                                         const double* const X_local_soln,
+                                         const double patch_dx_min)
+{
+    const std::size_t num_elems = patch_elems.size();
+    FEData::SystemDofMapCache& X_dof_map_cache = *getDofMapCache(getCurrentCoordinatesSystemName());
+
+    // Gather the nodal positions. The quadrature keys only depend on the
+    // positions when using adaptive quadrature, so in all other cases they are
+    // computed only once.
+    const bool reinit_all = patch_data.quad_keys.size() != num_elems;
+    const bool compute_keys = reinit_all || cache.use_adaptive_quadrature;
+    patch_data.X_local_dofs.resize(num_elems);
+    X_nodes.resize(num_elems);
+    std::vector<quadrature_key_type> quad_keys(compute_keys ? num_elems : 0);
+    for (unsigned int e_idx = 0; e_idx < num_elems; ++e_idx)
+    {
+        const Elem* const elem = patch_elems[e_idx];
+        const std::vector<dof_id_type>& X_local_dofs =
+            get_local_dof_indices(patch_data.X_local_dofs[e_idx], X_vec, X_dof_map_cache.dof_indices(elem));
+        get_cached_values_for_interpolation(X_nodes[e_idx], X_local_soln, X_local_dofs, NDIM);
+        if (compute_keys)
+        {
+            quad_keys[e_idx] = getQuadratureKey(cache.quad_type,
+                                                cache.quad_order,
+                                                cache.use_adaptive_quadrature,
+                                                cache.point_density,
+                                                cache.allow_rules_with_negative_weights,
+                                                elem,
+                                                X_nodes[e_idx],
+                                                patch_dx_min);
+        }
+    }
+    if (!compute_keys || (!reinit_all && quad_keys == patch_data.quad_keys)) return;
+
+    // Recompute the data of all elements whose quadrature rules have changed.
+    const unsigned int dim = d_fe_data->d_es->get_mesh().mesh_dimension();
+    const bool is_volume_mesh = dim == NDIM;
+    FEMappingCache<NDIM, NDIM> volume_mapping_cache(FEUpdateFlags::update_JxW);
+    FEMappingCache<NDIM - 1, NDIM> surface_mapping_cache(FEUpdateFlags::update_JxW);
+    patch_data.quad_keys.resize(num_elems);
+    patch_data.qp_offsets.resize(num_elems + 1);
+    patch_data.JxW.resize(num_elems);
+    patch_data.phi_F.resize(num_elems);
+    patch_data.phi_X.resize(num_elems);
+    patch_data.qp_offsets[0] = 0;
+    for (unsigned int e_idx = 0; e_idx < num_elems; ++e_idx)
+    {
+        const Elem* const elem = patch_elems[e_idx];
+        const quadrature_key_type& key = quad_keys[e_idx];
+        QBase& qrule = d_fe_data->d_quadrature_cache[key];
+        if (reinit_all || key != patch_data.quad_keys[e_idx])
+        {
+            patch_data.quad_keys[e_idx] = key;
+            patch_data.JxW[e_idx] = get_JxW(key, elem, is_volume_mesh, volume_mapping_cache, surface_mapping_cache);
+            patch_data.phi_F[e_idx] = &get_cached_phi(cache.phi_F, key, dim, cache.F_fe_type, qrule, elem);
+            patch_data.phi_X[e_idx] = &get_cached_phi(cache.phi_X, key, dim, cache.X_fe_type, qrule, elem);
+        }
+        patch_data.qp_offsets[e_idx + 1] = patch_data.qp_offsets[e_idx] + qrule.n_points();
+    }
+    return;
+} // updatePatchQuadratureData
+
 int
 FEDataManager::getPatchLevel(const Elem* elem) const
 {
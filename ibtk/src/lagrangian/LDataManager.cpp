@@ -113,6 +113,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <ostream>
 #include <set>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -625,6 +626,9 @@ LDataManager::spread(const int f_data_idx,
             Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
             const Box<NDIM>& box = idx_data->getGhostBox();
+            LEInteractor::setWeightCache(d_use_interaction_weight_cache ?
+                                             &d_interaction_weight_cache[std::make_tuple(ln, p(), f_data_idx, true)] :
+                                             nullptr);
             if (cc_data)
             {
                 Pointer<CellData<NDIM, double> > f_cc_data = f_data;
@@ -649,6 +653,7 @@ LDataManager::spread(const int f_data_idx,
                 LEInteractor::spread(
                     f_sc_data, F_data[ln], X_data[ln], idx_data, patch, box, periodic_shift, spread_kernel_fcn);
             }
+            LEInteractor::setWeightCache(nullptr);
             if (f_phys_bdry_op)
             {
                 f_phys_bdry_op->setPatchDataIndex(f_data_idx);
@@ -750,6 +755,9 @@ LDataManager::interp(const int f_data_idx,
             Pointer<PatchData<NDIM> > f_data = patch->getPatchData(f_data_idx);
             Pointer<LNodeSetData> idx_data = patch->getPatchData(d_lag_node_index_current_idx);
             const Box<NDIM>& box = idx_data->getBox();
+            LEInteractor::setWeightCache(d_use_interaction_weight_cache ?
+                                             &d_interaction_weight_cache[std::make_tuple(ln, p(), f_data_idx, false)] :
+                                             nullptr);
             if (cc_data)
             {
                 Pointer<CellData<NDIM, double> > f_cc_data = f_data;
@@ -798,6 +806,7 @@ LDataManager::interp(const int f_data_idx,
                                           periodic_shift,
                                           d_default_interp_kernel_fcn);
             }
+            LEInteractor::setWeightCache(nullptr);
         }
     }
 
@@ -811,6 +820,27 @@ LDataManager::interp(const int f_data_idx,
     return;
 } // interp
 
+void
+LDataManager::setUseInteractionWeightCache(const bool use_cache)
+{
+    d_use_interaction_weight_cache = use_cache;
+    if (!d_use_interaction_weight_cache) clearInteractionWeightCache();
+    return;
+} // setUseInteractionWeightCache
+
+bool
+LDataManager::getUseInteractionWeightCache() const
+{
+    return d_use_interaction_weight_cache;
+} // getUseInteractionWeightCache
+
+void
+LDataManager::clearInteractionWeightCache()
+{
+    d_interaction_weight_cache.clear();
+    return;
+} // clearInteractionWeightCache
+
 void
 LDataManager::registerLInitStrategy(Pointer<LInitStrategy> lag_init)
 {
@@ -1512,6 +1542,9 @@ LDataManager::endDataRedistribution(const int coarsest_ln_in, const int finest_l
 {
     IBTK_TIMER_START(t_end_data_redistribution);
 
+    // Cached kernel weights refer to the old distribution of the nodes.
+    clearInteractionWeightCache();
+
     const int coarsest_ln = (coarsest_ln_in == invalid_level_number) ? d_coarsest_ln : coarsest_ln_in;
     const int finest_ln = (finest_ln_in == invalid_level_number) ? d_finest_ln : finest_ln_in;
 
@@ -2344,6 +2377,9 @@ LDataManager::resetHierarchyConfiguration(const Pointer<BasePatchHierarchy<NDIM>
 #endif
     const int finest_hier_level = hierarchy->getFinestLevelNumber();
 
+    // Cached kernel weights refer to the old patch layout.
+    clearInteractionWeightCache();
+
     // Reset the patch hierarchy and levels.
     setPatchHierarchy(hierarchy);
     setPatchLevels(0, finest_hier_level);
@@ -18,6 +18,7 @@
 #include "ibtk/LEInteractor.h"
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LSet.h"
+#include "ibtk/ThreadPool.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "ArrayData.h"
@@ -51,6 +52,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <cmath>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 // FORTRAN ROUTINES
@@ -1568,14 +1570,775 @@ string_to_kernel(const std::string& kernel_fcn)
     TBOX_ERROR("Unknown kernel function " << kernel_fcn << std::endl);
     return INVALID;
 }
+
+// Weight functions for the templated C++ implementations of the interaction
+// kernels. Each one provides its stencil width as a compile-time constant and
+// computes the one-dimensional weights of a point whose (scaled) distance to
+// the center of stencil entry (width - 1) / 2 is r.
+struct IB4Weights
+{
+    static constexpr int width = 4;
+
+    static inline void compute(const double r, double* const w)
+    {
+        // Same formulae as lagrangian_ib_4_{interp,spread}, so that both
+        // backends produce identical weights.
+        const double q = std::sqrt(1.0 + 4.0 * r * (1.0 - r));
+        w[0] = 0.125 * (3.0 - 2.0 * r - q);
+        w[1] = 0.125 * (3.0 - 2.0 * r + q);
+        w[2] = 0.125 * (1.0 + 2.0 * r + q);
+        w[3] = 0.125 * (1.0 + 2.0 * r - q);
+    }
+};
+
+struct IB6Weights
+{
+    static constexpr int width = 6;
+
+    static inline void compute(const double r_c, double* const w)
+    {
+        // Same formulae as lagrangian_ib_6_{interp,spread}, which measure the
+        // distance from the opposite side of the center cell.
+        static const double K = (59.0 / 60.0) * (1.0 - std::sqrt(1.0 - (3220.0 / 3481.0)));
+        const double r = 1.0 - r_c;
+        const double r2 = r * r, r3 = r2 * r;
+        const double alpha = 28.0;
+        const double beta = (9.0 / 4.0) - (3.0 / 2.0) * (K + r2) + ((22.0 / 3.0) - 7.0 * K) * r - (7.0 / 3.0) * r3;
+        const double gamma = (1.0 / 4.0) * (((161.0 / 36.0) - (59.0 / 6.0) * K + 5.0 * K * K) * (1.0 / 2.0) * r2 +
+                                            (-(109.0 / 24.0) + 5.0 * K) * (1.0 / 3.0) * r2 * r2 +
+                                            (5.0 / 18.0) * r3 * r3);
+        const double discr = beta * beta - 4.0 * alpha * gamma;
+        const double pm3 = (-beta + std::copysign(1.0, (3.0 / 2.0) - K) * std::sqrt(discr)) / (2.0 * alpha);
+        w[0] = pm3;
+        w[1] = -3.0 * pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) + (1.0 / 12.0) * (3.0 * K - 1.0) * r +
+               (1.0 / 12.0) * r3;
+        w[2] = 2.0 * pm3 + (1.0 / 4.0) + (1.0 / 6.0) * (4.0 - 3.0 * K) * r - (1.0 / 6.0) * r3;
+        w[3] = 2.0 * pm3 + (5.0 / 8.0) - (1.0 / 4.0) * (K + r2);
+        w[4] = -3.0 * pm3 + (1.0 / 4.0) - (1.0 / 6.0) * (4.0 - 3.0 * K) * r + (1.0 / 6.0) * r3;
+        w[5] = pm3 - (1.0 / 16.0) + (1.0 / 8.0) * (K + r2) - (1.0 / 12.0) * (3.0 * K - 1.0) * r - (1.0 / 12.0) * r3;
+    }
+};
+
+// The B-spline kernels evaluate the same piecewise polynomials as
+// lagrangian_bspline_{3,4,5,6}_delta at the distance of each stencil entry.
+struct BSpline3Weights
+{
+    static constexpr int width = 3;
+
+    static inline double delta(const double x)
+    {
+        const double modx = std::abs(x);
+        const double r = modx + 1.5, r2 = r * r;
+        if (modx <= 0.5) return 0.5 * (-2.0 * r2 + 6.0 * r - 3.0);
+        if (modx <= 1.5) return 0.5 * (r2 - 6.0 * r + 9.0);
+        return 0.0;
+    }
+
+    static inline void compute(const double r, double* const w)
+    {
+        for (int i = 0; i < width; ++i) w[i] = delta(r + static_cast<double>((width - 1) / 2 - i));
+    }
+};
+
+struct BSpline4Weights
+{
+    static constexpr int width = 4;
+
+    static inline double delta(const double x)
+    {
+        const double modx = std::abs(x);
+        const double r = modx + 2.0, r2 = r * r, r3 = r2 * r;
+        if (modx <= 1.0) return (1.0 / 6.0) * (3.0 * r3 - 24.0 * r2 + 60.0 * r - 44.0);
+        if (modx <= 2.0) return (1.0 / 6.0) * (-r3 + 12.0 * r2 - 48.0 * r + 64.0);
+        return 0.0;
+    }
+
+    static inline void compute(const double r, double* const w)
+    {
+        for (int i = 0; i < width; ++i) w[i] = delta(r + static_cast<double>((width - 1) / 2 - i));
+    }
+};
+
+struct BSpline5Weights
+{
+    static constexpr int width = 5;
+
+    static inline double delta(const double x)
+    {
+        const double modx = std::abs(x);
+        const double r = modx + 2.5, r2 = r * r, r3 = r2 * r, r4 = r3 * r;
+        if (modx <= 0.5) return (1.0 / 24.0) * (6.0 * r4 - 60.0 * r3 + 210.0 * r2 - 300.0 * r + 155.0);
+        if (modx <= 1.5) return (1.0 / 24.0) * (-4.0 * r4 + 60.0 * r3 - 330.0 * r2 + 780.0 * r - 655.0);
+        if (modx <= 2.5) return (1.0 / 24.0) * (r4 - 20.0 * r3 + 150.0 * r2 - 500.0 * r + 625.0);
+        return 0.0;
+    }
+
+    static inline void compute(const double r, double* const w)
+    {
+        for (int i = 0; i < width; ++i) w[i] = delta(r + static_cast<double>((width - 1) / 2 - i));
+    }
+};
+
+struct BSpline6Weights
+{
+    static constexpr int width = 6;
+
+    static inline double delta(const double x)
+    {
+        const double modx = std::abs(x);
+        const double r = modx + 3.0, r2 = r * r, r3 = r2 * r, r4 = r3 * r, r5 = r4 * r;
+        if (modx <= 1.0)
+            return (1.0 / 60.0) * (2193.0 - 3465.0 * r + 2130.0 * r2 - 630.0 * r3 + 90.0 * r4 - 5.0 * r5);
+        if (modx <= 2.0)
+            return (1.0 / 120.0) * (-10974.0 + 12270.0 * r - 5340.0 * r2 + 1140.0 * r3 - 120.0 * r4 + 5.0 * r5);
+        if (modx <= 3.0) return (1.0 / 120.0) * (7776.0 - 6480.0 * r + 2160.0 * r2 - 360.0 * r3 + 30.0 * r4 - r5);
+        return 0.0;
+    }
+
+    static inline void compute(const double r, double* const w)
+    {
+        for (int i = 0; i < width; ++i) w[i] = delta(r + static_cast<double>((width - 1) / 2 - i));
+    }
+};
+
+template <int W>
+struct UserDefinedWeights
+{
+    static constexpr int width = W;
+
+    static inline void compute(const double r, double* const w)
+    {
+        for (int i = 0; i < W; ++i) w[i] = LEInteractor::s_kernel_fcn(r + static_cast<double>((W - 1) / 2 - i));
+    }
+};
+
+// Collect the extents and strides of a ghosted patch data array and return the
+// stride between its components.
+inline int
+get_array_layout(const Box<NDIM>& q_data_box,
+                 const IntVector<NDIM>& q_gcw,
+                 std::array<int, NDIM>& ilower,
+                 std::array<int, NDIM>& ig_lower,
+                 std::array<int, NDIM>& ig_upper,
+                 std::array<int, NDIM>& stride)
+{
+    int depth_stride = 1;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ilower[d] = q_data_box.lower()(d);
+        ig_lower[d] = q_data_box.lower()(d) - q_gcw(d);
+        ig_upper[d] = q_data_box.upper()(d) + q_gcw(d);
+        stride[d] = depth_stride;
+        depth_stride *= ig_upper[d] - ig_lower[d] + 1;
+    }
+    return depth_stride;
+}
+
+// Compute the stencil of a single point: the one-dimensional weights along
+// each axis and the corresponding offsets into the (ghosted, Fortran-ordered)
+// patch data array, with the entries for axis d stored in [d * W, (d + 1) * W).
+// Entries that fall outside of the ghost box get a zero weight and a clamped
+// offset, which lets every loop over the stencil have a fixed trip count that
+// the compiler can unroll and vectorize.
+template <class WeightFcn>
+inline void
+compute_point_stencil(double* const w,
+                      int* const offset,
+                      const double* const X,
+                      const double* const X_shift,
+                      const double* const x_lower,
+                      const double* const dx,
+                      const int* const ilower,
+                      const int* const ig_lower,
+                      const int* const ig_upper,
+                      const int* const stride)
+{
+    constexpr int W = WeightFcn::width;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        const double X_o_dx = (X[d] + X_shift[d] - x_lower[d]) / dx[d];
+        const int ic_lower = (W % 2 == 0 ? NINT(X_o_dx) : static_cast<int>(std::floor(X_o_dx))) - W / 2;
+        WeightFcn::compute(X_o_dx - (static_cast<double>(ic_lower + (W - 1) / 2) + 0.5), &w[d * W]);
+        for (int i = 0; i < W; ++i)
+        {
+            const int ic = ic_lower + ilower[d] + i;
+            if (ic < ig_lower[d] || ic > ig_upper[d]) w[d * W + i] = 0.0;
+            offset[d * W + i] = (std::min(std::max(ic, ig_lower[d]), ig_upper[d]) - ig_lower[d]) * stride[d];
+        }
+    }
+    return;
+}
+
+// Interpolate all components of q to a single point with a precomputed
+// stencil.
+template <int W>
+inline void
+interpolate_point(double* const Q,
+                  const int Q_depth,
+                  const double* const q,
+                  const int depth_stride,
+                  const double* const w,
+                  const int* const offset)
+{
+    // Compute the tensor product of the weights in the first two directions.
+    std::array<double, W * W> w01;
+    for (int i1 = 0; i1 < W; ++i1)
+    {
+        for (int i0 = 0; i0 < W; ++i0)
+        {
+            w01[i0 + W * i1] = w[i0] * w[W + i1];
+        }
+    }
+
+    for (int comp = 0; comp < Q_depth; ++comp)
+    {
+        const double* const q_comp = q + comp * depth_stride;
+        double Q_comp = 0.0;
+#if (NDIM == 3)
+        for (int i2 = 0; i2 < W; ++i2)
+        {
+            const double w2 = w[2 * W + i2];
+            const int offset2 = offset[2 * W + i2];
+#endif
+            for (int i1 = 0; i1 < W; ++i1)
+            {
+#if (NDIM == 2)
+                const double* const q_row = q_comp + offset[W + i1];
+#endif
+#if (NDIM == 3)
+                const double* const q_row = q_comp + offset2 + offset[W + i1];
+#endif
+                double Q_row = 0.0;
+                for (int i0 = 0; i0 < W; ++i0)
+                {
+                    Q_row += w01[i0 + W * i1] * q_row[offset[i0]];
+                }
+#if (NDIM == 2)
+                Q_comp += Q_row;
+#endif
+#if (NDIM == 3)
+                Q_comp += w2 * Q_row;
+#endif
+            }
+#if (NDIM == 3)
+        }
+#endif
+        Q[comp] = Q_comp;
+    }
+    return;
+}
+
+// Spread all components of the value at a single point onto q with a
+// precomputed stencil.
+template <int W>
+inline void
+spread_point(double* const q,
+             const int depth_stride,
+             const double* const Q,
+             const int Q_depth,
+             const double* const w,
+             const int* const offset)
+{
+    std::array<double, W * W> w01;
+    for (int comp = 0; comp < Q_depth; ++comp)
+    {
+        // Fold the Lagrangian value into the tensor product weights.
+        const double Q_comp = Q[comp];
+        for (int i1 = 0; i1 < W; ++i1)
+        {
+            for (int i0 = 0; i0 < W; ++i0)
+            {
+                w01[i0 + W * i1] = Q_comp * w[i0] * w[W + i1];
+            }
+        }
+
+        double* const q_comp = q + comp * depth_stride;
+#if (NDIM == 3)
+        for (int i2 = 0; i2 < W; ++i2)
+        {
+            const double w2 = w[2 * W + i2];
+            const int offset2 = offset[2 * W + i2];
+#endif
+            for (int i1 = 0; i1 < W; ++i1)
+            {
+#if (NDIM == 2)
+                double* const q_row = q_comp + offset[W + i1];
+#endif
+#if (NDIM == 3)
+                double* const q_row = q_comp + offset2 + offset[W + i1];
+#endif
+                for (int i0 = 0; i0 < W; ++i0)
+                {
+#if (NDIM == 2)
+                    q_row[offset[i0]] += w01[i0 + W * i1];
+#endif
+#if (NDIM == 3)
+                    q_row[offset[i0]] += w2 * w01[i0 + W * i1];
+#endif
+                }
+            }
+#if (NDIM == 3)
+        }
+#endif
+    }
+    return;
+}
+
+template <class WeightFcn>
+void
+interpolate_cxx(double* const Q,
+                const int Q_depth,
+                const double* const X,
+                const double* const q,
+                const Box<NDIM>& q_data_box,
+                const IntVector<NDIM>& q_gcw,
+                const double* const x_lower,
+                const double* const dx,
+                const int* const local_indices,
+                const double* const X_shift,
+                const int num_local_indices)
+{
+    constexpr int W = WeightFcn::width;
+    std::array<int, NDIM> ilower, ig_lower, ig_upper, stride;
+    const int depth_stride = get_array_layout(q_data_box, q_gcw, ilower, ig_lower, ig_upper, stride);
+    std::array<double, NDIM * W> w;
+    std::array<int, NDIM * W> offset;
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        compute_point_stencil<WeightFcn>(w.data(),
+                                         offset.data(),
+                                         &X[NDIM * s],
+                                         &X_shift[NDIM * l],
+                                         x_lower,
+                                         dx,
+                                         ilower.data(),
+                                         ig_lower.data(),
+                                         ig_upper.data(),
+                                         stride.data());
+        interpolate_point<W>(&Q[s * Q_depth], Q_depth, q, depth_stride, w.data(), offset.data());
+    }
+    return;
+}
+
+template <class WeightFcn>
+void
+spread_cxx(double* const q,
+           const Box<NDIM>& q_data_box,
+           const IntVector<NDIM>& q_gcw,
+           const double* const x_lower,
+           const double* const dx,
+           const double* const Q,
+           const int Q_depth,
+           const double* const X,
+           const int* const local_indices,
+           const double* const X_shift,
+           const int num_local_indices)
+{
+    constexpr int W = WeightFcn::width;
+    std::array<int, NDIM> ilower, ig_lower, ig_upper, stride;
+    const int depth_stride = get_array_layout(q_data_box, q_gcw, ilower, ig_lower, ig_upper, stride);
+    std::array<double, NDIM * W> w;
+    std::array<int, NDIM * W> offset;
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        const int s = local_indices[l];
+        compute_point_stencil<WeightFcn>(w.data(),
+                                         offset.data(),
+                                         &X[NDIM * s],
+                                         &X_shift[NDIM * l],
+                                         x_lower,
+                                         dx,
+                                         ilower.data(),
+                                         ig_lower.data(),
+                                         ig_upper.data(),
+                                         stride.data());
+        spread_point<W>(q, depth_stride, &Q[s * Q_depth], Q_depth, w.data(), offset.data());
+    }
+    return;
+}
+
+// Compute and store the stencils of all of the points in a weight cache entry.
+template <class WeightFcn>
+void
+build_stencils_cxx(LEInteractor::WeightCache::Entry& entry, const double* const X, const double* const X_shift)
+{
+    constexpr int W = WeightFcn::width;
+    std::array<int, NDIM> ilower, ig_lower, ig_upper, stride;
+    entry.depth_stride = get_array_layout(entry.q_data_box, entry.q_gcw, ilower, ig_lower, ig_upper, stride);
+    entry.stencil_width = W;
+    const int num_local_indices = static_cast<int>(entry.local_indices.size());
+    entry.weights.resize(NDIM * W * num_local_indices);
+    entry.offsets.resize(NDIM * W * num_local_indices);
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        compute_point_stencil<WeightFcn>(&entry.weights[NDIM * W * l],
+                                         &entry.offsets[NDIM * W * l],
+                                         &X[NDIM * entry.local_indices[l]],
+                                         &X_shift[NDIM * l],
+                                         entry.x_lower.data(),
+                                         entry.dx.data(),
+                                         ilower.data(),
+                                         ig_lower.data(),
+                                         ig_upper.data(),
+                                         stride.data());
+    }
+    return;
+}
+
+template <int W>
+void
+interpolate_cached(double* const Q,
+                   const int Q_depth,
+                   const double* const q,
+                   const LEInteractor::WeightCache::Entry& entry,
+                   const int begin,
+                   const int end)
+{
+    for (int l = begin; l < end; ++l)
+    {
+        interpolate_point<W>(&Q[entry.local_indices[l] * Q_depth],
+                             Q_depth,
+                             q,
+                             entry.depth_stride,
+                             &entry.weights[NDIM * W * l],
+                             &entry.offsets[NDIM * W * l]);
+    }
+    return;
+}
+
+// Spread the points with (cache) positions order[begin], ..., order[end - 1],
+// or begin, ..., end - 1 if order is nullptr.
+template <int W>
+void
+spread_cached(double* const q,
+              const double* const Q,
+              const int Q_depth,
+              const LEInteractor::WeightCache::Entry& entry,
+              const int* const order,
+              const int begin,
+              const int end)
+{
+    for (int k = begin; k < end; ++k)
+    {
+        const int l = order ? order[k] : k;
+        spread_point<W>(q,
+                        entry.depth_stride,
+                        &Q[entry.local_indices[l] * Q_depth],
+                        Q_depth,
+                        &entry.weights[NDIM * W * l],
+                        &entry.offsets[NDIM * W * l]);
+    }
+    return;
+}
+
+struct InterpolateCXX
+{
+    template <class WeightFcn, typename... Args>
+    static inline void apply(Args&&... args)
+    {
+        interpolate_cxx<WeightFcn>(std::forward<Args>(args)...);
+    }
+};
+
+struct SpreadCXX
+{
+    template <class WeightFcn, typename... Args>
+    static inline void apply(Args&&... args)
+    {
+        spread_cxx<WeightFcn>(std::forward<Args>(args)...);
+    }
+};
+
+struct BuildStencilsCXX
+{
+    template <class WeightFcn, typename... Args>
+    static inline void apply(Args&&... args)
+    {
+        build_stencils_cxx<WeightFcn>(std::forward<Args>(args)...);
+    }
+};
+
+struct InterpolateCached
+{
+    template <int W, typename... Args>
+    static inline void apply(Args&&... args)
+    {
+        interpolate_cached<W>(std::forward<Args>(args)...);
+    }
+};
+
+struct SpreadCached
+{
+    template <int W, typename... Args>
+    static inline void apply(Args&&... args)
+    {
+        spread_cached<W>(std::forward<Args>(args)...);
+    }
+};
+
+// Whether or not an interaction kernel has a templated C++ implementation.
+inline bool
+has_cxx_implementation(const KernelType kernel)
+{
+    switch (kernel)
+    {
+    case IB_4:
+    case IB_6:
+    case BSPLINE_3:
+    case BSPLINE_4:
+    case BSPLINE_5:
+    case BSPLINE_6:
+        return true;
+    case USER_DEFINED:
+        return LEInteractor::s_kernel_fcn_stencil_size >= 1 && LEInteractor::s_kernel_fcn_stencil_size <= 8;
+    default:
+        return false;
+    }
+}
+
+// Dispatch to the templated C++ implementation of an interaction kernel. The
+// return value indicates whether or not such an implementation exists; if it
+// does not, the caller falls back to the Fortran implementation.
+template <class Op, typename... Args>
+bool
+dispatch_cxx(const KernelType kernel, Args&&... args)
+{
+    switch (kernel)
+    {
+    case IB_4:
+        Op::template apply<IB4Weights>(std::forward<Args>(args)...);
+        return true;
+    case IB_6:
+        Op::template apply<IB6Weights>(std::forward<Args>(args)...);
+        return true;
+    case BSPLINE_3:
+        Op::template apply<BSpline3Weights>(std::forward<Args>(args)...);
+        return true;
+    case BSPLINE_4:
+        Op::template apply<BSpline4Weights>(std::forward<Args>(args)...);
+        return true;
+    case BSPLINE_5:
+        Op::template apply<BSpline5Weights>(std::forward<Args>(args)...);
+        return true;
+    case BSPLINE_6:
+        Op::template apply<BSpline6Weights>(std::forward<Args>(args)...);
+        return true;
+    case USER_DEFINED:
+        switch (LEInteractor::s_kernel_fcn_stencil_size)
+        {
+        case 1:
+            Op::template apply<UserDefinedWeights<1> >(std::forward<Args>(args)...);
+            return true;
+        case 2:
+            Op::template apply<UserDefinedWeights<2> >(std::forward<Args>(args)...);
+            return true;
+        case 3:
+            Op::template apply<UserDefinedWeights<3> >(std::forward<Args>(args)...);
+            return true;
+        case 4:
+            Op::template apply<UserDefinedWeights<4> >(std::forward<Args>(args)...);
+            return true;
+        case 5:
+            Op::template apply<UserDefinedWeights<5> >(std::forward<Args>(args)...);
+            return true;
+        case 6:
+            Op::template apply<UserDefinedWeights<6> >(std::forward<Args>(args)...);
+            return true;
+        case 7:
+            Op::template apply<UserDefinedWeights<7> >(std::forward<Args>(args)...);
+            return true;
+        case 8:
+            Op::template apply<UserDefinedWeights<8> >(std::forward<Args>(args)...);
+            return true;
+        default:
+            return false;
+        }
+    default:
+        return false;
+    }
+}
+
+// Dispatch on the stencil width of a set of precomputed stencils.
+template <class Op, typename... Args>
+void
+dispatch_stencil_width(const int stencil_width, Args&&... args)
+{
+    switch (stencil_width)
+    {
+    case 1:
+        Op::template apply<1>(std::forward<Args>(args)...);
+        break;
+    case 2:
+        Op::template apply<2>(std::forward<Args>(args)...);
+        break;
+    case 3:
+        Op::template apply<3>(std::forward<Args>(args)...);
+        break;
+    case 4:
+        Op::template apply<4>(std::forward<Args>(args)...);
+        break;
+    case 5:
+        Op::template apply<5>(std::forward<Args>(args)...);
+        break;
+    case 6:
+        Op::template apply<6>(std::forward<Args>(args)...);
+        break;
+    case 7:
+        Op::template apply<7>(std::forward<Args>(args)...);
+        break;
+    case 8:
+        Op::template apply<8>(std::forward<Args>(args)...);
+        break;
+    default:
+        TBOX_ERROR("LEInteractor: unsupported cached stencil width " << stencil_width << std::endl);
+    }
+    return;
+}
+
+// Bin points into slabs, normal to the last coordinate axis, that are slab_width
+// cells wide. On return, order lists the points sorted by slab and
+// colored_ranges[c] holds the ranges [begin, end) of order that make up the
+// slabs of color c (the slab index parity). Points keep their original order
+// within each slab. X_slab[k] is the coordinate of point k along the slab axis.
+void
+color_slabs(const std::vector<double>& X_slab,
+            const double x_lower,
+            const double dx,
+            const int slab_width,
+            std::vector<int>& order,
+            std::array<std::vector<std::pair<int, int> >, 2>& colored_ranges)
+{
+    const int num_points = static_cast<int>(X_slab.size());
+    std::vector<std::pair<int, int> > slab_and_position(num_points);
+    for (int k = 0; k < num_points; ++k)
+    {
+        const auto ic = static_cast<int>(std::floor((X_slab[k] - x_lower) / dx));
+        const int slab = ic >= 0 ? ic / slab_width : -((-ic - 1) / slab_width) - 1;
+        slab_and_position[k] = std::make_pair(slab, k);
+    }
+    std::sort(slab_and_position.begin(), slab_and_position.end());
+
+    order.resize(num_points);
+    for (auto& ranges : colored_ranges) ranges.clear();
+    for (int k = 0; k < num_points; ++k)
+    {
+        const int slab = slab_and_position[k].first;
+        order[k] = slab_and_position[k].second;
+        auto& ranges = colored_ranges[(slab % 2 + 2) % 2];
+        if (k == 0 || slab != slab_and_position[k - 1].first) ranges.emplace_back(k, k);
+        ++ranges.back().second;
+    }
+    return;
+}
+
+// Find the precomputed stencils of a set of points in a weight cache, computing
+// them if the cached ones are missing or stale (i.e., if the points, their
+// positions, the kernel, or the patch data layout have changed). Returns
+// nullptr unless the C++ kernel backend is selected and the kernel has a C++
+// implementation, since only those weights are cached.
+LEInteractor::WeightCache::Entry*
+get_cached_weights(LEInteractor::WeightCache& cache,
+                   const int axis,
+                   const Box<NDIM>& q_data_box,
+                   const IntVector<NDIM>& q_gcw,
+                   const double* const x_lower,
+                   const double* const dx,
+                   const double* const X_data,
+                   const std::vector<int>& local_indices,
+                   const std::vector<double>& periodic_shifts,
+                   const std::string& kernel_fcn)
+{
+    const KernelType kernel = string_to_kernel(kernel_fcn);
+    if (LEInteractor::s_kernel_backend != CXX_KERNEL_BACKEND || !has_cxx_implementation(kernel)) return nullptr;
+
+    LEInteractor::WeightCache::Entry& entry = cache.entries[axis];
+    const int num_local_indices = static_cast<int>(local_indices.size());
+    bool valid = entry.stencil_width > 0 && entry.kernel_fcn == kernel_fcn && entry.q_data_box == q_data_box &&
+                 entry.q_gcw == q_gcw && entry.local_indices == local_indices;
+    for (unsigned int d = 0; valid && d < NDIM; ++d)
+    {
+        valid = entry.x_lower[d] == x_lower[d] && entry.dx[d] == dx[d];
+    }
+    for (int l = 0; valid && l < num_local_indices; ++l)
+    {
+        for (unsigned int d = 0; valid && d < NDIM; ++d)
+        {
+            valid = entry.X[NDIM * l + d] == X_data[NDIM * local_indices[l] + d] + periodic_shifts[NDIM * l + d];
+        }
+    }
+    if (valid) return &entry;
+
+    entry.kernel_fcn = kernel_fcn;
+    entry.slab_order.clear();
+    entry.q_data_box = q_data_box;
+    entry.q_gcw = q_gcw;
+    entry.local_indices = local_indices;
+    entry.X.resize(NDIM * num_local_indices);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        entry.x_lower[d] = x_lower[d];
+        entry.dx[d] = dx[d];
+    }
+    for (int l = 0; l < num_local_indices; ++l)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            entry.X[NDIM * l + d] = X_data[NDIM * local_indices[l] + d] + periodic_shifts[NDIM * l + d];
+        }
+    }
+    dispatch_cxx<BuildStencilsCXX>(kernel, entry, X_data, periodic_shifts.data());
+    return &entry;
+}
 } // namespace
 
 double (*LEInteractor::s_kernel_fcn)(double r) = &ib4_kernel_fcn;
 int LEInteractor::s_kernel_fcn_stencil_size = 4;
+int LEInteractor::s_num_threads = 1;
+int LEInteractor::s_min_threaded_batch_size = 1024;
+LEInteractorKernelBackend LEInteractor::s_kernel_backend = FORTRAN_KERNEL_BACKEND;
+LEInteractorSummationOrder LEInteractor::s_spread_summation_order = SLAB_SUMMATION_ORDER;
+LEInteractor::WeightCache* LEInteractor::s_weight_cache = nullptr;
+
+void
+LEInteractor::setFromDatabase(Pointer<Database> db)
+{
+    if (!db) return;
+    s_num_threads = db->getIntegerWithDefault("num_threads", s_num_threads);
+    s_min_threaded_batch_size = db->getIntegerWithDefault("min_threaded_batch_size", s_min_threaded_batch_size);
+    if (s_num_threads < 1)
+    {
+        TBOX_ERROR("LEInteractor::setFromDatabase():\n"
+                   << "  num_threads must be positive (got " << s_num_threads << ")" << std::endl);
+    }
+    if (db->keyExists("kernel_backend"))
+    {
+        s_kernel_backend = string_to_enum<LEInteractorKernelBackend>(db->getString("kernel_backend"));
+        if (s_kernel_backend == UNKNOWN_KERNEL_BACKEND)
+        {
+            TBOX_ERROR("LEInteractor::setFromDatabase():\n"
+                       << "  unknown kernel_backend " << db->getString("kernel_backend") << "\n"
+                       << "  valid choices are: FORTRAN, CXX" << std::endl);
+        }
+    }
+    if (db->keyExists("spread_summation_order"))
+    {
+        s_spread_summation_order =
+            string_to_enum<LEInteractorSummationOrder>(db->getString("spread_summation_order"));
+        if (s_spread_summation_order == UNKNOWN_SUMMATION_ORDER)
+        {
+            TBOX_ERROR("LEInteractor::setFromDatabase():\n"
+                       << "  unknown spread_summation_order " << db->getString("spread_summation_order") << "\n"
+                       << "  valid choices are: SLAB, INPUT" << std::endl);
+        }
+    }
+    return;
+}
 
-void LEInteractor::setFromDatabase(Pointer<Database> /*db*/)
+void
+LEInteractor::setWeightCache(WeightCache* const weight_cache)
 {
-    // intentionally blank
+    s_weight_cache = weight_cache;
     return;
 }
 
@@ -1583,6 +2346,10 @@ void
 LEInteractor::printClassData(std::ostream& os)
 {
     os << "LEInteractor::printClassData():\n";
+    os << "  s_num_threads = " << s_num_threads << "\n";
+    os << "  s_min_threaded_batch_size = " << s_min_threaded_batch_size << "\n";
+    os << "  s_kernel_backend = " << enum_to_string(s_kernel_backend) << "\n";
+    os << "  s_spread_summation_order = " << enum_to_string(s_spread_summation_order) << "\n";
     return;
 }
 
@@ -4003,7 +4770,104 @@ LEInteractor::interpolate(double* const Q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
+    const WeightCache::Entry* const cached_weights =
+        s_weight_cache ?
+            get_cached_weights(
+                *s_weight_cache, axis, q_data_box, q_gcw, x_lower, dx, X_data, local_indices, periodic_shifts, interp_fcn) :
+            nullptr;
+    if (cached_weights)
+    {
+        const int num_tasks = local_indices_size < s_min_threaded_batch_size ? 1 : s_num_threads;
+        const int chunk_size = (local_indices_size + num_tasks - 1) / num_tasks;
+        ThreadPool::run(num_tasks, num_tasks, [&](const int chunk) {
+            const int begin = chunk * chunk_size;
+            const int end = std::min(begin + chunk_size, local_indices_size);
+            if (begin >= end) return;
+            dispatch_stencil_width<InterpolateCached>(
+                cached_weights->stencil_width, Q_data, Q_depth, q_data, *cached_weights, begin, end);
+        });
+        return;
+    }
+    if (s_num_threads <= 1 || local_indices_size < s_min_threaded_batch_size)
+    {
+        interpolateBatch(Q_data,
+                         Q_depth,
+                         X_data,
+                         q_data,
+                         q_data_box,
+                         q_gcw,
+                         q_depth,
+                         x_lower,
+                         x_upper,
+                         dx,
+                         local_indices.data(),
+                         periodic_shifts.data(),
+                         local_indices_size,
+                         interp_fcn,
+                         axis);
+        return;
+    }
+
+    // Each Lagrangian point only writes to its own entries of Q_data, so
+    // contiguous chunks of the index list may be processed concurrently.
+    const int chunk_size = (local_indices_size + s_num_threads - 1) / s_num_threads;
+    ThreadPool::run(s_num_threads, s_num_threads, [&](const int chunk) {
+        const int begin = chunk * chunk_size;
+        const int end = std::min(begin + chunk_size, local_indices_size);
+        if (begin >= end) return;
+        interpolateBatch(Q_data,
+                         Q_depth,
+                         X_data,
+                         q_data,
+                         q_data_box,
+                         q_gcw,
+                         q_depth,
+                         x_lower,
+                         x_upper,
+                         dx,
+                         &local_indices[begin],
+                         &periodic_shifts[NDIM * begin],
+                         end - begin,
+                         interp_fcn,
+                         axis);
+    });
+    return;
+}
+
+void
+LEInteractor::interpolateBatch(double* const Q_data,
+                               const int Q_depth,
+                               const double* const X_data,
+                               const double* const q_data,
+                               const Box<NDIM>& q_data_box,
+                               const IntVector<NDIM>& q_gcw,
+                               const int q_depth,
+                               const double* const x_lower,
+                               const double* const x_upper,
+                               const double* const dx,
+                               const int* const local_indices,
+                               const double* const periodic_shifts,
+                               const int local_indices_size,
+                               const std::string& interp_fcn,
+                               const int axis)
+{
     const IntVector<NDIM>& ilower = q_data_box.lower();
+    if (s_kernel_backend == CXX_KERNEL_BACKEND &&
+        dispatch_cxx<InterpolateCXX>(string_to_kernel(interp_fcn),
+                                     Q_data,
+                                     Q_depth,
+                                     X_data,
+                                     q_data,
+                                     q_data_box,
+                                     q_gcw,
+                                     x_lower,
+                                     dx,
+                                     local_indices,
+                                     periodic_shifts,
+                                     local_indices_size))
+    {
+        return;
+    }
     const IntVector<NDIM>& iupper = q_data_box.upper();
     switch (string_to_kernel(interp_fcn))
     {
@@ -4033,8 +4897,8 @@ LEInteractor::interpolate(double* const Q_data,
                                                 q_gcw(2),
 #endif
                                                 q_data,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
+                                                local_indices,
+                                                periodic_shifts,
                                                 local_indices_size,
                                                 X_data,
                                                 Q_data);
@@ -4067,8 +4931,8 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
+                                                  local_indices,
+                                                  periodic_shifts,
                                                   local_indices_size,
                                                   X_data,
                                                   Q_data);
@@ -4100,8 +4964,8 @@ LEInteractor::interpolate(double* const Q_data,
                                               q_gcw(2),
 #endif
                                               q_data,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
+                                              local_indices,
+                                              periodic_shifts,
                                               local_indices_size,
                                               X_data,
                                               Q_data);
@@ -4133,8 +4997,8 @@ LEInteractor::interpolate(double* const Q_data,
                                              q_gcw(2),
 #endif
                                              q_data,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
+                                             local_indices,
+                                             periodic_shifts,
                                              local_indices_size,
                                              X_data,
                                              Q_data);
@@ -4166,8 +5030,8 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  local_indices,
+                                  periodic_shifts,
                                   local_indices_size,
                                   X_data,
                                   Q_data);
@@ -4199,8 +5063,8 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  local_indices,
+                                  periodic_shifts,
                                   local_indices_size,
                                   X_data,
                                   Q_data);
@@ -4232,8 +5096,8 @@ LEInteractor::interpolate(double* const Q_data,
                                      q_gcw(2),
 #endif
                                      q_data,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
+                                     local_indices,
+                                     periodic_shifts,
                                      local_indices_size,
                                      X_data,
                                      Q_data);
@@ -4265,8 +5129,8 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  local_indices,
+                                  periodic_shifts,
                                   local_indices_size,
                                   X_data,
                                   Q_data);
@@ -4298,8 +5162,8 @@ LEInteractor::interpolate(double* const Q_data,
                                   q_gcw(2),
 #endif
                                   q_data,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  local_indices,
+                                  periodic_shifts,
                                   local_indices_size,
                                   X_data,
                                   Q_data);
@@ -4331,8 +5195,8 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       local_indices,
+                                       periodic_shifts,
                                        local_indices_size,
                                        X_data,
                                        Q_data);
@@ -4364,8 +5228,8 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       local_indices,
+                                       periodic_shifts,
                                        local_indices_size,
                                        X_data,
                                        Q_data);
@@ -4397,8 +5261,8 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       local_indices,
+                                       periodic_shifts,
                                        local_indices_size,
                                        X_data,
                                        Q_data);
@@ -4430,8 +5294,8 @@ LEInteractor::interpolate(double* const Q_data,
                                        q_gcw(2),
 #endif
                                        q_data,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       local_indices,
+                                       periodic_shifts,
                                        local_indices_size,
                                        X_data,
                                        Q_data);
@@ -4464,8 +5328,8 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
+                                                  local_indices,
+                                                  periodic_shifts,
                                                   local_indices_size,
                                                   X_data,
                                                   Q_data);
@@ -4498,8 +5362,8 @@ LEInteractor::interpolate(double* const Q_data,
                                                   q_gcw(2),
 #endif
                                                   q_data,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
+                                                  local_indices,
+                                                  periodic_shifts,
                                                   local_indices_size,
                                                   X_data,
                                                   Q_data);
@@ -4517,8 +5381,8 @@ LEInteractor::interpolate(double* const Q_data,
                                x_lower,
                                x_upper,
                                dx,
-                               &local_indices[0],
-                               &periodic_shifts[0],
+                               local_indices,
+                               periodic_shifts,
                                local_indices_size);
         break;
     }
@@ -4567,7 +5431,156 @@ LEInteractor::spread(double* const q_data,
     }
     if (local_indices.empty()) return;
     const int local_indices_size = static_cast<int>(local_indices.size());
+    WeightCache::Entry* const cached_weights =
+        s_weight_cache ?
+            get_cached_weights(
+                *s_weight_cache, axis, q_data_box, q_gcw, x_lower, dx, X_data, local_indices, periodic_shifts, spread_fcn) :
+            nullptr;
+    const bool use_threads = s_num_threads > 1 && local_indices_size >= s_min_threaded_batch_size &&
+                             s_spread_summation_order == SLAB_SUMMATION_ORDER;
+
+    // Stencils of points in two different slabs of the same color never
+    // overlap when the slabs are twice as wide as the minimum ghost cell width
+    // (i.e., wider than the kernel stencil), so all slabs of one color may be
+    // spread concurrently without write conflicts. Keeping the original order
+    // of the points within each slab makes the summation order (and hence the
+    // result) independent of the number of threads.
+    static const unsigned int slab_axis = NDIM - 1;
+    const int slab_width = 2 * min_ghosts;
+    if (cached_weights)
+    {
+        if (!use_threads)
+        {
+            dispatch_stencil_width<SpreadCached>(cached_weights->stencil_width,
+                                                 q_data,
+                                                 Q_data,
+                                                 Q_depth,
+                                                 *cached_weights,
+                                                 nullptr,
+                                                 0,
+                                                 local_indices_size);
+            return;
+        }
+        if (cached_weights->slab_order.empty())
+        {
+            std::vector<double> X_slab(local_indices_size);
+            for (int k = 0; k < local_indices_size; ++k) X_slab[k] = cached_weights->X[NDIM * k + slab_axis];
+            color_slabs(X_slab,
+                        x_lower[slab_axis],
+                        dx[slab_axis],
+                        slab_width,
+                        cached_weights->slab_order,
+                        cached_weights->slab_ranges);
+        }
+        for (const auto& ranges : cached_weights->slab_ranges)
+        {
+            ThreadPool::run(static_cast<int>(ranges.size()), s_num_threads, [&](const int r) {
+                dispatch_stencil_width<SpreadCached>(cached_weights->stencil_width,
+                                                     q_data,
+                                                     Q_data,
+                                                     Q_depth,
+                                                     *cached_weights,
+                                                     cached_weights->slab_order.data(),
+                                                     ranges[r].first,
+                                                     ranges[r].second);
+            });
+        }
+        return;
+    }
+    if (!use_threads)
+    {
+        spreadBatch(q_data,
+                    q_data_box,
+                    q_gcw,
+                    q_depth,
+                    Q_data,
+                    Q_depth,
+                    X_data,
+                    x_lower,
+                    x_upper,
+                    dx,
+                    local_indices.data(),
+                    periodic_shifts.data(),
+                    local_indices_size,
+                    spread_fcn,
+                    axis);
+        return;
+    }
+
+    std::vector<double> X_slab(local_indices_size);
+    for (int k = 0; k < local_indices_size; ++k)
+    {
+        X_slab[k] = X_data[NDIM * local_indices[k] + slab_axis] + periodic_shifts[NDIM * k + slab_axis];
+    }
+    std::vector<int> order;
+    std::array<std::vector<std::pair<int, int> >, 2> colored_ranges;
+    color_slabs(X_slab, x_lower[slab_axis], dx[slab_axis], slab_width, order, colored_ranges);
+    std::vector<int> sorted_indices(local_indices_size);
+    std::vector<double> sorted_shifts(NDIM * local_indices_size);
+    for (int k = 0; k < local_indices_size; ++k)
+    {
+        sorted_indices[k] = local_indices[order[k]];
+        for (unsigned int d = 0; d < NDIM; ++d) sorted_shifts[NDIM * k + d] = periodic_shifts[NDIM * order[k] + d];
+    }
+
+    for (const auto& ranges : colored_ranges)
+    {
+        ThreadPool::run(static_cast<int>(ranges.size()), s_num_threads, [&](const int r) {
+            const int begin = ranges[r].first;
+            const int end = ranges[r].second;
+            spreadBatch(q_data,
+                        q_data_box,
+                        q_gcw,
+                        q_depth,
+                        Q_data,
+                        Q_depth,
+                        X_data,
+                        x_lower,
+                        x_upper,
+                        dx,
+                        &sorted_indices[begin],
+                        &sorted_shifts[NDIM * begin],
+                        end - begin,
+                        spread_fcn,
+                        axis);
+        });
+    }
+    return;
+}
+
+void
+LEInteractor::spreadBatch(double* const q_data,
+                          const Box<NDIM>& q_data_box,
+                          const IntVector<NDIM>& q_gcw,
+                          const int q_depth,
+                          const double* const Q_data,
+                          const int Q_depth,
+                          const double* const X_data,
+                          const double* const x_lower,
+                          const double* const x_upper,
+                          const double* const dx,
+                          const int* const local_indices,
+                          const double* const periodic_shifts,
+                          const int local_indices_size,
+                          const std::string& spread_fcn,
+                          const int axis)
+{
     const IntVector<NDIM>& ilower = q_data_box.lower();
+    if (s_kernel_backend == CXX_KERNEL_BACKEND && dispatch_cxx<SpreadCXX>(string_to_kernel(spread_fcn),
+                                                                          q_data,
+                                                                          q_data_box,
+                                                                          q_gcw,
+                                                                          x_lower,
+                                                                          dx,
+                                                                          Q_data,
+                                                                          Q_depth,
+                                                                          X_data,
+                                                                          local_indices,
+                                                                          periodic_shifts,
+                                                                          local_indices_size))
+    {
+        return;
+    }
     const IntVector<NDIM>& iupper = q_data_box.upper();
     switch (string_to_kernel(spread_fcn))
     {
@@ -4577,8 +5590,8 @@ LEInteractor::spread(double* const q_data,
                                                 x_lower,
                                                 x_upper,
                                                 q_depth,
-                                                &local_indices[0],
-                                                &periodic_shifts[0],
+                                                local_indices,
+                                                periodic_shifts,
                                                 local_indices_size,
                                                 X_data,
                                                 Q_data,
@@ -4611,8 +5624,8 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
+                                                  local_indices,
+                                                  periodic_shifts,
                                                   local_indices_size,
                                                   X_data,
                                                   Q_data,
@@ -4644,8 +5657,8 @@ LEInteractor::spread(double* const q_data,
                                               x_lower,
                                               x_upper,
                                               q_depth,
-                                              &local_indices[0],
-                                              &periodic_shifts[0],
+                                              local_indices,
+                                              periodic_shifts,
                                               local_indices_size,
                                               X_data,
                                               Q_data,
@@ -4677,8 +5690,8 @@ LEInteractor::spread(double* const q_data,
                                              x_lower,
                                              x_upper,
                                              q_depth,
-                                             &local_indices[0],
-                                             &periodic_shifts[0],
+                                             local_indices,
+                                             periodic_shifts,
                                              local_indices_size,
                                              X_data,
                                              Q_data,
@@ -4710,8 +5723,8 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  local_indices,
+                                  periodic_shifts,
                                   local_indices_size,
                                   X_data,
                                   Q_data,
@@ -4743,8 +5756,8 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  local_indices,
+                                  periodic_shifts,
                                   local_indices_size,
                                   X_data,
                                   Q_data,
@@ -4776,8 +5789,8 @@ LEInteractor::spread(double* const q_data,
                                      x_lower,
                                      x_upper,
                                      q_depth,
-                                     &local_indices[0],
-                                     &periodic_shifts[0],
+                                     local_indices,
+                                     periodic_shifts,
                                      local_indices_size,
                                      X_data,
                                      Q_data,
@@ -4809,8 +5822,8 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  local_indices,
+                                  periodic_shifts,
                                   local_indices_size,
                                   X_data,
                                   Q_data,
@@ -4842,8 +5855,8 @@ LEInteractor::spread(double* const q_data,
                                   x_lower,
                                   x_upper,
                                   q_depth,
-                                  &local_indices[0],
-                                  &periodic_shifts[0],
+                                  local_indices,
+                                  periodic_shifts,
                                   local_indices_size,
                                   X_data,
                                   Q_data,
@@ -4875,8 +5888,8 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       local_indices,
+                                       periodic_shifts,
                                        local_indices_size,
                                        X_data,
                                        Q_data,
@@ -4908,8 +5921,8 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       local_indices,
+                                       periodic_shifts,
                                        local_indices_size,
                                        X_data,
                                        Q_data,
@@ -4941,8 +5954,8 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       local_indices,
+                                       periodic_shifts,
                                        local_indices_size,
                                        X_data,
                                        Q_data,
@@ -4974,8 +5987,8 @@ LEInteractor::spread(double* const q_data,
                                        x_lower,
                                        x_upper,
                                        q_depth,
-                                       &local_indices[0],
-                                       &periodic_shifts[0],
+                                       local_indices,
+                                       periodic_shifts,
                                        local_indices_size,
                                        X_data,
                                        Q_data,
@@ -5008,8 +6021,8 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
+                                                  local_indices,
+                                                  periodic_shifts,
                                                   local_indices_size,
                                                   X_data,
                                                   Q_data,
@@ -5042,8 +6055,8 @@ LEInteractor::spread(double* const q_data,
                                                   x_upper,
                                                   q_depth,
                                                   axis,
-                                                  &local_indices[0],
-                                                  &periodic_shifts[0],
+                                                  local_indices,
+                                                  periodic_shifts,
                                                   local_indices_size,
                                                   X_data,
                                                   Q_data,
@@ -5082,8 +6095,8 @@ LEInteractor::spread(double* const q_data,
                           Q_data,
                           Q_depth,
                           X_data,
-                          &local_indices[0],
-                          &periodic_shifts[0],
+                          local_indices,
+                          periodic_shifts,
                           local_indices_size);
         break;
     }
@@ -16,16 +16,22 @@
 #include "ibtk/LIndexSetData.h"
 #include "ibtk/LNode.h"
 #include "ibtk/LNodeIndex.h"
+#include "ibtk/LNodeTransferBuffer.h"
 #include "ibtk/LSet.h"
 #include "ibtk/LSetData.h"
 
 #include "Box.h"
+#include "BoxList.h"
+#include "BoxOverlap.h"
 #include "CartesianPatchGeometry.h"
 #include "CellIndex.h"
+#include "CellOverlap.h"
 #include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
+#include "tbox/AbstractStream.h"
 #include "tbox/Pointer.h"
+#include "tbox/Utilities.h"
 
 #include <algorithm>
 #include <array>
@@ -139,10 +145,66 @@ LIndexSetData<T>::cacheLocalIndices(Pointer<Patch<NDIM> > patch, const IntVector
     return;
 } // cacheLocalIndices
 
+template <class T>
+int
+LIndexSetData<T>::getDataStreamSize(const BoxOverlap<NDIM>& overlap) const
+{
+    LNodeTransferBuffer transfer_buffer;
+    gatherOverlapNodes(transfer_buffer, overlap);
+    return static_cast<int>(transfer_buffer.getDataStreamSize());
+} // getDataStreamSize
+
+template <class T>
+void
+LIndexSetData<T>::packStream(AbstractStream& stream, const BoxOverlap<NDIM>& overlap) const
+{
+    LNodeTransferBuffer transfer_buffer;
+    gatherOverlapNodes(transfer_buffer, overlap);
+    transfer_buffer.packStream(stream);
+    return;
+} // packStream
+
+template <class T>
+void
+LIndexSetData<T>::unpackStream(AbstractStream& stream, const BoxOverlap<NDIM>& overlap)
+{
+    auto const t_overlap = dynamic_cast<const CellOverlap<NDIM>*>(&overlap);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(t_overlap);
+#endif
+    const IntVector<NDIM>& src_offset = t_overlap->getSourceOffset();
+    for (BoxList<NDIM>::Iterator b(t_overlap->getDestinationBoxList()); b; b++)
+    {
+        this->removeInsideIndices(b());
+    }
+    LNodeTransferBuffer transfer_buffer;
+    transfer_buffer.unpackStream(stream, src_offset);
+    transfer_buffer.scatterNodes(*this, src_offset);
+    return;
+} // unpackStream
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+template <class T>
+void
+LIndexSetData<T>::gatherOverlapNodes(LNodeTransferBuffer& transfer_buffer, const BoxOverlap<NDIM>& overlap) const
+{
+    auto const t_overlap = dynamic_cast<const CellOverlap<NDIM>*>(&overlap);
+#if !defined(NDEBUG)
+    TBOX_ASSERT(t_overlap);
+#endif
+    const IntVector<NDIM>& src_offset = t_overlap->getSourceOffset();
+    for (BoxList<NDIM>::Iterator b(t_overlap->getDestinationBoxList()); b; b++)
+    {
+        Box<NDIM> src_box = b();
+        src_box.shift(-src_offset);
+        transfer_buffer.gatherNodes(*this, src_box);
+    }
+    return;
+} // gatherOverlapNodes
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
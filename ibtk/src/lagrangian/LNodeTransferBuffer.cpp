@@ -0,0 +1,343 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/LNode.h"
+#include "ibtk/LNodeIndex.h"
+#include "ibtk/LNodeTransferBuffer.h"
+#include "ibtk/LSet.h"
+#include "ibtk/LSetData.h"
+#include "ibtk/Streamable.h"
+#include "ibtk/StreamableManager.h"
+#include "ibtk/ibtk_utilities.h"
+
+#include "Box.h"
+#include "Index.h"
+#include "IntVector.h"
+#include "tbox/AbstractStream.h"
+#include "tbox/Pointer.h"
+
+#include <vector>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+template <typename U>
+inline void
+pack_array(AbstractStream& stream, const std::vector<U>& data)
+{
+    if (!data.empty()) stream.pack(data.data(), static_cast<int>(data.size()));
+    return;
+} // pack_array
+
+template <typename U>
+inline void
+unpack_array(AbstractStream& stream, std::vector<U>& data, const std::size_t size)
+{
+    data.resize(size);
+    if (!data.empty()) stream.unpack(data.data(), static_cast<int>(data.size()));
+    return;
+} // unpack_array
+
+inline void
+append_node_data(const LNodeIndex& /*node*/, std::vector<Pointer<Streamable> >& /*node_data*/)
+{
+    // intentionally blank
+    return;
+} // append_node_data
+
+inline void
+append_node_data(const LNode& node, std::vector<Pointer<Streamable> >& node_data)
+{
+    const std::vector<Pointer<Streamable> >& data = node.getNodeData();
+    node_data.insert(node_data.end(), data.begin(), data.end());
+    return;
+} // append_node_data
+
+template <class T>
+T* create_node(int lag_idx,
+               int global_petsc_idx,
+               int local_petsc_idx,
+               const IntVector<NDIM>& offset_0,
+               const IntVector<NDIM>& offset,
+               const Vector& displacement_0,
+               const Vector& displacement,
+               std::vector<Pointer<Streamable> >::const_iterator node_data_begin,
+               std::vector<Pointer<Streamable> >::const_iterator node_data_end);
+
+template <>
+inline LNodeIndex*
+create_node<LNodeIndex>(const int lag_idx,
+                        const int global_petsc_idx,
+                        const int local_petsc_idx,
+                        const IntVector<NDIM>& offset_0,
+                        const IntVector<NDIM>& offset,
+                        const Vector& displacement_0,
+                        const Vector& displacement,
+                        std::vector<Pointer<Streamable> >::const_iterator /*node_data_begin*/,
+                        std::vector<Pointer<Streamable> >::const_iterator /*node_data_end*/)
+{
+    return new LNodeIndex(lag_idx, global_petsc_idx, local_petsc_idx, offset_0, offset, displacement_0, displacement);
+} // create_node
+
+template <>
+inline LNode*
+create_node<LNode>(const int lag_idx,
+                   const int global_petsc_idx,
+                   const int local_petsc_idx,
+                   const IntVector<NDIM>& offset_0,
+                   const IntVector<NDIM>& offset,
+                   const Vector& displacement_0,
+                   const Vector& displacement,
+                   std::vector<Pointer<Streamable> >::const_iterator node_data_begin,
+                   std::vector<Pointer<Streamable> >::const_iterator node_data_end)
+{
+    return new LNode(lag_idx,
+                     global_petsc_idx,
+                     local_petsc_idx,
+                     offset_0,
+                     offset,
+                     displacement_0,
+                     displacement,
+                     std::vector<Pointer<Streamable> >(node_data_begin, node_data_end));
+} // create_node
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+LNodeTransferBuffer::LNodeTransferBuffer() : d_bin_offsets(1, 0), d_node_data_offsets(1, 0)
+{
+    // intentionally blank
+    return;
+} // LNodeTransferBuffer
+
+void
+LNodeTransferBuffer::clear()
+{
+    d_cell_idxs.clear();
+    d_bin_offsets.assign(1, 0);
+    d_lag_idxs.clear();
+    d_global_petsc_idxs.clear();
+    d_local_petsc_idxs.clear();
+    d_periodic_offsets_0.clear();
+    d_periodic_offsets.clear();
+    d_periodic_displacements_0.clear();
+    d_periodic_displacements.clear();
+    d_node_data_offsets.assign(1, 0);
+    d_node_data.clear();
+    return;
+} // clear
+
+template <class T>
+void
+LNodeTransferBuffer::gatherNodes(const LSetData<T>& data, const Box<NDIM>& box)
+{
+    const Box<NDIM> gather_box = box * data.getGhostBox();
+    for (Box<NDIM>::Iterator b(gather_box); b; b++)
+    {
+        const hier::Index<NDIM>& i = b();
+        const LSet<T>* const node_set = data.getItem(i);
+        if (!node_set || node_set->empty()) continue;
+        for (unsigned int d = 0; d < NDIM; ++d) d_cell_idxs.push_back(i(d));
+        for (const auto& node : *node_set)
+        {
+            d_lag_idxs.push_back(node->getLagrangianIndex());
+            d_global_petsc_idxs.push_back(node->getGlobalPETScIndex());
+            d_local_petsc_idxs.push_back(node->getLocalPETScIndex());
+            const IntVector<NDIM>& offset_0 = node->getInitialPeriodicOffset();
+            const IntVector<NDIM>& offset = node->getPeriodicOffset();
+            const Vector& displacement_0 = node->getInitialPeriodicDisplacement();
+            const Vector& displacement = node->getPeriodicDisplacement();
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                d_periodic_offsets_0.push_back(offset_0(d));
+                d_periodic_offsets.push_back(offset(d));
+                d_periodic_displacements_0.push_back(displacement_0[d]);
+                d_periodic_displacements.push_back(displacement[d]);
+            }
+            append_node_data(*node, d_node_data);
+            d_node_data_offsets.push_back(static_cast<int>(d_node_data.size()));
+        }
+        d_bin_offsets.push_back(static_cast<int>(d_lag_idxs.size()));
+    }
+    return;
+} // gatherNodes
+
+template <class T>
+void
+LNodeTransferBuffer::scatterNodes(LSetData<T>& data, const IntVector<NDIM>& offset) const
+{
+    IntVector<NDIM> offset_0, periodic_offset;
+    Vector displacement_0, displacement;
+    for (std::size_t bin = 0; bin < getNumberOfBins(); ++bin)
+    {
+        const hier::Index<NDIM> i = getCellIndex(bin) + offset;
+        auto node_set = new LSet<T>();
+        node_set->setPeriodicOffset(offset);
+        for (int k = d_bin_offsets[bin]; k < d_bin_offsets[bin + 1]; ++k)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                offset_0(d) = d_periodic_offsets_0[NDIM * k + d];
+                periodic_offset(d) = d_periodic_offsets[NDIM * k + d];
+                displacement_0[d] = d_periodic_displacements_0[NDIM * k + d];
+                displacement[d] = d_periodic_displacements[NDIM * k + d];
+            }
+            const typename LSet<T>::value_type node(create_node<T>(d_lag_idxs[k],
+                                                                   d_global_petsc_idxs[k],
+                                                                   d_local_petsc_idxs[k],
+                                                                   offset_0,
+                                                                   periodic_offset,
+                                                                   displacement_0,
+                                                                   displacement,
+                                                                   d_node_data.begin() + d_node_data_offsets[k],
+                                                                   d_node_data.begin() + d_node_data_offsets[k + 1]));
+            node_set->push_back(node);
+        }
+        if (data.isElement(i)) data.removeItem(i);
+        data.appendItemPointer(i, node_set);
+    }
+    return;
+} // scatterNodes
+
+std::size_t
+LNodeTransferBuffer::getNumberOfBins() const
+{
+    return d_bin_offsets.size() - 1;
+} // getNumberOfBins
+
+std::size_t
+LNodeTransferBuffer::getNumberOfNodes() const
+{
+    return d_lag_idxs.size();
+} // getNumberOfNodes
+
+hier::Index<NDIM>
+LNodeTransferBuffer::getCellIndex(const std::size_t bin) const
+{
+    hier::Index<NDIM> i;
+    for (unsigned int d = 0; d < NDIM; ++d) i(d) = d_cell_idxs[NDIM * bin + d];
+    return i;
+} // getCellIndex
+
+const std::vector<int>&
+LNodeTransferBuffer::getBinOffsets() const
+{
+    return d_bin_offsets;
+} // getBinOffsets
+
+const std::vector<int>&
+LNodeTransferBuffer::getLagrangianIndices() const
+{
+    return d_lag_idxs;
+} // getLagrangianIndices
+
+const std::vector<int>&
+LNodeTransferBuffer::getGlobalPETScIndices() const
+{
+    return d_global_petsc_idxs;
+} // getGlobalPETScIndices
+
+const std::vector<int>&
+LNodeTransferBuffer::getLocalPETScIndices() const
+{
+    return d_local_petsc_idxs;
+} // getLocalPETScIndices
+
+std::size_t
+LNodeTransferBuffer::getDataStreamSize() const
+{
+    const std::size_t num_bins = getNumberOfBins();
+    const std::size_t num_nodes = getNumberOfNodes();
+    const std::size_t num_ints = 3 + (NDIM + 1) * num_bins + (3 + 2 * NDIM + 1) * num_nodes;
+    const std::size_t num_doubles = 2 * NDIM * num_nodes;
+    std::size_t size = num_ints * AbstractStream::sizeofInt() + num_doubles * AbstractStream::sizeofDouble();
+    StreamableManager* const streamable_manager = StreamableManager::getManager();
+    for (const auto& data_item : d_node_data) size += streamable_manager->getDataStreamSize(data_item);
+    return size;
+} // getDataStreamSize
+
+void
+LNodeTransferBuffer::packStream(AbstractStream& stream) const
+{
+    const int num_bins = static_cast<int>(getNumberOfBins());
+    const int num_nodes = static_cast<int>(getNumberOfNodes());
+    const int num_data_items = static_cast<int>(d_node_data.size());
+    stream.pack(&num_bins, 1);
+    stream.pack(&num_nodes, 1);
+    stream.pack(&num_data_items, 1);
+    pack_array(stream, d_cell_idxs);
+    pack_array(stream, d_bin_offsets);
+    pack_array(stream, d_lag_idxs);
+    pack_array(stream, d_global_petsc_idxs);
+    pack_array(stream, d_local_petsc_idxs);
+    pack_array(stream, d_periodic_offsets_0);
+    pack_array(stream, d_periodic_offsets);
+    pack_array(stream, d_periodic_displacements_0);
+    pack_array(stream, d_periodic_displacements);
+    pack_array(stream, d_node_data_offsets);
+    StreamableManager* const streamable_manager = StreamableManager::getManager();
+    for (const auto& data_item : d_node_data) streamable_manager->packStream(stream, data_item);
+    return;
+} // packStream
+
+void
+LNodeTransferBuffer::unpackStream(AbstractStream& stream, const IntVector<NDIM>& offset)
+{
+    int num_bins, num_nodes, num_data_items;
+    stream.unpack(&num_bins, 1);
+    stream.unpack(&num_nodes, 1);
+    stream.unpack(&num_data_items, 1);
+    unpack_array(stream, d_cell_idxs, NDIM * num_bins);
+    unpack_array(stream, d_bin_offsets, num_bins + 1);
+    unpack_array(stream, d_lag_idxs, num_nodes);
+    unpack_array(stream, d_global_petsc_idxs, num_nodes);
+    unpack_array(stream, d_local_petsc_idxs, num_nodes);
+    unpack_array(stream, d_periodic_offsets_0, NDIM * num_nodes);
+    unpack_array(stream, d_periodic_offsets, NDIM * num_nodes);
+    unpack_array(stream, d_periodic_displacements_0, NDIM * num_nodes);
+    unpack_array(stream, d_periodic_displacements, NDIM * num_nodes);
+    unpack_array(stream, d_node_data_offsets, num_nodes + 1);
+    StreamableManager* const streamable_manager = StreamableManager::getManager();
+    d_node_data.resize(num_data_items);
+    for (auto& data_item : d_node_data) data_item = streamable_manager->unpackStream(stream, offset);
+    return;
+} // unpackStream
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+/////////////////////////////// TEMPLATE INSTANTIATION ///////////////////////
+
+template void IBTK::LNodeTransferBuffer::gatherNodes(const IBTK::LSetData<IBTK::LNode>& data, const Box<NDIM>& box);
+template void IBTK::LNodeTransferBuffer::gatherNodes(const IBTK::LSetData<IBTK::LNodeIndex>& data,
+                                                     const Box<NDIM>& box);
+template void IBTK::LNodeTransferBuffer::scatterNodes(IBTK::LSetData<IBTK::LNode>& data,
+                                                      const IntVector<NDIM>& offset) const;
+template void IBTK::LNodeTransferBuffer::scatterNodes(IBTK::LSetData<IBTK::LNodeIndex>& data,
+                                                      const IntVector<NDIM>& offset) const;
+
+//////////////////////////////////////////////////////////////////////////////
@@ -34,12 +34,19 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <array>
 #include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -58,9 +65,8 @@ namespace IBTK
 
 namespace
 {
-// The rank of the root MPI process and the MPI tag number.
+// The rank of the root MPI process.
 static const int SILO_MPI_ROOT = 0;
-static const int SILO_MPI_TAG = 0;
 
 // The name of the Silo dumps and database filenames.
 static const int SILO_NAME_BUFSIZE = 128;
@@ -70,11 +76,31 @@ static const std::string SILO_SUMMARY_FILE_PREFIX = "lag_data.cycle_";
 static const std::string SILO_SUMMARY_FILE_POSTFIX = ".summary.silo";
 static const std::string SILO_PROCESSOR_FILE_PREFIX = "lag_data.proc_";
 static const std::string SILO_PROCESSOR_FILE_POSTFIX = ".silo";
+static const std::string SILO_PROCESSOR_DIR_PREFIX = "proc_";
 
 // Version of LSiloDataWriter restart file data.
 static const int LAG_SILO_DATA_WRITER_VERSION = 1;
 
+// Silo is not thread safe: all Silo calls made while asynchronous output may
+// be in progress must hold this lock.
+std::mutex s_silo_mutex;
+
+// All LSiloDataWriter objects, any of which may have output in progress.
+std::set<LSiloDataWriter*> s_writers;
+std::mutex s_writers_mutex;
+
 #if defined(IBTK_HAVE_SILO)
+// The functions that write Silo files may be run on a background thread, on
+// which TBOX_ERROR cannot be used to abort.  Errors are instead thrown and
+// reported by the thread that owns the writer.
+#define SILO_WRITE_ERROR(X)                                                                                            \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        std::ostringstream silo_write_error_os;                                                                        \
+        silo_write_error_os << X;                                                                                      \
+        throw std::runtime_error(silo_write_error_os.str());                                                           \
+    } while (0)
+
 /*!
  * \brief Build a local mesh database entry corresponding to a cloud of marker
  * points.
@@ -125,8 +151,8 @@ build_local_marker_cloud(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
-                   << "  Could not set directory " << dirname << std::endl);
+        SILO_WRITE_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
+                         << "  Could not set directory " << dirname << std::endl);
     }
 
     // Write out the variables.
@@ -177,8 +203,8 @@ build_local_marker_cloud(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
-                   << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
+        SILO_WRITE_ERROR("LSiloDataWriter::build_local_marker_cloud()\n"
+                         << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
     }
     return;
 } // build_local_marker_cloud
@@ -288,8 +314,8 @@ build_local_curv_block(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_curv_block()\n"
-                   << "  Could not set directory " << dirname << std::endl);
+        SILO_WRITE_ERROR("LSiloDataWriter::build_local_curv_block()\n"
+                         << "  Could not set directory " << dirname << std::endl);
     }
 
     // Write out the variables.
@@ -377,8 +403,8 @@ build_local_curv_block(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_curv_block()\n"
-                   << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
+        SILO_WRITE_ERROR("LSiloDataWriter::build_local_curv_block()\n"
+                         << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
     }
     return;
 } // build_local_curv_block
@@ -470,8 +496,8 @@ build_local_ucd_mesh(DBfile* dbfile,
     // Set the working directory in the Silo database.
     if (DBSetDir(dbfile, dirname.c_str()) == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
-                   << "  Could not set directory " << dirname << std::endl);
+        SILO_WRITE_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
+                         << "  Could not set directory " << dirname << std::endl);
     }
 
     // Node coordinates.
@@ -594,11 +620,673 @@ build_local_ucd_mesh(DBfile* dbfile,
     // Reset the working directory in the Silo database.
     if (DBSetDir(dbfile, "..") == -1)
     {
-        TBOX_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
-                   << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
+        SILO_WRITE_ERROR("LSiloDataWriter::build_local_ucd_mesh()\n"
+                         << "  Could not return to the base directory from subdirectory " << dirname << std::endl);
     }
     return;
 } // build_local_ucd_mesh
+
+/*!
+ * \brief The plot data of a single patch level on a single MPI process.
+ */
+struct LevelPlotData
+{
+    int level_number = 0;
+    std::vector<double> X;
+    std::vector<std::vector<double> > var_vals;
+    std::vector<int> cloud_nmarks;
+    std::vector<IntVector<NDIM> > block_nelems, block_periodic;
+    std::vector<std::vector<IntVector<NDIM> > > mb_nelems, mb_periodic;
+    std::vector<std::set<int> > ucd_mesh_vertices;
+    std::vector<std::multimap<int, std::pair<int, int> > > ucd_mesh_edge_maps;
+};
+
+/*!
+ * \brief The names of the plot objects of a single patch level on a single MPI
+ * process.
+ */
+struct LevelPlotNames
+{
+    std::vector<std::string> cloud_names, block_names, mb_names, ucd_mesh_names;
+    std::vector<int> mb_nblocks;
+};
+
+/*!
+ * \brief The plot variables of a single patch level.
+ */
+struct LevelPlotVariables
+{
+    std::vector<std::string> names;
+    std::vector<int> start_depths, plot_depths, depths;
+};
+
+/*!
+ * \brief All of the data required by a single MPI process to write a plot
+ * dump.  The file name is empty on processes that do not write a Silo file,
+ * and the summary data are only set on the root MPI process.
+ */
+struct PlotDump
+{
+    std::string object_name;
+    int time_step_number = 0;
+    double simulation_time = 0.0;
+    int procs_per_file = 1;
+    std::vector<LevelPlotVariables> variables;
+
+    std::string file_name;
+    std::vector<std::pair<int, std::vector<LevelPlotData> > > proc_data;
+
+    bool write_summary = false;
+    std::string summary_file_name, visit_dumps_file_name, visit_dumps_entry;
+    std::vector<std::vector<LevelPlotNames> > proc_names;
+};
+
+template <typename T>
+void
+pack_values(std::vector<char>& buf, const T* const vals, const std::size_t n)
+{
+    const std::size_t offset = buf.size();
+    buf.resize(offset + n * sizeof(T));
+    if (n > 0) std::memcpy(buf.data() + offset, vals, n * sizeof(T));
+    return;
+} // pack_values
+
+template <typename T>
+void
+pack_value(std::vector<char>& buf, const T& val)
+{
+    pack_values(buf, &val, 1);
+    return;
+} // pack_value
+
+void
+pack_string(std::vector<char>& buf, const std::string& str)
+{
+    pack_value(buf, str.size());
+    pack_values(buf, str.data(), str.size());
+    return;
+} // pack_string
+
+void
+pack_int_vector(std::vector<char>& buf, const IntVector<NDIM>& vec)
+{
+    for (unsigned int d = 0; d < NDIM; ++d) pack_value(buf, vec(d));
+    return;
+} // pack_int_vector
+
+template <typename T>
+void
+unpack_values(const char*& ptr, T* const vals, const std::size_t n)
+{
+    if (n > 0) std::memcpy(vals, ptr, n * sizeof(T));
+    ptr += n * sizeof(T);
+    return;
+} // unpack_values
+
+template <typename T>
+T
+unpack_value(const char*& ptr)
+{
+    T val;
+    unpack_values(ptr, &val, 1);
+    return val;
+} // unpack_value
+
+std::string
+unpack_string(const char*& ptr)
+{
+    const auto size = unpack_value<std::size_t>(ptr);
+    std::string str(ptr, size);
+    ptr += size;
+    return str;
+} // unpack_string
+
+IntVector<NDIM>
+unpack_int_vector(const char*& ptr)
+{
+    IntVector<NDIM> vec;
+    for (unsigned int d = 0; d < NDIM; ++d) vec(d) = unpack_value<int>(ptr);
+    return vec;
+} // unpack_int_vector
+
+/*!
+ * \brief Serialize the plot data of a single patch level.
+ */
+void
+pack_level_plot_data(std::vector<char>& buf, const LevelPlotData& data)
+{
+    pack_value(buf, data.level_number);
+    pack_value(buf, data.X.size());
+    pack_values(buf, data.X.data(), data.X.size());
+    pack_value(buf, data.var_vals.size());
+    for (const auto& var_vals : data.var_vals)
+    {
+        pack_value(buf, var_vals.size());
+        pack_values(buf, var_vals.data(), var_vals.size());
+    }
+    pack_value(buf, data.cloud_nmarks.size());
+    pack_values(buf, data.cloud_nmarks.data(), data.cloud_nmarks.size());
+    pack_value(buf, data.block_nelems.size());
+    for (std::size_t block = 0; block < data.block_nelems.size(); ++block)
+    {
+        pack_int_vector(buf, data.block_nelems[block]);
+        pack_int_vector(buf, data.block_periodic[block]);
+    }
+    pack_value(buf, data.mb_nelems.size());
+    for (std::size_t mb = 0; mb < data.mb_nelems.size(); ++mb)
+    {
+        pack_value(buf, data.mb_nelems[mb].size());
+        for (std::size_t block = 0; block < data.mb_nelems[mb].size(); ++block)
+        {
+            pack_int_vector(buf, data.mb_nelems[mb][block]);
+            pack_int_vector(buf, data.mb_periodic[mb][block]);
+        }
+    }
+    pack_value(buf, data.ucd_mesh_vertices.size());
+    for (std::size_t mesh = 0; mesh < data.ucd_mesh_vertices.size(); ++mesh)
+    {
+        pack_value(buf, data.ucd_mesh_vertices[mesh].size());
+        for (const int vertex : data.ucd_mesh_vertices[mesh]) pack_value(buf, vertex);
+        pack_value(buf, data.ucd_mesh_edge_maps[mesh].size());
+        for (const auto& edge : data.ucd_mesh_edge_maps[mesh])
+        {
+            const std::array<int, 3> vals = { { edge.first, edge.second.first, edge.second.second } };
+            pack_values(buf, vals.data(), vals.size());
+        }
+    }
+    return;
+} // pack_level_plot_data
+
+/*!
+ * \brief Deserialize the plot data of a single patch level.
+ */
+LevelPlotData
+unpack_level_plot_data(const char*& ptr)
+{
+    LevelPlotData data;
+    data.level_number = unpack_value<int>(ptr);
+    data.X.resize(unpack_value<std::size_t>(ptr));
+    unpack_values(ptr, data.X.data(), data.X.size());
+    data.var_vals.resize(unpack_value<std::size_t>(ptr));
+    for (auto& var_vals : data.var_vals)
+    {
+        var_vals.resize(unpack_value<std::size_t>(ptr));
+        unpack_values(ptr, var_vals.data(), var_vals.size());
+    }
+    data.cloud_nmarks.resize(unpack_value<std::size_t>(ptr));
+    unpack_values(ptr, data.cloud_nmarks.data(), data.cloud_nmarks.size());
+    const auto nblocks = unpack_value<std::size_t>(ptr);
+    for (std::size_t block = 0; block < nblocks; ++block)
+    {
+        data.block_nelems.push_back(unpack_int_vector(ptr));
+        data.block_periodic.push_back(unpack_int_vector(ptr));
+    }
+    const auto nmbs = unpack_value<std::size_t>(ptr);
+    data.mb_nelems.resize(nmbs);
+    data.mb_periodic.resize(nmbs);
+    for (std::size_t mb = 0; mb < nmbs; ++mb)
+    {
+        const auto mb_nblocks = unpack_value<std::size_t>(ptr);
+        for (std::size_t block = 0; block < mb_nblocks; ++block)
+        {
+            data.mb_nelems[mb].push_back(unpack_int_vector(ptr));
+            data.mb_periodic[mb].push_back(unpack_int_vector(ptr));
+        }
+    }
+    const auto nmeshes = unpack_value<std::size_t>(ptr);
+    data.ucd_mesh_vertices.resize(nmeshes);
+    data.ucd_mesh_edge_maps.resize(nmeshes);
+    for (std::size_t mesh = 0; mesh < nmeshes; ++mesh)
+    {
+        const auto nvertices = unpack_value<std::size_t>(ptr);
+        for (std::size_t k = 0; k < nvertices; ++k)
+        {
+            data.ucd_mesh_vertices[mesh].insert(data.ucd_mesh_vertices[mesh].end(), unpack_value<int>(ptr));
+        }
+        const auto nedges = unpack_value<std::size_t>(ptr);
+        for (std::size_t k = 0; k < nedges; ++k)
+        {
+            std::array<int, 3> vals;
+            unpack_values(ptr, vals.data(), vals.size());
+            data.ucd_mesh_edge_maps[mesh].insert(data.ucd_mesh_edge_maps[mesh].end(),
+                                                 std::make_pair(vals[0], std::make_pair(vals[1], vals[2])));
+        }
+    }
+    return data;
+} // unpack_level_plot_data
+
+/*!
+ * \brief Serialize the names of the plot objects of a single patch level.
+ */
+void
+pack_level_plot_names(std::vector<char>& buf, const LevelPlotNames& names)
+{
+    for (const auto* object_names : { &names.cloud_names, &names.block_names, &names.mb_names, &names.ucd_mesh_names })
+    {
+        pack_value(buf, object_names->size());
+        for (const auto& name : *object_names) pack_string(buf, name);
+    }
+    pack_values(buf, names.mb_nblocks.data(), names.mb_nblocks.size());
+    return;
+} // pack_level_plot_names
+
+/*!
+ * \brief Deserialize the names of the plot objects of a single patch level.
+ */
+LevelPlotNames
+unpack_level_plot_names(const char*& ptr)
+{
+    LevelPlotNames names;
+    for (auto* object_names : { &names.cloud_names, &names.block_names, &names.mb_names, &names.ucd_mesh_names })
+    {
+        object_names->resize(unpack_value<std::size_t>(ptr));
+        for (auto& name : *object_names) name = unpack_string(ptr);
+    }
+    names.mb_nblocks.resize(names.mb_names.size());
+    unpack_values(ptr, names.mb_nblocks.data(), names.mb_nblocks.size());
+    return names;
+} // unpack_level_plot_names
+
+/*!
+ * \brief Gather variable-length byte buffers from all processes in the
+ * communicator to the specified root process.  The returned buffers are
+ * indexed by rank and are only set on the root process.
+ */
+std::vector<std::vector<char> >
+gather_bytes(const std::vector<char>& send_buf, const int root, MPI_Comm comm)
+{
+    int rank, nodes;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &nodes);
+    int send_size = static_cast<int>(send_buf.size());
+    std::vector<int> recv_sizes(rank == root ? nodes : 0), recv_displs(rank == root ? nodes : 0);
+    MPI_Gather(&send_size, 1, MPI_INT, recv_sizes.data(), 1, MPI_INT, root, comm);
+    std::vector<char> recv_buf;
+    if (rank == root)
+    {
+        int total_size = 0;
+        for (int proc = 0; proc < nodes; ++proc)
+        {
+            recv_displs[proc] = total_size;
+            total_size += recv_sizes[proc];
+        }
+        recv_buf.resize(total_size);
+    }
+    MPI_Gatherv(const_cast<char*>(send_buf.data()),
+                send_size,
+                MPI_CHAR,
+                recv_buf.data(),
+                recv_sizes.data(),
+                recv_displs.data(),
+                MPI_CHAR,
+                root,
+                comm);
+    std::vector<std::vector<char> > recv_bufs;
+    if (rank == root)
+    {
+        for (int proc = 0; proc < nodes; ++proc)
+        {
+            recv_bufs.emplace_back(recv_buf.begin() + recv_displs[proc],
+                                   recv_buf.begin() + recv_displs[proc] + recv_sizes[proc]);
+        }
+    }
+    return recv_bufs;
+} // gather_bytes
+
+/*!
+ * \brief Return the name of the Silo file that contains the data of the
+ * specified MPI process.
+ */
+std::string
+get_processor_file_name(const int proc, const int procs_per_file)
+{
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc / procs_per_file);
+    return SILO_PROCESSOR_FILE_PREFIX + temp_buf + SILO_PROCESSOR_FILE_POSTFIX;
+} // get_processor_file_name
+
+/*!
+ * \brief Return the directory of the Silo file that contains the data of the
+ * specified MPI process.  When each MPI process writes its own file, data are
+ * stored in the top-level directory of the file.
+ */
+std::string
+get_processor_dir_name(const int proc, const int procs_per_file)
+{
+    if (procs_per_file == 1) return "";
+    char temp_buf[SILO_NAME_BUFSIZE];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
+    return SILO_PROCESSOR_DIR_PREFIX + temp_buf + "/";
+} // get_processor_dir_name
+
+/*!
+ * \brief Write the plot data of a single patch level on a single MPI process
+ * to the present directory of a Silo database.
+ */
+void
+write_level_plot_data(DBfile* dbfile,
+                      const LevelPlotData& data,
+                      const LevelPlotVariables& variables,
+                      const int time_step_number,
+                      const double simulation_time)
+{
+    const int ln = data.level_number;
+    const auto nvars = static_cast<int>(variables.names.size());
+
+    // Keep track of the current offset in the local data.
+    int offset = 0;
+    auto get_var_vals = [&]() {
+        std::vector<const double*> var_vals(nvars);
+        for (int v = 0; v < nvars; ++v)
+        {
+            var_vals[v] = data.var_vals[v].data() + variables.depths[v] * offset;
+        }
+        return var_vals;
+    };
+    auto make_dir = [&](const std::string& dirname) {
+        if (DBMkDir(dbfile, dirname.c_str()) == -1)
+        {
+            SILO_WRITE_ERROR("LSiloDataWriter::writePlotData()\n"
+                             << "  Could not create directory named " << dirname << std::endl);
+        }
+    };
+
+    // Add the local clouds to the DBfile.
+    for (std::size_t cloud = 0; cloud < data.cloud_nmarks.size(); ++cloud)
+    {
+        const int nmarks = data.cloud_nmarks[cloud];
+        std::string dirname = "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud);
+        make_dir(dirname);
+        build_local_marker_cloud(dbfile,
+                                 dirname,
+                                 nmarks,
+                                 data.X.data() + NDIM * offset,
+                                 nvars,
+                                 variables.names,
+                                 variables.start_depths,
+                                 variables.plot_depths,
+                                 variables.depths,
+                                 get_var_vals(),
+                                 time_step_number,
+                                 simulation_time);
+        offset += nmarks;
+    }
+
+    // Add the local blocks to the DBfile.
+    for (std::size_t block = 0; block < data.block_nelems.size(); ++block)
+    {
+        const IntVector<NDIM>& nelem = data.block_nelems[block];
+        std::string dirname = "level_" + std::to_string(ln) + "_block_" + std::to_string(block);
+        make_dir(dirname);
+        build_local_curv_block(dbfile,
+                               dirname,
+                               nelem,
+                               data.block_periodic[block],
+                               data.X.data() + NDIM * offset,
+                               nvars,
+                               variables.names,
+                               variables.start_depths,
+                               variables.plot_depths,
+                               variables.depths,
+                               get_var_vals(),
+                               time_step_number,
+                               simulation_time);
+        offset += nelem.getProduct();
+    }
+
+    // Add the local multiblocks to the DBfile.
+    for (std::size_t mb = 0; mb < data.mb_nelems.size(); ++mb)
+    {
+        for (std::size_t block = 0; block < data.mb_nelems[mb].size(); ++block)
+        {
+            const IntVector<NDIM>& nelem = data.mb_nelems[mb][block];
+            std::string dirname =
+                "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
+            make_dir(dirname);
+            build_local_curv_block(dbfile,
+                                   dirname,
+                                   nelem,
+                                   data.mb_periodic[mb][block],
+                                   data.X.data() + NDIM * offset,
+                                   nvars,
+                                   variables.names,
+                                   variables.start_depths,
+                                   variables.plot_depths,
+                                   variables.depths,
+                                   get_var_vals(),
+                                   time_step_number,
+                                   simulation_time);
+            offset += nelem.getProduct();
+        }
+    }
+
+    // Add the local UCD meshes to the DBfile.
+    for (std::size_t mesh = 0; mesh < data.ucd_mesh_vertices.size(); ++mesh)
+    {
+        const std::set<int>& vertices = data.ucd_mesh_vertices[mesh];
+        std::string dirname = "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh);
+        make_dir(dirname);
+        build_local_ucd_mesh(dbfile,
+                             dirname,
+                             vertices,
+                             data.ucd_mesh_edge_maps[mesh],
+                             data.X.data() + NDIM * offset,
+                             nvars,
+                             variables.names,
+                             variables.start_depths,
+                             variables.plot_depths,
+                             variables.depths,
+                             get_var_vals(),
+                             time_step_number,
+                             simulation_time);
+        offset += static_cast<int>(vertices.size());
+    }
+    return;
+} // write_level_plot_data
+
+/*!
+ * \brief Write the multimesh and multivar summary file and update the VisIt
+ * dumps file.
+ */
+void
+write_summary_file(const PlotDump& dump)
+{
+    DBfile* dbfile;
+    if (!(dbfile = DBCreate(dump.summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+    {
+        SILO_WRITE_ERROR(dump.object_name << "::writePlotData()\n"
+                                          << "  Could not create DBfile named " << dump.summary_file_name << std::endl);
+    }
+
+    int cycle = dump.time_step_number;
+    auto time = static_cast<float>(dump.simulation_time);
+    double dtime = dump.simulation_time;
+
+    static const int MAX_OPTS = 3;
+    DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
+    DBAddOption(optlist, DBOPT_CYCLE, &cycle);
+    DBAddOption(optlist, DBOPT_TIME, &time);
+    DBAddOption(optlist, DBOPT_DTIME, &dtime);
+
+    auto make_dir = [&](const std::string& dirname) {
+        if (DBMkDir(dbfile, dirname.c_str()) == -1)
+        {
+            SILO_WRITE_ERROR(dump.object_name << "::writePlotData()\n"
+                                              << "  Could not create directory named " << dirname << std::endl);
+        }
+    };
+
+    const auto mpi_nodes = static_cast<int>(dump.proc_names.size());
+    for (int proc = 0; proc < mpi_nodes; ++proc)
+    {
+        const std::string path_prefix = get_processor_file_name(proc, dump.procs_per_file) + ":" +
+                                        get_processor_dir_name(proc, dump.procs_per_file);
+        for (int ln = 0; ln < static_cast<int>(dump.proc_names[proc].size()); ++ln)
+        {
+            const LevelPlotNames& names = dump.proc_names[proc][ln];
+            const std::string level_prefix = path_prefix + "level_" + std::to_string(ln);
+
+            for (std::size_t cloud = 0; cloud < names.cloud_names.size(); ++cloud)
+            {
+                std::string meshname = level_prefix + "_cloud_" + std::to_string(cloud) + "/mesh";
+                auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                int meshtype = DB_POINTMESH;
+                const std::string& cloud_name = names.cloud_names[cloud];
+                DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+                make_dir(cloud_name);
+            }
+
+            for (std::size_t block = 0; block < names.block_names.size(); ++block)
+            {
+                std::string meshname = level_prefix + "_block_" + std::to_string(block) + "/mesh";
+                auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                int meshtype = DB_QUAD_CURV;
+                const std::string& block_name = names.block_names[block];
+                DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+                make_dir(block_name);
+            }
+
+            for (std::size_t mb = 0; mb < names.mb_names.size(); ++mb)
+            {
+                const int nblocks = names.mb_nblocks[mb];
+                std::vector<std::string> meshnames;
+                for (int block = 0; block < nblocks; ++block)
+                {
+                    meshnames.push_back(level_prefix + "_mb_" + std::to_string(mb) + "_block_" +
+                                        std::to_string(block) + "/mesh");
+                }
+                std::vector<const char*> meshnames_ptrs;
+                for (int block = 0; block < nblocks; ++block)
+                {
+                    meshnames_ptrs.push_back(meshnames[block].c_str());
+                }
+                std::vector<int> meshtypes(nblocks, DB_QUAD_CURV);
+                const std::string& mb_name = names.mb_names[mb];
+                DBPutMultimesh(dbfile, mb_name.c_str(), nblocks, meshnames_ptrs.data(), meshtypes.data(), optlist);
+                make_dir(mb_name);
+            }
+
+            for (std::size_t mesh = 0; mesh < names.ucd_mesh_names.size(); ++mesh)
+            {
+                std::string meshname = level_prefix + "_mesh_" + std::to_string(mesh) + "/mesh";
+                auto meshname_ptr = const_cast<char*>(meshname.c_str());
+                int meshtype = DB_UCDMESH;
+                const std::string& mesh_name = names.ucd_mesh_names[mesh];
+                DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
+                make_dir(mesh_name);
+            }
+
+            for (const std::string& var_name : dump.variables[ln].names)
+            {
+                for (std::size_t cloud = 0; cloud < names.cloud_names.size(); ++cloud)
+                {
+                    std::string varname = level_prefix + "_cloud_" + std::to_string(cloud) + "/" + var_name;
+                    auto varname_ptr = const_cast<char*>(varname.c_str());
+                    int vartype = DB_POINTVAR;
+                    std::string multivar_name = names.cloud_names[cloud] + "/" + var_name;
+                    DBPutMultivar(dbfile, multivar_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                }
+
+                for (std::size_t block = 0; block < names.block_names.size(); ++block)
+                {
+                    std::string varname = level_prefix + "_block_" + std::to_string(block) + "/" + var_name;
+                    auto varname_ptr = const_cast<char*>(varname.c_str());
+                    int vartype = DB_QUADVAR;
+                    std::string multivar_name = names.block_names[block] + "/" + var_name;
+                    DBPutMultivar(dbfile, multivar_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                }
+
+                for (std::size_t mb = 0; mb < names.mb_names.size(); ++mb)
+                {
+                    const int nblocks = names.mb_nblocks[mb];
+                    std::vector<std::string> varnames;
+                    for (int block = 0; block < nblocks; ++block)
+                    {
+                        varnames.push_back(level_prefix + "_mb_" + std::to_string(mb) + "_block_" +
+                                           std::to_string(block) + "/" + var_name);
+                    }
+                    std::vector<const char*> varnames_ptrs;
+                    for (int block = 0; block < nblocks; ++block)
+                    {
+                        varnames_ptrs.push_back(varnames[block].c_str());
+                    }
+                    std::vector<int> vartypes(nblocks, DB_QUADVAR);
+                    std::string multivar_name = names.mb_names[mb] + "/" + var_name;
+                    DBPutMultivar(
+                        dbfile, multivar_name.c_str(), nblocks, varnames_ptrs.data(), vartypes.data(), optlist);
+                }
+
+                for (std::size_t mesh = 0; mesh < names.ucd_mesh_names.size(); ++mesh)
+                {
+                    std::string varname = level_prefix + "_mesh_" + std::to_string(mesh) + "/" + var_name;
+                    auto varname_ptr = const_cast<char*>(varname.c_str());
+                    int vartype = DB_UCDVAR;
+                    std::string multivar_name = names.ucd_mesh_names[mesh] + "/" + var_name;
+                    DBPutMultivar(dbfile, multivar_name.c_str(), 1, &varname_ptr, &vartype, optlist);
+                }
+            }
+        }
+    }
+
+    DBFreeOptlist(optlist);
+    DBClose(dbfile);
+
+    // Create or update the dumps file.
+    static bool summary_file_opened = false;
+    std::ofstream sfile(dump.visit_dumps_file_name.c_str(), summary_file_opened ? std::ios::app : std::ios::out);
+    sfile << dump.visit_dumps_entry << std::endl;
+    sfile.close();
+    summary_file_opened = true;
+    return;
+} // write_summary_file
+
+/*!
+ * \brief Write the Silo files of a plot dump.
+ */
+void
+write_plot_dump(const PlotDump& dump)
+{
+    std::lock_guard<std::mutex> lock(s_silo_mutex);
+    if (!dump.file_name.empty())
+    {
+        DBfile* dbfile;
+        if (!(dbfile = DBCreate(dump.file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+        {
+            SILO_WRITE_ERROR(dump.object_name << "::writePlotData()\n"
+                                              << "  Could not create DBfile named " << dump.file_name << std::endl);
+        }
+        for (const auto& proc_data : dump.proc_data)
+        {
+            std::string dirname = get_processor_dir_name(proc_data.first, dump.procs_per_file);
+            if (!dirname.empty())
+            {
+                dirname.pop_back();
+                if (DBMkDir(dbfile, dirname.c_str()) == -1 || DBSetDir(dbfile, dirname.c_str()) == -1)
+                {
+                    SILO_WRITE_ERROR(dump.object_name << "::writePlotData()\n"
+                                                      << "  Could not create directory named " << dirname << std::endl);
+                }
+            }
+            for (const LevelPlotData& level_data : proc_data.second)
+            {
+                write_level_plot_data(dbfile,
+                                      level_data,
+                                      dump.variables[level_data.level_number],
+                                      dump.time_step_number,
+                                      dump.simulation_time);
+            }
+            if (!dirname.empty() && DBSetDir(dbfile, "..") == -1)
+            {
+                SILO_WRITE_ERROR(dump.object_name << "::writePlotData()\n"
+                                                  << "  Could not return to the base directory from subdirectory "
+                                                  << dirname << std::endl);
+            }
+        }
+        DBClose(dbfile);
+    }
+    if (dump.write_summary) write_summary_file(dump);
+    return;
+} // write_plot_dump
 #endif // if defined(IBTK_HAVE_SILO)
 } // namespace
 
@@ -656,11 +1344,20 @@ LSiloDataWriter::LSiloDataWriter(std::string object_name, std::string dump_direc
     {
         getFromRestart();
     }
+
+    std::lock_guard<std::mutex> lock(s_writers_mutex);
+    s_writers.insert(this);
     return;
 } // LSiloDataWriter
 
 LSiloDataWriter::~LSiloDataWriter()
 {
+    waitForPendingOutput();
+    {
+        std::lock_guard<std::mutex> lock(s_writers_mutex);
+        s_writers.erase(this);
+    }
+
     if (d_registered_for_restart)
     {
         RestartManager::getManager()->unregisterRestartItem(d_object_name);
@@ -1168,6 +1865,23 @@ LSiloDataWriter::registerLagrangianAO(std::vector<AO>& ao, const int coarsest_ln
     return;
 } // registerLagrangianAO
 
+void
+LSiloDataWriter::setNumberOfProcessorsPerFile(const int procs_per_file)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(procs_per_file >= 1);
+#endif
+    d_procs_per_file = procs_per_file;
+    return;
+} // setNumberOfProcessorsPerFile
+
+void
+LSiloDataWriter::setAsynchronousOutput(const bool async_output)
+{
+    d_async_output = async_output;
+    return;
+} // setAsynchronousOutput
+
 void
 LSiloDataWriter::writePlotData(const int time_step_number, const double simulation_time)
 {
@@ -1193,12 +1907,15 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
                                  << "  dump directory name is empty" << std::endl);
     }
 
+    // Wait for any previous dump to be written before starting a new one.
+    waitForPendingOutput();
+
     int ierr;
     char temp_buf[SILO_NAME_BUFSIZE];
-    std::string current_file_name;
-    DBfile* dbfile;
     const int mpi_rank = IBTK_MPI::getRank();
     const int mpi_nodes = IBTK_MPI::getNodes();
+    const int procs_per_file = std::min(d_procs_per_file, mpi_nodes);
+    const int file_number = mpi_rank / procs_per_file;
 
     // Construct the VecScatter objects required to write the plot data.
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
@@ -1217,750 +1934,159 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
 
     Utilities::recursiveMkdir(dump_dirname);
 
-    // Create one local DBfile per MPI process.
-    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", mpi_rank);
-    current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
-    current_file_name += temp_buf;
-    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-    if (!(dbfile = DBCreate(current_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
+    // Set the information that is common to all of the data written in this
+    // dump.
+    auto dump = std::make_shared<PlotDump>();
+    dump->object_name = d_object_name;
+    dump->time_step_number = time_step_number;
+    dump->simulation_time = simulation_time;
+    dump->procs_per_file = procs_per_file;
+    dump->variables.resize(d_finest_ln + 1);
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                 << "  Could not create DBfile named " << current_file_name << std::endl);
+        dump->variables[ln].names = d_var_names[ln];
+        dump->variables[ln].start_depths = d_var_start_depths[ln];
+        dump->variables[ln].plot_depths = d_var_plot_depths[ln];
+        dump->variables[ln].depths = d_var_depths[ln];
     }
 
-    std::vector<std::vector<int> > meshtype(d_finest_ln + 1), vartype(d_finest_ln + 1);
-    std::vector<std::vector<std::vector<int> > > multimeshtype(d_finest_ln + 1), multivartype(d_finest_ln + 1);
-
-    // Set the local data.
+    // Copy the local data into buffers that remain valid until the data are
+    // written.
+    std::vector<LevelPlotData> local_plot_data;
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        if (d_coords_data[ln])
-        {
-            // Scatter the data from "global" to "local" form.
-            Vec local_X_vec;
-            ierr = VecDuplicate(d_dst_vec[ln][NDIM], &local_X_vec);
+        if (!d_coords_data[ln]) continue;
+
+        LevelPlotData data;
+        data.level_number = ln;
+        data.cloud_nmarks = d_cloud_nmarks[ln];
+        data.block_nelems = d_block_nelems[ln];
+        data.block_periodic = d_block_periodic[ln];
+        data.mb_nelems = d_mb_nelems[ln];
+        data.mb_periodic = d_mb_periodic[ln];
+        data.ucd_mesh_vertices = d_ucd_mesh_vertices[ln];
+        data.ucd_mesh_edge_maps = d_ucd_mesh_edge_maps[ln];
+
+        // Scatter the data from "global" to "local" form.
+        auto scatter_to_local = [&](Vec global_vec, const int depth, std::vector<double>& local_vals) {
+            Vec local_vec;
+            ierr = VecDuplicate(d_dst_vec[ln][depth], &local_vec);
             IBTK_CHKERRQ(ierr);
-
-            Vec global_X_vec = d_coords_data[ln]->getVec();
-            ierr = VecScatterBegin(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            ierr = VecScatterBegin(d_vec_scatter[ln][depth], global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-            ierr = VecScatterEnd(d_vec_scatter[ln][NDIM], global_X_vec, local_X_vec, INSERT_VALUES, SCATTER_FORWARD);
+            ierr = VecScatterEnd(d_vec_scatter[ln][depth], global_vec, local_vec, INSERT_VALUES, SCATTER_FORWARD);
             IBTK_CHKERRQ(ierr);
-
-            double* local_X_arr;
-            ierr = VecGetArray(local_X_vec, &local_X_arr);
+            int local_size;
+            ierr = VecGetLocalSize(local_vec, &local_size);
             IBTK_CHKERRQ(ierr);
-
-            std::vector<Vec> local_v_vecs;
-            std::vector<double*> local_v_arrs;
-
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                const int var_depth = d_var_depths[ln][v];
-                Vec local_v_vec;
-                ierr = VecDuplicate(d_dst_vec[ln][var_depth], &local_v_vec);
-                IBTK_CHKERRQ(ierr);
-
-                Vec global_v_vec = d_var_data[ln][v]->getVec();
-                ierr = VecScatterBegin(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecScatterEnd(
-                    d_vec_scatter[ln][var_depth], global_v_vec, local_v_vec, INSERT_VALUES, SCATTER_FORWARD);
-                IBTK_CHKERRQ(ierr);
-
-                double* local_v_arr;
-                ierr = VecGetArray(local_v_vec, &local_v_arr);
-                IBTK_CHKERRQ(ierr);
-
-                local_v_vecs.push_back(local_v_vec);
-                local_v_arrs.push_back(local_v_arr);
-            }
-
-            // Keep track of the current offset in the local Vec data.
-            int offset = 0;
-
-            // Add the local clouds to the local DBfile.
-            for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-            {
-                const int nmarks = d_cloud_nmarks[ln][cloud];
-
-                std::string dirname = "level_" + std::to_string(ln) + "_cloud_" + std::to_string(cloud);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_marker_cloud(dbfile,
-                                         dirname,
-                                         nmarks,
-                                         X,
-                                         d_nvars[ln],
-                                         d_var_names[ln],
-                                         d_var_start_depths[ln],
-                                         d_var_plot_depths[ln],
-                                         d_var_depths[ln],
-                                         var_vals,
-                                         time_step_number,
-                                         simulation_time);
-
-                offset += nmarks;
-            }
-
-            // Add the local blocks to the local DBfile.
-            for (int block = 0; block < d_nblocks[ln]; ++block)
-            {
-                const IntVector<NDIM>& nelem = d_block_nelems[ln][block];
-                const IntVector<NDIM>& periodic = d_block_periodic[ln][block];
-                const int ntot = nelem.getProduct();
-
-                std::string dirname = "level_" + std::to_string(ln) + "_block_" + std::to_string(block);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_curv_block(dbfile,
-                                       dirname,
-                                       nelem,
-                                       periodic,
-                                       X,
-                                       d_nvars[ln],
-                                       d_var_names[ln],
-                                       d_var_start_depths[ln],
-                                       d_var_plot_depths[ln],
-                                       d_var_depths[ln],
-                                       var_vals,
-                                       time_step_number,
-                                       simulation_time);
-                meshtype[ln].push_back(DB_QUAD_CURV);
-                vartype[ln].push_back(DB_QUADVAR);
-
-                offset += ntot;
-            }
-
-            // Add the local multiblocks to the local DBfile.
-            multimeshtype[ln].resize(d_nmbs[ln]);
-            multivartype[ln].resize(d_nmbs[ln]);
-            for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-            {
-                for (int block = 0; block < d_mb_nblocks[ln][mb]; ++block)
-                {
-                    const IntVector<NDIM>& nelem = d_mb_nelems[ln][mb][block];
-                    const IntVector<NDIM>& periodic = d_mb_periodic[ln][mb][block];
-                    const int ntot = nelem.getProduct();
-
-                    std::string dirname =
-                        "level_" + std::to_string(ln) + "_mb_" + std::to_string(mb) + "_block_" + std::to_string(block);
-
-                    if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << dirname << std::endl);
-                    }
-
-                    const double* const X = local_X_arr + NDIM * offset;
-                    std::vector<const double*> var_vals(d_nvars[ln]);
-                    for (int v = 0; v < d_nvars[ln]; ++v)
-                    {
-                        var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                    }
-
-                    build_local_curv_block(dbfile,
-                                           dirname,
-                                           nelem,
-                                           periodic,
-                                           X,
-                                           d_nvars[ln],
-                                           d_var_names[ln],
-                                           d_var_start_depths[ln],
-                                           d_var_plot_depths[ln],
-                                           d_var_depths[ln],
-                                           var_vals,
-                                           time_step_number,
-                                           simulation_time);
-                    multimeshtype[ln][mb].push_back(DB_QUAD_CURV);
-                    multivartype[ln][mb].push_back(DB_QUADVAR);
-
-                    offset += ntot;
-                }
-            }
-
-            // Add the local UCD meshes to the local DBfile.
-            for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-            {
-                const std::set<int>& vertices = d_ucd_mesh_vertices[ln][mesh];
-                const std::multimap<int, std::pair<int, int> >& edge_map = d_ucd_mesh_edge_maps[ln][mesh];
-                const size_t ntot = vertices.size();
-
-                std::string dirname = "level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh);
-
-                if (DBMkDir(dbfile, dirname.c_str()) == -1)
-                {
-                    TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                             << "  Could not create directory named " << dirname << std::endl);
-                }
-
-                const double* const X = local_X_arr + NDIM * offset;
-                std::vector<const double*> var_vals(d_nvars[ln]);
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    var_vals[v] = local_v_arrs[v] + d_var_depths[ln][v] * offset;
-                }
-
-                build_local_ucd_mesh(dbfile,
-                                     dirname,
-                                     vertices,
-                                     edge_map,
-                                     X,
-                                     d_nvars[ln],
-                                     d_var_names[ln],
-                                     d_var_start_depths[ln],
-                                     d_var_plot_depths[ln],
-                                     d_var_depths[ln],
-                                     var_vals,
-                                     time_step_number,
-                                     simulation_time);
-
-                offset += ntot;
-            }
-
-            // Clean up allocated data.
-            ierr = VecRestoreArray(local_X_vec, &local_X_arr);
+            const double* local_arr;
+            ierr = VecGetArrayRead(local_vec, &local_arr);
             IBTK_CHKERRQ(ierr);
-            ierr = VecDestroy(&local_X_vec);
+            local_vals.assign(local_arr, local_arr + local_size);
+            ierr = VecRestoreArrayRead(local_vec, &local_arr);
             IBTK_CHKERRQ(ierr);
-            for (int v = 0; v < d_nvars[ln]; ++v)
-            {
-                ierr = VecRestoreArray(local_v_vecs[v], &local_v_arrs[v]);
-                IBTK_CHKERRQ(ierr);
-                ierr = VecDestroy(&local_v_vecs[v]);
-                IBTK_CHKERRQ(ierr);
-            }
+            ierr = VecDestroy(&local_vec);
+            IBTK_CHKERRQ(ierr);
+        };
+        scatter_to_local(d_coords_data[ln]->getVec(), NDIM, data.X);
+        data.var_vals.resize(d_nvars[ln]);
+        for (int v = 0; v < d_nvars[ln]; ++v)
+        {
+            scatter_to_local(d_var_data[ln][v]->getVec(), d_var_depths[ln][v], data.var_vals[v]);
         }
+        local_plot_data.push_back(std::move(data));
     }
 
-    DBClose(dbfile);
-
-    // Send data to the root MPI process required to create the multimesh and
-    // multivar objects.
-    std::vector<std::vector<int> > nclouds_per_proc, nblocks_per_proc, nmbs_per_proc, nucd_meshes_per_proc;
-    std::vector<std::vector<std::vector<int> > > meshtypes_per_proc, vartypes_per_proc, mb_nblocks_per_proc;
-    std::vector<std::vector<std::vector<std::vector<int> > > > multimeshtypes_per_proc, multivartypes_per_proc;
-    std::vector<std::vector<std::vector<std::string> > > cloud_names_per_proc, block_names_per_proc, mb_names_per_proc,
-        ucd_mesh_names_per_proc;
-
-    if (mpi_rank == SILO_MPI_ROOT)
+    // Collect the plot data of each group of processes on the process that
+    // writes the Silo file for that group.
+    if (procs_per_file == 1)
     {
-        nclouds_per_proc.resize(d_finest_ln + 1);
-        nblocks_per_proc.resize(d_finest_ln + 1);
-        nmbs_per_proc.resize(d_finest_ln + 1);
-        nucd_meshes_per_proc.resize(d_finest_ln + 1);
-        meshtypes_per_proc.resize(d_finest_ln + 1);
-        vartypes_per_proc.resize(d_finest_ln + 1);
-        mb_nblocks_per_proc.resize(d_finest_ln + 1);
-        multimeshtypes_per_proc.resize(d_finest_ln + 1);
-        multivartypes_per_proc.resize(d_finest_ln + 1);
-        cloud_names_per_proc.resize(d_finest_ln + 1);
-        block_names_per_proc.resize(d_finest_ln + 1);
-        mb_names_per_proc.resize(d_finest_ln + 1);
-        ucd_mesh_names_per_proc.resize(d_finest_ln + 1);
+        dump->proc_data.emplace_back(mpi_rank, std::move(local_plot_data));
     }
-
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    else
     {
-        if (mpi_rank == SILO_MPI_ROOT)
-        {
-            nclouds_per_proc[ln].resize(mpi_nodes);
-            nblocks_per_proc[ln].resize(mpi_nodes);
-            nmbs_per_proc[ln].resize(mpi_nodes);
-            nucd_meshes_per_proc[ln].resize(mpi_nodes);
-            meshtypes_per_proc[ln].resize(mpi_nodes);
-            vartypes_per_proc[ln].resize(mpi_nodes);
-            mb_nblocks_per_proc[ln].resize(mpi_nodes);
-            multimeshtypes_per_proc[ln].resize(mpi_nodes);
-            multivartypes_per_proc[ln].resize(mpi_nodes);
-            cloud_names_per_proc[ln].resize(mpi_nodes);
-            block_names_per_proc[ln].resize(mpi_nodes);
-            mb_names_per_proc[ln].resize(mpi_nodes);
-            ucd_mesh_names_per_proc[ln].resize(mpi_nodes);
-
-            // Set the values for the root process.
-            nclouds_per_proc[ln][mpi_rank] = d_nclouds[ln];
-            nblocks_per_proc[ln][mpi_rank] = d_nblocks[ln];
-            nmbs_per_proc[ln][mpi_rank] = d_nmbs[ln];
-            nucd_meshes_per_proc[ln][mpi_rank] = d_nucd_meshes[ln];
-            meshtypes_per_proc[ln][mpi_rank] = meshtype[ln];
-            vartypes_per_proc[ln][mpi_rank] = vartype[ln];
-            mb_nblocks_per_proc[ln][mpi_rank] = d_mb_nblocks[ln];
-            multimeshtypes_per_proc[ln][mpi_rank] = multimeshtype[ln];
-            multivartypes_per_proc[ln][mpi_rank] = multivartype[ln];
-            cloud_names_per_proc[ln][mpi_rank] = d_cloud_names[ln];
-            block_names_per_proc[ln][mpi_rank] = d_block_names[ln];
-            mb_names_per_proc[ln][mpi_rank] = d_mb_names[ln];
-            ucd_mesh_names_per_proc[ln][mpi_rank] = d_ucd_mesh_names[ln];
-        }
-
-        // Get the values for the non-root processes.
-        int one = 1;
-        for (int proc = 0; proc < mpi_nodes; ++proc)
-        {
-            // Skip the root process; we already have those values.
-            if (proc == SILO_MPI_ROOT)
-            {
-                proc += 1;
-                if (proc >= mpi_nodes) break;
-            }
-
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nclouds[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nclouds_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nclouds[ln] > 0)
-            {
-                int num_bytes;
-                for (int cloud = 0; cloud < d_nclouds[ln]; ++cloud)
-                {
-                    num_bytes = static_cast<int>((d_cloud_names[ln][cloud].size() + 1) * sizeof(char));
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    IBTK_MPI::sendBytes(
-                        static_cast<const void*>(d_cloud_names[ln][cloud].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nclouds_per_proc[ln][proc] > 0)
-            {
-                cloud_names_per_proc[ln][proc].resize(nclouds_per_proc[ln][proc]);
-
-                int num_bytes;
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    IBTK_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    cloud_names_per_proc[ln][proc][cloud].assign(name.data());
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nblocks[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nblocks_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nblocks[ln] > 0)
-            {
-                IBTK_MPI::send(&meshtype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-                IBTK_MPI::send(&vartype[ln][0], d_nblocks[ln], SILO_MPI_ROOT, false);
-
-                int num_bytes;
-                for (int block = 0; block < d_nblocks[ln]; ++block)
-                {
-                    num_bytes = static_cast<int>((d_block_names[ln][block].size() + 1) * sizeof(char));
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    IBTK_MPI::sendBytes(
-                        static_cast<const void*>(d_block_names[ln][block].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nblocks_per_proc[ln][proc] > 0)
-            {
-                meshtypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                vartypes_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-                block_names_per_proc[ln][proc].resize(nblocks_per_proc[ln][proc]);
-
-                IBTK_MPI::recv(&meshtypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-                IBTK_MPI::recv(&vartypes_per_proc[ln][proc][0], nblocks_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    IBTK_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    block_names_per_proc[ln][proc][block].assign(name.data());
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nmbs[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nmbs_per_proc[ln][proc], one, proc, false);
-            }
-
-            if (mpi_rank == proc && d_nmbs[ln] > 0)
-            {
-                IBTK_MPI::send(&d_mb_nblocks[ln][0], d_nmbs[ln], SILO_MPI_ROOT, false);
+        std::vector<char> send_buf;
+        pack_value(send_buf, local_plot_data.size());
+        for (const LevelPlotData& data : local_plot_data) pack_level_plot_data(send_buf, data);
+        local_plot_data.clear();
 
-                int num_bytes;
-                for (int mb = 0; mb < d_nmbs[ln]; ++mb)
-                {
-                    IBTK_MPI::send(&multimeshtype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-                    IBTK_MPI::send(&multivartype[ln][mb][0], d_mb_nblocks[ln][mb], SILO_MPI_ROOT, false);
-
-                    num_bytes = static_cast<int>(d_mb_names[ln][mb].size()) + 1;
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-
-                    const void* mb_name_ptr = d_mb_names[ln][mb].c_str();
-                    MPI_Send(const_cast<void*>(mb_name_ptr),
-                             num_bytes,
-                             MPI_CHAR,
-                             SILO_MPI_ROOT,
-                             SILO_MPI_TAG,
-                             IBTK_MPI::getCommunicator());
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nmbs_per_proc[ln][proc] > 0)
-            {
-                mb_nblocks_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multimeshtypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                multivartypes_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-                mb_names_per_proc[ln][proc].resize(nmbs_per_proc[ln][proc]);
-
-                IBTK_MPI::recv(&mb_nblocks_per_proc[ln][proc][0], nmbs_per_proc[ln][proc], proc, false);
-
-                int num_bytes;
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    multimeshtypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-                    multivartypes_per_proc[ln][proc][mb].resize(mb_nblocks_per_proc[ln][proc][mb]);
-
-                    IBTK_MPI::recv(
-                        &multimeshtypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-                    IBTK_MPI::recv(
-                        &multivartypes_per_proc[ln][proc][mb][0], mb_nblocks_per_proc[ln][proc][mb], proc, false);
-
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-
-                    MPI_Status status;
-                    MPI_Recv(
-                        name.data(), num_bytes, MPI_CHAR, proc, SILO_MPI_TAG, IBTK_MPI::getCommunicator(), &status);
-
-                    mb_names_per_proc[ln][proc][mb].assign(name.data());
-                }
-            }
-
-            if (mpi_rank == proc)
-            {
-                IBTK_MPI::send(&d_nucd_meshes[ln], one, SILO_MPI_ROOT, false);
-            }
-            if (mpi_rank == SILO_MPI_ROOT)
-            {
-                IBTK_MPI::recv(&nucd_meshes_per_proc[ln][proc], one, proc, false);
-            }
+        MPI_Comm file_comm;
+        MPI_Comm_split(IBTK_MPI::getCommunicator(), file_number, mpi_rank, &file_comm);
+        const std::vector<std::vector<char> > recv_bufs = gather_bytes(send_buf, 0, file_comm);
+        MPI_Comm_free(&file_comm);
 
-            if (mpi_rank == proc && d_nucd_meshes[ln] > 0)
-            {
-                int num_bytes;
-                for (int mesh = 0; mesh < d_nucd_meshes[ln]; ++mesh)
-                {
-                    num_bytes = static_cast<int>((d_ucd_mesh_names[ln][mesh].size() + 1) * sizeof(char));
-                    IBTK_MPI::send(&num_bytes, one, SILO_MPI_ROOT, false);
-                    IBTK_MPI::sendBytes(
-                        static_cast<const void*>(d_ucd_mesh_names[ln][mesh].c_str()), num_bytes, SILO_MPI_ROOT);
-                }
-            }
-            if (mpi_rank == SILO_MPI_ROOT && nucd_meshes_per_proc[ln][proc] > 0)
-            {
-                ucd_mesh_names_per_proc[ln][proc].resize(nucd_meshes_per_proc[ln][proc]);
-                int num_bytes;
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    IBTK_MPI::recv(&num_bytes, one, proc, false);
-                    std::vector<char> name(num_bytes / sizeof(char));
-                    IBTK_MPI::recvBytes(static_cast<void*>(name.data()), num_bytes);
-                    ucd_mesh_names_per_proc[ln][proc][mesh].assign(name.data());
-                }
-            }
-
-            IBTK_MPI::barrier();
+        for (std::size_t k = 0; k < recv_bufs.size(); ++k)
+        {
+            const char* ptr = recv_bufs[k].data();
+            std::vector<LevelPlotData> proc_plot_data(unpack_value<std::size_t>(ptr));
+            for (auto& data : proc_plot_data) data = unpack_level_plot_data(ptr);
+            dump->proc_data.emplace_back(file_number * procs_per_file + static_cast<int>(k),
+                                         std::move(proc_plot_data));
         }
     }
+    if (mpi_rank % procs_per_file == 0)
+    {
+        dump->file_name = dump_dirname + "/" + get_processor_file_name(mpi_rank, procs_per_file);
+    }
 
+    // Collect the names of the plot objects on the root MPI process, which
+    // writes the multimesh and multivar objects.
+    std::vector<char> names_buf;
+    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
+    {
+        LevelPlotNames names;
+        names.cloud_names = d_cloud_names[ln];
+        names.block_names = d_block_names[ln];
+        names.mb_names = d_mb_names[ln];
+        names.ucd_mesh_names = d_ucd_mesh_names[ln];
+        names.mb_nblocks = d_mb_nblocks[ln];
+        pack_level_plot_names(names_buf, names);
+    }
+    const std::vector<std::vector<char> > proc_names_bufs =
+        gather_bytes(names_buf, SILO_MPI_ROOT, IBTK_MPI::getCommunicator());
     if (mpi_rank == SILO_MPI_ROOT)
     {
-        // Create and initialize the multimesh Silo database on the root MPI
-        // process.
-        std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
-        std::string summary_file_name =
-            dump_dirname + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!(dbfile = DBCreate(summary_file_name.c_str(), DB_CLOBBER, DB_LOCAL, nullptr, DB_PDB)))
-        {
-            TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                     << "  Could not create DBfile named " << summary_file_name << std::endl);
-        }
-
-        int cycle = time_step_number;
-        auto time = static_cast<float>(simulation_time);
-        double dtime = simulation_time;
-
-        static const int MAX_OPTS = 3;
-        DBoptlist* optlist = DBMakeOptlist(MAX_OPTS);
-        DBAddOption(optlist, DBOPT_CYCLE, &cycle);
-        DBAddOption(optlist, DBOPT_TIME, &time);
-        DBAddOption(optlist, DBOPT_DTIME, &dtime);
-
+        dump->write_summary = true;
+        dump->proc_names.resize(mpi_nodes, std::vector<LevelPlotNames>(d_finest_ln + 1));
         for (int proc = 0; proc < mpi_nodes; ++proc)
         {
+            const char* ptr = proc_names_bufs[proc].data();
             for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
             {
-                for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
-                                           std::to_string(cloud) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_POINTMESH;
-
-                    std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
-
-                    DBPutMultimesh(dbfile, cloud_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, cloud_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << cloud_name << std::endl);
-                    }
-                }
-
-                for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
-                                           std::to_string(block) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = meshtypes_per_proc[ln][proc][block];
-
-                    std::string& block_name = block_names_per_proc[ln][proc][block];
-
-                    DBPutMultimesh(dbfile, block_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, block_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << block_name << std::endl);
-                    }
-                }
-
-                for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-                    std::vector<std::string> meshnames;
-                    for (int block = 0; block < nblocks; ++block)
-                    {
-                        meshnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
-                                            std::to_string(mb) + "_block_" + std::to_string(block) + "/mesh");
-                    }
-                    std::vector<const char*> meshnames_ptrs;
-                    for (int block = 0; block < nblocks; ++block)
-                    {
-                        meshnames_ptrs.push_back(meshnames[block].c_str());
-                    }
-
-                    std::string& mb_name = mb_names_per_proc[ln][proc][mb];
-
-                    DBPutMultimesh(dbfile,
-                                   mb_name.c_str(),
-                                   nblocks,
-                                   meshnames_ptrs.data(),
-                                   &multimeshtypes_per_proc[ln][proc][mb][0],
-                                   optlist);
-
-                    if (DBMkDir(dbfile, mb_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << mb_name << std::endl);
-                    }
-                }
-
-                for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                {
-                    std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                    current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                    current_file_name += temp_buf;
-                    current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                    std::string meshname =
-                        current_file_name + ":level_" + std::to_string(ln) + "_mesh_" + std::to_string(mesh) + "/mesh";
-                    auto meshname_ptr = const_cast<char*>(meshname.c_str());
-                    int meshtype = DB_UCDMESH;
-
-                    std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
-
-                    DBPutMultimesh(dbfile, mesh_name.c_str(), 1, &meshname_ptr, &meshtype, optlist);
-
-                    if (DBMkDir(dbfile, mesh_name.c_str()) == -1)
-                    {
-                        TBOX_ERROR(d_object_name << "::writePlotData()\n"
-                                                 << "  Could not create directory named " << mesh_name << std::endl);
-                    }
-                }
-
-                for (int v = 0; v < d_nvars[ln]; ++v)
-                {
-                    for (int cloud = 0; cloud < nclouds_per_proc[ln][proc]; ++cloud)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_cloud_" +
-                                              std::to_string(cloud) + "/" + d_var_names[ln][v];
-                        auto varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_POINTVAR;
-
-                        std::string& cloud_name = cloud_names_per_proc[ln][proc][cloud];
-
-                        std::string var_name = cloud_name + "/" + d_var_names[ln][v];
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-
-                    for (int block = 0; block < nblocks_per_proc[ln][proc]; ++block)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_block_" +
-                                              std::to_string(block) + "/" + d_var_names[ln][v];
-                        auto varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = vartypes_per_proc[ln][proc][block];
-
-                        std::string& block_name = block_names_per_proc[ln][proc][block];
-
-                        std::string var_name = block_name + "/" + d_var_names[ln][v];
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-
-                    for (int mb = 0; mb < nmbs_per_proc[ln][proc]; ++mb)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        const int nblocks = mb_nblocks_per_proc[ln][proc][mb];
-
-                        std::vector<std::string> varnames;
-                        for (int block = 0; block < nblocks; ++block)
-                        {
-                            varnames.push_back(current_file_name + ":level_" + std::to_string(ln) + "_mb_" +
-                                               std::to_string(mb) + "_block_" + std::to_string(block) +
-                                               d_var_names[ln][v]);
-                        }
-                        std::vector<const char*> varnames_ptrs;
-                        for (int block = 0; block < nblocks; ++block)
-                        {
-                            varnames_ptrs.push_back(varnames[block].c_str());
-                        }
-
-                        std::string& mb_name = mb_names_per_proc[ln][proc][mb];
-
-                        std::string var_name = mb_name + "/" + d_var_names[ln][v];
-
-                        DBPutMultivar(dbfile,
-                                      var_name.c_str(),
-                                      nblocks,
-                                      varnames_ptrs.data(),
-                                      &multivartypes_per_proc[ln][proc][mb][0],
-                                      optlist);
-                    }
-
-                    for (int mesh = 0; mesh < nucd_meshes_per_proc[ln][proc]; ++mesh)
-                    {
-                        std::snprintf(temp_buf, sizeof(temp_buf), "%04d", proc);
-                        current_file_name = SILO_PROCESSOR_FILE_PREFIX;
-                        current_file_name += temp_buf;
-                        current_file_name += SILO_PROCESSOR_FILE_POSTFIX;
-
-                        std::string varname = current_file_name + ":level_" + std::to_string(ln) + "_mesh_" +
-                                              std::to_string(mesh) + "/" + d_var_names[ln][v];
-                        auto varname_ptr = const_cast<char*>(varname.c_str());
-                        int vartype = DB_UCDVAR;
-
-                        std::string& mesh_name = ucd_mesh_names_per_proc[ln][proc][mesh];
-
-                        std::string var_name = mesh_name + "/" + d_var_names[ln][v];
-
-                        DBPutMultivar(dbfile, var_name.c_str(), 1, &varname_ptr, &vartype, optlist);
-                    }
-                }
+                dump->proc_names[proc][ln] = unpack_level_plot_names(ptr);
             }
         }
-
-        DBFreeOptlist(optlist);
-        DBClose(dbfile);
-
-        // Create or update the dumps file on the root MPI process.
-        static bool summary_file_opened = false;
-        std::string path = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
         std::snprintf(temp_buf, sizeof(temp_buf), "%06d", d_time_step_number);
-        std::string file =
-            current_dump_directory_name + "/" + SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
-        if (!summary_file_opened)
+        const std::string summary_file_name = SILO_SUMMARY_FILE_PREFIX + temp_buf + SILO_SUMMARY_FILE_POSTFIX;
+        dump->summary_file_name = dump_dirname + "/" + summary_file_name;
+        dump->visit_dumps_file_name = d_dump_directory_name + "/" + VISIT_DUMPS_FILENAME;
+        dump->visit_dumps_entry = current_dump_directory_name + "/" + summary_file_name;
+    }
+
+    // Write the data, either now or in the background.  Errors are reported by
+    // waitForPendingOutput().
+    auto write_dump = [this, dump]() {
+        try
         {
-            summary_file_opened = true;
-            std::ofstream sfile(path.c_str(), std::ios::out);
-            sfile << file << std::endl;
-            sfile.close();
+            write_plot_dump(*dump);
         }
-        else
+        catch (...)
         {
-            std::ofstream sfile(path.c_str(), std::ios::app);
-            sfile << file << std::endl;
-            sfile.close();
+            d_output_exception = std::current_exception();
         }
+    };
+    if (d_async_output)
+    {
+        d_output_thread = std::thread(write_dump);
+    }
+    else
+    {
+        write_dump();
+        waitForPendingOutput();
+        IBTK_MPI::barrier();
     }
-    IBTK_MPI::barrier();
 #else
     NULL_USE(SILO_MPI_ROOT);
-    NULL_USE(SILO_MPI_TAG);
     NULL_USE(SILO_NAME_BUFSIZE);
     NULL_USE(d_time_step_number);
     NULL_USE(time_step_number);
@@ -1970,6 +2096,40 @@ LSiloDataWriter::writePlotData(const int time_step_number, const double simulati
     return;
 } // writePlotData
 
+void
+LSiloDataWriter::waitForPendingOutput()
+{
+    if (d_output_thread.joinable()) d_output_thread.join();
+    if (d_output_exception)
+    {
+        std::exception_ptr exception = d_output_exception;
+        d_output_exception = nullptr;
+        try
+        {
+            std::rethrow_exception(exception);
+        }
+        catch (const std::exception& e)
+        {
+            TBOX_ERROR(e.what());
+        }
+    }
+    return;
+} // waitForPendingOutput
+
+void
+LSiloDataWriter::waitForAllPendingOutput()
+{
+    std::lock_guard<std::mutex> lock(s_writers_mutex);
+    for (LSiloDataWriter* writer : s_writers) writer->waitForPendingOutput();
+    return;
+} // waitForAllPendingOutput
+
+std::mutex&
+LSiloDataWriter::getSiloMutex()
+{
+    return s_silo_mutex;
+} // getSiloMutex
+
 void
 LSiloDataWriter::putToDatabase(Pointer<Database> db)
 {
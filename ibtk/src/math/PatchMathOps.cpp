@@ -41,6 +41,7 @@
 #define LAPLACE_ADD_FC IBTK_FC_FUNC(laplaceadd2d, LAPLACEADD2D)
 #define DAMPED_LAPLACE_FC IBTK_FC_FUNC(dampedlaplace2d, DAMPEDLAPLACE2D)
 #define DAMPED_LAPLACE_ADD_FC IBTK_FC_FUNC(dampedlaplaceadd2d, DAMPEDLAPLACEADD2D)
+#define S_TO_S_DAMPED_LAPLACE_GRAD_FC IBTK_FC_FUNC(stosdampedlaplacegrad2d, STOSDAMPEDLAPLACEGRAD2D)
 
 #define MULTIPLY1_FC IBTK_FC_FUNC(multiply12d, MULTIPLY12D)
 #define MULTIPLY_ADD1_FC IBTK_FC_FUNC(multiplyadd12d, MULTIPLYADD12D)
@@ -117,6 +118,7 @@
 #define LAPLACE_ADD_FC IBTK_FC_FUNC(laplaceadd3d, LAPLACEADD3D)
 #define DAMPED_LAPLACE_FC IBTK_FC_FUNC(dampedlaplace3d, DAMPEDLAPLACE3D)
 #define DAMPED_LAPLACE_ADD_FC IBTK_FC_FUNC(dampedlaplaceadd3d, DAMPEDLAPLACEADD3D)
+#define S_TO_S_DAMPED_LAPLACE_GRAD_FC IBTK_FC_FUNC(stosdampedlaplacegrad3d, STOSDAMPEDLAPLACEGRAD3D)
 
 #define MULTIPLY1_FC IBTK_FC_FUNC(multiply13d, MULTIPLY13D)
 #define MULTIPLY_ADD1_FC IBTK_FC_FUNC(multiplyadd13d, MULTIPLYADD13D)
@@ -263,6 +265,33 @@ extern "C"
 #endif
                                const double* dx);
 
+    void S_TO_S_DAMPED_LAPLACE_GRAD_FC(double* F0,
+                                       double* F1,
+#if (NDIM == 3)
+                                       double* F2,
+#endif
+                                       const int& F_gcw,
+                                       const double& alpha,
+                                       const double& beta,
+                                       const double* U0,
+                                       const double* U1,
+#if (NDIM == 3)
+                                       const double* U2,
+#endif
+                                       const int& U_gcw,
+                                       const double& gamma,
+                                       const double* P,
+                                       const int& P_gcw,
+                                       const int& ilower0,
+                                       const int& iupper0,
+                                       const int& ilower1,
+                                       const int& iupper1,
+#if (NDIM == 3)
+                                       const int& ilower2,
+                                       const int& iupper2,
+#endif
+                                       const double* dx);
+
     void C_TO_C_CURL_FC(double* W,
                         const int& W_gcw,
                         const double* U,
@@ -5404,6 +5433,129 @@ PatchMathOps::laplace(Pointer<SideData<NDIM, double> > dst,
     return;
 } // laplace
 
+void
+PatchMathOps::laplaceGrad(Pointer<SideData<NDIM, double> > dst,
+                          const double alpha,
+                          const double beta,
+                          const Pointer<SideData<NDIM, double> > src1,
+                          const double gamma,
+                          const Pointer<CellData<NDIM, double> > src2,
+                          const Pointer<Patch<NDIM> > patch,
+                          const int m) const
+{
+    const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const double* const dx = pgeom->getDx();
+
+    std::array<double*, NDIM> F;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        F[d] = dst->getPointer(d);
+    }
+    const int F_ghosts = (dst->getGhostCellWidth()).max();
+
+    std::array<const double*, NDIM> U;
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        U[d] = src1->getPointer(d);
+    }
+    const int U_ghosts = (src1->getGhostCellWidth()).max();
+
+    const double* const P = src2->getPointer(m);
+    const int P_ghosts = (src2->getGhostCellWidth()).max();
+
+    const Box<NDIM>& patch_box = patch->getBox();
+
+#if !defined(NDEBUG)
+    if (F_ghosts != (dst->getGhostCellWidth()).min())
+    {
+        TBOX_ERROR("PatchMathOps::laplaceGrad():\n"
+                   << "  dst does not have uniform ghost cell widths" << std::endl);
+    }
+
+    if (U_ghosts != (src1->getGhostCellWidth()).min())
+    {
+        TBOX_ERROR("PatchMathOps::laplaceGrad():\n"
+                   << "  src1 does not have uniform ghost cell widths" << std::endl);
+    }
+
+    if (P_ghosts != (src2->getGhostCellWidth()).min())
+    {
+        TBOX_ERROR("PatchMathOps::laplaceGrad():\n"
+                   << "  src2 does not have uniform ghost cell widths" << std::endl);
+    }
+
+    if (src1 == dst)
+    {
+        TBOX_ERROR("PatchMathOps::laplaceGrad():\n"
+                   << "  src1 == dst." << std::endl);
+    }
+
+    const Box<NDIM>& U_box = src1->getGhostBox();
+    const Box<NDIM> U_box_shrunk = Box<NDIM>::grow(U_box, -1);
+
+    if ((!U_box_shrunk.contains(patch_box.lower())) || (!U_box_shrunk.contains(patch_box.upper())))
+    {
+        TBOX_ERROR("PatchMathOps::laplaceGrad():\n"
+                   << "  src1 has insufficient ghost cell width" << std::endl);
+    }
+
+    const Box<NDIM>& P_box = src2->getGhostBox();
+    const Box<NDIM> P_box_shrunk = Box<NDIM>::grow(P_box, -1);
+
+    if ((!P_box_shrunk.contains(patch_box.lower())) || (!P_box_shrunk.contains(patch_box.upper())))
+    {
+        TBOX_ERROR("PatchMathOps::laplaceGrad():\n"
+                   << "  src2 has insufficient ghost cell width" << std::endl);
+    }
+
+    if (patch_box != dst->getBox())
+    {
+        TBOX_ERROR("PatchMathOps::laplaceGrad():\n"
+                   << "  dst, src1, and src2 must all live on the same patch" << std::endl);
+    }
+
+    if (patch_box != src1->getBox())
+    {
+        TBOX_ERROR("PatchMathOps::laplaceGrad():\n"
+                   << "  dst, src1, and src2 must all live on the same patch" << std::endl);
+    }
+
+    if (patch_box != src2->getBox())
+    {
+        TBOX_ERROR("PatchMathOps::laplaceGrad():\n"
+                   << "  dst, src1, and src2 must all live on the same patch" << std::endl);
+    }
+#endif
+
+    S_TO_S_DAMPED_LAPLACE_GRAD_FC(F[0],
+                                  F[1],
+#if (NDIM == 3)
+                                  F[2],
+#endif
+                                  F_ghosts,
+                                  alpha,
+                                  beta,
+                                  U[0],
+                                  U[1],
+#if (NDIM == 3)
+                                  U[2],
+#endif
+                                  U_ghosts,
+                                  gamma,
+                                  P,
+                                  P_ghosts,
+                                  patch_box.lower(0),
+                                  patch_box.upper(0),
+                                  patch_box.lower(1),
+                                  patch_box.upper(1),
+#if (NDIM == 3)
+                                  patch_box.lower(2),
+                                  patch_box.upper(2),
+#endif
+                                  dx);
+    return;
+} // laplaceGrad
+
 void
 PatchMathOps::laplace(Pointer<CellData<NDIM, double> > dst,
                       const Pointer<FaceData<NDIM, double> > alpha,
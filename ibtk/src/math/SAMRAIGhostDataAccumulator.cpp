@@ -14,7 +14,6 @@
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
 #include "ibtk/IBTK_MPI.h"
-#include <ibtk/IBTK_CHKERRQ.h>
 #include <ibtk/PETScVecUtilities.h>
 #include <ibtk/SAMRAIGhostDataAccumulator.h>
 #include <ibtk/ibtk_utilities.h>
@@ -22,11 +21,6 @@
 #include <tbox/Pointer.h>
 #include <tbox/Utilities.h>
 
-#include <petscis.h>
-#include <petscistypes.h>
-#include <petsclog.h>
-#include <petscvec.h>
-
 #include <ArrayData.h>
 #include <BasePatchHierarchy.h>
 #include <Box.h>
@@ -45,10 +39,11 @@
 #include <VariableContext.h>
 #include <VariableDatabase.h>
 
+#include <mpi.h>
+
 #include <algorithm>
 #include <numeric>
 #include <string>
-#include <type_traits>
 #include <vector>
 
 #include <ibtk/namespaces.h> // IWYU pragma: keep
@@ -62,72 +57,71 @@ namespace
 {
 static Timer *t_constructor;
 static Timer *t_accumulate_ghost_data;
-static Timer *t_add_or_get;
+static Timer *t_pack_or_unpack;
+
+// Get the ArrayData objects of a CellData or SideData object. SideData stores
+// one array for each axis.
+template <typename T>
+std::vector<ArrayData<NDIM, T>*>
+get_array_data(Pointer<Patch<NDIM> > patch, const int data_idx, const bool cc_data)
+{
+    std::vector<ArrayData<NDIM, T>*> arrays;
+    if (cc_data)
+    {
+        Pointer<CellData<NDIM, T> > data = patch->getPatchData(data_idx);
+        TBOX_ASSERT(data);
+        arrays.push_back(&data->getArrayData());
+    }
+    else
+    {
+        Pointer<SideData<NDIM, T> > data = patch->getPatchData(data_idx);
+        TBOX_ASSERT(data);
+        for (int d = 0; d < NDIM; ++d) arrays.push_back(&data->getArrayData(d));
+    }
+    return arrays;
+}
 
-// The code leading to VecGetValues and VecSetValues is identical, so use one
-// function for both. Here the last argument is true if we set and false if we
-// get.
+// Packing and unpacking use the same loops, so use one function for both.
+// When packing, values in patch data (including ghost regions) are summed
+// into the entries of @p buffer associated with the same degree of freedom;
+// when unpacking, the entries of @p buffer are copied back into patch data.
+// Negative dof indices (e.g., ghost cells outside the physical domain) are
+// ignored.
 void
-add_or_get(Pointer<PatchLevel<NDIM> >& level,
-           const IntVector<NDIM> gcw,
-           const bool cc_data,
-           const int local_dof_idx,
-           const int value_idx,
-           Vec vec,
-           const bool add)
+pack_or_unpack(Pointer<PatchLevel<NDIM> >& level,
+               const IntVector<NDIM> gcw,
+               const bool cc_data,
+               const int local_dof_idx,
+               const int value_idx,
+               std::vector<double>& buffer,
+               const bool pack)
 {
-    IBTK_TIMER_START(t_add_or_get);
+    IBTK_TIMER_START(t_pack_or_unpack);
     for (PatchLevel<NDIM>::Iterator p(level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = level->getPatch(p());
         TBOX_ASSERT(gcw == patch->getPatchData(value_idx)->getGhostCellWidth());
-        std::vector<ArrayData<NDIM, double>*> values_ptrs;
-        std::vector<ArrayData<NDIM, int>*> dofs_ptrs;
-        if (cc_data) // semantics are slightly different for side-centered data
-        {
-            Pointer<CellData<NDIM, double> > value_data = patch->getPatchData(value_idx);
-            Pointer<CellData<NDIM, int> > dof_data = patch->getPatchData(local_dof_idx);
-            TBOX_ASSERT(value_data);
-            TBOX_ASSERT(dof_data);
-
-            dofs_ptrs.push_back(&dof_data->getArrayData());
-            values_ptrs.push_back(&value_data->getArrayData());
-        }
-        else
-        {
-            Pointer<SideData<NDIM, double> > value_data = patch->getPatchData(value_idx);
-            Pointer<SideData<NDIM, int> > dof_data = patch->getPatchData(local_dof_idx);
-            TBOX_ASSERT(value_data);
-            TBOX_ASSERT(dof_data);
-
-            for (int d = 0; d < NDIM; ++d)
-            {
-                dofs_ptrs.push_back(&dof_data->getArrayData(d));
-                values_ptrs.push_back(&value_data->getArrayData(d));
-            }
-        }
-
-        static_assert(std::is_same<PetscInt, int>::value, "only implemented for 32-bit PETSc indices");
-        Vec local;
-        int ierr = VecGhostGetLocalForm(vec, &local);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecSetOption(local, VEC_IGNORE_NEGATIVE_INDICES, PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
+        const std::vector<ArrayData<NDIM, int>*> dofs_ptrs = get_array_data<int>(patch, local_dof_idx, cc_data);
+        const std::vector<ArrayData<NDIM, double>*> values_ptrs = get_array_data<double>(patch, value_idx, cc_data);
         for (unsigned int d = 0; d < dofs_ptrs.size(); ++d)
         {
-            const PetscInt size = dofs_ptrs[d]->getDepth() * dofs_ptrs[d]->getOffset();
+            const int size = dofs_ptrs[d]->getDepth() * dofs_ptrs[d]->getOffset();
             TBOX_ASSERT(size == values_ptrs[d]->getDepth() * values_ptrs[d]->getOffset());
-            if (add)
-                ierr = VecSetValues(local, size, dofs_ptrs[d]->getPointer(), values_ptrs[d]->getPointer(), ADD_VALUES);
+            const int* const dofs = dofs_ptrs[d]->getPointer();
+            double* const values = values_ptrs[d]->getPointer();
+            if (pack)
+            {
+                for (int n = 0; n < size; ++n)
+                    if (dofs[n] >= 0) buffer[dofs[n]] += values[n];
+            }
             else
-                ierr = VecGetValues(local, size, dofs_ptrs[d]->getPointer(), values_ptrs[d]->getPointer());
-
-            IBTK_CHKERRQ(ierr);
+            {
+                for (int n = 0; n < size; ++n)
+                    if (dofs[n] >= 0) values[n] = buffer[dofs[n]];
+            }
         }
-        ierr = VecGhostRestoreLocalForm(vec, &local);
-        IBTK_CHKERRQ(ierr);
     }
-    IBTK_TIMER_STOP(t_add_or_get);
+    IBTK_TIMER_STOP(t_pack_or_unpack);
 }
 } // namespace
 
@@ -143,7 +137,7 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
     { return TimerManager::getManager()->getTimer(name); };
     t_constructor = set_timer("IBTK::SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator()");
     t_accumulate_ghost_data = set_timer("IBTK::SAMRAIGhostDataAccumulator::accumulateGhostData()");
-    t_add_or_get = set_timer("IBTK::SAMRAIGhostDataAccumulator::accumulateGhostData()[add_or_get]");
+    t_pack_or_unpack = set_timer("IBTK::SAMRAIGhostDataAccumulator::accumulateGhostData()[pack_or_unpack]");
 
     IBTK_TIMER_START(t_constructor);
     // Determine data layout:
@@ -154,6 +148,11 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
     TBOX_ASSERT(cc_data || sc_data);
     d_cc_data = cc_data;
 
+    // Use a private communicator so that the persistent requests cannot match
+    // messages sent by other parts of the library.
+    int ierr = MPI_Comm_dup(IBTK_MPI::getCommunicator(), &d_communicator);
+    TBOX_ASSERT(ierr == 0);
+
     // Create a context into which all indexing variables are grouped for this class:
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     Pointer<VariableContext> context = var_db->getContext("SAMRAIGhostDataAccumulator");
@@ -175,7 +174,7 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
     const std::string name = "SAMRAIGhostDataAccumulator::dof_" + var->getName();
 
     // Create the dof indexing variable and its data:
-    d_vecs.resize(d_finest_ln + 1); // be lazy and index this array directly by level number
+    d_plans.resize(d_finest_ln + 1); // be lazy and index this array directly by level number
     Pointer<Variable<NDIM> > dof_var;
     if (var_db->checkVariableExists(name))
         dof_var = var_db->getVariable(name);
@@ -185,6 +184,8 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
 
     d_global_dof_idx = var_db->registerVariableAndContext(dof_var, context, d_gcw);
     d_local_dof_idx = var_db->registerClonedPatchDataIndex(dof_var, d_global_dof_idx);
+    const int mpi_rank = IBTK_MPI::getRank();
+    const int n_procs = IBTK_MPI::getNodes();
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
@@ -193,30 +194,18 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
 
         std::vector<int> num_dofs_per_proc;
         PETScVecUtilities::constructPatchLevelDOFIndices(num_dofs_per_proc, d_global_dof_idx, level);
-        const int mpi_rank = IBTK_MPI::getRank();
 
-        // half-open range of DoFs on the current processor
-        const int local_dofs_begin =
-            std::accumulate(num_dofs_per_proc.begin(), num_dofs_per_proc.begin() + mpi_rank, 0);
-        const int local_dofs_end = local_dofs_begin + num_dofs_per_proc[mpi_rank];
+        // half-open ranges of DoFs on each processor
+        std::vector<int> dofs_begin(n_procs + 1, 0);
+        std::partial_sum(num_dofs_per_proc.begin(), num_dofs_per_proc.end(), dofs_begin.begin() + 1);
+        const int local_dofs_begin = dofs_begin[mpi_rank];
+        const int local_dofs_end = dofs_begin[mpi_rank + 1];
 
-        std::vector<PetscInt> ghosts;
+        std::vector<int> ghosts;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            std::vector<ArrayData<NDIM, int>*> dofs_ptrs;
-            if (d_cc_data)
-            {
-                Pointer<CellData<NDIM, int> > dof_data = patch->getPatchData(d_global_dof_idx);
-                dofs_ptrs.push_back(&dof_data->getArrayData());
-            }
-            else
-            {
-                Pointer<SideData<NDIM, int> > dof_data = patch->getPatchData(d_global_dof_idx);
-                // SideData stores multiple arrays (one for each dimension)
-                for (int d = 0; d < NDIM; ++d) dofs_ptrs.push_back(&dof_data->getArrayData(d));
-            }
-            for (ArrayData<NDIM, int>* dofs : dofs_ptrs)
+            for (ArrayData<NDIM, int>* dofs : get_array_data<int>(patch, d_global_dof_idx, d_cc_data))
             {
                 const int* dofs_ptr = dofs->getPointer();
                 const int size = dofs->getBox().size() * dofs->getDepth();
@@ -230,55 +219,140 @@ SAMRAIGhostDataAccumulator::SAMRAIGhostDataAccumulator(Pointer<BasePatchHierarch
         ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
         // make sure that ghosts doesn't have any negative entries
         ghosts.erase(ghosts.begin(), std::upper_bound(ghosts.begin(), ghosts.end(), -1));
-        int ierr = VecCreateGhost(PETSC_COMM_WORLD,
-                                  num_dofs_per_proc[mpi_rank],
-                                  PETSC_DECIDE,
-                                  static_cast<PetscInt>(ghosts.size()),
-                                  ghosts.data(),
-                                  &d_vecs[ln]);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecSetOption(d_vecs[ln], VEC_IGNORE_NEGATIVE_INDICES, PETSC_TRUE);
-        IBTK_CHKERRQ(ierr);
-
-        // set up local indices
-        ISLocalToGlobalMapping mapping;
-        ierr = VecGetLocalToGlobalMapping(d_vecs[ln], &mapping);
-        IBTK_CHKERRQ(ierr);
+
+        CommunicationPlan& plan = d_plans[ln];
+        plan.n_local_dofs = num_dofs_per_proc[mpi_rank];
+        plan.values.resize(plan.n_local_dofs + ghosts.size());
+
+        // set up local indices: owned dofs come first, followed by ghosts in
+        // the same order as in the (sorted) ghosts array
+        const auto global_to_local = [&](const int dof) -> int
+        {
+            if (dof < 0) return -1;
+            if (local_dofs_begin <= dof && dof < local_dofs_end) return dof - local_dofs_begin;
+            const auto it = std::lower_bound(ghosts.begin(), ghosts.end(), dof);
+            TBOX_ASSERT(it != ghosts.end() && *it == dof);
+            return plan.n_local_dofs + static_cast<int>(it - ghosts.begin());
+        };
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
-            std::vector<ArrayData<NDIM, int>*> dofs_ptrs;
-            if (d_cc_data)
+            const std::vector<ArrayData<NDIM, int>*> global_dofs =
+                get_array_data<int>(patch, d_global_dof_idx, d_cc_data);
+            const std::vector<ArrayData<NDIM, int>*> local_dofs =
+                get_array_data<int>(patch, d_local_dof_idx, d_cc_data);
+            for (unsigned int d = 0; d < global_dofs.size(); ++d)
             {
-                Pointer<CellData<NDIM, int> > global_dofs = patch->getPatchData(d_global_dof_idx);
-                Pointer<CellData<NDIM, int> > local_dofs = patch->getPatchData(d_local_dof_idx);
-                ArrayData<NDIM, int>& global_dof_data = global_dofs->getArrayData();
-                ArrayData<NDIM, int>& local_dof_data = local_dofs->getArrayData();
-                const auto size = local_dof_data.getBox().size() * local_dof_data.getDepth();
                 // since these arrays contain ghost cells outside the physical domain they will always contain -1s
-                ierr = ISGlobalToLocalMappingApply(
-                    mapping, IS_GTOLM_MASK, size, global_dof_data.getPointer(), nullptr, local_dof_data.getPointer());
-                IBTK_CHKERRQ(ierr);
+                const int size = local_dofs[d]->getBox().size() * local_dofs[d]->getDepth();
+                const int* const global_dofs_ptr = global_dofs[d]->getPointer();
+                int* const local_dofs_ptr = local_dofs[d]->getPointer();
+                for (int n = 0; n < size; ++n) local_dofs_ptr[n] = global_to_local(global_dofs_ptr[n]);
             }
-            else
+        }
+
+        // Since ghosts is sorted, the ghosts owned by each processor are
+        // stored contiguously. Tell each owner how many of its dofs we need.
+        std::vector<int> ghosts_begin(n_procs + 1, 0);
+        std::vector<int> num_ghosts_per_proc(n_procs, 0);
+        for (int r = 0; r < n_procs; ++r)
+        {
+            ghosts_begin[r] =
+                static_cast<int>(std::lower_bound(ghosts.begin(), ghosts.end(), dofs_begin[r]) - ghosts.begin());
+        }
+        ghosts_begin[n_procs] = static_cast<int>(ghosts.size());
+        for (int r = 0; r < n_procs; ++r) num_ghosts_per_proc[r] = ghosts_begin[r + 1] - ghosts_begin[r];
+        TBOX_ASSERT(num_ghosts_per_proc[mpi_rank] == 0);
+
+        std::vector<int> num_shared_per_proc(n_procs, 0);
+        ierr = MPI_Alltoall(
+            num_ghosts_per_proc.data(), 1, MPI_INT, num_shared_per_proc.data(), 1, MPI_INT, d_communicator);
+        TBOX_ASSERT(ierr == 0);
+        std::vector<int> shared_begin(n_procs + 1, 0);
+        std::partial_sum(num_shared_per_proc.begin(), num_shared_per_proc.end(), shared_begin.begin() + 1);
+
+        // Exchange the global indices of the shared dofs once: afterwards only
+        // values are communicated.
+        plan.shared_dofs.resize(shared_begin[n_procs]);
+        plan.shared_buffer.resize(shared_begin[n_procs]);
+        const int accumulate_tag = 2 * ln;
+        const int update_tag = 2 * ln + 1;
+        std::vector<MPI_Request> setup_requests;
+        for (int r = 0; r < n_procs; ++r)
+        {
+            if (num_shared_per_proc[r] == 0) continue;
+            setup_requests.emplace_back();
+            MPI_Irecv(plan.shared_dofs.data() + shared_begin[r],
+                      num_shared_per_proc[r],
+                      MPI_INT,
+                      r,
+                      accumulate_tag,
+                      d_communicator,
+                      &setup_requests.back());
+        }
+        for (int r = 0; r < n_procs; ++r)
+        {
+            if (num_ghosts_per_proc[r] == 0) continue;
+            setup_requests.emplace_back();
+            MPI_Isend(ghosts.data() + ghosts_begin[r],
+                      num_ghosts_per_proc[r],
+                      MPI_INT,
+                      r,
+                      accumulate_tag,
+                      d_communicator,
+                      &setup_requests.back());
+        }
+        ierr = MPI_Waitall(static_cast<int>(setup_requests.size()), setup_requests.data(), MPI_STATUSES_IGNORE);
+        TBOX_ASSERT(ierr == 0);
+        for (int& dof : plan.shared_dofs)
+        {
+            TBOX_ASSERT(local_dofs_begin <= dof && dof < local_dofs_end);
+            dof -= local_dofs_begin;
+        }
+
+        // Set up the persistent requests. Ghost values are sent directly out
+        // of (and received directly into) plan.values.
+        double* const ghost_values = plan.values.data() + plan.n_local_dofs;
+        for (int r = 0; r < n_procs; ++r)
+        {
+            if (num_shared_per_proc[r] != 0)
             {
-                Pointer<SideData<NDIM, int> > global_dofs = patch->getPatchData(d_global_dof_idx);
-                Pointer<SideData<NDIM, int> > local_dofs = patch->getPatchData(d_local_dof_idx);
-                // SideData stores multiple arrays (one for each dimension)
-                for (int d = 0; d < NDIM; ++d)
-                {
-                    ArrayData<NDIM, int>& global_dof_data = global_dofs->getArrayData(d);
-                    ArrayData<NDIM, int>& local_dof_data = local_dofs->getArrayData(d);
-                    const auto size = local_dof_data.getBox().size() * local_dof_data.getDepth();
-                    // since these arrays contain ghost cells outside the physical domain they will always contain -1s
-                    ierr = ISGlobalToLocalMappingApply(mapping,
-                                                       IS_GTOLM_MASK,
-                                                       size,
-                                                       global_dof_data.getPointer(),
-                                                       nullptr,
-                                                       local_dof_data.getPointer());
-                    IBTK_CHKERRQ(ierr);
-                }
+                double* const shared_values = plan.shared_buffer.data() + shared_begin[r];
+                plan.accumulate_requests.emplace_back();
+                MPI_Recv_init(shared_values,
+                              num_shared_per_proc[r],
+                              MPI_DOUBLE,
+                              r,
+                              accumulate_tag,
+                              d_communicator,
+                              &plan.accumulate_requests.back());
+                plan.update_requests.emplace_back();
+                MPI_Send_init(shared_values,
+                              num_shared_per_proc[r],
+                              MPI_DOUBLE,
+                              r,
+                              update_tag,
+                              d_communicator,
+                              &plan.update_requests.back());
+            }
+            if (num_ghosts_per_proc[r] != 0)
+            {
+                plan.accumulate_requests.emplace_back();
+                MPI_Send_init(ghost_values + ghosts_begin[r],
+                              num_ghosts_per_proc[r],
+                              MPI_DOUBLE,
+                              r,
+                              accumulate_tag,
+                              d_communicator,
+                              &plan.accumulate_requests.back());
+                plan.update_requests.emplace_back();
+                MPI_Recv_init(ghost_values + ghosts_begin[r],
+                              num_ghosts_per_proc[r],
+                              MPI_DOUBLE,
+                              r,
+                              update_tag,
+                              d_communicator,
+                              &plan.update_requests.back());
             }
         }
     } // loop over levels
@@ -294,61 +368,53 @@ SAMRAIGhostDataAccumulator::accumulateGhostData(const int idx)
     var_db->mapIndexToVariable(idx, var);
     TBOX_ASSERT(var == d_var);
 
-    // the next part looks like PETScVecUtilities::copyToPatchLevelVec()
-    // except here we include the ghost box and use ADD_VALUES since we
-    // are accumulating.
-
-    // 1. Copy data to the Vec:
+    // 1. Sum patch data (including ghost regions) into the contiguous buffers
+    // and send ghost values to their owners:
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        // VecSet doesn't modify ghost values - use the local form instead
-        Vec local;
-        int ierr = VecGhostGetLocalForm(d_vecs[ln], &local);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecSet(local, 0.0);
-        IBTK_CHKERRQ(ierr);
-        ierr = VecGhostRestoreLocalForm(d_vecs[ln], &local);
-        IBTK_CHKERRQ(ierr);
-
+        CommunicationPlan& plan = d_plans[ln];
+        std::fill(plan.values.begin(), plan.values.end(), 0.0);
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        add_or_get(level, d_gcw, d_cc_data, d_local_dof_idx, idx, d_vecs[ln], true);
+        pack_or_unpack(level, d_gcw, d_cc_data, d_local_dof_idx, idx, plan.values, true);
+        if (!plan.accumulate_requests.empty())
+            MPI_Startall(static_cast<int>(plan.accumulate_requests.size()), plan.accumulate_requests.data());
     }
 
-    // 2. Accumulate:
+    // 2. Accumulate contributions from other processors and send the summed
+    // values back to each processor that stores them as ghosts:
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
-        const int ierr = VecGhostUpdateBegin(d_vecs[ln], ADD_VALUES, SCATTER_REVERSE);
-        IBTK_CHKERRQ(ierr);
-    }
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        const int ierr = VecGhostUpdateEnd(d_vecs[ln], ADD_VALUES, SCATTER_REVERSE);
-        IBTK_CHKERRQ(ierr);
-    }
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        const int ierr = VecGhostUpdateBegin(d_vecs[ln], INSERT_VALUES, SCATTER_FORWARD);
-        IBTK_CHKERRQ(ierr);
-    }
-    for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
-    {
-        const int ierr = VecGhostUpdateEnd(d_vecs[ln], INSERT_VALUES, SCATTER_FORWARD);
-        IBTK_CHKERRQ(ierr);
+        CommunicationPlan& plan = d_plans[ln];
+        MPI_Waitall(static_cast<int>(plan.accumulate_requests.size()),
+                    plan.accumulate_requests.data(),
+                    MPI_STATUSES_IGNORE);
+        const std::size_t n_shared = plan.shared_dofs.size();
+        for (std::size_t k = 0; k < n_shared; ++k) plan.values[plan.shared_dofs[k]] += plan.shared_buffer[k];
+        for (std::size_t k = 0; k < n_shared; ++k) plan.shared_buffer[k] = plan.values[plan.shared_dofs[k]];
+        if (!plan.update_requests.empty())
+            MPI_Startall(static_cast<int>(plan.update_requests.size()), plan.update_requests.data());
     }
 
     // 3. copy back:
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
+        CommunicationPlan& plan = d_plans[ln];
+        MPI_Waitall(
+            static_cast<int>(plan.update_requests.size()), plan.update_requests.data(), MPI_STATUSES_IGNORE);
         Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
-        add_or_get(level, d_gcw, d_cc_data, d_local_dof_idx, idx, d_vecs[ln], false);
+        pack_or_unpack(level, d_gcw, d_cc_data, d_local_dof_idx, idx, plan.values, false);
     }
     IBTK_TIMER_STOP(t_accumulate_ghost_data);
 }
 
 SAMRAIGhostDataAccumulator::~SAMRAIGhostDataAccumulator()
 {
-    for (Vec& vec : d_vecs)
-        if (vec != nullptr) VecDestroy(&vec);
+    for (CommunicationPlan& plan : d_plans)
+    {
+        for (MPI_Request& request : plan.accumulate_requests) MPI_Request_free(&request);
+        for (MPI_Request& request : plan.update_requests) MPI_Request_free(&request);
+    }
+    if (d_communicator != MPI_COMM_NULL) MPI_Comm_free(&d_communicator);
 
     for (int ln = d_coarsest_ln; ln <= d_finest_ln; ++ln)
     {
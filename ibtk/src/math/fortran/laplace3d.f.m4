@@ -1741,3 +1741,107 @@ c
       end
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Computes F = alpha div grad U + beta U + gamma grad P.
+c
+c     Uses the seven point stencil to compute the damped discrete
+c     Laplacian of a side centered variable U and adds the side centered
+c     gradient of a cell centered variable P, so that each component of
+c     F is computed in a single pass over the data.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine stosdampedlaplacegrad3d(
+     &     F0,F1,F2,F_gcw,
+     &     alpha,beta,
+     &     U0,U1,U2,U_gcw,
+     &     gamma,
+     &     P,P_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     ilower2,iupper2,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER ilower2,iupper2
+      INTEGER F_gcw,U_gcw,P_gcw
+
+      REAL alpha,beta
+
+      REAL U0(SIDE3d0(ilower,iupper,U_gcw))
+      REAL U1(SIDE3d1(ilower,iupper,U_gcw))
+      REAL U2(SIDE3d2(ilower,iupper,U_gcw))
+
+      REAL gamma
+
+      REAL P(CELL3d(ilower,iupper,P_gcw))
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      REAL F0(SIDE3d0(ilower,iupper,F_gcw))
+      REAL F1(SIDE3d1(ilower,iupper,F_gcw))
+      REAL F2(SIDE3d2(ilower,iupper,F_gcw))
+c
+c     Local variables.
+c
+      INTEGER i0,i1,i2
+      REAL    fac0,fac1,fac2,gfac0,gfac1,gfac2
+c
+c     Compute the damped discrete Laplacian of U and add the gradient of
+c     P.
+c
+      fac0 = alpha/(dx(0)*dx(0))
+      fac1 = alpha/(dx(1)*dx(1))
+      fac2 = alpha/(dx(2)*dx(2))
+      gfac0 = gamma/dx(0)
+      gfac1 = gamma/dx(1)
+      gfac2 = gamma/dx(2)
+
+      do i2 = ilower2,iupper2
+         do i1 = ilower1,iupper1
+            do i0 = ilower0,iupper0+1
+               F0(i0,i1,i2) =
+     &           fac0*(U0(i0-1,i1,i2)+U0(i0+1,i1,i2)-2.d0*U0(i0,i1,i2))+
+     &           fac1*(U0(i0,i1-1,i2)+U0(i0,i1+1,i2)-2.d0*U0(i0,i1,i2))+
+     &           fac2*(U0(i0,i1,i2-1)+U0(i0,i1,i2+1)-2.d0*U0(i0,i1,i2))+
+     &           beta* U0(i0,i1,i2)                                    +
+     &           gfac0*(P(i0,i1,i2)-P(i0-1,i1,i2))
+            enddo
+         enddo
+      enddo
+      do i2 = ilower2,iupper2
+         do i1 = ilower1,iupper1+1
+            do i0 = ilower0,iupper0
+               F1(i0,i1,i2) =
+     &           fac0*(U1(i0-1,i1,i2)+U1(i0+1,i1,i2)-2.d0*U1(i0,i1,i2))+
+     &           fac1*(U1(i0,i1-1,i2)+U1(i0,i1+1,i2)-2.d0*U1(i0,i1,i2))+
+     &           fac2*(U1(i0,i1,i2-1)+U1(i0,i1,i2+1)-2.d0*U1(i0,i1,i2))+
+     &           beta* U1(i0,i1,i2)                                    +
+     &           gfac1*(P(i0,i1,i2)-P(i0,i1-1,i2))
+            enddo
+         enddo
+      enddo
+      do i2 = ilower2,iupper2+1
+         do i1 = ilower1,iupper1
+            do i0 = ilower0,iupper0
+               F2(i0,i1,i2) =
+     &           fac0*(U2(i0-1,i1,i2)+U2(i0+1,i1,i2)-2.d0*U2(i0,i1,i2))+
+     &           fac1*(U2(i0,i1-1,i2)+U2(i0,i1+1,i2)-2.d0*U2(i0,i1,i2))+
+     &           fac2*(U2(i0,i1,i2-1)+U2(i0,i1,i2+1)-2.d0*U2(i0,i1,i2))+
+     &           beta* U2(i0,i1,i2)                                    +
+     &           gfac2*(P(i0,i1,i2)-P(i0,i1,i2-1))
+            enddo
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
@@ -166,6 +166,10 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
         {
             if (input_db->keyExists("two_norm")) d_two_norm = input_db->getInteger("two_norm");
         }
+
+        if (input_db->keyExists("reuse_hypre_data")) d_reuse_hypre_data = input_db->getBool("reuse_hypre_data");
+        if (input_db->keyExists("solver_setup_reuse_tol"))
+            d_solver_setup_reuse_tol = input_db->getDouble("solver_setup_reuse_tol");
     }
 
     // Setup Timers.
@@ -183,6 +187,7 @@ CCPoissonHypreLevelSolver::CCPoissonHypreLevelSolver(const std::string& object_n
 CCPoissonHypreLevelSolver::~CCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_hypre_data_retained) releaseHypreData();
     return;
 } // ~CCPoissonHypreLevelSolver
 
@@ -286,6 +291,8 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     if (d_is_initialized) deallocateSolverState();
 
     // Get the hierarchy information.
+    const Pointer<PatchHierarchy<NDIM> > prev_hierarchy = d_hierarchy;
+    const int prev_level_num = d_level_num;
     d_hierarchy = x.getPatchHierarchy();
     d_level_num = x.getCoarsestLevelNumber();
     TBOX_ASSERT(d_level_num == x.getFinestLevelNumber());
@@ -299,12 +306,9 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
     const int x_idx = x.getComponentDescriptorIndex(0);
     Pointer<CellDataFactory<NDIM, double> > x_fac = var_db->getPatchDescriptor()->getPatchDataFactory(x_idx);
-    d_depth = x_fac->getDefaultDepth();
-    if (d_poisson_spec.dIsConstant())
-    {
-        d_grid_aligned_anisotropy = true;
-    }
-    else
+    const unsigned int depth = x_fac->getDefaultDepth();
+    bool grid_aligned_anisotropy = true;
+    if (!d_poisson_spec.dIsConstant())
     {
         VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
         Pointer<SideDataFactory<NDIM, double> > pdat_factory =
@@ -312,9 +316,29 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
 #if !defined(NDEBUG)
         TBOX_ASSERT(pdat_factory);
 #endif
-        d_grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+        grid_aligned_anisotropy = pdat_factory->getDefaultDepth() == 1;
+    }
+
+    // Reuse any retained hypre data structures if the layout of the level is
+    // unchanged.  Otherwise, create new ones.
+    std::vector<Box<NDIM> > patch_boxes;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        patch_boxes.push_back(d_level->getPatch(p())->getBox());
+    }
+    const bool reuse_hypre_data = d_hypre_data_retained && d_hierarchy == prev_hierarchy &&
+                                  d_level_num == prev_level_num && depth == d_depth &&
+                                  grid_aligned_anisotropy == d_grid_aligned_anisotropy &&
+                                  hypreLayoutUnchanged(d_hypre_boxes, patch_boxes);
+    if (!reuse_hypre_data)
+    {
+        if (d_hypre_data_retained) releaseHypreData();
+        d_depth = depth;
+        d_grid_aligned_anisotropy = grid_aligned_anisotropy;
+        allocateHypreData();
     }
-    allocateHypreData();
+    std::vector<std::vector<double> > prev_matrix_vals;
+    prev_matrix_vals.swap(d_matrix_vals);
     if (d_grid_aligned_anisotropy)
     {
         setMatrixCoefficients_aligned();
@@ -323,7 +347,23 @@ CCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     {
         setMatrixCoefficients_nonaligned();
     }
-    setupHypreSolver();
+
+    // Keep the existing solver setup if the matrix coefficients have not
+    // changed too much.
+    bool reuse_solver_setup =
+        reuse_hypre_data && d_solver_setup_reuse_tol >= 0.0 && prev_matrix_vals.size() == d_depth;
+    for (unsigned int k = 0; k < d_depth && reuse_solver_setup; ++k)
+    {
+        reuse_solver_setup =
+            hypreMatrixRelativeChange(prev_matrix_vals[k], d_matrix_vals[k]) <= d_solver_setup_reuse_tol;
+    }
+    if (!reuse_solver_setup)
+    {
+        if (reuse_hypre_data) destroyHypreSolver();
+        setupHypreSolver();
+    }
+    d_hypre_boxes = d_reuse_hypre_data ? patch_boxes : std::vector<Box<NDIM> >();
+    d_hypre_data_retained = false;
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -339,9 +379,17 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures, or retain them so that they can be
+    // reused by the next call to initializeSolverState().
+    if (d_reuse_hypre_data)
+    {
+        d_hypre_data_retained = true;
+    }
+    else
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -350,6 +398,21 @@ CCPoissonHypreLevelSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+void
+CCPoissonHypreLevelSolver::setReuseHypreData(const bool reuse_hypre_data)
+{
+    d_reuse_hypre_data = reuse_hypre_data;
+    if (!d_reuse_hypre_data && d_hypre_data_retained) releaseHypreData();
+    return;
+} // setReuseHypreData
+
+void
+CCPoissonHypreLevelSolver::setSolverSetupReuseTolerance(const double solver_setup_reuse_tol)
+{
+    d_solver_setup_reuse_tol = solver_setup_reuse_tol;
+    return;
+} // setSolverSetupReuseTolerance
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -484,31 +547,38 @@ CCPoissonHypreLevelSolver::allocateHypreData()
 void
 CCPoissonHypreLevelSolver::setMatrixCoefficients_aligned()
 {
-    // Set matrix entries and copy them to the hypre matrix structures.
+    // Set matrix entries and copy them to the hypre matrix structures one patch
+    // at a time.  hypre expects the stencil entries of each cell to be stored
+    // contiguously.
     const auto stencil_size = d_stencil_offsets.size();
     std::vector<HYPRE_Int> stencil_indices(stencil_size);
     std::iota(stencil_indices.begin(), stencil_indices.end(), HYPRE_Int(0));
-    std::vector<double> mat_vals(stencil_size, 0.0);
+    d_matrix_vals.clear();
+    if (d_reuse_hypre_data) d_matrix_vals.resize(d_depth);
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
         const Box<NDIM>& patch_box = patch->getBox();
+        const auto lower = hypre_array(patch_box.lower());
+        const auto upper = hypre_array(patch_box.upper());
+        const std::size_t num_cells = patch_box.size();
         CellData<NDIM, double> matrix_coefs(patch_box, stencil_size, IntVector<NDIM>(0));
+        std::vector<double> mat_vals(stencil_size * num_cells);
         for (unsigned int k = 0; k < d_depth; ++k)
         {
             PoissonUtilities::computeMatrixCoefficients(
                 matrix_coefs, patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs[k], d_solution_time);
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            for (unsigned int j = 0; j < stencil_size; ++j)
             {
-                hier::Index<NDIM> i = b();
-                for (unsigned int j = 0; j < stencil_size; ++j)
+                const double* const coefs = matrix_coefs.getPointer(j);
+                for (std::size_t c = 0; c < num_cells; ++c)
                 {
-                    mat_vals[j] = matrix_coefs(i, j);
+                    mat_vals[c * stencil_size + j] = coefs[c];
                 }
-                auto hypre_i = hypre_array(i);
-                HYPRE_StructMatrixSetValues(
-                    d_matrices[k], hypre_i.data(), stencil_size, stencil_indices.data(), mat_vals.data());
             }
+            HYPRE_StructMatrixSetBoxValues(
+                d_matrices[k], lower.data(), upper.data(), stencil_size, stencil_indices.data(), mat_vals.data());
+            if (d_reuse_hypre_data) d_matrix_vals[k].insert(d_matrix_vals[k].end(), mat_vals.begin(), mat_vals.end());
         }
     }
 
@@ -524,6 +594,8 @@ void
 CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
 {
     static const IntVector<NDIM> no_ghosts = 0;
+    d_matrix_vals.clear();
+    if (d_reuse_hypre_data) d_matrix_vals.resize(d_depth);
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
@@ -603,8 +675,12 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
         }
 
         // Set the matrix coefficients to correspond to a second-order accurate
-        // finite difference stencil for the Laplace operator.
-        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        // finite difference stencil for the Laplace operator.  The stencil
+        // entries of each cell are stored contiguously, in the order expected
+        // by hypre.
+        std::vector<double> patch_mat_vals(stencil_size * patch_box.size());
+        std::size_t c = 0;
+        for (Box<NDIM>::Iterator b(patch_box); b; b++, ++c)
         {
             hier::Index<NDIM> i = b();
             static const hier::Index<NDIM> i_stencil_center(0);
@@ -708,11 +784,22 @@ CCPoissonHypreLevelSolver::setMatrixCoefficients_nonaligned()
                 }
             }
 
-            for (unsigned int k = 0; k < d_depth; ++k)
+            std::copy(mat_vals.begin(), mat_vals.end(), patch_mat_vals.begin() + c * stencil_size);
+        }
+
+        const auto lower = hypre_array(patch_box.lower());
+        const auto upper = hypre_array(patch_box.upper());
+        for (unsigned int k = 0; k < d_depth; ++k)
+        {
+            HYPRE_StructMatrixSetBoxValues(d_matrices[k],
+                                           lower.data(),
+                                           upper.data(),
+                                           stencil_indices.size(),
+                                           stencil_indices.data(),
+                                           patch_mat_vals.data());
+            if (d_reuse_hypre_data)
             {
-                auto hypre_i = hypre_array(i);
-                HYPRE_StructMatrixSetValues(
-                    d_matrices[k], hypre_i.data(), stencil_indices.size(), stencil_indices.data(), &mat_vals[0]);
+                d_matrix_vals[k].insert(d_matrix_vals[k].end(), patch_mat_vals.begin(), patch_mat_vals.end());
             }
         }
     }
@@ -1250,6 +1337,17 @@ CCPoissonHypreLevelSolver::deallocateHypreData()
     return;
 } // deallocateHypreData
 
+void
+CCPoissonHypreLevelSolver::releaseHypreData()
+{
+    destroyHypreSolver();
+    deallocateHypreData();
+    d_hypre_boxes.clear();
+    d_matrix_vals.clear();
+    d_hypre_data_retained = false;
+    return;
+} // releaseHypreData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -20,6 +20,8 @@
 #include "ibtk/CartCellRobinPhysBdryOp.h"
 #include "ibtk/CellNoCornersFillPattern.h"
 #include "ibtk/CoarseFineBoundaryRefinePatchStrategy.h"
+#include "ibtk/FACPreconditioner.h"
+#include "ibtk/FACPreconditionerStrategy.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
 #include "ibtk/LinearSolver.h"
@@ -30,11 +32,16 @@
 
 #include "ArrayData.h"
 #include "Box.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellDataFactory.h"
+#include "CellIndex.h"
+#include "CellVariable.h"
 #include "CoarsenOperator.h"
 #include "HierarchyCellDataOpsReal.h"
+#include "IntVector.h"
 #include "MultiblockDataTranslator.h"
 #include "Patch.h"
 #include "PatchDescriptor.h"
@@ -42,8 +49,10 @@
 #include "PatchLevel.h"
 #include "PoissonSpecifications.h"
 #include "ProcessorMapping.h"
+#include "RobinBcCoefStrategy.h"
 #include "SideData.h"
 #include "Variable.h"
+#include "VariableContext.h"
 #include "VariableDatabase.h"
 #include "VariableFillPattern.h"
 #include "tbox/Array.h"
@@ -55,6 +64,7 @@
 #include "tbox/TimerManager.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -68,6 +78,8 @@
 #if (NDIM == 2)
 #define SMOOTH_GS_CONST_DC_FC IBTK_FC_FUNC_(smooth_gs_const_dc_2d, SMOOTH_GS_CONST_DC_2D)
 #define SMOOTH_GS_RB_CONST_DC_FC IBTK_FC_FUNC_(smooth_gs_rb_const_dc_2d, SMOOTH_GS_RB_CONST_DC_2D)
+#define SMOOTH_GS_CONST_DC_SP_FC IBTK_FC_FUNC_(smooth_gs_const_dc_sp_2d, SMOOTH_GS_CONST_DC_SP_2D)
+#define SMOOTH_GS_RB_CONST_DC_SP_FC IBTK_FC_FUNC_(smooth_gs_rb_const_dc_sp_2d, SMOOTH_GS_RB_CONST_DC_SP_2D)
 #define SMOOTH_GS_VAR_D_CONST_C_FC IBTK_FC_FUNC_(smooth_gs_var_d_const_c_2d, SMOOTH_GS_VAR_D_CONST_C_2D)
 #define SMOOTH_GS_RB_VAR_D_CONST_C_FC IBTK_FC_FUNC_(smooth_gs_rb_var_d_const_c_2d, SMOOTH_GS_RB_VAR_D_CONST_C_2D)
 #define SMOOTH_GS_CONST_D_VAR_C_FC IBTK_FC_FUNC_(smooth_gs_const_d_var_c_2d, SMOOTH_GS_CONST_D_VAR_C_2D)
@@ -78,6 +90,8 @@
 #if (NDIM == 3)
 #define SMOOTH_GS_CONST_DC_FC IBTK_FC_FUNC_(smooth_gs_const_dc_3d, SMOOTH_GS_CONST_DC_3D)
 #define SMOOTH_GS_RB_CONST_DC_FC IBTK_FC_FUNC_(smooth_gs_rb_const_dc_3d, SMOOTH_GS_RB_CONST_DC_3D)
+#define SMOOTH_GS_CONST_DC_SP_FC IBTK_FC_FUNC_(smooth_gs_const_dc_sp_3d, SMOOTH_GS_CONST_DC_SP_3D)
+#define SMOOTH_GS_RB_CONST_DC_SP_FC IBTK_FC_FUNC_(smooth_gs_rb_const_dc_sp_3d, SMOOTH_GS_RB_CONST_DC_SP_3D)
 #define SMOOTH_GS_VAR_D_CONST_C_FC IBTK_FC_FUNC_(smooth_gs_var_d_const_c_3d, SMOOTH_GS_VAR_D_CONST_C_3D)
 #define SMOOTH_GS_RB_VAR_D_CONST_C_FC IBTK_FC_FUNC_(smooth_gs_rb_var_d_const_c_3d, SMOOTH_GS_RB_VAR_D_CONST_C_3D)
 #define SMOOTH_GS_CONST_D_VAR_C_FC IBTK_FC_FUNC_(smooth_gs_const_d_var_c_3d, SMOOTH_GS_CONST_D_VAR_C_3D)
@@ -122,6 +136,39 @@ extern "C"
                                   const double* dx,
                                   const int& red_or_black);
 
+    void SMOOTH_GS_CONST_DC_SP_FC(float* U,
+                                  const int& U_gcw,
+                                  const double& D,
+                                  const double& C,
+                                  const float* F,
+                                  const int& F_gcw,
+                                  const int& ilower0,
+                                  const int& iupper0,
+                                  const int& ilower1,
+                                  const int& iupper1,
+#if (NDIM == 3)
+                                  const int& ilower2,
+                                  const int& iupper2,
+#endif
+                                  const double* dx);
+
+    void SMOOTH_GS_RB_CONST_DC_SP_FC(float* U,
+                                     const int& U_gcw,
+                                     const double& D,
+                                     const double& C,
+                                     const float* F,
+                                     const int& F_gcw,
+                                     const int& ilower0,
+                                     const int& iupper0,
+                                     const int& ilower1,
+                                     const int& iupper1,
+#if (NDIM == 3)
+                                     const int& ilower2,
+                                     const int& iupper2,
+#endif
+                                     const double* dx,
+                                     const int& red_or_black);
+
     void SMOOTH_GS_VAR_D_CONST_C_FC(double* U,
                                     const int& U_gcw,
                                     const double* D0,
@@ -323,6 +370,57 @@ do_local_data_update(SmootherType smoother_type)
         return false;
     }
 } // do_local_data_update
+
+// Register a single-precision cell-centered scratch variable used by the
+// smoother.
+int
+register_single_precision_scratch_variable(const std::string& name,
+                                           Pointer<VariableContext> context,
+                                           const IntVector<NDIM>& ghosts)
+{
+    VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+    Pointer<Variable<NDIM> > var = new CellVariable<NDIM, float>(name, DEFAULT_DATA_DEPTH);
+    if (var_db->checkVariableExists(name))
+    {
+        var = var_db->getVariable(name);
+        var_db->removePatchDataIndex(var_db->mapVariableAndContextToIndex(var, context));
+    }
+    return var_db->registerVariableAndContext(var, context, ghosts);
+} // register_single_precision_scratch_variable
+
+// Copy cell-centered values between patch data objects with the same ghost
+// box but possibly different precisions on the specified boxes.
+template <class DstType, class SrcType>
+void
+copy_cell_data(CellData<NDIM, DstType>& dst_data, const CellData<NDIM, SrcType>& src_data, const BoxList<NDIM>& boxes)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(dst_data.getGhostBox() == src_data.getGhostBox());
+    TBOX_ASSERT(dst_data.getDepth() == src_data.getDepth());
+#endif
+    for (BoxList<NDIM>::Iterator bl(boxes); bl; bl++)
+    {
+        const Box<NDIM> box = bl() * dst_data.getGhostBox();
+        if (box.empty()) continue;
+
+        // Values are stored contiguously along the first coordinate direction,
+        // so we copy each row of the box at once.
+        Box<NDIM> row_box = box;
+        row_box.upper(0) = row_box.lower(0);
+        const int row_length = box.numberCells(0);
+        for (int depth = 0; depth < dst_data.getDepth(); ++depth)
+        {
+            for (Box<NDIM>::Iterator b(row_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                DstType* const dst = &dst_data(i, depth);
+                const SrcType* const src = &src_data(i, depth);
+                for (int k = 0; k < row_length; ++k) dst[k] = static_cast<DstType>(src[k]);
+            }
+        }
+    }
+    return;
+} // copy_cell_data
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -368,6 +466,8 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
         {
             d_coarse_solver_db = input_db->getDatabase("coarse_solver_db");
         }
+        if (input_db->keyExists("use_single_precision_smoother"))
+            d_use_single_precision_smoother = input_db->getBool("use_single_precision_smoother");
         if (input_db->isDatabase("bottom_solver"))
         {
             tbox::pout << "WARNING: ``bottom_solver'' input entry is no longer used by class "
@@ -391,6 +491,10 @@ CCPoissonPointRelaxationFACOperator::CCPoissonPointRelaxationFACOperator(const s
     // Configure the coarse level solver.
     setCoarseSolverType(d_coarse_solver_type);
 
+    // Setup single-precision scratch variables used by the smoother.
+    d_error_sp_idx = register_single_precision_scratch_variable(d_object_name + "::error_sp", d_context, d_gcw);
+    d_residual_sp_idx = register_single_precision_scratch_variable(d_object_name + "::residual_sp", d_context, d_gcw);
+
     // Setup Timers.
     IBTK_DO_ONCE(t_smooth_error =
                      TimerManager::getManager()->getTimer("IBTK::CCPoissonPointRelaxationFACOperator::smoothError()");
@@ -437,6 +541,34 @@ CCPoissonPointRelaxationFACOperator::setCoarseSolverType(const std::string& coar
     return;
 } // setCoarseSolverType
 
+void
+CCPoissonPointRelaxationFACOperator::setUseSinglePrecisionSmoother(const bool use_single_precision_smoother)
+{
+    if (d_is_initialized)
+    {
+        TBOX_ERROR(d_object_name << "::setUseSinglePrecisionSmoother():\n"
+                                 << "  cannot be called while operator state is initialized" << std::endl);
+    }
+    d_use_single_precision_smoother = use_single_precision_smoother;
+    return;
+} // setUseSinglePrecisionSmoother
+
+void
+CCPoissonPointRelaxationFACOperator::setPoissonSpecifications(const PoissonSpecifications& poisson_spec)
+{
+    PoissonFACPreconditionerStrategy::setPoissonSpecifications(poisson_spec);
+    if (d_coarsened_level_op) d_coarsened_level_op->setPoissonSpecifications(poisson_spec);
+    return;
+} // setPoissonSpecifications
+
+void
+CCPoissonPointRelaxationFACOperator::setPhysicalBcCoefs(const std::vector<RobinBcCoefStrategy<NDIM>*>& bc_coefs)
+{
+    PoissonFACPreconditionerStrategy::setPhysicalBcCoefs(bc_coefs);
+    if (d_coarsened_level_op) d_coarsened_level_op->setPhysicalBcCoefs(d_bc_coefs);
+    return;
+} // setPhysicalBcCoefs
+
 void
 CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>& error,
                                                  const SAMRAIVectorReal<NDIM, double>& residual,
@@ -462,6 +594,27 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     const bool red_black_ordering = use_red_black_ordering(smoother_type);
     const bool update_local_data = do_local_data_update(smoother_type);
 
+    // When using the single-precision smoother, the sweeps update copies of
+    // the error and residual stored in single precision.  Between sweeps, only
+    // the values near the patch boundaries that are needed to fill ghost cells
+    // are copied back to the double-precision error.
+    const bool use_single_precision =
+        d_use_single_precision_smoother && d_poisson_spec.dIsConstant() && !d_poisson_spec.cIsVariable();
+    const IntVector<NDIM> sp_bdry_layer_width = d_gcw * 2;
+    if (use_single_precision)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, double> > residual_data = residual.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, float> > error_sp_data = patch->getPatchData(d_error_sp_idx);
+            Pointer<CellData<NDIM, float> > residual_sp_data = patch->getPatchData(d_residual_sp_idx);
+            copy_cell_data(*error_sp_data, *error_data, BoxList<NDIM>(error_data->getGhostBox()));
+            copy_cell_data(*residual_sp_data, *residual_data, BoxList<NDIM>(patch->getBox()));
+        }
+    }
+
     // Cache coarse-fine interface ghost cell values in the "scratch" data.
     if (level_num > d_coarsest_ln && num_sweeps > 1)
     {
@@ -486,6 +639,22 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
     if (red_black_ordering) num_sweeps *= 2;
     for (int isweep = 0; isweep < num_sweeps; ++isweep)
     {
+        // Copy the values near the patch boundaries from the single-precision
+        // error data into the error data.
+        if (use_single_precision && isweep > 0)
+        {
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                Pointer<CellData<NDIM, float> > error_sp_data = patch->getPatchData(d_error_sp_idx);
+                const Box<NDIM>& patch_box = patch->getBox();
+                BoxList<NDIM> bdry_layer_boxes(patch_box);
+                bdry_layer_boxes.removeIntersections(Box<NDIM>::grow(patch_box, -sp_bdry_layer_width));
+                copy_cell_data(*error_data, *error_sp_data, bdry_layer_boxes);
+            }
+        }
+
         // Re-fill ghost cell data as needed.
         if (level_num > d_coarsest_ln)
         {
@@ -530,6 +699,20 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             xeqScheduleGhostFillNoCoarse(error_idx, level_num);
         }
 
+        // Copy the ghost cell values into the single-precision error data.
+        if (use_single_precision && (level_num > d_coarsest_ln || isweep > 0))
+        {
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+                Pointer<CellData<NDIM, float> > error_sp_data = patch->getPatchData(d_error_sp_idx);
+                BoxList<NDIM> ghost_boxes(error_data->getGhostBox());
+                ghost_boxes.removeIntersections(patch->getBox());
+                copy_cell_data(*error_sp_data, *error_data, ghost_boxes);
+            }
+        }
+
         // Smooth the error on the patches.
         int patch_counter = 0;
         for (PatchLevel<NDIM>::Iterator p(level); p; p++, ++patch_counter)
@@ -548,6 +731,13 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
             const double* const dx = pgeom->getDx();
 
+            Pointer<CellData<NDIM, float> > error_sp_data, residual_sp_data;
+            if (use_single_precision)
+            {
+                error_sp_data = patch->getPatchData(d_error_sp_idx);
+                residual_sp_data = patch->getPatchData(d_residual_sp_idx);
+            }
+
             // Copy updated values from neighboring local patches.
             if (update_local_data)
             {
@@ -557,8 +747,17 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                     const int src_patch_num = pair.first;
                     const Box<NDIM>& overlap = pair.second;
                     Pointer<Patch<NDIM> > src_patch = level->getPatch(src_patch_num);
-                    Pointer<CellData<NDIM, double> > src_error_data = error.getComponentPatchData(0, *src_patch);
-                    error_data->getArrayData().copy(src_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
+                    if (use_single_precision)
+                    {
+                        Pointer<CellData<NDIM, float> > src_error_sp_data = src_patch->getPatchData(d_error_sp_idx);
+                        error_sp_data->getArrayData().copy(
+                            src_error_sp_data->getArrayData(), overlap, IntVector<NDIM>(0));
+                    }
+                    else
+                    {
+                        Pointer<CellData<NDIM, double> > src_error_data = error.getComponentPatchData(0, *src_patch);
+                        error_data->getArrayData().copy(src_error_data->getArrayData(), overlap, IntVector<NDIM>(0));
+                    }
                 }
             }
 
@@ -601,7 +800,50 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
                 const int U_ghosts = (error_data->getGhostCellWidth()).max();
                 const double* const F = residual_data->getPointer(depth);
                 const int F_ghosts = (residual_data->getGhostCellWidth()).max();
-                if (D_is_constant && !C_is_var)
+                if (use_single_precision)
+                {
+                    float* const U_sp = error_sp_data->getPointer(depth);
+                    const float* const F_sp = residual_sp_data->getPointer(depth);
+                    if (red_black_ordering)
+                    {
+                        int red_or_black = isweep % 2; // "red" = 0, "black" = 1
+                        SMOOTH_GS_RB_CONST_DC_SP_FC(U_sp,
+                                                    U_ghosts,
+                                                    D,
+                                                    C,
+                                                    F_sp,
+                                                    F_ghosts,
+                                                    patch_box.lower(0),
+                                                    patch_box.upper(0),
+                                                    patch_box.lower(1),
+                                                    patch_box.upper(1),
+#if (NDIM == 3)
+                                                    patch_box.lower(2),
+                                                    patch_box.upper(2),
+#endif
+                                                    dx,
+                                                    red_or_black);
+                    }
+                    else
+                    {
+                        SMOOTH_GS_CONST_DC_SP_FC(U_sp,
+                                                 U_ghosts,
+                                                 D,
+                                                 C,
+                                                 F_sp,
+                                                 F_ghosts,
+                                                 patch_box.lower(0),
+                                                 patch_box.upper(0),
+                                                 patch_box.lower(1),
+                                                 patch_box.upper(1),
+#if (NDIM == 3)
+                                                 patch_box.lower(2),
+                                                 patch_box.upper(2),
+#endif
+                                                 dx);
+                    }
+                }
+                else if (D_is_constant && !C_is_var)
                 {
                     if (red_black_ordering)
                     {
@@ -804,6 +1046,18 @@ CCPoissonPointRelaxationFACOperator::smoothError(SAMRAIVectorReal<NDIM, double>&
             }
         }
     }
+
+    // Copy the smoothed values back into the error data.
+    if (use_single_precision)
+    {
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > error_data = error.getComponentPatchData(0, *patch);
+            Pointer<CellData<NDIM, float> > error_sp_data = patch->getPatchData(d_error_sp_idx);
+            copy_cell_data(*error_data, *error_sp_data, BoxList<NDIM>(patch->getBox()));
+        }
+    }
     IBTK_TIMER_STOP(t_smooth_error);
     return;
 } // smoothError
@@ -907,6 +1161,44 @@ CCPoissonPointRelaxationFACOperator::computeResidual(SAMRAIVectorReal<NDIM, doub
     return;
 } // computeResidual
 
+Pointer<FACPreconditionerStrategy>
+CCPoissonPointRelaxationFACOperator::createCoarsenedLevelStrategy(const std::string& object_name)
+{
+    // Variable coefficients are not defined on the coarsened levels.
+    if (!d_poisson_spec.cIsConstant() || !d_poisson_spec.dIsConstant())
+    {
+        d_coarsened_level_op.setNull();
+        return Pointer<FACPreconditionerStrategy>(nullptr);
+    }
+
+    Pointer<Database> input_db = new MemoryDatabase(object_name + "::input_db");
+    input_db->putInteger("ghost_cell_width", d_gcw.max());
+    input_db->putString("smoother_type", d_smoother_type);
+    input_db->putString("prolongation_method", d_prolongation_method);
+    input_db->putString("restriction_method", d_restriction_method);
+    input_db->putDouble("coarse_solver_rel_residual_tol", d_coarse_solver_rel_residual_tol);
+    input_db->putDouble("coarse_solver_abs_residual_tol", d_coarse_solver_abs_residual_tol);
+    input_db->putInteger("coarse_solver_max_iterations", d_coarse_solver_max_iterations);
+    input_db->putString("coarse_solver_prefix", d_coarse_solver_default_options_prefix);
+    input_db->putBool("use_single_precision_smoother", d_use_single_precision_smoother);
+    d_coarsened_level_op = new CCPoissonPointRelaxationFACOperator(object_name, input_db, "");
+
+    // The coarse level solver of the new operator uses the same configuration
+    // as the coarse level solver of this operator.
+    d_coarsened_level_op->d_coarse_solver_db = d_coarse_solver_db;
+    d_coarsened_level_op->d_coarse_solver.setNull();
+    d_coarsened_level_op->setCoarseSolverType(d_coarse_solver_type);
+
+    // Like the coarse level solver, the operator on the coarsened levels solves
+    // for the error and always employs homogeneous boundary conditions.
+    d_coarsened_level_op->setPoissonSpecifications(d_poisson_spec);
+    d_coarsened_level_op->setPhysicalBcCoefs(d_bc_coefs);
+    d_coarsened_level_op->setHomogeneousBc(true);
+    d_coarsened_level_op->setSolutionTime(d_solution_time);
+    d_coarsened_level_op->setTimeInterval(d_current_time, d_new_time);
+    return d_coarsened_level_op;
+} // createCoarsenedLevelStrategy
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
@@ -942,8 +1234,26 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
         var_db->getPatchDescriptor()->getPatchDataFactory(d_scratch_idx);
     scratch_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
 
-    // Initialize the coarse level solvers when needed.
-    if (coarsest_reset_ln == d_coarsest_ln && d_coarse_solver)
+    // Allocate single-precision scratch data used by the smoother.
+    if (d_use_single_precision_smoother)
+    {
+        for (const int sp_idx : { d_error_sp_idx, d_residual_sp_idx })
+        {
+            Pointer<CellDataFactory<NDIM, float> > sp_pdat_fac =
+                var_db->getPatchDescriptor()->getPatchDataFactory(sp_idx);
+            sp_pdat_fac->setDefaultDepth(solution_pdat_fac->getDefaultDepth());
+            for (int ln = coarsest_reset_ln; ln <= finest_reset_ln; ++ln)
+            {
+                Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+                if (!level->checkAllocated(sp_idx)) level->allocatePatchData(sp_idx);
+            }
+        }
+    }
+
+    // Initialize the coarse level solvers when needed.  The coarse level solver
+    // is not used when the preconditioner solves on coarsened levels.
+    const bool use_coarsened_levels = d_preconditioner && d_preconditioner->getNumCoarsenedLevels() > 0;
+    if (coarsest_reset_ln == d_coarsest_ln && d_coarse_solver && !use_coarsened_levels)
     {
         // Note that since the coarse level solver is solving for the error, it
         // must always employ homogeneous boundary conditions.
@@ -1020,11 +1330,19 @@ CCPoissonPointRelaxationFACOperator::initializeOperatorStateSpecialized(const SA
 } // initializeOperatorStateSpecialized
 
 void
-CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int /*coarsest_reset_ln*/,
-                                                                        const int /*finest_reset_ln*/)
+CCPoissonPointRelaxationFACOperator::deallocateOperatorStateSpecialized(const int coarsest_reset_ln,
+                                                                        const int finest_reset_ln)
 {
     if (!d_is_initialized) return;
 
+    // Deallocate single-precision scratch data.
+    for (int ln = coarsest_reset_ln; ln <= std::min(d_finest_ln, finest_reset_ln); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        if (level->checkAllocated(d_error_sp_idx)) level->deallocatePatchData(d_error_sp_idx);
+        if (level->checkAllocated(d_residual_sp_idx)) level->deallocatePatchData(d_residual_sp_idx);
+    }
+
     if (!d_in_initialize_operator_state)
     {
         d_patch_bc_box_overlap.clear();
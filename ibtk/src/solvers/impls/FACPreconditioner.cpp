@@ -13,21 +13,36 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/CartCellDoubleCubicCoarsen.h"
+#include "ibtk/CartSideDoubleCubicCoarsen.h"
 #include "ibtk/FACPreconditioner.h"
 #include "ibtk/FACPreconditionerStrategy.h"
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/LinearSolver.h"
+#include "ibtk/box_utilities.h"
 #include "ibtk/ibtk_enums.h"
+#include "ibtk/ibtk_utilities.h"
 
+#include "Box.h"
+#include "BoxArray.h"
+#include "CartesianGridGeometry.h"
+#include "IntVector.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
+#include "PatchData.h"
 #include "PatchHierarchy.h"
+#include "PatchLevel.h"
+#include "ProcessorMapping.h"
 #include "SAMRAIVectorReal.h"
 #include "tbox/Database.h"
+#include "tbox/MemoryDatabase.h"
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "ibtk/namespaces.h" // IWYU pragma: keep
 
@@ -37,6 +52,90 @@ namespace IBTK
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// Return whether each box can be coarsened exactly by the specified ratio and
+// whether the coarsened boxes have at least the specified number of cells in
+// each coordinate direction.
+bool
+can_coarsen_boxes(const BoxArray<NDIM>& boxes, const int ratio, const int min_box_size)
+{
+    for (int i = 0; i < boxes.size(); ++i)
+    {
+        const Box<NDIM> coarse_box = Box<NDIM>::coarsen(boxes[i], IntVector<NDIM>(ratio));
+        if (Box<NDIM>::refine(coarse_box, IntVector<NDIM>(ratio)) != boxes[i]) return false;
+        if (coarse_box.numberCells().min() < min_box_size) return false;
+    }
+    return true;
+} // can_coarsen_boxes
+
+// Reassign the boxes of a level to the first num_procs processors, merging the
+// boxes that are assigned to the same processor where possible.
+void
+agglomerate_boxes(BoxArray<NDIM>& boxes, ProcessorMapping& mapping, const int num_procs)
+{
+    const int n_nodes = IBTK_MPI::getNodes();
+    std::vector<std::vector<Box<NDIM> > > proc_boxes(num_procs);
+    for (int i = 0; i < boxes.size(); ++i)
+    {
+        proc_boxes[(mapping.getProcessorAssignment(i) * num_procs) / n_nodes].push_back(boxes[i]);
+    }
+
+    std::vector<std::pair<int, Box<NDIM> > > new_boxes;
+    for (int r = 0; r < num_procs; ++r)
+    {
+        if (proc_boxes[r].empty()) continue;
+        for (const Box<NDIM>& box : merge_boxes_by_longest_edge(proc_boxes[r])) new_boxes.emplace_back(r, box);
+    }
+
+    mapping.setMappingSize(new_boxes.size());
+    boxes.resizeBoxArray(new_boxes.size());
+    for (unsigned int i = 0; i < new_boxes.size(); ++i)
+    {
+        mapping.setProcessorAssignment(i, new_boxes[i].first);
+        boxes[i] = new_boxes[i].second;
+    }
+    return;
+} // agglomerate_boxes
+
+// Copy the components of one vector to the components of another on levels
+// with the same patches.
+void
+copy_level_data(const SAMRAIVectorReal<NDIM, double>& src_vec,
+                const Pointer<PatchLevel<NDIM> > src_level,
+                SAMRAIVectorReal<NDIM, double>& dst_vec,
+                const Pointer<PatchLevel<NDIM> > dst_level)
+{
+    for (PatchLevel<NDIM>::Iterator p(dst_level); p; p++)
+    {
+        Pointer<Patch<NDIM> > src_patch = src_level->getPatch(p());
+        Pointer<Patch<NDIM> > dst_patch = dst_level->getPatch(p());
+        for (int comp = 0; comp < dst_vec.getNumberOfComponents(); ++comp)
+        {
+            Pointer<PatchData<NDIM> > src_data = src_patch->getPatchData(src_vec.getComponentDescriptorIndex(comp));
+            Pointer<PatchData<NDIM> > dst_data = dst_patch->getPatchData(dst_vec.getComponentDescriptorIndex(comp));
+            dst_data->copy(*src_data);
+        }
+    }
+    return;
+} // copy_level_data
+
+// Return a vector that corresponds to the given vector but is restricted to a
+// single level of the patch hierarchy.
+Pointer<SAMRAIVectorReal<NDIM, double> >
+get_level_vector(const SAMRAIVectorReal<NDIM, double>& vec, const int level_num)
+{
+    Pointer<SAMRAIVectorReal<NDIM, double> > level_vec = new SAMRAIVectorReal<NDIM, double>(
+        vec.getName() + "::level_" + std::to_string(level_num), vec.getPatchHierarchy(), level_num, level_num);
+    for (int comp = 0; comp < vec.getNumberOfComponents(); ++comp)
+    {
+        level_vec->addComponent(
+            vec.getComponentVariable(comp), vec.getComponentDescriptorIndex(comp), vec.getControlVolumeIndex(comp));
+    }
+    return level_vec;
+} // get_level_vector
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FACPreconditioner::FACPreconditioner(std::string object_name,
@@ -82,6 +181,7 @@ FACPreconditioner::setSolutionTime(const double solution_time)
 {
     LinearSolver::setSolutionTime(solution_time);
     d_fac_strategy->setSolutionTime(solution_time);
+    if (d_coarsened_level_solver) d_coarsened_level_solver->setSolutionTime(solution_time);
     return;
 } // setSolutionTime
 
@@ -90,6 +190,7 @@ FACPreconditioner::setTimeInterval(const double current_time, const double new_t
 {
     LinearSolver::setTimeInterval(current_time, new_time);
     d_fac_strategy->setTimeInterval(current_time, new_time);
+    if (d_coarsened_level_solver) d_coarsened_level_solver->setTimeInterval(current_time, new_time);
     return;
 } // setTimeInterval
 
@@ -169,6 +270,10 @@ FACPreconditioner::initializeSolverState(const SAMRAIVectorReal<NDIM, double>& s
     TBOX_ASSERT(d_coarsest_ln == rhs.getCoarsestLevelNumber());
     TBOX_ASSERT(d_finest_ln == rhs.getFinestLevelNumber());
 #endif
+
+    // Setup the coarsened levels before the operator state so that the
+    // strategy object can tell whether its coarse level solver is needed.
+    initializeCoarsenedLevels(solution, rhs);
     d_fac_strategy->initializeOperatorState(solution, rhs);
 
     // Create temporary vectors.
@@ -213,6 +318,7 @@ FACPreconditioner::deallocateSolverState()
 
     // Deallocate operator state.
     d_fac_strategy->deallocateOperatorState();
+    deallocateCoarsenedLevels();
 
     // Indicate that the operator is NOT initialized.
     d_is_initialized = false;
@@ -280,6 +386,33 @@ FACPreconditioner::getNumPostSmoothingSweeps() const
     return d_num_post_sweeps;
 } // getNumPostSmoothingSweeps
 
+void
+FACPreconditioner::setMaxNumCoarsenedLevels(int max_num_coarsened_levels)
+{
+    d_max_num_coarsened_levels = max_num_coarsened_levels;
+    return;
+} // setMaxNumCoarsenedLevels
+
+void
+FACPreconditioner::setMinCoarsenedBoxSize(int min_coarsened_box_size)
+{
+    d_min_coarsened_box_size = min_coarsened_box_size;
+    return;
+} // setMinCoarsenedBoxSize
+
+void
+FACPreconditioner::setNumCoarsestLevelProcessors(int num_coarsest_level_procs)
+{
+    d_num_coarsest_level_procs = num_coarsest_level_procs;
+    return;
+} // setNumCoarsestLevelProcessors
+
+int
+FACPreconditioner::getNumCoarsenedLevels() const
+{
+    return d_num_coarsened_levels;
+} // getNumCoarsenedLevels
+
 Pointer<FACPreconditionerStrategy>
 FACPreconditioner::getFACPreconditionerStrategy() const
 {
@@ -296,7 +429,7 @@ FACPreconditioner::FACVCycleNoPreSmoothing(SAMRAIVectorReal<NDIM, double>& u,
     if (level_num == d_coarsest_ln)
     {
         // Solve Au = f on the coarsest level.
-        d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        solveCoarsestLevel(u, f, level_num);
     }
     else
     {
@@ -325,7 +458,7 @@ FACPreconditioner::muCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<N
 {
     if (level_num == d_coarsest_ln)
     {
-        d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        solveCoarsestLevel(u, f, level_num);
     }
     else
     {
@@ -351,7 +484,7 @@ FACPreconditioner::FCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<ND
 {
     if (level_num == d_coarsest_ln)
     {
-        d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        solveCoarsestLevel(u, f, level_num);
     }
     else
     {
@@ -390,8 +523,167 @@ FACPreconditioner::FMGCycle(SAMRAIVectorReal<NDIM, double>& u, SAMRAIVectorReal<
     return;
 } // FMGCycle
 
+void
+FACPreconditioner::solveCoarsestLevel(SAMRAIVectorReal<NDIM, double>& u,
+                                      SAMRAIVectorReal<NDIM, double>& f,
+                                      int level_num)
+{
+    if (!d_coarsened_level_solver)
+    {
+        d_fac_strategy->solveCoarsestLevel(u, f, level_num);
+        return;
+    }
+
+    // The preconditioner on the coarsened levels always uses a zero initial
+    // guess.  Except for V-cycles without presmoothing, the solution on the
+    // coarsest level may be nonzero, so we solve for a correction to the
+    // solution driven by the residual.
+    Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(level_num);
+    Pointer<PatchLevel<NDIM> > coarsened_level = d_coarsened_hierarchy->getPatchLevel(d_num_coarsened_levels);
+    if (d_r)
+    {
+        d_fac_strategy->computeResidual(*d_r, u, f, level_num, level_num);
+        copy_level_data(*d_r, level, *d_coarsened_f, coarsened_level);
+    }
+    else
+    {
+        copy_level_data(f, level, *d_coarsened_f, coarsened_level);
+    }
+    d_coarsened_level_solver->solveSystem(*d_coarsened_u, *d_coarsened_f);
+    if (d_r)
+    {
+        copy_level_data(*d_coarsened_u, coarsened_level, *d_r, level);
+        Pointer<SAMRAIVectorReal<NDIM, double> > u_level = get_level_vector(u, level_num);
+        u_level->add(u_level, get_level_vector(*d_r, level_num));
+    }
+    else
+    {
+        copy_level_data(*d_coarsened_u, coarsened_level, u, level);
+    }
+    return;
+} // solveCoarsestLevel
+
 /////////////////////////////// PRIVATE //////////////////////////////////////
 
+void
+FACPreconditioner::initializeCoarsenedLevels(const SAMRAIVectorReal<NDIM, double>& solution,
+                                             const SAMRAIVectorReal<NDIM, double>& rhs)
+{
+    d_num_coarsened_levels = 0;
+    if (d_max_num_coarsened_levels <= 0 || d_coarsest_ln != 0) return;
+
+    // Determine the number of times that the patches of the coarsest level
+    // and the physical domain can be coarsened by a factor of two.
+    Pointer<PatchLevel<NDIM> > coarsest_level = d_hierarchy->getPatchLevel(d_coarsest_ln);
+    const BoxArray<NDIM>& level_boxes = coarsest_level->getBoxes();
+    const BoxArray<NDIM>& domain_boxes = coarsest_level->getPhysicalDomain();
+    int num_levels = 0;
+    while (num_levels < d_max_num_coarsened_levels &&
+           can_coarsen_boxes(level_boxes, 1 << (num_levels + 1), d_min_coarsened_box_size) &&
+           can_coarsen_boxes(domain_boxes, 1 << (num_levels + 1), 1))
+    {
+        ++num_levels;
+    }
+    if (num_levels == 0) return;
+
+    // Get the strategy object that is used on the coarsened levels.
+    Pointer<FACPreconditionerStrategy> coarsened_level_strategy =
+        d_fac_strategy->createCoarsenedLevelStrategy(d_object_name + "::coarsened_level_strategy");
+    if (!coarsened_level_strategy)
+    {
+        IBTK_DO_ONCE(TBOX_WARNING(d_object_name << "::initializeSolverState():\n"
+                                                << "  FAC strategy does not support coarsened levels.\n"
+                                                << "  using the coarse level solver of the strategy instead."
+                                                << std::endl););
+        return;
+    }
+
+    // Build the auxiliary hierarchy.  Level k of this hierarchy is obtained by
+    // coarsening the coarsest level by a factor of 2^(num_levels - k), so that
+    // its finest level has the same patches and processor mapping as the
+    // coarsest level.  The IBTK transfer operators are registered only once
+    // with the grid geometry of the patch hierarchy, so we also register them
+    // with the coarsened grid geometry.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    Pointer<CartesianGridGeometry<NDIM> > coarsened_grid_geom = grid_geom->makeCoarsenedGridGeometry(
+        d_object_name + "::coarsened_grid_geometry", IntVector<NDIM>(1 << num_levels), /*register_for_restart*/ false);
+    coarsened_grid_geom->addSpatialCoarsenOperator(new CartCellDoubleCubicCoarsen());
+    coarsened_grid_geom->addSpatialCoarsenOperator(new CartSideDoubleCubicCoarsen());
+    d_coarsened_hierarchy = new PatchHierarchy<NDIM>(
+        d_object_name + "::coarsened_hierarchy", coarsened_grid_geom, /*register_for_restart*/ false);
+    const int n_nodes = IBTK_MPI::getNodes();
+    for (int ln = 0; ln <= num_levels; ++ln)
+    {
+        BoxArray<NDIM> boxes(level_boxes);
+        boxes.coarsen(IntVector<NDIM>(1 << (num_levels - ln)));
+        ProcessorMapping mapping(coarsest_level->getProcessorMapping());
+        if (ln == 0 && d_num_coarsest_level_procs > 0 && d_num_coarsest_level_procs < n_nodes)
+        {
+            agglomerate_boxes(boxes, mapping, d_num_coarsest_level_procs);
+        }
+        d_coarsened_hierarchy->makeNewPatchLevel(ln, IntVector<NDIM>(1 << ln), boxes, mapping);
+    }
+
+    // Setup vectors on the auxiliary hierarchy.  These vectors use the same
+    // patch data descriptor indices as the solution and right-hand-side
+    // vectors.
+    d_coarsened_u = new SAMRAIVectorReal<NDIM, double>(
+        d_object_name + "::coarsened_u", d_coarsened_hierarchy, 0, num_levels);
+    d_coarsened_f = new SAMRAIVectorReal<NDIM, double>(
+        d_object_name + "::coarsened_f", d_coarsened_hierarchy, 0, num_levels);
+    for (int comp = 0; comp < solution.getNumberOfComponents(); ++comp)
+    {
+        d_coarsened_u->addComponent(solution.getComponentVariable(comp), solution.getComponentDescriptorIndex(comp));
+    }
+    for (int comp = 0; comp < rhs.getNumberOfComponents(); ++comp)
+    {
+        d_coarsened_f->addComponent(rhs.getComponentVariable(comp), rhs.getComponentDescriptorIndex(comp));
+    }
+    d_coarsened_u->allocateVectorData();
+    d_coarsened_f->allocateVectorData();
+
+    // Setup the preconditioner on the coarsened levels.
+    Pointer<Database> solver_db = new MemoryDatabase(d_object_name + "::coarsened_level_solver_db");
+    solver_db->putString("cycle_type", enum_to_string<MGCycleType>(d_cycle_type));
+    solver_db->putInteger("num_pre_sweeps", d_num_pre_sweeps);
+    solver_db->putInteger("num_post_sweeps", d_num_post_sweeps);
+    solver_db->putBool("enable_logging", d_enable_logging);
+    d_coarsened_level_solver =
+        new FACPreconditioner(d_object_name + "::coarsened_level_solver", coarsened_level_strategy, solver_db, "");
+    d_coarsened_level_solver->setSolutionTime(d_solution_time);
+    d_coarsened_level_solver->setTimeInterval(d_current_time, d_new_time);
+    d_coarsened_level_solver->initializeSolverState(*d_coarsened_u, *d_coarsened_f);
+    d_num_coarsened_levels = num_levels;
+    return;
+} // initializeCoarsenedLevels
+
+void
+FACPreconditioner::deallocateCoarsenedLevels()
+{
+    if (d_coarsened_level_solver)
+    {
+        d_coarsened_level_solver->deallocateSolverState();
+        d_coarsened_level_solver.setNull();
+    }
+
+    // The components of these vectors are owned by the solution and
+    // right-hand-side vectors, so we only deallocate their data.
+    if (d_coarsened_u)
+    {
+        d_coarsened_u->deallocateVectorData();
+        d_coarsened_u.setNull();
+    }
+    if (d_coarsened_f)
+    {
+        d_coarsened_f->deallocateVectorData();
+        d_coarsened_f.setNull();
+    }
+
+    d_coarsened_hierarchy.setNull();
+    d_num_coarsened_levels = 0;
+    return;
+} // deallocateCoarsenedLevels
+
 void
 FACPreconditioner::getFromInput(tbox::Pointer<tbox::Database> db)
 {
@@ -400,6 +692,11 @@ FACPreconditioner::getFromInput(tbox::Pointer<tbox::Database> db)
     if (db->keyExists("num_pre_sweeps")) setNumPreSmoothingSweeps(db->getInteger("num_pre_sweeps"));
     if (db->keyExists("num_post_sweeps")) setNumPostSmoothingSweeps(db->getInteger("num_post_sweeps"));
     if (db->keyExists("enable_logging")) setLoggingEnabled(db->getBool("enable_logging"));
+    if (db->keyExists("max_num_coarsened_levels"))
+        setMaxNumCoarsenedLevels(db->getInteger("max_num_coarsened_levels"));
+    if (db->keyExists("min_coarsened_box_size")) setMinCoarsenedBoxSize(db->getInteger("min_coarsened_box_size"));
+    if (db->keyExists("num_coarsest_level_procs"))
+        setNumCoarsestLevelProcessors(db->getInteger("num_coarsest_level_procs"));
     return;
 } // getFromInput
 
@@ -130,6 +130,10 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
         {
             if (input_db->keyExists("two_norm")) d_two_norm = input_db->getInteger("two_norm");
         }
+
+        if (input_db->keyExists("reuse_hypre_data")) d_reuse_hypre_data = input_db->getBool("reuse_hypre_data");
+        if (input_db->keyExists("solver_setup_reuse_tol"))
+            d_solver_setup_reuse_tol = input_db->getDouble("solver_setup_reuse_tol");
     }
 
     // Setup Timers.
@@ -147,6 +151,7 @@ SCPoissonHypreLevelSolver::SCPoissonHypreLevelSolver(const std::string& object_n
 SCPoissonHypreLevelSolver::~SCPoissonHypreLevelSolver()
 {
     if (d_is_initialized) deallocateSolverState();
+    if (d_hypre_data_retained) releaseHypreData();
     return;
 } // ~SCPoissonHypreLevelSolver
 
@@ -252,6 +257,8 @@ SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
     if (d_is_initialized) deallocateSolverState();
 
     // Get the hierarchy information.
+    const Pointer<PatchHierarchy<NDIM> > prev_hierarchy = d_hierarchy;
+    const int prev_level_num = d_level_num;
     d_hierarchy = x.getPatchHierarchy();
     d_level_num = x.getCoarsestLevelNumber();
     TBOX_ASSERT(d_level_num == x.getFinestLevelNumber());
@@ -261,10 +268,36 @@ SCPoissonHypreLevelSolver::initializeSolverState(const SAMRAIVectorReal<NDIM, do
         d_cf_boundary = new CoarseFineBoundary<NDIM>(*d_hierarchy, d_level_num, IntVector<NDIM>(1));
     }
 
-    // Allocate and initialize the hypre data structures.
-    allocateHypreData();
+    // Reuse any retained hypre data structures if the layout of the level is
+    // unchanged.  Otherwise, create new ones.
+    std::vector<Box<NDIM> > patch_boxes;
+    for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
+    {
+        patch_boxes.push_back(d_level->getPatch(p())->getBox());
+    }
+    const bool reuse_hypre_data = d_hypre_data_retained && d_hierarchy == prev_hierarchy &&
+                                  d_level_num == prev_level_num && hypreLayoutUnchanged(d_hypre_boxes, patch_boxes);
+    if (!reuse_hypre_data)
+    {
+        if (d_hypre_data_retained) releaseHypreData();
+        allocateHypreData();
+    }
+    std::vector<double> prev_matrix_vals;
+    prev_matrix_vals.swap(d_matrix_vals);
     setMatrixCoefficients();
-    setupHypreSolver();
+
+    // Keep the existing solver setup if the matrix coefficients have not
+    // changed too much.
+    const bool reuse_solver_setup =
+        reuse_hypre_data && d_solver_setup_reuse_tol >= 0.0 &&
+        hypreMatrixRelativeChange(prev_matrix_vals, d_matrix_vals) <= d_solver_setup_reuse_tol;
+    if (!reuse_solver_setup)
+    {
+        if (reuse_hypre_data) destroyHypreSolver();
+        setupHypreSolver();
+    }
+    d_hypre_boxes = d_reuse_hypre_data ? patch_boxes : std::vector<Box<NDIM> >();
+    d_hypre_data_retained = false;
 
     // Indicate that the solver is initialized.
     d_is_initialized = true;
@@ -280,9 +313,17 @@ SCPoissonHypreLevelSolver::deallocateSolverState()
 
     IBTK_TIMER_START(t_deallocate_solver_state);
 
-    // Deallocate the hypre data structures.
-    destroyHypreSolver();
-    deallocateHypreData();
+    // Deallocate the hypre data structures, or retain them so that they can be
+    // reused by the next call to initializeSolverState().
+    if (d_reuse_hypre_data)
+    {
+        d_hypre_data_retained = true;
+    }
+    else
+    {
+        destroyHypreSolver();
+        deallocateHypreData();
+    }
 
     // Indicate that the solver is NOT initialized.
     d_is_initialized = false;
@@ -291,6 +332,21 @@ SCPoissonHypreLevelSolver::deallocateSolverState()
     return;
 } // deallocateSolverState
 
+void
+SCPoissonHypreLevelSolver::setReuseHypreData(const bool reuse_hypre_data)
+{
+    d_reuse_hypre_data = reuse_hypre_data;
+    if (!d_reuse_hypre_data && d_hypre_data_retained) releaseHypreData();
+    return;
+} // setReuseHypreData
+
+void
+SCPoissonHypreLevelSolver::setSolverSetupReuseTolerance(const double solver_setup_reuse_tol)
+{
+    d_solver_setup_reuse_tol = solver_setup_reuse_tol;
+    return;
+} // setSolverSetupReuseTolerance
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 /////////////////////////////// PRIVATE //////////////////////////////////////
@@ -384,6 +440,7 @@ SCPoissonHypreLevelSolver::allocateHypreData()
 void
 SCPoissonHypreLevelSolver::setMatrixCoefficients()
 {
+    d_matrix_vals.clear();
     for (PatchLevel<NDIM>::Iterator p(d_level); p; p++)
     {
         Pointer<Patch<NDIM> > patch = d_level->getPatch(p());
@@ -393,36 +450,41 @@ SCPoissonHypreLevelSolver::setMatrixCoefficients()
         PoissonUtilities::computeMatrixCoefficients(
             matrix_coefs, patch, d_stencil_offsets, d_poisson_spec, d_bc_coefs, d_solution_time);
 
-        // Copy matrix entries to the hypre matrix structure.
+        // Copy matrix entries to the hypre matrix structure one side box at a
+        // time.  hypre expects the stencil entries of each side to be stored
+        // contiguously.
         std::vector<HYPRE_Int> stencil_indices(stencil_size);
         std::iota(stencil_indices.begin(), stencil_indices.end(), HYPRE_Int(0));
-        std::vector<double> mat_vals(stencil_size, 0.0);
         for (unsigned int axis = 0; axis < NDIM; ++axis)
         {
-            Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
-            for (Box<NDIM>::Iterator b(side_box); b; b++)
+            const Box<NDIM> side_box = SideGeometry<NDIM>::toSideBox(patch_box, axis);
+            const std::size_t num_sides = side_box.size();
+            std::vector<double> mat_vals(stencil_size * num_sides);
+            for (unsigned int k = 0; k < stencil_size; ++k)
             {
-                SideIndex<NDIM> i(b(), axis, SideIndex<NDIM>::Lower);
-                for (unsigned int k = 0; k < stencil_size; ++k)
+                const double* const coefs = matrix_coefs.getPointer(axis, k);
+                for (std::size_t c = 0; c < num_sides; ++c)
                 {
-                    mat_vals[k] = matrix_coefs(i, k);
+                    mat_vals[c * stencil_size + k] = coefs[c];
                 }
-                // NOTE: In SAMRAI, face-centered values are associated with the
-                // cell index located on the "upper" side of the face, but in
-                // hypre, face-centered values are associated with the cell
-                // index located on the "lower" side of the face. Similarly,
-                // in SAMRAI the index stores its axis, but here hypre expects
-                // that to be a second argument (so slicing i is okay).
-                i(axis) -= 1;
-                auto hypre_i = hypre_array(i);
-                HYPRE_SStructMatrixSetValues(d_matrix,
-                                             PART,
-                                             hypre_i.data(),
-                                             axis,
-                                             stencil_indices.size(),
-                                             stencil_indices.data(),
-                                             mat_vals.data());
             }
+            // NOTE: In SAMRAI, face-centered values are associated with the
+            // cell index located on the "upper" side of the face, but in hypre,
+            // face-centered values are associated with the cell index located
+            // on the "lower" side of the face.
+            auto lower = hypre_array(side_box.lower());
+            auto upper = hypre_array(side_box.upper());
+            lower[axis] -= 1;
+            upper[axis] -= 1;
+            HYPRE_SStructMatrixSetBoxValues(d_matrix,
+                                            PART,
+                                            lower.data(),
+                                            upper.data(),
+                                            axis,
+                                            stencil_indices.size(),
+                                            stencil_indices.data(),
+                                            mat_vals.data());
+            if (d_reuse_hypre_data) d_matrix_vals.insert(d_matrix_vals.end(), mat_vals.begin(), mat_vals.end());
         }
     }
 
@@ -893,6 +955,17 @@ SCPoissonHypreLevelSolver::deallocateHypreData()
     return;
 } // deallocateHypreData
 
+void
+SCPoissonHypreLevelSolver::releaseHypreData()
+{
+    destroyHypreSolver();
+    deallocateHypreData();
+    d_hypre_boxes.clear();
+    d_matrix_vals.clear();
+    d_hypre_data_retained = false;
+    return;
+} // releaseHypreData
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBTK
@@ -141,6 +141,135 @@ c
 c
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
+c     Perform a single Gauss-Seidel sweep for F = D div grad U +
+c     C U. Both D and C coefficients are constant.
+c
+c     The solution and right-hand side are stored in single precision;
+c     the update is computed in double precision.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine smooth_gs_const_dc_sp_2d(
+     &     U,U_gcw,
+     &     D,C,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw
+
+      REAL D,C
+
+      real F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      real U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,fac
+c
+c     Perform a single Gauss-Seidel sweep.
+c
+      fac0 = D/(dx(0)*dx(0))
+      fac1 = D/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*C)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            U(i0,i1) = real(fac*(
+     &           fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &           fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &           F(i0,i1)))
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Perform a single "red" or "black" Gauss-Seidel sweep for F = D
+c     div grad U + C U. Both D and C coefficients
+c     are constant.
+c
+c     The solution and right-hand side are stored in single precision;
+c     the update is computed in double precision.
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine smooth_gs_rb_const_dc_sp_2d(
+     &     U,U_gcw,
+     &     D,C,
+     &     F,F_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dx,
+     &     red_or_black)
+c
+      implicit none
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER U_gcw,F_gcw
+      INTEGER red_or_black
+
+      REAL D,C
+
+      real F(ilower0-F_gcw:iupper0+F_gcw,
+     &       ilower1-F_gcw:iupper1+F_gcw)
+
+      REAL dx(0:NDIM-1)
+c
+c     Input/Output.
+c
+      real U(ilower0-U_gcw:iupper0+U_gcw,
+     &       ilower1-U_gcw:iupper1+U_gcw)
+c
+c     Local variables.
+c
+      INTEGER i0,i1
+      REAL    fac0,fac1,fac
+c
+c     Perform a single "red" or "black" Gauss-Seidel sweep.
+c
+      red_or_black = mod(red_or_black,2) ! "red" = 0, "black" = 1
+
+      fac0 = D/(dx(0)*dx(0))
+      fac1 = D/(dx(1)*dx(1))
+      fac = 0.5d0/(fac0+fac1-0.5d0*C)
+
+      do i1 = ilower1,iupper1
+         do i0 = ilower0,iupper0
+            if ( mod(i0+i1,2) .eq. red_or_black ) then
+               U(i0,i1) = real(fac*(
+     &              fac0*(U(i0-1,i1)+U(i0+1,i1)) +
+     &              fac1*(U(i0,i1-1)+U(i0,i1+1)) -
+     &              F(i0,i1)))
+            endif
+         enddo
+      enddo
+c
+      return
+      end
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
 c     Perform a single Gauss-Seidel sweep for F = alpha div grad U +
 c     beta U with masking of certain degrees of freedom.
 c
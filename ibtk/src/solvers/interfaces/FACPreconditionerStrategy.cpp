@@ -135,6 +135,12 @@ FACPreconditionerStrategy::deallocateScratchData()
     return;
 }
 
+Pointer<FACPreconditionerStrategy>
+FACPreconditionerStrategy::createCoarsenedLevelStrategy(const std::string& /*object_name*/)
+{
+    return Pointer<FACPreconditionerStrategy>(nullptr);
+} // createCoarsenedLevelStrategy
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 Pointer<SAMRAIVectorReal<NDIM, double> >
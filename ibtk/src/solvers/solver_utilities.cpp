@@ -13,8 +13,12 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/solver_utilities.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <memory>
 
 namespace IBTK
@@ -236,4 +240,34 @@ copyToHypre(HYPRE_SStructVector& vector,
     }
     return;
 } // copyToHypre
+
+bool
+hypreLayoutUnchanged(const std::vector<SAMRAI::hier::Box<NDIM> >& old_boxes,
+                     const std::vector<SAMRAI::hier::Box<NDIM> >& new_boxes)
+{
+    const int local_unchanged = (old_boxes == new_boxes) ? 1 : 0;
+    return IBTK_MPI::minReduction(local_unchanged) == 1;
+} // hypreLayoutUnchanged
+
+double
+hypreMatrixRelativeChange(const std::vector<double>& old_vals, const std::vector<double>& new_vals)
+{
+    // norms[0] is max |new - old| and norms[1] is max |old|.
+    double norms[2] = { 0.0, 0.0 };
+    if (old_vals.size() == new_vals.size())
+    {
+        for (std::size_t i = 0; i < old_vals.size(); ++i)
+        {
+            norms[0] = std::max(norms[0], std::abs(new_vals[i] - old_vals[i]));
+            norms[1] = std::max(norms[1], std::abs(old_vals[i]));
+        }
+    }
+    else
+    {
+        norms[0] = std::numeric_limits<double>::infinity();
+    }
+    IBTK_MPI::maxReduction(norms, 2);
+    if (norms[0] == 0.0) return 0.0;
+    return norms[1] > 0.0 ? norms[0] / norms[1] : std::numeric_limits<double>::infinity();
+} // hypreMatrixRelativeChange
 } // namespace IBTK
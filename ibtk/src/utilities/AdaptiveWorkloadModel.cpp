@@ -0,0 +1,113 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/AdaptiveWorkloadModel.h"
+#include "ibtk/IBTK_MPI.h"
+
+#include "tbox/Utilities.h"
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+AdaptiveWorkloadModel::AdaptiveWorkloadModel(const unsigned int window_size) : d_window_size(window_size)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(window_size > 0);
+#endif
+    return;
+} // AdaptiveWorkloadModel
+
+void
+AdaptiveWorkloadModel::addSample(const double cell_time,
+                                 const double num_cells,
+                                 const double particle_time,
+                                 const double num_particles)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(num_cells >= 0.0);
+    TBOX_ASSERT(num_particles >= 0.0);
+#endif
+    if (d_samples.size() == d_window_size) d_samples.pop_front();
+    d_samples.push_back({ cell_time, num_cells, particle_time, num_particles });
+    return;
+} // addSample
+
+bool
+AdaptiveWorkloadModel::computeCosts()
+{
+    // Each cost c minimizes sum_i (t_i - c n_i)^2 over all samples i on all
+    // processes, i.e., c = sum_i t_i n_i / sum_i n_i^2.
+    double sums[4] = { 0.0, 0.0, 0.0, 0.0 };
+    for (const Sample& sample : d_samples)
+    {
+        sums[0] += sample.cell_time * sample.num_cells;
+        sums[1] += sample.num_cells * sample.num_cells;
+        sums[2] += sample.particle_time * sample.num_particles;
+        sums[3] += sample.num_particles * sample.num_particles;
+    }
+    IBTK_MPI::sumReduction(sums, 4);
+    if (sums[0] <= 0.0 || sums[1] <= 0.0 || sums[2] <= 0.0 || sums[3] <= 0.0) return false;
+    d_cell_cost = sums[0] / sums[1];
+    d_particle_cost = sums[2] / sums[3];
+    return true;
+} // computeCosts
+
+double
+AdaptiveWorkloadModel::getCellCost() const
+{
+    return d_cell_cost;
+} // getCellCost
+
+double
+AdaptiveWorkloadModel::getParticleCost() const
+{
+    return d_particle_cost;
+} // getParticleCost
+
+double
+AdaptiveWorkloadModel::getRelativeParticleWeight() const
+{
+    return d_cell_cost > 0.0 ? d_particle_cost / d_cell_cost : 1.0;
+} // getRelativeParticleWeight
+
+unsigned int
+AdaptiveWorkloadModel::getNumberOfSamples() const
+{
+    return static_cast<unsigned int>(d_samples.size());
+} // getNumberOfSamples
+
+void
+AdaptiveWorkloadModel::clear()
+{
+    d_samples.clear();
+    return;
+} // clear
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -246,6 +246,10 @@ AppInitializer::AppInitializer(int argc, char* argv[], const std::string& defaul
         if (viz_writer == "Silo")
         {
             d_silo_data_writer = new LSiloDataWriter("LSiloDataWriter", d_viz_dump_dirname);
+            if (main_db->keyExists("silo_number_procs_per_file"))
+                d_silo_data_writer->setNumberOfProcessorsPerFile(main_db->getInteger("silo_number_procs_per_file"));
+            if (main_db->keyExists("silo_asynchronous_output"))
+                d_silo_data_writer->setAsynchronousOutput(main_db->getBool("silo_asynchronous_output"));
         }
 
         if (viz_writer == "ExodusII")
@@ -17,6 +17,7 @@
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/LSiloDataWriter.h"
 #include "ibtk/RefinePatchStrategySet.h"
 #include "ibtk/ibtk_enums.h"
 #include "ibtk/ibtk_utilities.h"
@@ -601,6 +602,11 @@ HierarchyIntegrator::getVisItDataWriter() const
 void
 HierarchyIntegrator::setupPlotData()
 {
+    // Plot data are written immediately after this function is called, and
+    // VisItDataWriter does not synchronize its use of Silo with data that are
+    // being written asynchronously.
+    LSiloDataWriter::waitForAllPendingOutput();
+
     setupPlotDataSpecialized();
     for (const auto& child_integrator : d_child_integrators)
     {
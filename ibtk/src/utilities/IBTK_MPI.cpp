@@ -16,7 +16,9 @@
 #include <ibtk/IBTK_MPI.h>
 
 #include <tbox/SAMRAI_MPI.h>
+#include <tbox/Utilities.h>
 
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -24,6 +26,7 @@
 namespace IBTK
 {
 MPI_Comm IBTK_MPI::s_communicator = MPI_COMM_WORLD;
+double IBTK_MPI::s_collective_time = 0.0;
 
 void
 IBTK_MPI::setCommunicator(MPI_Comm communicator)
@@ -66,14 +69,22 @@ IBTK_MPI::getRank()
 void
 IBTK_MPI::barrier()
 {
+    CollectiveTimer timer;
     (void)MPI_Barrier(IBTK_MPI::getCommunicator());
 } // barrier
 
+double
+IBTK_MPI::getCollectiveTime()
+{
+    return s_collective_time;
+} // getCollectiveTime
+
 void
 IBTK_MPI::allToOneSumReduction(int* x, const int n, const int root)
 {
     if (getNodes() > 1)
     {
+        CollectiveTimer timer;
         if (IBTK_MPI::getRank() == root)
             MPI_Reduce(MPI_IN_PLACE, x, n, MPI_INT, MPI_SUM, root, IBTK_MPI::getCommunicator());
         else
@@ -98,6 +109,61 @@ IBTK_MPI::recvBytes(void* buf, int number_bytes)
     return rval;
 } // recvBytes
 
+IBTK_MPI::SumReductionBatch::~SumReductionBatch()
+{
+    if (!d_arrays.empty()) wait();
+} // ~SumReductionBatch
+
+void
+IBTK_MPI::SumReductionBatch::add(double* const x, const int n)
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_started);
+    TBOX_ASSERT(n >= 0);
+#endif
+    if (n > 0) d_arrays.emplace_back(x, n);
+} // add
+
+void
+IBTK_MPI::SumReductionBatch::start()
+{
+#if !defined(NDEBUG)
+    TBOX_ASSERT(!d_started);
+#endif
+    d_started = true;
+    if (d_arrays.empty() || getNodes() < 2) return;
+    d_payload.clear();
+    for (const auto& array : d_arrays) d_payload.insert(d_payload.end(), array.first, array.first + array.second);
+    const int ierr = MPI_Iallreduce(MPI_IN_PLACE,
+                                    d_payload.data(),
+                                    static_cast<int>(d_payload.size()),
+                                    MPI_DOUBLE,
+                                    MPI_SUM,
+                                    IBTK_MPI::getCommunicator(),
+                                    &d_request);
+    TBOX_ASSERT(ierr == 0);
+} // start
+
+void
+IBTK_MPI::SumReductionBatch::wait()
+{
+    if (!d_started) start();
+    if (d_request != MPI_REQUEST_NULL)
+    {
+        CollectiveTimer timer;
+        const int ierr = MPI_Wait(&d_request, MPI_STATUS_IGNORE);
+        TBOX_ASSERT(ierr == 0);
+        auto payload_it = d_payload.cbegin();
+        for (const auto& array : d_arrays)
+        {
+            std::copy(payload_it, payload_it + array.second, array.first);
+            payload_it += array.second;
+        }
+    }
+    d_arrays.clear();
+    d_started = false;
+} // wait
+
 //////////////////////////////////////  PRIVATE  ///////////////////////////////////////////////////
 
 void
@@ -13,18 +13,31 @@
 
 /////////////////////////////// INCLUDES /////////////////////////////////////
 
+#include <ibtk/IBTK_MPI.h>
 #include <ibtk/SnapshotCache.h>
 #include <ibtk/ibtk_utilities.h>
 
 #include <tbox/RestartManager.h>
+#include <tbox/Utilities.h>
 
+#include <ArrayData.h>
 #include <CartesianGridGeometry.h>
+#include <CellData.h>
+#include <EdgeData.h>
+#include <FaceData.h>
 #include <HierarchyDataOpsManager.h>
+#include <NodeData.h>
 #include <RefineAlgorithm.h>
 #include <RefineOperator.h>
+#include <SideData.h>
 #include <VariableDatabase.h>
 
 #include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 
 #include <ibtk/app_namespaces.h> // IWYU pragma: keep
 
@@ -32,6 +45,108 @@
 
 namespace IBTK
 {
+namespace
+{
+/*!
+ * Get the arrays that store the values of patch data of type double.
+ */
+std::vector<ArrayData<NDIM, double>*>
+get_array_data(const Pointer<PatchData<NDIM> >& data)
+{
+    std::vector<ArrayData<NDIM, double>*> arrays;
+    Pointer<CellData<NDIM, double> > cc_data = data;
+    Pointer<NodeData<NDIM, double> > nc_data = data;
+    Pointer<SideData<NDIM, double> > sc_data = data;
+    Pointer<FaceData<NDIM, double> > fc_data = data;
+    Pointer<EdgeData<NDIM, double> > ec_data = data;
+    if (cc_data) arrays.push_back(&cc_data->getArrayData());
+    if (nc_data) arrays.push_back(&nc_data->getArrayData());
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        if (sc_data && sc_data->getDirectionVector()(axis)) arrays.push_back(&sc_data->getArrayData(axis));
+        if (fc_data) arrays.push_back(&fc_data->getArrayData(axis));
+        if (ec_data) arrays.push_back(&ec_data->getArrayData(axis));
+    }
+    if (arrays.empty())
+    {
+        TBOX_ERROR("SnapshotCache: paging snapshots requires cell, node, side, face, or edge data of type double.\n");
+    }
+    return arrays;
+} // get_array_data
+
+/*!
+ * Append n values to a buffer. If compress is true, each value is XORed with the previous value and only the low-order
+ * bytes that are not zero are stored. The numbers of leading zero bytes are stored as 4-bit codes ahead of the values.
+ * The encoded values are preceded by a flag byte, and the raw values are stored instead if the encoding would not make
+ * them smaller.
+ */
+void
+encode_values(const double* const x, const std::size_t n, const bool compress, std::vector<char>& buffer)
+{
+    if (compress)
+    {
+        const std::size_t flag_offset = buffer.size();
+        buffer.push_back(1);
+        const std::size_t code_offset = buffer.size();
+        buffer.resize(code_offset + (n + 1) / 2, 0);
+        std::uint64_t prev = 0;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            std::uint64_t bits;
+            std::memcpy(&bits, &x[k], sizeof(double));
+            std::uint64_t diff = bits ^ prev;
+            prev = bits;
+            unsigned int num_bytes = 0;
+            while (num_bytes < sizeof(double) && diff >> (8 * num_bytes)) ++num_bytes;
+            buffer[code_offset + k / 2] |= static_cast<char>((sizeof(double) - num_bytes) << (4 * (k % 2)));
+            for (unsigned int b = 0; b < num_bytes; ++b)
+            {
+                buffer.push_back(static_cast<char>(diff & 0xff));
+                diff >>= 8;
+            }
+        }
+        if (buffer.size() - code_offset < n * sizeof(double)) return;
+
+        // The encoding did not pay off, so store the raw values.
+        buffer.resize(flag_offset);
+        buffer.push_back(0);
+    }
+
+    const char* const bytes = reinterpret_cast<const char*>(x);
+    buffer.insert(buffer.end(), bytes, bytes + n * sizeof(double));
+    return;
+} // encode_values
+
+/*!
+ * Read n values encoded by encode_values() starting at pos. Returns the position following the encoded values.
+ */
+const char*
+decode_values(const char* pos, double* const x, const std::size_t n, const bool compress)
+{
+    if (!compress || *pos++ == 0)
+    {
+        std::memcpy(x, pos, n * sizeof(double));
+        return pos + n * sizeof(double);
+    }
+
+    const unsigned char* const codes = reinterpret_cast<const unsigned char*>(pos);
+    pos += (n + 1) / 2;
+    std::uint64_t prev = 0;
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        const unsigned int num_bytes = sizeof(double) - ((codes[k / 2] >> (4 * (k % 2))) & 0xf);
+        std::uint64_t diff = 0;
+        for (unsigned int b = 0; b < num_bytes; ++b)
+        {
+            diff |= static_cast<std::uint64_t>(static_cast<unsigned char>(*pos++)) << (8 * b);
+        }
+        prev ^= diff;
+        std::memcpy(&x[k], &prev, sizeof(double));
+    }
+    return pos;
+} // decode_values
+} // namespace
+
 SnapshotCache::SnapshotCache(std::string object_name,
                              Pointer<Variable<NDIM> > var,
                              Pointer<Database> input_db,
@@ -42,7 +157,18 @@ SnapshotCache::SnapshotCache(std::string object_name,
     TBOX_ASSERT(grid_geom);
 
     if (input_db)
+    {
         if (input_db->keyExists("gcw")) input_db->getIntegerArray("gcw", &d_gcw[0], NDIM);
+        d_compress_snapshots = input_db->getBoolWithDefault("compress_snapshots", d_compress_snapshots);
+        d_spill_directory = input_db->getStringWithDefault("spill_directory", d_spill_directory);
+        d_max_resident_snapshots = input_db->getIntegerWithDefault("max_resident_snapshots", d_max_resident_snapshots);
+        if (d_max_resident_snapshots < 2)
+        {
+            TBOX_ERROR(d_object_name << "::SnapshotCache():\n"
+                                     << "  max_resident_snapshots must be at least 2.\n");
+        }
+    }
+    if (!d_spill_directory.empty()) Utilities::recursiveMkdir(d_spill_directory);
 
     auto var_db = VariableDatabase<NDIM>::getDatabase();
     d_ctx = var_db->getContext(d_object_name + "::context");
@@ -79,6 +205,16 @@ SnapshotCache::clearSnapshots()
         }
     }
 
+    // Remove spilled data.
+    for (const auto& paged_snapshot : d_paged_snapshots)
+    {
+        if (!paged_snapshot.second.resident && !d_spill_directory.empty())
+        {
+            std::remove(getSpillFileName(paged_snapshot.second.id).c_str());
+        }
+    }
+    d_paged_snapshots.clear();
+
     // Clear snapshots
     d_snapshots.clear();
     auto var_db = VariableDatabase<NDIM>::getDatabase();
@@ -95,8 +231,8 @@ SnapshotCache::getSnapshot(double time, double tol)
     });
     if (it == d_snapshots.end())
         return std::make_pair(std::numeric_limits<double>::quiet_NaN(), nullptr);
-    else
-        return *it;
+    if (pagingEnabled()) useSnapshot(*it);
+    return *it;
 }
 
 void
@@ -132,7 +268,12 @@ SnapshotCache::storeSnapshot(const int u_idx, const double time, Pointer<PatchHi
     auto it = std::find_if(d_snapshots.begin(), d_snapshots.end(), [time](const value_type& snapshot) -> bool {
         return time < snapshot.first;
     });
-    d_snapshots.insert(it, std::make_pair(time, snapshot_hierarchy));
+    it = d_snapshots.insert(it, std::make_pair(time, snapshot_hierarchy));
+    if (pagingEnabled())
+    {
+        d_paged_snapshots[snapshot_hierarchy.getPointer()].id = d_next_snapshot_id++;
+        useSnapshot(*it);
+    }
 }
 
 void
@@ -147,7 +288,11 @@ SnapshotCache::putToDatabase(Pointer<Database> db)
         const double time = snapshot.first;
         db->putDouble("time_" + std::to_string(i), time);
         Pointer<Database> snapshot_db = db->putDatabase("snapshot_hierarchy_" + std::to_string(i));
+        // Paged out snapshots are temporarily paged in so that their patch data is written.
+        const bool paged_out = pagingEnabled() && !d_paged_snapshots[snapshot.second.getPointer()].resident;
+        if (paged_out) pageInSnapshot(snapshot);
         snapshot.second->putToDatabase(snapshot_db);
+        if (paged_out) pageOutSnapshot(snapshot);
         ++i;
     }
 }
@@ -178,7 +323,164 @@ SnapshotCache::getFromRestart(Pointer<GridGeometry<NDIM> > grid_geom)
             new PatchHierarchy<NDIM>(d_object_name + "::SnapshotHierarchy_" + std::to_string(i), grid_geom, false);
         hierarchy->getFromDatabase(db->getDatabase("snapshot_hierarchy_" + std::to_string(i)), comp_selector);
         d_snapshots.push_back(std::make_pair(time, hierarchy));
+        if (pagingEnabled())
+        {
+            d_paged_snapshots[hierarchy.getPointer()].id = d_next_snapshot_id++;
+            useSnapshot(d_snapshots.back());
+        }
+    }
+}
+
+bool
+SnapshotCache::pagingEnabled() const
+{
+    return d_compress_snapshots || !d_spill_directory.empty();
+}
+
+void
+SnapshotCache::useSnapshot(const value_type& snapshot)
+{
+    PagedSnapshot& paged_snapshot = d_paged_snapshots[snapshot.second.getPointer()];
+    paged_snapshot.last_use = ++d_use_counter;
+    if (!paged_snapshot.resident) pageInSnapshot(snapshot);
+
+    // Page out the least recently used snapshots. All processes make the same decisions because they access the
+    // snapshots in the same order.
+    int num_resident = 0;
+    for (const auto& it : d_paged_snapshots) num_resident += it.second.resident ? 1 : 0;
+    while (num_resident > d_max_resident_snapshots)
+    {
+        const value_type* lru_snapshot = nullptr;
+        unsigned long lru_use = paged_snapshot.last_use;
+        for (const auto& other : d_snapshots)
+        {
+            const PagedSnapshot& other_paged_snapshot = d_paged_snapshots[other.second.getPointer()];
+            if (other_paged_snapshot.resident && other_paged_snapshot.last_use < lru_use)
+            {
+                lru_snapshot = &other;
+                lru_use = other_paged_snapshot.last_use;
+            }
+        }
+        if (!lru_snapshot) break;
+        pageOutSnapshot(*lru_snapshot);
+        --num_resident;
+    }
+}
+
+void
+SnapshotCache::pageInSnapshot(const value_type& snapshot)
+{
+    PagedSnapshot& paged_snapshot = d_paged_snapshots[snapshot.second.getPointer()];
+    TBOX_ASSERT(!paged_snapshot.resident);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = snapshot.second;
+
+    // Read spilled data back into memory.
+    if (!d_spill_directory.empty())
+    {
+        const std::string file_name = getSpillFileName(paged_snapshot.id);
+        std::ifstream is(file_name, std::ios::binary);
+        paged_snapshot.patch_data.resize(paged_snapshot.patch_data_size.size());
+        for (std::size_t ln = 0; ln < paged_snapshot.patch_data_size.size(); ++ln)
+        {
+            paged_snapshot.patch_data[ln].resize(paged_snapshot.patch_data_size[ln].size());
+            for (std::size_t p = 0; p < paged_snapshot.patch_data_size[ln].size(); ++p)
+            {
+                std::vector<char>& buffer = paged_snapshot.patch_data[ln][p];
+                buffer.resize(paged_snapshot.patch_data_size[ln][p]);
+                is.read(buffer.data(), buffer.size());
+            }
+        }
+        if (!is)
+        {
+            TBOX_ERROR(d_object_name << "::pageInSnapshot():\n"
+                                     << "  unable to read snapshot data from " << file_name << "\n");
+        }
+        is.close();
+        std::remove(file_name.c_str());
     }
+
+    // Allocate and fill the patch data.
+    for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_snapshot_idx, snapshot.first);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const std::vector<char>& buffer = paged_snapshot.patch_data[ln][p()];
+            const char* pos = buffer.data();
+            for (ArrayData<NDIM, double>* array : get_array_data(patch->getPatchData(d_snapshot_idx)))
+            {
+                const std::size_t n = array->getBox().size() * array->getDepth();
+                pos = decode_values(pos, array->getPointer(), n, d_compress_snapshots);
+            }
+            TBOX_ASSERT(pos == buffer.data() + buffer.size());
+        }
+    }
+    paged_snapshot.patch_data.clear();
+    paged_snapshot.patch_data_size.clear();
+    paged_snapshot.resident = true;
+}
+
+void
+SnapshotCache::pageOutSnapshot(const value_type& snapshot)
+{
+    PagedSnapshot& paged_snapshot = d_paged_snapshots[snapshot.second.getPointer()];
+    TBOX_ASSERT(paged_snapshot.resident);
+    Pointer<PatchHierarchy<NDIM> > hierarchy = snapshot.second;
+
+    // Encode and deallocate the patch data. The data is encoded from the current state of the hierarchy because it may
+    // have been modified (e.g., by update_snapshot()) while it was resident.
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    paged_snapshot.patch_data.resize(finest_ln + 1);
+    paged_snapshot.patch_data_size.resize(finest_ln + 1);
+    for (int ln = 0; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        paged_snapshot.patch_data[ln].assign(level->getNumberOfPatches(), std::vector<char>());
+        paged_snapshot.patch_data_size[ln].assign(level->getNumberOfPatches(), 0);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            std::vector<char>& buffer = paged_snapshot.patch_data[ln][p()];
+            for (const ArrayData<NDIM, double>* array : get_array_data(patch->getPatchData(d_snapshot_idx)))
+            {
+                const std::size_t n = array->getBox().size() * array->getDepth();
+                encode_values(array->getPointer(), n, d_compress_snapshots, buffer);
+            }
+            buffer.shrink_to_fit();
+            paged_snapshot.patch_data_size[ln][p()] = buffer.size();
+        }
+        level->deallocatePatchData(d_snapshot_idx);
+    }
+
+    // Write the encoded data to disk.
+    if (!d_spill_directory.empty())
+    {
+        const std::string file_name = getSpillFileName(paged_snapshot.id);
+        std::ofstream os(file_name, std::ios::binary | std::ios::trunc);
+        for (const auto& level_data : paged_snapshot.patch_data)
+        {
+            for (const auto& buffer : level_data) os.write(buffer.data(), buffer.size());
+        }
+        if (!os)
+        {
+            TBOX_ERROR(d_object_name << "::pageOutSnapshot():\n"
+                                     << "  unable to write snapshot data to " << file_name << "\n");
+        }
+        os.close();
+        paged_snapshot.patch_data.clear();
+    }
+    paged_snapshot.resident = false;
+}
+
+std::string
+SnapshotCache::getSpillFileName(const unsigned int snapshot_id) const
+{
+    std::string prefix = d_object_name;
+    std::replace_if(prefix.begin(), prefix.end(), [](const unsigned char c) -> bool { return !std::isalnum(c); }, '_');
+    return d_spill_directory + "/" + prefix + "_snapshot_" + std::to_string(snapshot_id) + "." +
+           std::to_string(IBTK_MPI::getRank());
 }
 } // namespace IBTK
 
@@ -0,0 +1,163 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibtk/ThreadPool.h"
+
+#include <algorithm>
+
+#include "ibtk/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBTK
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+// Whether the current thread is executing tasks of the pool (either as a
+// worker or as the thread that called run()).
+thread_local bool s_in_pool_task = false;
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+void
+ThreadPool::run(const int num_tasks, const int num_threads, const std::function<void(int)>& task)
+{
+    if (num_tasks <= 0) return;
+    if (s_in_pool_task || std::min(num_tasks, num_threads) <= 1)
+    {
+        for (int i = 0; i < num_tasks; ++i) task(i);
+        return;
+    }
+    getPool().runTasks(num_tasks, num_threads, task);
+    return;
+} // run
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_shutdown = true;
+    }
+    d_work_cv.notify_all();
+    for (auto& worker : d_workers) worker.join();
+    return;
+} // ~ThreadPool
+
+/////////////////////////////// PROTECTED ////////////////////////////////////
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+ThreadPool&
+ThreadPool::getPool()
+{
+    static ThreadPool pool;
+    return pool;
+} // getPool
+
+void
+ThreadPool::runTasks(const int num_tasks, const int num_threads, const std::function<void(int)>& task)
+{
+    std::lock_guard<std::mutex> run_lock(d_run_mutex);
+    const int num_workers = std::min(num_tasks, num_threads) - 1;
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        while (static_cast<int>(d_workers.size()) < num_workers)
+        {
+            d_workers.emplace_back(&ThreadPool::workerLoop, this);
+        }
+        d_task = &task;
+        d_num_tasks = num_tasks;
+        d_next_task = 0;
+        d_num_open_slots = num_workers;
+        d_exception = nullptr;
+        ++d_generation;
+    }
+    d_work_cv.notify_all();
+
+    s_in_pool_task = true;
+    executeTasks();
+    s_in_pool_task = false;
+
+    // Close any slots that no worker has claimed yet and wait for the workers
+    // that did join to finish.
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        d_num_open_slots = 0;
+        d_done_cv.wait(lock, [this]() { return d_num_active_workers == 0; });
+        d_task = nullptr;
+        exception = d_exception;
+        d_exception = nullptr;
+    }
+    if (exception) std::rethrow_exception(exception);
+    return;
+} // runTasks
+
+void
+ThreadPool::executeTasks()
+{
+    for (int i = d_next_task++; i < d_num_tasks; i = d_next_task++)
+    {
+        try
+        {
+            (*d_task)(i);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            if (!d_exception) d_exception = std::current_exception();
+            d_next_task = d_num_tasks;
+        }
+    }
+    return;
+} // executeTasks
+
+void
+ThreadPool::workerLoop()
+{
+    s_in_pool_task = true;
+    unsigned long last_generation = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(d_mutex);
+            d_work_cv.wait(lock, [&]() {
+                return d_shutdown || (d_generation != last_generation && d_num_open_slots > 0);
+            });
+            if (d_shutdown) return;
+            last_generation = d_generation;
+            --d_num_open_slots;
+            ++d_num_active_workers;
+        }
+
+        executeTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            --d_num_active_workers;
+        }
+        d_done_cv.notify_all();
+    }
+    return;
+} // workerLoop
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBTK
+
+//////////////////////////////////////////////////////////////////////////////
@@ -28,6 +28,7 @@
 #include "ibtk/CCPoissonPointRelaxationFACOperator.h"
 #include "ibtk/FACPreconditioner.h"
 #include "ibtk/HierarchyGhostCellInterpolation.h"
+#include "ibtk/IBTK_MPI.h"
 #include "ibtk/PETScKrylovPoissonSolver.h"
 #include "ibtk/ibtk_utilities.h"
 
@@ -366,9 +367,16 @@ private:
     void interpolateFluidSolveVelocity();
 
     /*!
-     * \brief Calculate the rigid translational velocity.
+     * \brief Compute the local contributions to the rigid translational
+     * velocity and start summing them with \p momentum_sums.
      */
-    void calculateRigidTranslationalMomentum();
+    void startRigidTranslationalMomentum(IBTK::IBTK_MPI::SumReductionBatch& momentum_sums);
+
+    /*!
+     * \brief Calculate the rigid translational velocity from the sums started
+     * by startRigidTranslationalMomentum().
+     */
+    void calculateRigidTranslationalMomentum(IBTK::IBTK_MPI::SumReductionBatch& momentum_sums);
 
     /*!
      * \brief Calculate the rigid rotational velocity.
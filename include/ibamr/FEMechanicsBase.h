@@ -54,7 +54,24 @@ namespace IBAMR
  *   <li>FEProjector: Input database passed along to the object responsible for
  *     computing projections onto the finite element space. See the
  *     documentation of IBTK::FEProjector for more information.</li>
+ *   <li>num_assembly_threads: number of threads used by each MPI process to
+ *     assemble the interior force density (see
+ *     assembleInteriorForceDensityRHS()). Defaults to 1. Values larger than
+ *     one require all PK1 stress, body force, surface force, and surface
+ *     pressure functions to be thread-safe (see below).</li>
  * </ol>
+ *
+ * <h2>Thread safety of user-provided functions</h2>
+ * When num_assembly_threads is larger than one, the elements local to each
+ * process are split into ranges that are assembled by several threads at the
+ * same time. The registered PK1 stress, body force, surface force, and surface
+ * pressure functions are then called concurrently for different elements and
+ * quadrature points, and so they must be thread-safe: they may write only to
+ * their output arguments, and any other state that they modify (e.g., data
+ * accessed through the context pointer, static variables, or output streams)
+ * must be protected by the user. The function arguments themselves (such as
+ * the element pointer and the interpolated system data) are never shared
+ * between threads.
  */
 class FEMechanicsBase : public SAMRAI::tbox::Serializable
 {
@@ -232,8 +249,48 @@ public:
      */
     using PK1StressFcnPtr = IBTK::TensorMeshFcnPtr;
 
+    /*!
+     * Typedef specifying interface for a batched PK1 stress tensor function,
+     * which evaluates the stress at all \p n_qp quadrature points of an
+     * element in a single call.
+     *
+     * All arrays use a structure-of-arrays layout in which the quadrature
+     * point index varies fastest:
+     *
+     * - \p PP and \p FF are NDIM x NDIM tensors stored row-wise, i.e.,
+     *   component (i,j) at quadrature point qp is at index
+     *   <code>(i * NDIM + j) * n_qp + qp</code>.
+     * - \p x and \p X store component d at quadrature point qp at index
+     *   <code>d * n_qp + qp</code>.
+     * - Entry s of \p system_var_data points to the values of the requested
+     *   variables of system s, with variable k at quadrature point qp at index
+     *   <code>k * n_qp + qp</code>.
+     * - Entry s of \p system_grad_var_data points to the gradients of the
+     *   requested variables of system s, with component d of the gradient of
+     *   variable k at quadrature point qp at index
+     *   <code>(k * NDIM + d) * n_qp + qp</code>.
+     *
+     * \p PP must be completely overwritten by the function.
+     */
+    using PK1StressBatchFcnPtr = void (*)(double* PP,
+                                          const double* FF,
+                                          const double* x,
+                                          const double* X,
+                                          unsigned int n_qp,
+                                          libMesh::Elem* elem,
+                                          const std::vector<const double*>& system_var_data,
+                                          const std::vector<const double*>& system_grad_var_data,
+                                          double data_time,
+                                          void* ctx);
+
     /*!
      * Struct encapsulating PK1 stress tensor function data.
+     *
+     * Either a pointwise function (\p fcn) or a batched function (\p
+     * batch_fcn) may be provided.  When a batched function is available, it is
+     * used to evaluate the stress at element interior quadrature points.  The
+     * constructor sets up a pointwise function; use batched() to set up a
+     * batched one.
      */
     struct PK1StressFcnData
     {
@@ -246,7 +303,22 @@ public:
         {
         }
 
-        PK1StressFcnPtr fcn;
+        /*!
+         * Set up the data of a batched PK1 stress function.
+         */
+        static PK1StressFcnData batched(PK1StressBatchFcnPtr batch_fcn,
+                                        std::vector<IBTK::SystemData> system_data = {},
+                                        void* const ctx = nullptr,
+                                        const libMesh::QuadratureType& quad_type = libMesh::INVALID_Q_RULE,
+                                        const libMesh::Order& quad_order = libMesh::INVALID_ORDER)
+        {
+            PK1StressFcnData data(nullptr, std::move(system_data), ctx, quad_type, quad_order);
+            data.batch_fcn = batch_fcn;
+            return data;
+        }
+
+        PK1StressFcnPtr fcn = nullptr;
+        PK1StressBatchFcnPtr batch_fcn = nullptr;
         std::vector<IBTK::SystemData> system_data;
         void* ctx;
         libMesh::QuadratureType quad_type;
@@ -261,6 +333,9 @@ public:
      * @note       It is possible to register multiple PK1 stress functions with
      *             this class.  This is intended to be used to implement
      *             selective reduced integration.
+     *
+     * @note       The function must be thread-safe when num_assembly_threads is
+     *             larger than one; see the class documentation.
      */
     virtual void registerPK1StressFunction(const PK1StressFcnData& data, unsigned int part = 0);
 
@@ -269,6 +344,22 @@ public:
      */
     std::vector<PK1StressFcnData> getPK1StressFunction(unsigned int part = 0) const;
 
+    /*!
+     * Evaluate the PK1 stress tensor function \p pk1 at a single point, using
+     * the pointwise function if it is available and the batched function
+     * otherwise.
+     */
+    static void evaluatePK1StressFunction(
+        libMesh::TensorValue<double>& PP,
+        const PK1StressFcnData& pk1,
+        const libMesh::TensorValue<double>& FF,
+        const libMesh::Point& x,
+        const libMesh::Point& X,
+        libMesh::Elem* elem,
+        const std::vector<const std::vector<double>*>& system_var_data,
+        const std::vector<const std::vector<libMesh::VectorValue<double> >*>& system_grad_var_data,
+        double data_time);
+
     /*!
      * Typedef specifying interface for Lagrangian body force distribution
      * function.
@@ -298,6 +389,9 @@ public:
      *
      * @note       It is @em NOT possible to register multiple body force
      *             functions with this class.
+     *
+     * @note       The function must be thread-safe when num_assembly_threads is
+     *             larger than one; see the class documentation.
      */
     virtual void registerLagBodyForceFunction(const LagBodyForceFcnData& data, unsigned int part = 0);
 
@@ -335,6 +429,9 @@ public:
      *
      * @note       It is @em NOT possible to register multiple pressure
      *             functions with this class.
+     *
+     * @note       The function must be thread-safe when num_assembly_threads is
+     *             larger than one; see the class documentation.
      */
     virtual void registerLagSurfacePressureFunction(const LagSurfacePressureFcnData& data, unsigned int part = 0);
 
@@ -372,6 +469,9 @@ public:
      *
      * @note       It is @em NOT possible to register multiple surface force
      *             functions with this class.
+     *
+     * @note       The function must be thread-safe when num_assembly_threads is
+     *             larger than one; see the class documentation.
      */
     virtual void registerLagSurfaceForceFunction(const LagSurfaceForceFcnData& data, unsigned int part = 0);
 
@@ -701,6 +801,7 @@ protected:
     std::vector<libMesh::Order> d_default_quad_order_stress, d_default_quad_order_force, d_default_quad_order_pressure;
     bool d_use_consistent_mass_matrix = true;
     bool d_allow_rules_with_negative_weights = true;
+    int d_num_assembly_threads = 1;
     bool d_include_normal_stress_in_weak_form = false;
     bool d_include_tangential_stress_in_weak_form = false;
     bool d_include_normal_surface_forces_in_weak_form = true;
@@ -45,6 +45,11 @@ class Patch;
 } // namespace hier
 } // namespace SAMRAI
 
+namespace IBTK
+{
+class HierarchyGhostCellInterpolation;
+} // namespace IBTK
+
 /////////////////////////////// CLASS DEFINITION /////////////////////////////
 
 namespace IBAMR
@@ -59,6 +64,19 @@ namespace IBAMR
  * specified through input file. In presence of a physical domain wall, the distance function
  * at a grid point is D = min(distance from interface, distance from wall location).
  *
+ * \note By default every cell of the patch hierarchy is updated and iterations
+ * stop once the L2 norm of the change between successive iterations is
+ * smaller than \p abs_tol.  Setting the input database key \p use_narrow_band
+ * to TRUE restricts the computation to cells within \p narrow_band_width grid
+ * cells (measured in the smallest grid spacing of each level; default 6) of
+ * the zero contour.  Each patch tracks the list of cells in its band, which
+ * grows as distance values propagate away from the interface, and only
+ * patches whose band or ghost cell values changed in the previous iteration
+ * are swept again.  In this mode iterations stop once the max norm of the
+ * change over the band is smaller than \p abs_tol and the band no longer
+ * grows.  Upon completion, values outside of the band are set to plus or
+ * minus the band width.
+ *
  * References
  * Zhao, H., <A HREF="http://www.ams.org/journals/mcom/2005-74-250/S0025-5718-04-01678-3/">
  * A Fast Sweeping Method For Eikonal Equations</A>
@@ -91,6 +109,8 @@ protected:
     // Algorithm parameters.
     bool d_consider_phys_bdry_wall = false;
     int d_wall_location_idx[2 * NDIM];
+    bool d_use_narrow_band = false;
+    double d_narrow_band_width = 6.0;
 
 private:
     /*!
@@ -105,6 +125,23 @@ private:
                    const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
                    const SAMRAI::hier::Box<NDIM>& domain_box) const;
 
+    /*!
+     * \brief Iterate the fast sweeping algorithm to convergence on the narrow
+     * band around the zero contour.
+     */
+    void narrowBandFastSweep(SAMRAI::tbox::Pointer<IBTK::HierarchyMathOps> hier_math_ops,
+                             int dist_idx,
+                             SAMRAI::tbox::Pointer<IBTK::HierarchyGhostCellInterpolation> fill_op,
+                             double time) const;
+
+    /*!
+     * \brief Determine which sides of the patch are treated as walls.
+     *
+     * \return Whether the patch touches the physical domain boundary.
+     */
+    bool getWallLocations(const SAMRAI::tbox::Pointer<SAMRAI::hier::Patch<NDIM> > patch,
+                          int touches_wall_loc_idx[2 * NDIM]) const;
+
     /*!
      * Read input values from a given database.
      */
@@ -763,6 +763,12 @@ public:
     /*!
      * Complete redistributing Lagrangian data following regridding the patch
      * hierarchy.
+     *
+     * @note When <code>use_scratch_hierarchy = TRUE</code>, this function
+     * always regrids and reinitializes the scratch hierarchy, including when
+     * IBHierarchyIntegrator calls it to rebin Lagrangian data on an unchanged
+     * patch hierarchy. Rebinning therefore saves much less work with this
+     * option than without it.
      */
     void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg) override;
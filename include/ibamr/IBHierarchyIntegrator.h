@@ -24,6 +24,7 @@
 #include "ibamr/INSHierarchyIntegrator.h"
 #include "ibamr/ibamr_enums.h"
 
+#include "ibtk/AdaptiveWorkloadModel.h"
 #include "ibtk/CartGridFunction.h"
 #include "ibtk/HierarchyIntegrator.h"
 #include "ibtk/LMarkerSetVariable.h"
@@ -118,8 +119,8 @@ namespace IBAMR
  * database. For backwards compatibility the value
  * <code>regrid_cfl_interval</code> is equivalent to
  * <code>regrid_fluid_cfl_interval</code>. <em>At the present time
- * <code>regrid_structure_cfl_interval</code> is not implemented for all
- * IBStrategy classes.</em>
+ * <code>regrid_structure_cfl_interval</code> is only implemented by IBMethod
+ * and IBFEMethod (and IBStrategySet objects composed of them).</em>
  *
  * Alternatively, one can request that the solver (regardless of any computed
  * displacement or velocity) regrid every time a fixed number of timesteps have
@@ -127,6 +128,51 @@ namespace IBAMR
  * <em>If either <code>regrid_structure_cfl_interval</code> or
  * <code>regrid_fluid_cfl_interval</code> are provided in the input database
  * then <code>regrid_interval</code> is ignored.</em>
+ *
+ * <h2>Rebinning Lagrangian Data Without Regridding</h2>
+ *
+ * Structures that move through a static refined region trigger many regrids
+ * through <code>regrid_structure_cfl_interval</code> that do not change the
+ * patch layout. Setting <code>rebin_lagrangian_data = TRUE</code> in the input
+ * database (default <code>FALSE</code>) enables a cheaper path for this case:
+ * if the structure CFL criterion is the only criterion that triggered the
+ * regrid, cells are tagged on the current hierarchy and, if each tagged cell
+ * (grown by the tag buffer) is already covered by the next finer level, the
+ * Lagrangian data and markers are only redistributed among the existing
+ * patches via IBStrategy::beginDataRedistribution() and
+ * IBStrategy::endDataRedistribution(). Eulerian data, communication schedules,
+ * and solvers are left untouched. Otherwise a full regrid is performed. Since
+ * rebinning neither removes refined regions nor rebalances the hierarchy,
+ * applications that rely on these should also set
+ * <code>regrid_fluid_cfl_interval</code>.
+ *
+ * Rebinning is only as cheap as the IBStrategy's data redistribution. In
+ * particular, IBFEMethod with <code>use_scratch_hierarchy = TRUE</code> still
+ * regrids and reinitializes its scratch hierarchy in endDataRedistribution(),
+ * so in that case rebinning only avoids the work done on the main hierarchy.
+ *
+ * <h2>Calibrating Workload Estimates</h2>
+ *
+ * When a load balancer is registered, the workload of each cell is estimated
+ * as one plus the Lagrangian workload estimate computed by the IBStrategy
+ * object (e.g., a fixed weight times the number of IB points or quadrature
+ * points in the cell). Setting <code>calibrate_workload_estimates = TRUE</code>
+ * in the input database (default <code>FALSE</code>) scales the Lagrangian
+ * contribution by a weight that is fitted before each regrid by an
+ * IBTK::AdaptiveWorkloadModel. The model is fed the local computation times
+ * of the Eulerian and Lagrangian phases of the last
+ * <code>workload_calibration_window</code> (default 10) time steps. Eulerian
+ * phases are the fluid solver's preprocessing, solve, and postprocessing
+ * steps; the remainder of each time step is attributed to the Lagrangian
+ * phases. The time spent in the collective operations of IBTK_MPI is
+ * excluded because it is set by the slowest process rather than by the local
+ * workload. The global reductions of the Krylov solvers, which are performed
+ * by SAMRAI, PETSc, or hypre, and ghost cell exchanges are still included in
+ * the measured times. The calibrated weight is written to restart files.
+ * Only integrators that time their fluid solve via recordEulerianPhase()
+ * (currently IBExplicitHierarchyIntegrator and
+ * IBInterpolantHierarchyIntegrator) provide samples; otherwise the weight
+ * stays at one.
  */
 class IBHierarchyIntegrator : public IBTK::HierarchyIntegrator
 {
@@ -231,6 +277,15 @@ public:
     void initializePatchHierarchy(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
                                   SAMRAI::tbox::Pointer<SAMRAI::mesh::GriddingAlgorithm<NDIM> > gridding_alg) override;
 
+    /*!
+     * Regrid the patch hierarchy, or, if rebinning is enabled and the current
+     * patch hierarchy does not need to change, only redistribute the Lagrangian
+     * data among the existing patches.
+     *
+     * \see canRebinLagrangianData
+     */
+    void regridHierarchy() override;
+
 protected:
     /*!
      * Perform necessary data movement, workload estimation, and logging prior
@@ -260,6 +315,46 @@ protected:
      */
     bool atRegridPointSpecialized() const override;
 
+    /*!
+     * Determine whether the Lagrangian data can be rebinned instead of
+     * regridding the patch hierarchy. This is the case when rebinning is
+     * enabled, only the structure CFL criterion requests a regrid, and every
+     * cell tagged for refinement, grown by the tag buffer, is already covered
+     * by the next finer level of the current patch hierarchy.
+     *
+     * @note This function must be called on all processes.
+     */
+    bool canRebinLagrangianData();
+
+    /*!
+     * Redistribute the Lagrangian data and markers among the patches of the
+     * current patch hierarchy without regridding it.
+     */
+    void rebinLagrangianData();
+
+    /*!
+     * Return the wall-clock time of this process minus the time it has spent
+     * in the collective operations of IBTK_MPI, in seconds. Differences of
+     * this value measure the local computation time of a code section,
+     * excluding global reductions and the time spent waiting for other
+     * processes to reach them.
+     */
+    static double getLocalComputeTime();
+
+    /*!
+     * Add the local computation time elapsed since @p start, a value returned
+     * by getLocalComputeTime(), to the time spent in Eulerian phases of the
+     * current time step. Subclasses should call this function after solving
+     * the fluid equations to enable the calibration of workload estimates.
+     */
+    void recordEulerianPhase(double start);
+
+    /*!
+     * Recompute the number of local cells and the local Lagrangian workload
+     * estimate used to calibrate workload estimates.
+     */
+    void updateLocalWorkloadCounts();
+
     /*!
      * Initialize data on a new level after it is inserted into an AMR patch
      * hierarchy by the gridding algorithm.
@@ -366,6 +461,51 @@ protected:
      */
     double d_regrid_structure_cfl_estimate = 0.0;
 
+    /*!
+     * Whether or not to rebin Lagrangian data instead of regridding when the
+     * patch hierarchy does not need to change.
+     */
+    bool d_rebin_lagrangian_data = false;
+
+    /*!
+     * Scratch tag data used to determine whether the patch hierarchy needs to
+     * change.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, int> > d_rebin_tag_var;
+    int d_rebin_tag_idx = IBTK::invalid_index;
+
+    /*!
+     * Whether or not to calibrate the weight of the Lagrangian workload
+     * estimate from measured timings, and the model used to do so.
+     */
+    bool d_calibrate_workload_estimates = false;
+    IBTK::AdaptiveWorkloadModel d_workload_model;
+
+    /*!
+     * The weight applied to the Lagrangian workload estimate of the IBStrategy
+     * object.
+     */
+    double d_lagrangian_workload_weight = 1.0;
+
+    /*!
+     * The number of local cells and the local Lagrangian workload estimate
+     * since the last regrid.
+     */
+    double d_local_num_cells = 0.0, d_local_lagrangian_workload = 0.0;
+
+    /*!
+     * Timings of the current time step.
+     */
+    double d_step_start_time = 0.0;
+    double d_eulerian_phase_time = 0.0;
+    bool d_eulerian_solve_timed = false;
+
+    /*!
+     * Scratch data used to compute the Lagrangian workload estimate.
+     */
+    SAMRAI::tbox::Pointer<SAMRAI::pdat::CellVariable<NDIM, double> > d_lagrangian_workload_var;
+    int d_lagrangian_workload_idx = IBTK::invalid_index;
+
     /*
      * IB method implementation object.
      */
@@ -33,7 +33,6 @@ IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <functional>
 #include <iosfwd>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -228,43 +227,32 @@ private:
     std::vector<double> d_flow_values, d_mean_pres_values, d_point_pres_values;
 
     /*!
-     * \brief Data structures employed to manage mappings between cell indices
-     * and web patch data (i.e., patch centroids and area-weighted normals) and
-     * meter centroid data.
+     * \brief Data structures employed to store the web patch data (i.e., patch
+     * centroids and area-weighted normals) and meter centroid data that are
+     * located in each local patch, along with the indices of the cells that
+     * contain them.
+     *
+     * The lists are indexed first by level number and then by patch number and
+     * are only populated for local patches.
      */
-    struct IndexFortranOrder
-    {
-        inline bool operator()(const SAMRAI::hier::Index<NDIM>& lhs, const SAMRAI::hier::Index<NDIM>& rhs) const
-        {
-            return (lhs(0) < rhs(0)
-#if (NDIM > 1)
-                    || (lhs(0) == rhs(0) && lhs(1) < rhs(1))
-#if (NDIM > 2)
-                    || (lhs(0) == rhs(0) && lhs(1) == rhs(1) && lhs(2) < rhs(2))
-#endif
-#endif
-            );
-        } // operator()
-    };
-
     struct WebPatch
     {
+        SAMRAI::hier::Index<NDIM> i;
         int meter_num;
         const IBTK::Vector* X;
         const IBTK::Vector* dA;
     };
 
-    using WebPatchMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebPatch, IndexFortranOrder>;
-    std::vector<WebPatchMap> d_web_patch_map;
+    std::vector<std::vector<std::vector<WebPatch> > > d_web_patches;
 
     struct WebCentroid
     {
+        SAMRAI::hier::Index<NDIM> i;
         int meter_num;
         const IBTK::Vector* X;
     };
 
-    using WebCentroidMap = std::multimap<SAMRAI::hier::Index<NDIM>, WebCentroid, IndexFortranOrder>;
-    std::vector<WebCentroidMap> d_web_centroid_map;
+    std::vector<std::vector<std::vector<WebCentroid> > > d_web_centroids;
 
     /*
      * The directory where data is to be dumped and the most recent timestep
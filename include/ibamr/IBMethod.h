@@ -176,6 +176,13 @@ public:
     virtual bool getLagrangianStructureIsActivated(int structure_number = 0,
                                                    int level_number = std::numeric_limits<int>::max()) const override;
 
+    /*!
+     * Get the ratio of the maximum displacement of the Lagrangian points since
+     * the last data redistribution to the cell width of the level on which
+     * they are assigned. See IBAMR::IBStrategy::getMaxPointDisplacement().
+     */
+    double getMaxPointDisplacement() const override;
+
     /*!
      * Method to prepare to advance data from current_time to new_time.
      */
@@ -544,6 +551,7 @@ protected:
     IBTK::LDataManager* d_l_data_manager;
     std::string d_interp_kernel_fcn = "IB_4", d_spread_kernel_fcn = "IB_4";
     bool d_error_if_points_leave_domain = false;
+    bool d_use_interaction_weight_cache = false;
     SAMRAI::hier::IntVector<NDIM> d_ghosts;
 
     /*
@@ -562,6 +570,12 @@ protected:
      */
     std::vector<std::set<int> > d_anchor_point_local_idxs;
 
+    /*
+     * Local positions of the Lagrangian points at the last data
+     * redistribution, used to compute the point displacement since then.
+     */
+    std::vector<std::vector<double> > d_X_last_regrid;
+
     /*
      * Instrumentation (flow meter and pressure gauge) algorithms and data
      * structures.
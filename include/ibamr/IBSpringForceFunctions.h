@@ -52,6 +52,32 @@ using SpringForceFcnPtr = double (*)(double R, const double* params, int lag_mas
  */
 using SpringForceDerivFcnPtr = double (*)(double R, const double* params, int lag_mastr_idx, int lag_slave_idx);
 
+/*!
+ * \brief Typedef specifying the batched spring force function API.
+ *
+ * A batched spring force function computes the tension forces of several
+ * springs that share the same force function index in a single call, i.e., it
+ * sets T[k] to the value that the corresponding SpringForceFcnPtr would return
+ * for R[k], params[k], lag_mastr_idxs[k], and lag_slave_idxs[k], for 0 <= k < n.
+ *
+ * \param n               The number of springs.
+ * \param R               The displacements between the "master" and "slave" nodes of the
+ *springs.
+ * \param params          The constitutive parameters of the springs.
+ * \param lag_mastr_idxs  The Lagrangian indices of the "master" nodes of the springs.
+ * \param lag_slave_idxs  The Lagrangian indices of the "slave" nodes of the springs.
+ * \param T               The (undirected) "tension" forces generated by the springs.
+ *
+ * \note Batched functions may be called for springs of zero length (e.g., for
+ * springs whose nodes coincide); the resulting tensions are discarded.
+ */
+using SpringForceBatchFcnPtr = void (*)(int n,
+                                        const double* R,
+                                        const double* const* params,
+                                        const int* lag_mastr_idxs,
+                                        const int* lag_slave_idxs,
+                                        double* T);
+
 /*!
  * \brief Function to compute the (undirected) "tension" force generated by a
  * Hookean spring with either a zero or a non-zero resting length.
@@ -106,6 +132,24 @@ default_spring_force(double R, const double* params, int /*lag_mastr_idx*/, int
     return params[0] * (R - params[1]);
 } // default_spring_force
 
+/*!
+ * \brief Batched version of default_spring_force().
+ */
+inline void
+default_spring_force_batch(const int n,
+                           const double* const R,
+                           const double* const* const params,
+                           const int* /*lag_mastr_idxs*/,
+                           const int* /*lag_slave_idxs*/,
+                           double* const T)
+{
+    for (int k = 0; k < n; ++k)
+    {
+        T[k] = params[k][0] * (R[k] - params[k][1]);
+    }
+    return;
+} // default_spring_force_batch
+
 /*!
  * \brief Function to compute the derivative with respect to R of the tension
  * force generated by a Hookean spring with either a zero or a non-zero resting
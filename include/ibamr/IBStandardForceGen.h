@@ -85,12 +85,18 @@ public:
      * particular spring for the specified displacement, spring constant, rest
      * length, and Lagrangian index.
      *
+     * An optional batched version of the force function may also be provided.
+     * If it is, the forces of all springs with this force function index are
+     * computed by calling it on batches of springs instead of calling
+     * spring_force_fcn_ptr once per spring.
+     *
      * \note By default, function default_linear_spring_force() is associated
      * with \a force_fcn_idx 0.
      */
     void registerSpringForceFunction(int force_fcn_index,
                                      const SpringForceFcnPtr spring_force_fcn_ptr,
-                                     const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = nullptr);
+                                     const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr = nullptr,
+                                     const SpringForceBatchFcnPtr spring_force_batch_fcn_ptr = nullptr);
 
     /*!
      * \brief Set a uniform body force that is applied on each point in the
@@ -197,6 +203,16 @@ private:
         std::vector<SpringForceFcnPtr> force_fcns;
         std::vector<SpringForceDerivFcnPtr> force_deriv_fcns;
         std::vector<const double*> parameters;
+
+        // Springs are sorted by force function index. Each group is a
+        // contiguous range [begin, end) of springs that share a force function.
+        struct ForceFcnGroup
+        {
+            int begin, end;
+            SpringForceFcnPtr force_fcn;
+            SpringForceBatchFcnPtr force_batch_fcn;
+        };
+        std::vector<ForceFcnGroup> force_fcn_groups;
     };
     std::vector<SpringData> d_spring_data;
 
@@ -286,6 +302,7 @@ private:
      */
     std::map<int, SpringForceFcnPtr> d_spring_force_fcn_map;
     std::map<int, SpringForceDerivFcnPtr> d_spring_force_deriv_fcn_map;
+    std::map<int, SpringForceBatchFcnPtr> d_spring_force_batch_fcn_map;
 
     /*!
      * \brief Logging settings.
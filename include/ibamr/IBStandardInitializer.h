@@ -67,7 +67,17 @@ namespace IBAMR
  * initializes the configuration of one or more Lagrangian structures from input
  * files.
  *
- * \todo Document input database entries.
+ * \todo Document the remaining input database entries.
+ *
+ * The following input database entry selects the structure file format:
+ * - <TT>use_binary_structure_files</TT>: if TRUE, the vertex, spring, beam,
+ *   target point, and anchor point data are read from binary structure files
+ *   with the extension <TT>".ibstruct"</TT> (see below) instead of the
+ *   corresponding ASCII input files.  The binary format has no sections for
+ *   crosslink springs, rods, boundary masses, directors, instrumentation, or
+ *   sources, so the <TT>".xspring"</TT>, <TT>".rod"</TT>, <TT>".mass"</TT>,
+ *   <TT>".director"</TT>, <TT>".inst"</TT>, and <TT>".source"</TT> files are
+ *   always read in ASCII format.  Defaults to FALSE.
  *
  * \note "C-style" indices are used for all input files.
  *
@@ -391,6 +401,22 @@ namespace IBAMR
  *
  * <HR>
  *
+ * <B>Binary structure file format</B>
+ *
+ * For very large structures, the vertex, spring, beam, target point, and
+ * anchor point data may instead be read from a single binary file with the
+ * extension <TT>".ibstruct"</TT> by setting <TT>use_binary_structure_files =
+ * TRUE</TT> in the input database.  Binary structure files are generated from
+ * the ASCII input files by IBStructureBinaryFile::convertASCIIFiles().  These
+ * files are memory mapped, and each MPI process reads only a contiguous range
+ * of the records of the file, which are then exchanged among the processes.
+ * The remaining data (crosslink springs, rods, boundary masses, directors,
+ * instrumentation, and sources) are still read from ASCII input files.
+ *
+ * \see IBStructureBinaryFile
+ *
+ * <HR>
+ *
  * <B>Director file format</B>
  *
  * Orthonormal director vector input files end with the extension
@@ -522,6 +548,49 @@ private:
      */
     void readSourceFiles(const std::string& file_extension);
 
+    /*!
+     * \brief Read the vertex, spring, beam, target point, and anchor point data
+     * from one or more binary structure files.
+     *
+     * \see IBStructureBinaryFile
+     */
+    void readBinaryStructureFiles(const std::string& file_extension);
+
+    /*!
+     * \brief Add a spring to the specified structure after applying any
+     * uniform spring properties.
+     */
+    void addSpring(int ln,
+                   int j,
+                   Edge e,
+                   std::vector<double> parameters,
+                   int force_fcn_idx,
+                   bool input_uses_global_idxs,
+                   const std::string& filename,
+                   bool& warned);
+
+    /*!
+     * \brief Add a beam to the specified structure after applying any uniform
+     * beam properties.
+     */
+    void addBeam(int ln,
+                 int j,
+                 int prev_idx,
+                 int curr_idx,
+                 int next_idx,
+                 double bend,
+                 IBTK::Vector curv,
+                 bool input_uses_global_idxs,
+                 const std::string& filename,
+                 bool& warned);
+
+    /*!
+     * \brief Modify the target point specifications of the specified structure
+     * according to whether target points are enabled, or whether uniform
+     * values are to be employed, for the structure.
+     */
+    void resetTargetPointSpecs(int ln, int j);
+
     /*!
      * \return The specification objects associated with the specified vertex.
      */
@@ -543,6 +612,13 @@ private:
      */
     bool d_use_file_batons = true;
 
+    /*
+     * The boolean value determines whether the vertex, spring, beam, target
+     * point, and anchor point data are read from binary structure files
+     * instead of ASCII input files.
+     */
+    bool d_use_binary_structure_files = false;
+
     /*
      * The maximum number of levels in the Cartesian grid patch hierarchy and a
      * vector of boolean values indicating whether a particular level has been
@@ -436,6 +436,10 @@ public:
      * Complete redistributing Lagrangian data following regridding the patch
      * hierarchy.
      *
+     * @note IBHierarchyIntegrator may also call beginDataRedistribution() and
+     * endDataRedistribution() back to back, without regridding in between, to
+     * rebin Lagrangian data on an unchanged patch hierarchy.
+     *
      * An empty default implementation is provided.
      */
     virtual void endDataRedistribution(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
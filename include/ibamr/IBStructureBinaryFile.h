@@ -0,0 +1,258 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDE GUARD ////////////////////////////////
+
+#ifndef included_IBAMR_IBStructureBinaryFile
+#define included_IBAMR_IBStructureBinaryFile
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include <ibamr/config.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+/////////////////////////////// CLASS DEFINITION /////////////////////////////
+
+namespace IBAMR
+{
+/*!
+ * \brief Class IBStructureBinaryFile provides read-only access to a binary
+ * container holding the vertex, spring, beam, target point, and anchor point
+ * data of a single Lagrangian structure.
+ *
+ * Binary structure files hold the same data as the corresponding ASCII files
+ * read by class IBStandardInitializer and may be generated from those files via
+ * convertASCIIFiles().  The file is memory mapped, and all records of a given
+ * type are stored contiguously with a fixed size, so that any range of records
+ * may be accessed without reading (or parsing) the remainder of the file.
+ *
+ * The file consists of a header, a table of section descriptors, and the
+ * section data, all stored in native byte order:
+ \verbatim
+ char          magic[8]         # "IBSTRUCT"
+ std::uint32_t version          # file format version (presently 1)
+ std::uint32_t ndim             # spatial dimension of the structure
+ std::uint32_t byte_order_mark  # 0x01020304
+ std::uint32_t num_sections     # number of sections in the file
+ SectionDescriptor sections[num_sections]
+ ...                            # section data, aligned to 8 bytes
+ \endverbatim
+ * Each section holds the records of one SectionType.  Sections other than the
+ * vertex section are optional.  The parameters of spring i are the values
+ * <tt>[parameter_offset, parameter_offset + num_parameters)</tt> of the spring
+ * parameter section.
+ *
+ * \note Records are stored as read from the ASCII input files: node indices are
+ * local to the structure, and neither the length scale factor and position
+ * shift nor any uniform material properties specified in the input database of
+ * class IBStandardInitializer have been applied.
+ */
+class IBStructureBinaryFile
+{
+public:
+    /*!
+     * \brief The types of sections that may be stored in a binary structure
+     * file.
+     */
+    enum SectionType
+    {
+        VERTEX_SECTION = 0,
+        SPRING_SECTION = 1,
+        SPRING_PARAMETER_SECTION = 2,
+        BEAM_SECTION = 3,
+        TARGET_POINT_SECTION = 4,
+        ANCHOR_POINT_SECTION = 5
+    };
+
+    /*!
+     * \brief Section descriptor stored in the file header.
+     */
+    struct SectionDescriptor
+    {
+        std::uint32_t type;
+        std::uint32_t record_size;
+        std::uint64_t num_records;
+        std::uint64_t offset;
+    };
+
+    /*!
+     * \brief Record type of the vertex section.
+     */
+    struct VertexRecord
+    {
+        double X[NDIM];
+    };
+
+    /*!
+     * \brief Record type of the spring section.
+     */
+    struct SpringRecord
+    {
+        std::int32_t idx[2];
+        std::int32_t force_fcn_idx;
+        std::int32_t num_parameters;
+        std::uint64_t parameter_offset;
+    };
+
+    /*!
+     * \brief Record type of the beam section.
+     */
+    struct BeamRecord
+    {
+        std::int32_t prev_idx;
+        std::int32_t curr_idx;
+        std::int32_t next_idx;
+        std::int32_t padding;
+        double bend_rigidity;
+        double curvature[NDIM];
+    };
+
+    /*!
+     * \brief Record type of the target point section.
+     */
+    struct TargetPointRecord
+    {
+        std::int32_t idx;
+        std::int32_t padding;
+        double stiffness;
+        double damping;
+    };
+
+    /*!
+     * \brief Record type of the anchor point section.
+     */
+    struct AnchorPointRecord
+    {
+        std::int32_t idx;
+    };
+
+    /*!
+     * \brief Constructor.  Opens and memory maps the specified file.
+     */
+    IBStructureBinaryFile(std::string filename);
+
+    /*!
+     * \brief Destructor.  Unmaps and closes the file.
+     */
+    ~IBStructureBinaryFile();
+
+    /*!
+     * \return The name of the file.
+     */
+    const std::string& getFilename() const;
+
+    /*!
+     * \return Whether the file contains a section of the specified type.
+     */
+    bool hasSection(SectionType type) const;
+
+    /*!
+     * \return The number of records in the section of the specified type, or
+     * zero if there is no such section.
+     */
+    std::size_t getNumberOfRecords(SectionType type) const;
+
+    /*!
+     * \return A pointer to the records of the section of the specified type,
+     * or nullptr if the file does not contain such a section.
+     *
+     * \note Only the pages of the file that are actually accessed are read
+     * from disk.
+     */
+    template <typename RecordType>
+    const RecordType* getRecords(const SectionType type) const
+    {
+        const auto it = d_sections.find(type);
+        if (it == d_sections.end()) return nullptr;
+        return reinterpret_cast<const RecordType*>(d_data + it->second.offset);
+    } // getRecords
+
+    /*!
+     * \return The half-open range of records of a section with the specified
+     * number of records that is read by the present MPI process when the
+     * records are read in parallel.
+     */
+    static std::pair<std::size_t, std::size_t> getLocalRecordRange(std::size_t num_records);
+
+    /*!
+     * \brief Generate a binary structure file from the ASCII vertex, spring,
+     * beam, target point, and anchor point files with the specified base
+     * filename.
+     *
+     * Only the vertex file is required.  Class IBStandardInitializer expects
+     * binary structure files to be named <tt>base_filename + ".ibstruct"</tt>.
+     *
+     * \note This function should be called by only one MPI process.
+     */
+    static void convertASCIIFiles(const std::string& base_filename, const std::string& output_filename);
+
+private:
+    /*!
+     * \brief Default constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     */
+    IBStructureBinaryFile() = delete;
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * \note This constructor is not implemented and should not be used.
+     *
+     * \param from The value to copy to this object.
+     */
+    IBStructureBinaryFile(const IBStructureBinaryFile& from) = delete;
+
+    /*!
+     * \brief Assignment operator.
+     *
+     * \note This operator is not implemented and should not be used.
+     *
+     * \param that The value to assign to this object.
+     *
+     * \return A reference to this object.
+     */
+    IBStructureBinaryFile& operator=(const IBStructureBinaryFile& that) = delete;
+
+    /*!
+     * \return The record size associated with a section type.
+     */
+    static std::size_t getRecordSize(SectionType type);
+
+    /*!
+     * \brief The name of the file.
+     */
+    std::string d_filename;
+
+    /*!
+     * \brief The file descriptor, the mapped memory region, and its size.
+     */
+    int d_fd = -1;
+    const char* d_data = nullptr;
+    std::size_t d_size = 0;
+
+    /*!
+     * \brief The section descriptors, indexed by section type.
+     */
+    std::map<SectionType, SectionDescriptor> d_sections;
+};
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
+
+#endif //#ifndef included_IBAMR_IBStructureBinaryFile
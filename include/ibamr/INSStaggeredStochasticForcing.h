@@ -67,6 +67,11 @@ namespace IBAMR
  * \brief Class INSStaggeredStochasticForcing provides an interface for
  * specifying a stochastic forcing term for a staggered-grid incompressible
  * Navier-Stokes solver.
+ *
+ * Random values are generated by the global Mersenne Twister generator of
+ * class RNG unless the input database sets \p use_counter_based_rng to TRUE,
+ * in which case the counter-based generator of class RNG is used with the
+ * seed provided by the input database key \p rng_seed (default 0).
  */
 class INSStaggeredStochasticForcing : public IBTK::CartGridFunction
 {
@@ -173,6 +178,15 @@ private:
     int d_num_rand_vals = 0;
     std::vector<SAMRAI::tbox::Array<double> > d_weights;
 
+    /*!
+     * Random number generation.  When the counter-based generator is used,
+     * random values are determined by (seed, time step number, patch level
+     * number, index) and are independent of the parallel decomposition.
+     * Otherwise the global Mersenne Twister generator is used.
+     */
+    bool d_use_counter_based_rng = false;
+    unsigned int d_rng_seed = 0;
+
     /*!
      * Boundary condition scalings.
      */
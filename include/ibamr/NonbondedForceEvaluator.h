@@ -32,6 +32,7 @@
 
 #include "muParser.h"
 
+#include <array>
 #include <vector>
 
 namespace IBTK
@@ -68,6 +69,20 @@ public:
     // parameters are passed in the double* params.
     using NonBddForceFcnPtr = void (*)(double* D, const SAMRAI::tbox::Array<double> params, double* out_force);
 
+    // Batched Nonbonded Force Function Pointer.
+    // Takes the vectors between the points of num_pairs
+    // pairs, stored by component (i.e., D[k][l] is component k
+    // of the vector of pair l), and sets the forces that the
+    // first points of the pairs experience in the same layout.
+    //
+    // This is used instead of the pointwise force function,
+    // if one is registered, when forces are computed with a
+    // neighbor list.
+    using NonBddBatchForceFcnPtr = void (*)(int num_pairs,
+                                            const double* const* D,
+                                            const SAMRAI::tbox::Array<double>& params,
+                                            double* const* out_force);
+
     // Class constructor.
     NonbondedForceEvaluator(SAMRAI::tbox::Pointer<SAMRAI::tbox::Database> input_db,
                             SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > grid_geometry);
@@ -79,6 +94,14 @@ public:
                         std::vector<int> cell_offset,
                         SAMRAI::tbox::Pointer<IBTK::LData> F_data);
 
+    // Implementation of initializeLevelData. Invalidates the neighbor list of
+    // the level, since the node distribution has changed.
+    void initializeLevelData(SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                             int level_number,
+                             double init_data_time,
+                             bool initial_time,
+                             IBTK::LDataManager* l_data_manager) override;
+
     // Implementation of computeLagrangianForce.
     void computeLagrangianForce(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
                                 SAMRAI::tbox::Pointer<IBTK::LData> X_data,
@@ -91,6 +114,9 @@ public:
     // Register the force function used
     void registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr);
 
+    // Register the batched force function used
+    void registerBatchForceFcnPtr(NonBddBatchForceFcnPtr batch_force_fcn_ptr);
+
 private:
     // Default constructor, not implemented.
     NonbondedForceEvaluator() = delete;
@@ -101,6 +127,21 @@ private:
     // Assignment operator, not implemented.
     NonbondedForceEvaluator& operator=(const NonbondedForceEvaluator& that) = delete;
 
+    // Build the neighbor list of the specified level from the current node
+    // positions.
+    void buildNeighborList(SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                           SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                           int level_number,
+                           IBTK::LDataManager* l_data_manager);
+
+    // Compute forces using the neighbor list of the specified level,
+    // rebuilding it first if necessary.
+    void computeLagrangianForceWithNeighborList(SAMRAI::tbox::Pointer<IBTK::LData> F_data,
+                                                SAMRAI::tbox::Pointer<IBTK::LData> X_data,
+                                                SAMRAI::tbox::Pointer<SAMRAI::hier::PatchHierarchy<NDIM> > hierarchy,
+                                                int level_number,
+                                                IBTK::LDataManager* l_data_manager);
+
     // interaction radius:
     double d_interaction_radius;
 
@@ -110,12 +151,34 @@ private:
     // parameters for force function:
     SAMRAI::tbox::Array<double> d_parameters;
 
+    // whether to use Verlet neighbor lists, and the skin distance (in units of
+    // the grid spacing) added to the interaction radius when building them:
+    bool d_use_neighbor_list = false;
+    double d_neighbor_list_skin = 1.0;
+
+    // Verlet neighbor list of a single level. Pairs are stored contiguously
+    // by the local PETSc indices of their nodes and the periodic shift of the
+    // search node. The node positions at the time the list was built are kept
+    // to determine when it must be rebuilt.
+    struct NeighborList
+    {
+        bool is_valid = false;
+        std::vector<int> mstr_idxs, search_idxs;
+        std::array<std::vector<double>, NDIM> search_shifts;
+        std::vector<double> X_build;
+        double dx[NDIM];
+    };
+    std::vector<NeighborList> d_neighbor_lists;
+
     // grid geometry
     SAMRAI::tbox::Pointer<SAMRAI::geom::CartesianGridGeometry<NDIM> > d_grid_geometry;
 
     // spring force function pointer, to evaluate the force between particles:
     // TODO: Add species, make this a map from species1 x species2 -> Force Function Pointer
-    NonBddForceFcnPtr d_force_fcn_ptr;
+    NonBddForceFcnPtr d_force_fcn_ptr = nullptr;
+
+    // batched version of the force function, if any:
+    NonBddBatchForceFcnPtr d_batch_force_fcn_ptr = nullptr;
 };
 } // namespace IBAMR
 
@@ -20,11 +20,33 @@
 
 #include <ibamr/config.h>
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "SideData.h"
+
+#include <array>
+#include <cstdint>
+
 namespace IBAMR
 {
 /*!
  * \brief Class RNG organizes functions that provide random-number generator
  * functionality.
+ *
+ * Two kinds of generators are provided:
+ *
+ * - A global Mersenne Twister generator (srandgen(), genrand(), genrandn(),
+ *   and parallel_seed()).  The stream of values depends on the order in which
+ *   values are requested, and therefore on the parallel decomposition of the
+ *   patch hierarchy.
+ *
+ * - A stateless counter-based generator (Philox4x32-10) that computes the
+ *   random value associated with a cell-centered, side-centered, etc. index as
+ *   a pure function of a key (seed, time step number) and a counter (index,
+ *   patch level number, data depth, and a user-provided stream number).  The
+ *   values are independent of the number of MPI processes, the patch layout,
+ *   and the order of evaluation, and generation is thread-safe.
  */
 class RNG
 {
@@ -37,6 +59,54 @@ public:
 
     static void parallel_seed(int global_seed);
 
+    /*!
+     * \brief Apply the ten-round Philox4x32 bijection to the counter \p ctr
+     * using the key \p key.
+     */
+    static std::array<std::uint32_t, 4> philox4x32(std::array<std::uint32_t, 4> ctr,
+                                                   std::array<std::uint32_t, 2> key);
+
+    /*!
+     * \brief Set normally distributed random values at each index of \p box
+     * and each depth of \p data using the counter-based generator.
+     *
+     * The value at index i and depth d is determined by (seed, step) and (i,
+     * level_number, d, stream).  The stream number is used to distinguish
+     * different random fields (e.g., different data centerings or data axes)
+     * defined in the same index space; only its lower 16 bits are used.
+     * Similarly, only the lower 8 bits of the level number and depth are
+     * used.
+     */
+    static void genrandn(SAMRAI::pdat::ArrayData<NDIM, double>& data,
+                         const SAMRAI::hier::Box<NDIM>& box,
+                         unsigned int seed,
+                         unsigned int step,
+                         unsigned int level_number,
+                         unsigned int stream);
+
+    /*!
+     * \brief Set normally distributed random values on the patch interior of
+     * cell-centered data using the counter-based generator.
+     */
+    static void genrandn(SAMRAI::pdat::CellData<NDIM, double>& data,
+                         unsigned int seed,
+                         unsigned int step,
+                         unsigned int level_number,
+                         unsigned int stream);
+
+    /*!
+     * \brief Set normally distributed random values on the patch interior of
+     * side-centered data using the counter-based generator.
+     *
+     * \note The values associated with side axis \em axis are generated using
+     * stream number <code>NDIM * stream + axis</code>.
+     */
+    static void genrandn(SAMRAI::pdat::SideData<NDIM, double>& data,
+                         unsigned int seed,
+                         unsigned int step,
+                         unsigned int level_number,
+                         unsigned int stream);
+
 private:
     RNG() = delete;
     RNG(RNG&) = delete;
@@ -1834,9 +1834,15 @@ CIBMethod::computeCOMOfStructures(IBTK::EigenAlignedVector<Eigen::Vector3d>& cen
             for (unsigned int d = 0; d < NDIM; ++d) center_of_mass[struct_handle][d] += X[d];
         }
 
+        IBTK_MPI::SumReductionBatch com_sums;
+        for (unsigned struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
+        {
+            com_sums.add(center_of_mass[struct_no].data(), center_of_mass[struct_no].size());
+        }
+        com_sums.wait();
+
         for (unsigned struct_no = 0; struct_no < structs_on_this_ln; ++struct_no)
         {
-            IBTK_MPI::sumReduction(center_of_mass[struct_no].data(), center_of_mass[struct_no].size());
             const int total_nodes = getNumberOfNodes(struct_no);
             center_of_mass[struct_no] /= total_nodes;
         }
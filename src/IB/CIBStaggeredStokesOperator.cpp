@@ -177,17 +177,18 @@ CIBStaggeredStokesOperator::apply(Vec x, Vec y)
     //                          -beta*delta*Reg*L]
 
     // (a) Momentum equation.
-    d_hier_math_ops->grad(A_U_idx, A_U_sc_var, /*cf_bdry_synch*/ false, 1.0, P_idx, P_cc_var, d_no_fill, half_time);
-    d_hier_math_ops->laplace(A_U_idx,
-                             A_U_sc_var,
-                             d_U_problem_coefs,
-                             U_scratch_idx,
-                             U_sc_var,
-                             d_no_fill,
-                             half_time,
-                             1.0,
-                             A_U_idx,
-                             A_U_sc_var);
+    d_hier_math_ops->laplaceGrad(A_U_idx,
+                                 A_U_sc_var,
+                                 d_U_problem_coefs,
+                                 U_scratch_idx,
+                                 U_sc_var,
+                                 d_no_fill,
+                                 half_time,
+                                 1.0,
+                                 P_idx,
+                                 P_cc_var,
+                                 d_no_fill,
+                                 half_time);
 
     d_cib_strategy->setConstraintForce(L, half_time, -1.0 * d_scale_spread);
     ib_method_ops->spreadForce(A_U_idx, nullptr, std::vector<Pointer<RefineSchedule<NDIM> > >(), half_time);
@@ -445,9 +445,13 @@ ConstraintIBMethod::postprocessSolveFluidEquations(double current_time, double n
     calculateKinematicsVelocity();
     IBTK_TIMER_STOP(t_calculateKinematicsVelocity);
 
+    // The rigid translational momenta are summed over all processes while the
+    // rigid rotational momenta are computed.
     IBTK_TIMER_START(t_calculateRigidMomentum);
-    calculateRigidTranslationalMomentum();
+    IBTK_MPI::SumReductionBatch trans_momentum_sums;
+    startRigidTranslationalMomentum(trans_momentum_sums);
     calculateRigidRotationalMomentum();
+    calculateRigidTranslationalMomentum(trans_momentum_sums);
     IBTK_TIMER_STOP(t_calculateRigidMomentum);
 
     IBTK_TIMER_START(t_correctVelocityOnLagrangianMesh);
@@ -988,16 +992,23 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     }
 
+    // Sum the contributions of all structures with a single reduction.
+    IBTK_MPI::SumReductionBatch com_sums;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        com_sums.add(d_center_of_mass_unshifted_current[struct_no].data(),
+                     d_center_of_mass_unshifted_current[struct_no].size());
+        com_sums.add(d_center_of_mass_unshifted_new[struct_no].data(),
+                     d_center_of_mass_unshifted_new[struct_no].size());
+        com_sums.add(&tagged_position[struct_no][0], 3);
+    }
+    com_sums.wait();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         const int total_nodes = struct_param.getTotalNodes();
 
-        IBTK_MPI::sumReduction(d_center_of_mass_unshifted_current[struct_no].data(),
-                               d_center_of_mass_unshifted_current[struct_no].size());
-        IBTK_MPI::sumReduction(d_center_of_mass_unshifted_new[struct_no].data(),
-                               d_center_of_mass_unshifted_new[struct_no].size());
-
         for (int i = 0; i < 3; ++i)
         {
             d_center_of_mass_unshifted_current[struct_no][i] /= total_nodes;
@@ -1038,7 +1049,6 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
 
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&tagged_position[struct_no][0], 3);
         d_tagged_pt_position[struct_no] = tagged_position[struct_no];
     }
 
@@ -1153,29 +1163,19 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         ptr_x_lag_data_new->restoreArrays();
     } // all levels
 
+    IBTK_MPI::SumReductionBatch moi_sums;
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            IBTK_MPI::sumReduction(&d_moment_of_inertia_current[struct_no](0, 0), 9);
-            IBTK_MPI::sumReduction(&d_moment_of_inertia_new[struct_no](0, 0), 9);
+            moi_sums.add(&d_moment_of_inertia_current[struct_no](0, 0), 9);
+            moi_sums.add(&d_moment_of_inertia_new[struct_no](0, 0), 9);
         }
     }
+    moi_sums.start();
 
-    // Fill-in symmetric part of inertia tensor.
-    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
-    {
-        d_moment_of_inertia_current[struct_no](1, 0) = d_moment_of_inertia_current[struct_no](0, 1);
-        d_moment_of_inertia_current[struct_no](2, 0) = d_moment_of_inertia_current[struct_no](0, 2);
-        d_moment_of_inertia_current[struct_no](2, 1) = d_moment_of_inertia_current[struct_no](1, 2);
-
-        d_moment_of_inertia_new[struct_no](1, 0) = d_moment_of_inertia_new[struct_no](0, 1);
-        d_moment_of_inertia_new[struct_no](2, 0) = d_moment_of_inertia_new[struct_no](0, 2);
-        d_moment_of_inertia_new[struct_no](2, 1) = d_moment_of_inertia_new[struct_no](1, 2);
-    }
-
-    // write the COM and MOI to the output file
+    // Write the COM to the output file while the MOI is summed.
     if (!IBTK_MPI::getRank() && d_print_output && d_output_COM_coordinates &&
         (d_timestep_counter % d_output_interval) == 0 && !IBTK::abs_equal_eps(d_FuRMoRP_current_time, 0.0))
     {
@@ -1188,6 +1188,21 @@ ConstraintIBMethod::calculateCOMandMOIOfStructures()
         }
     }
 
+    moi_sums.wait();
+
+    // Fill-in symmetric part of inertia tensor.
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        d_moment_of_inertia_current[struct_no](1, 0) = d_moment_of_inertia_current[struct_no](0, 1);
+        d_moment_of_inertia_current[struct_no](2, 0) = d_moment_of_inertia_current[struct_no](0, 2);
+        d_moment_of_inertia_current[struct_no](2, 1) = d_moment_of_inertia_current[struct_no](1, 2);
+
+        d_moment_of_inertia_new[struct_no](1, 0) = d_moment_of_inertia_new[struct_no](0, 1);
+        d_moment_of_inertia_new[struct_no](2, 0) = d_moment_of_inertia_new[struct_no](0, 2);
+        d_moment_of_inertia_new[struct_no](2, 1) = d_moment_of_inertia_new[struct_no](1, 2);
+    }
+
+    // Write the MOI to the output file.
     if (!IBTK_MPI::getRank() && d_print_output && d_output_MOI && (d_timestep_counter % d_output_interval) == 0 &&
         !IBTK::abs_equal_eps(d_FuRMoRP_current_time, 0.0))
     {
@@ -1283,15 +1298,11 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
             d_vel_com_def_new[position_handle][d] += U_com_def[d];
         }
     }
-    IBTK_MPI::sumReduction(d_vel_com_def_new[position_handle].data(), d_vel_com_def_new[position_handle].size());
 
-    for (int d = 0; d < 3; ++d)
-    {
-        if (calculate_trans_mom[d])
-            d_vel_com_def_new[position_handle][d] /= total_nodes;
-        else
-            d_vel_com_def_new[position_handle][d] = 0.0;
-    }
+    // The linear and angular momenta are summed over all processes with a
+    // single reduction once both local contributions are known.
+    IBTK_MPI::SumReductionBatch momentum_sums;
+    momentum_sums.add(d_vel_com_def_new[position_handle].data(), d_vel_com_def_new[position_handle].size());
 
     // Calculate angular momentum.
     if (struct_param.getStructureIsSelfRotating())
@@ -1360,8 +1371,20 @@ ConstraintIBMethod::calculateMomentumOfKinematicsVelocity(const int position_han
             }
             ptr_x_lag_data->restoreArrays();
         } // all levels
-        IBTK_MPI::sumReduction(&d_omega_com_def_new[position_handle][0], 3);
+        momentum_sums.add(&d_omega_com_def_new[position_handle][0], 3);
+    } // if struct is rotating
+    momentum_sums.wait();
 
+    for (int d = 0; d < 3; ++d)
+    {
+        if (calculate_trans_mom[d])
+            d_vel_com_def_new[position_handle][d] /= total_nodes;
+        else
+            d_vel_com_def_new[position_handle][d] = 0.0;
+    }
+
+    if (struct_param.getStructureIsSelfRotating())
+    {
 // Find angular velocity of deformational velocity.
 #if (NDIM == 2)
         d_omega_com_def_new[position_handle][2] /= d_moment_of_inertia_new[position_handle](2, 2);
@@ -1525,7 +1548,7 @@ ConstraintIBMethod::calculateVolumeElement()
 } // calculateVolumeElement
 
 void
-ConstraintIBMethod::calculateRigidTranslationalMomentum()
+ConstraintIBMethod::startRigidTranslationalMomentum(IBTK_MPI::SumReductionBatch& momentum_sums)
 {
     // Zero out new rigid momentum.
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
@@ -1587,7 +1610,24 @@ ConstraintIBMethod::calculateRigidTranslationalMomentum()
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfTranslating())
         {
-            IBTK_MPI::sumReduction(d_rigid_trans_vel_new[struct_no].data(), d_rigid_trans_vel_new[struct_no].size());
+            momentum_sums.add(d_rigid_trans_vel_new[struct_no].data(), d_rigid_trans_vel_new[struct_no].size());
+        }
+    }
+    momentum_sums.start();
+    return;
+} // startRigidTranslationalMomentum
+
+void
+ConstraintIBMethod::calculateRigidTranslationalMomentum(IBTK_MPI::SumReductionBatch& momentum_sums)
+{
+    using StructureParameters = ConstraintIBKinematics::StructureParameters;
+    momentum_sums.wait();
+
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfTranslating())
+        {
             tbox::Array<int> calculate_trans_mom = struct_param.getCalculateTranslationalMomentum();
             for (int d = 0; d < NDIM; ++d)
             {
@@ -1687,12 +1727,22 @@ ConstraintIBMethod::calculateRigidRotationalMomentum()
         d_l_data_X_half_Euler[ln]->restoreArrays();
     } // all levels
 
+    IBTK_MPI::SumReductionBatch momentum_sums;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
+        if (struct_param.getStructureIsSelfRotating())
+        {
+            momentum_sums.add(&d_rigid_rot_vel_new[struct_no][0], 3);
+        }
+    }
+    momentum_sums.wait();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
         const StructureParameters& struct_param = d_ib_kinematics[struct_no]->getStructureParameters();
         if (struct_param.getStructureIsSelfRotating())
         {
-            IBTK_MPI::sumReduction(&d_rigid_rot_vel_new[struct_no][0], 3);
 #if (NDIM == 2)
             d_rigid_rot_vel_new[struct_no][2] /= d_moment_of_inertia_new[struct_no](2, 2);
 #endif
@@ -2535,10 +2585,16 @@ ConstraintIBMethod::calculateDrag()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    IBTK_MPI::SumReductionBatch drag_sums;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        drag_sums.add(&inertia_force[struct_no][0], 3);
+        drag_sums.add(&constraint_force[struct_no][0], 3);
+    }
+    drag_sums.wait();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&inertia_force[struct_no][0], 3);
-        IBTK_MPI::sumReduction(&constraint_force[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_force[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2646,10 +2702,16 @@ ConstraintIBMethod::calculateTorque()
         d_l_data_U_correction[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    IBTK_MPI::SumReductionBatch torque_sums;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        torque_sums.add(&inertia_torque[struct_no][0], 3);
+        torque_sums.add(&constraint_torque[struct_no][0], 3);
+    }
+    torque_sums.wait();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&inertia_torque[struct_no][0], 3);
-        IBTK_MPI::sumReduction(&constraint_torque[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             inertia_torque[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2728,10 +2790,16 @@ ConstraintIBMethod::calculatePower()
         d_l_data_U_correction[ln]->restoreArrays();
     }
 
+    IBTK_MPI::SumReductionBatch power_sums;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        power_sums.add(&inertia_power[struct_no][0], 3);
+        power_sums.add(&constraint_power[struct_no][0], 3);
+    }
+    power_sums.wait();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&inertia_power[struct_no][0], 3);
-        IBTK_MPI::sumReduction(&constraint_power[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             inertia_power[struct_no][d] *= (d_rho_solid[struct_no] / dt) * d_vol_element[struct_no];
@@ -2798,9 +2866,15 @@ ConstraintIBMethod::calculateStructureMomentum()
         d_l_data_U_new[ln]->restoreArrays();
     }
 
+    IBTK_MPI::SumReductionBatch momentum_sums;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        momentum_sums.add(&d_structure_mom[struct_no][0], 3);
+    }
+    momentum_sums.wait();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&d_structure_mom[struct_no][0], 3);
         for (int d = 0; d < NDIM; ++d)
         {
             d_structure_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -2878,9 +2952,15 @@ ConstraintIBMethod::calculateStructureRotationalMomentum()
         d_l_data_U_new[ln]->restoreArrays();
         d_X_new_data[ln]->restoreArrays();
     }
+    IBTK_MPI::SumReductionBatch momentum_sums;
+    for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
+    {
+        momentum_sums.add(&d_structure_rotational_mom[struct_no][0], 3);
+    }
+    momentum_sums.wait();
+
     for (int struct_no = 0; struct_no < d_no_structures; ++struct_no)
     {
-        IBTK_MPI::sumReduction(&d_structure_rotational_mom[struct_no][0], 3);
         for (int d = 0; d < 3; ++d)
         {
             d_structure_rotational_mom[struct_no][d] *= d_rho_solid[struct_no] * d_vol_element[struct_no];
@@ -24,6 +24,7 @@
 #include "ibtk/IBTK_CHKERRQ.h"
 #include "ibtk/IBTK_MPI.h"
 #include "ibtk/LibMeshSystemVectors.h"
+#include "ibtk/ThreadPool.h"
 #include "ibtk/ibtk_utilities.h"
 #include "ibtk/libmesh_utilities.h"
 
@@ -69,6 +70,13 @@
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/vector_value.h"
 
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <set>
+#include <string>
 #include <utility>
 
 #include "ibamr/namespaces.h" // IWYU pragma: keep
@@ -134,6 +142,36 @@ is_dirichlet_bdry(const Elem* elem,
     return get_dirichlet_bdry_ids(bdry_ids) != 0;
 }
 
+// Split @p elems into @p n_threads contiguous ranges and call
+// @p assemble(thread_n, range_begin, range_end) for each one. The ranges are
+// processed concurrently by the threads of the IBTK thread pool.
+template <typename ElemRangeFunction>
+void
+run_threaded_element_loop(const std::vector<Elem*>& elems,
+                          const unsigned int n_threads,
+                          const ElemRangeFunction& assemble)
+{
+    const auto range_begin = [&](const unsigned int thread_n)
+    { return elems.begin() + (elems.size() * thread_n) / n_threads; };
+    ThreadPool::run(n_threads,
+                    n_threads,
+                    [&](const int thread_n) { assemble(thread_n, range_begin(thread_n), range_begin(thread_n + 1)); });
+    return;
+}
+
+// Cache the dof indices of all elements in @p elems for each system in
+// @p system_names so that concurrent element loops only read the caches.
+void
+fill_dof_map_caches(FEData& fe_data, const std::set<std::string>& system_names, const std::vector<Elem*>& elems)
+{
+    for (const std::string& system_name : system_names)
+    {
+        FEDataManager::SystemDofMapCache& dof_map_cache = *fe_data.getDofMapCache(system_name);
+        for (const Elem* const elem : elems) dof_map_cache.dof_indices(elem);
+    }
+    return;
+}
+
 inline void
 get_FF(libMesh::TensorValue<double>& FF,
        const std::vector<VectorValue<double> >& grad_x_data,
@@ -316,6 +354,64 @@ FEMechanicsBase::getPK1StressFunction(unsigned int part) const
     return d_PK1_stress_fcn_data[part];
 }
 
+void
+FEMechanicsBase::evaluatePK1StressFunction(TensorValue<double>& PP,
+                                           const PK1StressFcnData& pk1,
+                                           const TensorValue<double>& FF,
+                                           const libMesh::Point& x,
+                                           const libMesh::Point& X,
+                                           Elem* const elem,
+                                           const std::vector<const std::vector<double>*>& system_var_data,
+                                           const std::vector<const std::vector<VectorValue<double> >*>& system_grad_var_data,
+                                           const double data_time)
+{
+    if (pk1.fcn)
+    {
+        pk1.fcn(PP, FF, x, X, elem, system_var_data, system_grad_var_data, data_time, pk1.ctx);
+        return;
+    }
+    TBOX_ASSERT(pk1.batch_fcn);
+
+    // Pack the data at the point as a batch of size one.
+    std::array<double, NDIM * NDIM> PP_pt, FF_pt;
+    std::array<double, NDIM> x_pt, X_pt;
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        x_pt[i] = x(i);
+        X_pt[i] = X(i);
+        for (unsigned int j = 0; j < NDIM; ++j) FF_pt[i * NDIM + j] = FF(i, j);
+    }
+    std::vector<const double*> var_data(system_var_data.size());
+    for (unsigned int k = 0; k < system_var_data.size(); ++k) var_data[k] = system_var_data[k]->data();
+    std::vector<std::vector<double> > grad_var_buf(system_grad_var_data.size());
+    std::vector<const double*> grad_var_data(system_grad_var_data.size());
+    for (unsigned int k = 0; k < system_grad_var_data.size(); ++k)
+    {
+        const std::vector<VectorValue<double> >& grad_vars = *system_grad_var_data[k];
+        grad_var_buf[k].resize(NDIM * grad_vars.size());
+        for (unsigned int l = 0; l < grad_vars.size(); ++l)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d) grad_var_buf[k][l * NDIM + d] = grad_vars[l](d);
+        }
+        grad_var_data[k] = grad_var_buf[k].data();
+    }
+    pk1.batch_fcn(PP_pt.data(),
+                  FF_pt.data(),
+                  x_pt.data(),
+                  X_pt.data(),
+                  1,
+                  elem,
+                  var_data,
+                  grad_var_data,
+                  data_time,
+                  pk1.ctx);
+    PP.zero();
+    for (unsigned int i = 0; i < NDIM; ++i)
+    {
+        for (unsigned int j = 0; j < NDIM; ++j) PP(i, j) = PP_pt[i * NDIM + j];
+    }
+}
+
 void
 FEMechanicsBase::registerLagBodyForceFunction(const LagBodyForceFcnData& data, const unsigned int part)
 {
@@ -904,15 +1000,46 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
     double* F_rhs_local_soln = nullptr;
     ierr = VecGetArray(F_rhs_vec_local, &F_rhs_local_soln);
     IBTK_CHKERRQ(ierr);
-    std::array<DenseVector<double>, NDIM> F_rhs_e;
-    std::vector<libMesh::dof_id_type> dof_id_scratch;
+
+    // Elements are split into contiguous ranges that are assembled
+    // concurrently by up to d_num_assembly_threads threads, each with its own FE
+    // objects. Every thread other than the first sums its element
+    // contributions into a private copy of the local form of the RHS vector;
+    // these copies are added to the RHS vector after all element loops are
+    // done, so the threads never write to the same memory.
+    const std::vector<Elem*> local_elems(mesh.active_local_elements_begin(), mesh.active_local_elements_end());
+    const unsigned int n_threads = static_cast<unsigned int>(
+        std::max<std::size_t>(1, std::min<std::size_t>(d_num_assembly_threads, local_elems.size())));
+    PetscInt F_rhs_local_size;
+    ierr = VecGetSize(F_rhs_vec_local, &F_rhs_local_size);
+    IBTK_CHKERRQ(ierr);
+    std::vector<std::vector<double> > F_rhs_thread_solns(n_threads - 1);
+    for (std::vector<double>& F_rhs_thread_soln : F_rhs_thread_solns) F_rhs_thread_soln.resize(F_rhs_local_size, 0.0);
+    const auto get_F_rhs_thread_soln = [&](const unsigned int thread_n) -> double*
+    { return thread_n == 0 ? F_rhs_local_soln : F_rhs_thread_solns[thread_n - 1].data(); };
+    if (n_threads > 1)
+    {
+        std::set<std::string> system_names = { getForceSystemName(), getCurrentCoordinatesSystemName() };
+        if (using_pressure) system_names.insert(getPressureSystemName());
+        for (const PK1StressFcnData& pk1 : getPK1StressFunction(part))
+        {
+            for (const SystemData& data : pk1.system_data) system_names.insert(data.system_name);
+        }
+        for (const std::vector<SystemData>* system_data : { &d_lag_body_force_fcn_data[part].system_data,
+                                                            &d_lag_surface_force_fcn_data[part].system_data,
+                                                            &d_lag_surface_pressure_fcn_data[part].system_data })
+        {
+            for (const SystemData& data : *system_data) system_names.insert(data.system_name);
+        }
+        fill_dof_map_caches(*d_fe_data[part], system_names, local_elems);
+    }
 
     // For efficiency, combine loops over PK1 functions corresponding to the
     // same quadrature rules and systems.
     const std::vector<PK1StressFcnData> all_pk1 = getPK1StressFunction(part);
     std::vector<PK1StressFcnData> remaining_pk1;
     std::copy_if(all_pk1.begin(), all_pk1.end(), std::back_inserter(remaining_pk1), [](const PK1StressFcnData& data) {
-        return data.fcn != nullptr;
+        return data.fcn != nullptr || data.batch_fcn != nullptr;
     });
     while (remaining_pk1.size() > 0)
     {
@@ -938,10 +1065,329 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         std::vector<int> vars(NDIM);
         for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
 
-        FEDataInterpolation fe(dim, d_fe_data[part]);
-        std::unique_ptr<QBase> qrule = QBase::build(exemplar_pk1.quad_type, dim, exemplar_pk1.quad_order);
+        // Set up one FE object, with its own quadrature rules, per thread.
+        std::vector<std::unique_ptr<QBase> > qrules(n_threads), qrules_face(n_threads);
+        std::vector<std::unique_ptr<FEDataInterpolation> > fes(n_threads);
+        size_t X_sys_idx = std::numeric_limits<size_t>::max();
+        std::vector<size_t> PK1_fcn_system_idxs;
+        for (unsigned int thread_n = 0; thread_n < n_threads; ++thread_n)
+        {
+            std::unique_ptr<QBase>& qrule = qrules[thread_n];
+            std::unique_ptr<QBase>& qrule_face = qrules_face[thread_n];
+            fes[thread_n].reset(new FEDataInterpolation(dim, d_fe_data[part]));
+            FEDataInterpolation& fe = *fes[thread_n];
+            qrule = QBase::build(exemplar_pk1.quad_type, dim, exemplar_pk1.quad_order);
+            qrule->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+            qrule_face = QBase::build(exemplar_pk1.quad_type, dim - 1, exemplar_pk1.quad_order);
+            qrule_face->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
+            fe.attachQuadratureRule(qrule.get());
+            fe.attachQuadratureRuleFace(qrule_face.get());
+            fe.evalNormalsFace();
+            fe.evalQuadraturePoints();
+            fe.evalQuadraturePointsFace();
+            fe.evalQuadratureWeights();
+            fe.evalQuadratureWeightsFace();
+            fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
+            X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+            fe.setupInterpolatedSystemDataIndexes(PK1_fcn_system_idxs, exemplar_pk1.system_data, &equation_systems);
+            fe.init();
+            fe.getLocalSolutionArrays();
+        }
+
+        const auto assemble = [&](const unsigned int thread_n,
+                                  const std::vector<Elem*>::const_iterator el_begin,
+                                  const std::vector<Elem*>::const_iterator el_end)
+        {
+            FEDataInterpolation& fe = *fes[thread_n];
+            QBase* const qrule = qrules[thread_n].get();
+            QBase* const qrule_face = qrules_face[thread_n].get();
+            double* const F_rhs_soln = get_F_rhs_thread_soln(thread_n);
+            std::array<DenseVector<double>, NDIM> F_rhs_e;
+            std::vector<libMesh::dof_id_type> dof_id_scratch;
+
+            const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
+            const std::vector<double>& JxW = fe.getQuadratureWeights();
+            const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
+
+            const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
+            const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
+            const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
+            const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
+
+            const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
+            const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
+                fe.getGradVarInterpolation();
+
+            std::vector<const std::vector<double>*> PK1_var_data;
+            std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
+
+            // Batched PK1 stress functions are evaluated once per element on
+            // structure-of-arrays data (see the documentation of
+            // PK1StressBatchFcnPtr for the layout); pointwise functions are
+            // evaluated at each quadrature point.
+            const bool use_batch_fcns =
+                std::any_of(current_pk1.begin(), current_pk1.end(), [](const PK1StressFcnData& pk1) {
+                    return pk1.batch_fcn != nullptr;
+                });
+            const bool use_pointwise_fcns =
+                std::any_of(current_pk1.begin(), current_pk1.end(), [](const PK1StressFcnData& pk1) {
+                    return pk1.batch_fcn == nullptr;
+                });
+            const size_t n_PK1_systems = PK1_fcn_system_idxs.size();
+            std::vector<double> FF_batch, x_batch, X_batch;
+            std::vector<std::vector<double> > PP_batch(current_pk1.size());
+            std::vector<std::vector<double> > PK1_var_batch(n_PK1_systems), PK1_grad_var_batch(n_PK1_systems);
+            std::vector<const double*> PK1_var_batch_ptrs(n_PK1_systems), PK1_grad_var_batch_ptrs(n_PK1_systems);
+
+            // Loop over the elements to compute the right-hand side vector.  This
+            // is computed via
+            //
+            //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
+            //    phi_k(s)}dA(s)
+            //
+            // This right-hand side vector is used to solve for the nodal values of
+            // the interior elastic force density.
+            TensorValue<double> PP, FF, FF_inv_trans;
+            VectorValue<double> F, F_qp, n, x;
+            for (auto el_it = el_begin; el_it != el_end; ++el_it)
+            {
+                auto elem = *el_it;
+                const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    F_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
+                }
+                fe.reinit(elem);
+                fe.collectDataForInterpolation(elem);
+                fe.interpolate(elem);
+                const unsigned int n_qp = qrule->n_points();
+                const size_t n_basis = dphi.size();
+
+                // Evaluate the batched PK1 stress functions at all quadrature
+                // points of the element.
+                if (use_batch_fcns)
+                {
+                    FF_batch.resize(NDIM * NDIM * n_qp);
+                    x_batch.resize(NDIM * n_qp);
+                    X_batch.resize(NDIM * n_qp);
+                    for (unsigned int qp = 0; qp < n_qp; ++qp)
+                    {
+                        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                        const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            x_batch[i * n_qp + qp] = x_data[i];
+                            X_batch[i * n_qp + qp] = q_point[qp](i);
+                            for (unsigned int j = 0; j < NDIM; ++j)
+                            {
+                                FF_batch[(i * NDIM + j) * n_qp + qp] = grad_x_data[i](j);
+                            }
+                        }
+
+                        fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                        for (unsigned int k = 0; k < n_PK1_systems; ++k)
+                        {
+                            const std::vector<double>& var_data = *PK1_var_data[k];
+                            const std::vector<VectorValue<double> >& grad_var_data = *PK1_grad_var_data[k];
+                            PK1_var_batch[k].resize(var_data.size() * n_qp);
+                            PK1_grad_var_batch[k].resize(NDIM * grad_var_data.size() * n_qp);
+                            for (unsigned int l = 0; l < var_data.size(); ++l)
+                            {
+                                PK1_var_batch[k][l * n_qp + qp] = var_data[l];
+                            }
+                            for (unsigned int l = 0; l < grad_var_data.size(); ++l)
+                            {
+                                for (unsigned int d = 0; d < NDIM; ++d)
+                                {
+                                    PK1_grad_var_batch[k][(l * NDIM + d) * n_qp + qp] = grad_var_data[l](d);
+                                }
+                            }
+                        }
+                    }
+                    for (unsigned int k = 0; k < n_PK1_systems; ++k)
+                    {
+                        PK1_var_batch_ptrs[k] = PK1_var_batch[k].data();
+                        PK1_grad_var_batch_ptrs[k] = PK1_grad_var_batch[k].data();
+                    }
+                    for (unsigned int k = 0; k < current_pk1.size(); ++k)
+                    {
+                        const PK1StressFcnData& pk1 = current_pk1[k];
+                        if (!pk1.batch_fcn) continue;
+                        PP_batch[k].resize(NDIM * NDIM * n_qp);
+                        pk1.batch_fcn(PP_batch[k].data(),
+                                      FF_batch.data(),
+                                      x_batch.data(),
+                                      X_batch.data(),
+                                      n_qp,
+                                      elem,
+                                      PK1_var_batch_ptrs,
+                                      PK1_grad_var_batch_ptrs,
+                                      data_time,
+                                      pk1.ctx);
+                    }
+                }
+
+                for (unsigned int qp = 0; qp < n_qp; ++qp)
+                {
+                    const libMesh::Point& X = q_point[qp];
+                    if (use_pointwise_fcns)
+                    {
+                        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                        const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                        get_x_and_FF(x, FF, x_data, grad_x_data);
+                        fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                    }
+
+                    // Compute the value of the first Piola-Kirchhoff stress tensor
+                    // at the quadrature point and add the corresponding forces to
+                    // the right-hand-side vector.
+                    for (unsigned int k = 0; k < current_pk1.size(); ++k)
+                    {
+                        const PK1StressFcnData& pk1 = current_pk1[k];
+                        if (pk1.batch_fcn)
+                        {
+                            const double* const PP_qp = PP_batch[k].data() + qp;
+                            for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                            {
+                                const VectorValue<double>& dphi_qp = dphi[basis_n][qp];
+                                for (unsigned int i = 0; i < NDIM; ++i)
+                                {
+                                    double PP_dphi = 0.0;
+                                    for (unsigned int j = 0; j < NDIM; ++j)
+                                    {
+                                        PP_dphi += PP_qp[(i * NDIM + j) * n_qp] * dphi_qp(j);
+                                    }
+                                    F_rhs_e[i](basis_n) -= PP_dphi * JxW[qp];
+                                }
+                            }
+                            continue;
+                        }
+                        pk1.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
+                        for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                        {
+                            F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                F_rhs_e[i](basis_n) += F_qp(i);
+                            }
+                        }
+                    }
+                }
+
+                // Loop over the element boundaries.
+                for (unsigned int side = 0; side < elem->n_sides(); ++side)
+                {
+                    // Skip non-physical boundaries.
+                    if (!is_physical_bdry(elem, side, boundary_info, F_dof_map)) continue;
+
+                    // Determine if we need to integrate surface forces along this
+                    // part of the physical boundary; if not, skip the present side.
+                    const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, F_dof_map);
+                    const bool integrate_normal_stress = (d_include_normal_stress_in_weak_form && !at_dirichlet_bdry) ||
+                                                         (!d_include_normal_stress_in_weak_form && at_dirichlet_bdry);
+                    const bool integrate_tangential_stress =
+                        (d_include_tangential_stress_in_weak_form && !at_dirichlet_bdry) ||
+                        (!d_include_tangential_stress_in_weak_form && at_dirichlet_bdry);
+                    if (!integrate_normal_stress && !integrate_tangential_stress) continue;
+
+                    fe.reinit(elem, side);
+                    fe.interpolate(elem, side);
+                    const unsigned int n_qp_face = qrule_face->n_points();
+                    const size_t n_basis_face = phi_face.size();
+                    for (unsigned int qp = 0; qp < n_qp_face; ++qp)
+                    {
+                        const libMesh::Point& X = q_point_face[qp];
+                        const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
+                        const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
+                        get_x_and_FF(x, FF, x_data, grad_x_data);
+                        tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+
+                        F.zero();
+
+                        // Compute the value of the first Piola-Kirchhoff stress
+                        // tensor at the quadrature point and add the corresponding
+                        // traction force to the right-hand-side vector.
+                        fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
+                        for (const PK1StressFcnData& pk1 : current_pk1)
+                        {
+                            evaluatePK1StressFunction(
+                                PP, pk1, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time);
+                            F += PP * normal_face[qp];
+                        }
+
+                        n = (FF_inv_trans * normal_face[qp]).unit();
+
+                        if (!integrate_normal_stress)
+                        {
+                            F -= (F * n) * n; // remove the normal component.
+                        }
+
+                        if (!integrate_tangential_stress)
+                        {
+                            F -= (F - (F * n) * n); // remove the tangential component.
+                        }
+
+                        // Add the boundary forces to the right-hand-side vector.
+                        for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
+                        {
+                            F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
+                            for (unsigned int i = 0; i < NDIM; ++i)
+                            {
+                                F_rhs_e[i](basis_face_n) += F_qp(i);
+                            }
+                        }
+                    }
+                }
+
+                // Apply constraints (e.g., enforce periodic boundary conditions)
+                // and add the elemental contributions to the global vector.
+                for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
+                {
+                    copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
+                    F_dof_map.constrain_element_vector(F_rhs_e[var_n], dof_id_scratch);
+                    for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
+                    {
+                        F_rhs_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
+                    }
+                }
+            }
+        };
+        run_threaded_element_loop(local_elems, n_threads, assemble);
+        for (std::unique_ptr<FEDataInterpolation>& fe : fes) fe->restoreLocalSolutionArrays();
+    }
+
+    // Now account for any additional force contributions.
+
+    // Extract the FE systems and DOF maps, and setup the FE objects.
+    const DofMap& F_dof_map = F_system.get_dof_map();
+    FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(getForceSystemName());
+    FEType F_fe_type = F_dof_map.variable_type(0);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        TBOX_ASSERT(F_dof_map.variable_type(d) == F_fe_type);
+    }
+    auto& X_system = equation_systems.get_system<ExplicitSystem>(getCurrentCoordinatesSystemName());
+    System* P_system = using_pressure ? &equation_systems.get_system<ExplicitSystem>(getPressureSystemName()) : nullptr;
+    std::vector<int> vars(NDIM);
+    for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
+    std::vector<int> P_vars(1, 0);
+    std::vector<int> no_vars;
+
+    // Set up one FE object, with its own quadrature rules, per thread.
+    std::vector<std::unique_ptr<QBase> > qrules(n_threads), qrules_face(n_threads);
+    std::vector<std::unique_ptr<FEDataInterpolation> > fes(n_threads);
+    size_t X_sys_idx = std::numeric_limits<size_t>::max();
+    size_t P_sys_idx = std::numeric_limits<size_t>::max();
+    std::vector<size_t> body_force_fcn_system_idxs, surface_force_fcn_system_idxs, surface_pressure_fcn_system_idxs;
+    for (unsigned int thread_n = 0; thread_n < n_threads; ++thread_n)
+    {
+        std::unique_ptr<QBase>& qrule = qrules[thread_n];
+        std::unique_ptr<QBase>& qrule_face = qrules_face[thread_n];
+        fes[thread_n].reset(new FEDataInterpolation(dim, d_fe_data[part]));
+        FEDataInterpolation& fe = *fes[thread_n];
+        qrule = QBase::build(d_default_quad_type_force[part], dim, d_default_quad_order_force[part]);
         qrule->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
-        std::unique_ptr<QBase> qrule_face = QBase::build(exemplar_pk1.quad_type, dim - 1, exemplar_pk1.quad_order);
+        qrule_face = QBase::build(d_default_quad_type_force[part], dim - 1, d_default_quad_order_force[part]);
         qrule_face->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
         fe.attachQuadratureRule(qrule.get());
         fe.attachQuadratureRuleFace(qrule_face.get());
@@ -950,14 +1396,33 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         fe.evalQuadraturePointsFace();
         fe.evalQuadratureWeights();
         fe.evalQuadratureWeightsFace();
-        fe.registerSystem(F_system, std::vector<int>(), vars); // compute dphi for the force system
-        const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
-        std::vector<size_t> PK1_fcn_system_idxs;
-        fe.setupInterpolatedSystemDataIndexes(PK1_fcn_system_idxs, exemplar_pk1.system_data, &equation_systems);
+        fe.registerSystem(F_system, vars, vars); // compute phi and dphi for the force system
+        X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
+        if (using_pressure) P_sys_idx = fe.registerInterpolatedSystem(*P_system, P_vars, no_vars, P_vec);
+        fe.setupInterpolatedSystemDataIndexes(
+            body_force_fcn_system_idxs, d_lag_body_force_fcn_data[part].system_data, &equation_systems);
+        fe.setupInterpolatedSystemDataIndexes(
+            surface_force_fcn_system_idxs, d_lag_surface_force_fcn_data[part].system_data, &equation_systems);
+        fe.setupInterpolatedSystemDataIndexes(
+            surface_pressure_fcn_system_idxs, d_lag_surface_pressure_fcn_data[part].system_data, &equation_systems);
         fe.init();
+        fe.getLocalSolutionArrays();
+    }
+
+    const auto assemble = [&](const unsigned int thread_n,
+                              const std::vector<Elem*>::const_iterator el_begin,
+                              const std::vector<Elem*>::const_iterator el_end)
+    {
+        FEDataInterpolation& fe = *fes[thread_n];
+        QBase* const qrule = qrules[thread_n].get();
+        QBase* const qrule_face = qrules_face[thread_n].get();
+        double* const F_rhs_soln = get_F_rhs_thread_soln(thread_n);
+        std::array<DenseVector<double>, NDIM> F_rhs_e;
+        std::vector<libMesh::dof_id_type> dof_id_scratch;
 
         const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
         const std::vector<double>& JxW = fe.getQuadratureWeights();
+        const std::vector<std::vector<double> >& phi = fe.getPhi(F_fe_type);
         const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
 
         const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
@@ -969,21 +1434,15 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
         const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
             fe.getGradVarInterpolation();
 
-        std::vector<const std::vector<double>*> PK1_var_data;
-        std::vector<const std::vector<VectorValue<double> >*> PK1_grad_var_data;
-
-        // Loop over the elements to compute the right-hand side vector.  This
-        // is computed via
-        //
-        //    rhs_k = -int{PP(s,t) grad phi_k(s)}ds + int{PP(s,t) N(s,t)
-        //    phi_k(s)}dA(s)
-        //
-        // This right-hand side vector is used to solve for the nodal values of
-        // the interior elastic force density.
+        std::vector<const std::vector<double>*> body_force_var_data, surface_force_var_data, surface_pressure_var_data;
+        std::vector<const std::vector<VectorValue<double> >*> body_force_grad_var_data, surface_force_grad_var_data,
+            surface_pressure_grad_var_data;
+
+        // Loop over the elements to compute the right-hand side vector.
         TensorValue<double> PP, FF, FF_inv_trans;
-        VectorValue<double> F, F_qp, n, x;
-        const auto el_begin = mesh.active_local_elements_begin();
-        const auto el_end = mesh.active_local_elements_end();
+        VectorValue<double> F, F_b, F_s, F_qp, n, x;
+        boost::multi_array<double, 2> X_node;
+        boost::multi_array<double, 1> P_node;
         for (auto el_it = el_begin; el_it != el_end; ++el_it)
         {
             auto elem = *el_it;
@@ -996,27 +1455,56 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
             fe.collectDataForInterpolation(elem);
             fe.interpolate(elem);
             const unsigned int n_qp = qrule->n_points();
-            const size_t n_basis = dphi.size();
+            const size_t n_basis = phi.size();
             for (unsigned int qp = 0; qp < n_qp; ++qp)
             {
                 const libMesh::Point& X = q_point[qp];
                 const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
                 const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
                 get_x_and_FF(x, FF, x_data, grad_x_data);
+                const double J = std::abs(FF.det());
+                tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+
+                if (using_pressure)
+                {
+                    const double P = fe_interp_var_data[qp][P_sys_idx][0];
+
+                    // Compute the value of the first Piola-Kirchhoff stress tensor
+                    // at the quadrature point and add the corresponding forces to
+                    // the right-hand-side vector.
+                    PP = -J * P * FF_inv_trans;
+                    for (unsigned int k = 0; k < n_basis; ++k)
+                    {
+                        F_qp = -PP * dphi[k][qp] * JxW[qp];
+                        for (unsigned int i = 0; i < NDIM; ++i)
+                        {
+                            F_rhs_e[i](k) += F_qp(i);
+                        }
+                    }
+                }
 
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                for (const PK1StressFcnData& pk1 : current_pk1)
+                if (d_lag_body_force_fcn_data[part].fcn)
                 {
-                    pk1.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
-                    for (unsigned int basis_n = 0; basis_n < n_basis; ++basis_n)
+                    // Compute the value of the body force at the quadrature
+                    // point and add the corresponding forces to the
+                    // right-hand-side vector.
+                    fe.setInterpolatedDataPointers(
+                        body_force_var_data, body_force_grad_var_data, body_force_fcn_system_idxs, elem, qp);
+                    d_lag_body_force_fcn_data[part].fcn(F_b,
+                                                        FF,
+                                                        x,
+                                                        X,
+                                                        elem,
+                                                        body_force_var_data,
+                                                        body_force_grad_var_data,
+                                                        data_time,
+                                                        d_lag_body_force_fcn_data[part].ctx);
+                    for (unsigned int k = 0; k < n_basis; ++k)
                     {
-                        F_qp = -PP * dphi[basis_n][qp] * JxW[qp];
+                        F_qp = F_b * phi[k][qp] * JxW[qp];
                         for (unsigned int i = 0; i < NDIM; ++i)
                         {
-                            F_rhs_e[i](basis_n) += F_qp(i);
+                            F_rhs_e[i](k) += F_qp(i);
                         }
                     }
                 }
@@ -1028,15 +1516,13 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                 // Skip non-physical boundaries.
                 if (!is_physical_bdry(elem, side, boundary_info, F_dof_map)) continue;
 
-                // Determine if we need to integrate surface forces along this
+                // Determine if we need to compute surface forces along this
                 // part of the physical boundary; if not, skip the present side.
                 const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, F_dof_map);
-                const bool integrate_normal_stress = (d_include_normal_stress_in_weak_form && !at_dirichlet_bdry) ||
-                                                     (!d_include_normal_stress_in_weak_form && at_dirichlet_bdry);
-                const bool integrate_tangential_stress =
-                    (d_include_tangential_stress_in_weak_form && !at_dirichlet_bdry) ||
-                    (!d_include_tangential_stress_in_weak_form && at_dirichlet_bdry);
-                if (!integrate_normal_stress && !integrate_tangential_stress) continue;
+                const bool integrate_normal_force = d_include_normal_surface_forces_in_weak_form && !at_dirichlet_bdry;
+                const bool integrate_tangential_force =
+                    d_include_tangential_surface_forces_in_weak_form && !at_dirichlet_bdry;
+                if (!integrate_normal_force && !integrate_tangential_force) continue;
 
                 fe.reinit(elem, side);
                 fe.interpolate(elem, side);
@@ -1048,39 +1534,77 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                     const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
                     const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
                     get_x_and_FF(x, FF, x_data, grad_x_data);
+                    const double J = std::abs(FF.det());
                     tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
+                    const libMesh::VectorValue<double>& N = normal_face[qp];
+                    n = (FF_inv_trans * N).unit();
 
                     F.zero();
 
-                    // Compute the value of the first Piola-Kirchhoff stress
-                    // tensor at the quadrature point and add the corresponding
-                    // traction force to the right-hand-side vector.
-                    fe.setInterpolatedDataPointers(PK1_var_data, PK1_grad_var_data, PK1_fcn_system_idxs, elem, qp);
-                    for (const PK1StressFcnData& pk1 : current_pk1)
+                    if (d_lag_surface_pressure_fcn_data[part].fcn)
                     {
-                        pk1.fcn(PP, FF, x, X, elem, PK1_var_data, PK1_grad_var_data, data_time, pk1.ctx);
-                        F += PP * normal_face[qp];
+                        // Compute the value of the pressure at the quadrature
+                        // point and add the corresponding force to the
+                        // right-hand-side vector.
+                        double P = 0;
+                        fe.setInterpolatedDataPointers(surface_pressure_var_data,
+                                                       surface_pressure_grad_var_data,
+                                                       surface_pressure_fcn_system_idxs,
+                                                       elem,
+                                                       qp);
+                        d_lag_surface_pressure_fcn_data[part].fcn(P,
+                                                                  n,
+                                                                  N,
+                                                                  FF,
+                                                                  x,
+                                                                  X,
+                                                                  elem,
+                                                                  side,
+                                                                  surface_pressure_var_data,
+                                                                  surface_pressure_grad_var_data,
+                                                                  data_time,
+                                                                  d_lag_surface_pressure_fcn_data[part].ctx);
+                        F -= P * J * FF_inv_trans * normal_face[qp];
                     }
 
-                    n = (FF_inv_trans * normal_face[qp]).unit();
-
-                    if (!integrate_normal_stress)
+                    if (d_lag_surface_force_fcn_data[part].fcn)
                     {
-                        F -= (F * n) * n; // remove the normal component.
+                        // Compute the value of the surface force at the
+                        // quadrature point and add the corresponding force to
+                        // the right-hand-side vector.
+                        fe.setInterpolatedDataPointers(surface_force_var_data,
+                                                   surface_force_grad_var_data,
+                                                   surface_force_fcn_system_idxs,
+                                                   elem,
+                                                   qp);
+                        d_lag_surface_force_fcn_data[part].fcn(F_s,
+                                                               n,
+                                                               N,
+                                                               FF,
+                                                               x,
+                                                               X,
+                                                               elem,
+                                                               side,
+                                                               surface_force_var_data,
+                                                               surface_force_grad_var_data,
+                                                               data_time,
+                                                               d_lag_surface_force_fcn_data[part].ctx);
+                        F += F_s;
                     }
 
-                    if (!integrate_tangential_stress)
-                    {
-                        F -= (F - (F * n) * n); // remove the tangential component.
-                    }
+                    // Remote the normal component of the boundary force when needed.
+                    if (!integrate_normal_force) F -= (F * n) * n;
+
+                    // Remote the tangential component of the boundary force when needed.
+                    if (!integrate_tangential_force) F -= (F - (F * n) * n);
 
                     // Add the boundary forces to the right-hand-side vector.
-                    for (unsigned int basis_face_n = 0; basis_face_n < n_basis_face; ++basis_face_n)
+                    for (unsigned int k = 0; k < n_basis_face; ++k)
                     {
-                        F_qp = F * phi_face[basis_face_n][qp] * JxW_face[qp];
+                        F_qp = F * phi_face[k][qp] * JxW_face[qp];
                         for (unsigned int i = 0; i < NDIM; ++i)
                         {
-                            F_rhs_e[i](basis_face_n) += F_qp(i);
+                            F_rhs_e[i](k) += F_qp(i);
                         }
                     }
                 }
@@ -1094,257 +1618,18 @@ FEMechanicsBase::assembleInteriorForceDensityRHS(PetscVector<double>& F_rhs_vec,
                 F_dof_map.constrain_element_vector(F_rhs_e[var_n], dof_id_scratch);
                 for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
                 {
-                    F_rhs_local_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
+                    F_rhs_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
                 }
             }
         }
-    }
-
-    // Now account for any additional force contributions.
+    };
+    run_threaded_element_loop(local_elems, n_threads, assemble);
+    for (std::unique_ptr<FEDataInterpolation>& fe : fes) fe->restoreLocalSolutionArrays();
 
-    // Extract the FE systems and DOF maps, and setup the FE objects.
-    const DofMap& F_dof_map = F_system.get_dof_map();
-    FEDataManager::SystemDofMapCache& F_dof_map_cache = *d_fe_data[part]->getDofMapCache(getForceSystemName());
-    FEType F_fe_type = F_dof_map.variable_type(0);
-    for (unsigned int d = 0; d < NDIM; ++d)
+    // Add the contributions of the other threads to the RHS vector.
+    for (const std::vector<double>& F_rhs_thread_soln : F_rhs_thread_solns)
     {
-        TBOX_ASSERT(F_dof_map.variable_type(d) == F_fe_type);
-    }
-    auto& X_system = equation_systems.get_system<ExplicitSystem>(getCurrentCoordinatesSystemName());
-    System* P_system = using_pressure ? &equation_systems.get_system<ExplicitSystem>(getPressureSystemName()) : nullptr;
-    std::vector<int> vars(NDIM);
-    for (unsigned int d = 0; d < NDIM; ++d) vars[d] = d;
-    std::vector<int> P_vars(1, 0);
-    std::vector<int> no_vars;
-
-    FEDataInterpolation fe(dim, d_fe_data[part]);
-    std::unique_ptr<QBase> qrule = QBase::build(d_default_quad_type_force[part], dim, d_default_quad_order_force[part]);
-    qrule->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
-    std::unique_ptr<QBase> qrule_face =
-        QBase::build(d_default_quad_type_force[part], dim - 1, d_default_quad_order_force[part]);
-    qrule_face->allow_rules_with_negative_weights = d_allow_rules_with_negative_weights;
-    fe.attachQuadratureRule(qrule.get());
-    fe.attachQuadratureRuleFace(qrule_face.get());
-    fe.evalNormalsFace();
-    fe.evalQuadraturePoints();
-    fe.evalQuadraturePointsFace();
-    fe.evalQuadratureWeights();
-    fe.evalQuadratureWeightsFace();
-    fe.registerSystem(F_system, vars, vars); // compute phi and dphi for the force system
-    const size_t X_sys_idx = fe.registerInterpolatedSystem(X_system, vars, vars, &X_vec);
-    const size_t P_sys_idx = using_pressure ? fe.registerInterpolatedSystem(*P_system, P_vars, no_vars, P_vec) :
-                                              std::numeric_limits<size_t>::max();
-    std::vector<size_t> body_force_fcn_system_idxs;
-    fe.setupInterpolatedSystemDataIndexes(
-        body_force_fcn_system_idxs, d_lag_body_force_fcn_data[part].system_data, &equation_systems);
-    std::vector<size_t> surface_force_fcn_system_idxs;
-    fe.setupInterpolatedSystemDataIndexes(
-        surface_force_fcn_system_idxs, d_lag_surface_force_fcn_data[part].system_data, &equation_systems);
-    std::vector<size_t> surface_pressure_fcn_system_idxs;
-    fe.setupInterpolatedSystemDataIndexes(
-        surface_pressure_fcn_system_idxs, d_lag_surface_pressure_fcn_data[part].system_data, &equation_systems);
-    fe.init();
-
-    const std::vector<libMesh::Point>& q_point = fe.getQuadraturePoints();
-    const std::vector<double>& JxW = fe.getQuadratureWeights();
-    const std::vector<std::vector<double> >& phi = fe.getPhi(F_fe_type);
-    const std::vector<std::vector<VectorValue<double> > >& dphi = fe.getDphi(F_fe_type);
-
-    const std::vector<libMesh::Point>& q_point_face = fe.getQuadraturePointsFace();
-    const std::vector<double>& JxW_face = fe.getQuadratureWeightsFace();
-    const std::vector<libMesh::Point>& normal_face = fe.getNormalsFace();
-    const std::vector<std::vector<double> >& phi_face = fe.getPhiFace(F_fe_type);
-
-    const std::vector<std::vector<std::vector<double> > >& fe_interp_var_data = fe.getVarInterpolation();
-    const std::vector<std::vector<std::vector<VectorValue<double> > > >& fe_interp_grad_var_data =
-        fe.getGradVarInterpolation();
-
-    std::vector<const std::vector<double>*> body_force_var_data, surface_force_var_data, surface_pressure_var_data;
-    std::vector<const std::vector<VectorValue<double> >*> body_force_grad_var_data, surface_force_grad_var_data,
-        surface_pressure_grad_var_data;
-
-    // Loop over the elements to compute the right-hand side vector.
-    TensorValue<double> PP, FF, FF_inv_trans;
-    VectorValue<double> F, F_b, F_s, F_qp, n, x;
-    boost::multi_array<double, 2> X_node;
-    boost::multi_array<double, 1> P_node;
-    const auto el_begin = mesh.active_local_elements_begin();
-    const auto el_end = mesh.active_local_elements_end();
-    for (auto el_it = el_begin; el_it != el_end; ++el_it)
-    {
-        auto elem = *el_it;
-        const auto& F_dof_indices = F_dof_map_cache.dof_indices(elem);
-        for (unsigned int d = 0; d < NDIM; ++d)
-        {
-            F_rhs_e[d].resize(static_cast<int>(F_dof_indices[d].size()));
-        }
-        fe.reinit(elem);
-        fe.collectDataForInterpolation(elem);
-        fe.interpolate(elem);
-        const unsigned int n_qp = qrule->n_points();
-        const size_t n_basis = phi.size();
-        for (unsigned int qp = 0; qp < n_qp; ++qp)
-        {
-            const libMesh::Point& X = q_point[qp];
-            const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-            const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-            get_x_and_FF(x, FF, x_data, grad_x_data);
-            const double J = std::abs(FF.det());
-            tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-
-            if (using_pressure)
-            {
-                const double P = fe_interp_var_data[qp][P_sys_idx][0];
-
-                // Compute the value of the first Piola-Kirchhoff stress tensor
-                // at the quadrature point and add the corresponding forces to
-                // the right-hand-side vector.
-                PP = -J * P * FF_inv_trans;
-                for (unsigned int k = 0; k < n_basis; ++k)
-                {
-                    F_qp = -PP * dphi[k][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        F_rhs_e[i](k) += F_qp(i);
-                    }
-                }
-            }
-
-            if (d_lag_body_force_fcn_data[part].fcn)
-            {
-                // Compute the value of the body force at the quadrature
-                // point and add the corresponding forces to the
-                // right-hand-side vector.
-                fe.setInterpolatedDataPointers(
-                    body_force_var_data, body_force_grad_var_data, body_force_fcn_system_idxs, elem, qp);
-                d_lag_body_force_fcn_data[part].fcn(F_b,
-                                                    FF,
-                                                    x,
-                                                    X,
-                                                    elem,
-                                                    body_force_var_data,
-                                                    body_force_grad_var_data,
-                                                    data_time,
-                                                    d_lag_body_force_fcn_data[part].ctx);
-                for (unsigned int k = 0; k < n_basis; ++k)
-                {
-                    F_qp = F_b * phi[k][qp] * JxW[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        F_rhs_e[i](k) += F_qp(i);
-                    }
-                }
-            }
-        }
-
-        // Loop over the element boundaries.
-        for (unsigned int side = 0; side < elem->n_sides(); ++side)
-        {
-            // Skip non-physical boundaries.
-            if (!is_physical_bdry(elem, side, boundary_info, F_dof_map)) continue;
-
-            // Determine if we need to compute surface forces along this
-            // part of the physical boundary; if not, skip the present side.
-            const bool at_dirichlet_bdry = is_dirichlet_bdry(elem, side, boundary_info, F_dof_map);
-            const bool integrate_normal_force = d_include_normal_surface_forces_in_weak_form && !at_dirichlet_bdry;
-            const bool integrate_tangential_force =
-                d_include_tangential_surface_forces_in_weak_form && !at_dirichlet_bdry;
-            if (!integrate_normal_force && !integrate_tangential_force) continue;
-
-            fe.reinit(elem, side);
-            fe.interpolate(elem, side);
-            const unsigned int n_qp_face = qrule_face->n_points();
-            const size_t n_basis_face = phi_face.size();
-            for (unsigned int qp = 0; qp < n_qp_face; ++qp)
-            {
-                const libMesh::Point& X = q_point_face[qp];
-                const std::vector<double>& x_data = fe_interp_var_data[qp][X_sys_idx];
-                const std::vector<VectorValue<double> >& grad_x_data = fe_interp_grad_var_data[qp][X_sys_idx];
-                get_x_and_FF(x, FF, x_data, grad_x_data);
-                const double J = std::abs(FF.det());
-                tensor_inverse_transpose(FF_inv_trans, FF, NDIM);
-                const libMesh::VectorValue<double>& N = normal_face[qp];
-                n = (FF_inv_trans * N).unit();
-
-                F.zero();
-
-                if (d_lag_surface_pressure_fcn_data[part].fcn)
-                {
-                    // Compute the value of the pressure at the quadrature
-                    // point and add the corresponding force to the
-                    // right-hand-side vector.
-                    double P = 0;
-                    fe.setInterpolatedDataPointers(surface_pressure_var_data,
-                                                   surface_pressure_grad_var_data,
-                                                   surface_pressure_fcn_system_idxs,
-                                                   elem,
-                                                   qp);
-                    d_lag_surface_pressure_fcn_data[part].fcn(P,
-                                                              n,
-                                                              N,
-                                                              FF,
-                                                              x,
-                                                              X,
-                                                              elem,
-                                                              side,
-                                                              surface_pressure_var_data,
-                                                              surface_pressure_grad_var_data,
-                                                              data_time,
-                                                              d_lag_surface_pressure_fcn_data[part].ctx);
-                    F -= P * J * FF_inv_trans * normal_face[qp];
-                }
-
-                if (d_lag_surface_force_fcn_data[part].fcn)
-                {
-                    // Compute the value of the surface force at the
-                    // quadrature point and add the corresponding force to
-                    // the right-hand-side vector.
-                    fe.setInterpolatedDataPointers(
-                        surface_force_var_data, surface_force_grad_var_data, surface_force_fcn_system_idxs, elem, qp);
-                    d_lag_surface_force_fcn_data[part].fcn(F_s,
-                                                           n,
-                                                           N,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           side,
-                                                           surface_force_var_data,
-                                                           surface_force_grad_var_data,
-                                                           data_time,
-                                                           d_lag_surface_force_fcn_data[part].ctx);
-                    F += F_s;
-                }
-
-                // Remote the normal component of the boundary force when needed.
-                if (!integrate_normal_force) F -= (F * n) * n;
-
-                // Remote the tangential component of the boundary force when needed.
-                if (!integrate_tangential_force) F -= (F - (F * n) * n);
-
-                // Add the boundary forces to the right-hand-side vector.
-                for (unsigned int k = 0; k < n_basis_face; ++k)
-                {
-                    F_qp = F * phi_face[k][qp] * JxW_face[qp];
-                    for (unsigned int i = 0; i < NDIM; ++i)
-                    {
-                        F_rhs_e[i](k) += F_qp(i);
-                    }
-                }
-            }
-        }
-
-        // Apply constraints (e.g., enforce periodic boundary conditions)
-        // and add the elemental contributions to the global vector.
-        for (unsigned int var_n = 0; var_n < NDIM; ++var_n)
-        {
-            copy_dof_ids_to_vector(var_n, F_dof_indices, dof_id_scratch);
-            F_dof_map.constrain_element_vector(F_rhs_e[var_n], dof_id_scratch);
-            for (unsigned int j = 0; j < dof_id_scratch.size(); ++j)
-            {
-                F_rhs_local_soln[F_rhs_vec.map_global_to_local_index(dof_id_scratch[j])] += F_rhs_e[var_n](j);
-            }
-        }
+        for (PetscInt k = 0; k < F_rhs_local_size; ++k) F_rhs_local_soln[k] += F_rhs_thread_soln[k];
     }
 
     ierr = VecRestoreArray(F_rhs_vec_local, &F_rhs_local_soln);
@@ -1716,6 +2001,16 @@ FEMechanicsBase::getFromInput(const Pointer<Database>& db, bool /*is_from_restar
         d_use_consistent_mass_matrix = db->getBool("use_consistent_mass_matrix");
     if (db->isBool("allow_rules_with_negative_weights"))
         d_allow_rules_with_negative_weights = db->getBool("allow_rules_with_negative_weights");
+    if (db->isInteger("num_assembly_threads"))
+    {
+        d_num_assembly_threads = db->getInteger("num_assembly_threads");
+        if (d_num_assembly_threads < 1)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  num_assembly_threads must be positive (got " << d_num_assembly_threads << ")"
+                                     << std::endl);
+        }
+    }
 
     // Pressure settings.
     if (db->isDouble("static_pressure_kappa")) d_static_pressure_kappa = db->getDouble("static_pressure_kappa");
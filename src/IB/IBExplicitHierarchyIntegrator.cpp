@@ -234,6 +234,7 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
     d_ib_method_ops->preprocessSolveFluidEquations(current_time, new_time, cycle_num);
     if (d_enable_logging)
         plog << d_object_name << "::integrateHierarchy(): solving the incompressible Navier-Stokes equations\n";
+    const double fluid_solve_start = getLocalComputeTime();
     if (d_current_num_cycles > 1)
     {
         d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
@@ -249,6 +250,7 @@ IBExplicitHierarchyIntegrator::integrateHierarchy(const double current_time, con
             d_ins_hier_integrator->integrateHierarchy(current_time, new_time, ins_cycle_num);
         }
     }
+    recordEulerianPhase(fluid_solve_start);
     d_ib_method_ops->postprocessSolveFluidEquations(current_time, new_time, cycle_num);
 
     // Interpolate the Eulerian velocity to the curvilinear mesh.
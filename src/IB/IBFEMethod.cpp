@@ -1946,22 +1946,22 @@ IBFEMethod::computeStressNormalization(PetscVector<double>& Phi_vec,
                 double Phi = 0.0;
                 for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                 {
-                    if (d_PK1_stress_fcn_data[part][k].fcn)
+                    if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                     {
                         // Compute the value of the first Piola-Kirchhoff stress
                         // tensor at the quadrature point and add the corresponding
                         // traction force to the right-hand-side vector.
                         fe.setInterpolatedDataPointers(
                             PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                        d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                           FF,
-                                                           x,
-                                                           X,
-                                                           elem,
-                                                           PK1_var_data[k],
-                                                           PK1_grad_var_data[k],
-                                                           data_time,
-                                                           d_PK1_stress_fcn_data[part][k].ctx);
+                        evaluatePK1StressFunction(PP,
+                                                  d_PK1_stress_fcn_data[part][k],
+                                                  FF,
+                                                  x,
+                                                  X,
+                                                  elem,
+                                                  PK1_var_data[k],
+                                                  PK1_grad_var_data[k],
+                                                  data_time);
                         Phi += n * ((PP * FF_trans) * n) / J;
                     }
                 }
@@ -2229,22 +2229,22 @@ IBFEMethod::spreadTransmissionForceDensity(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff stress
                             // tensor at the quadrature point and compute the
                             // corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            evaluatePK1StressFunction(PP,
+                                                      d_PK1_stress_fcn_data[part][k],
+                                                      FF,
+                                                      x,
+                                                      X,
+                                                      elem,
+                                                      PK1_var_data[k],
+                                                      PK1_grad_var_data[k],
+                                                      data_time);
                             F -= PP * normal_face[qp] * JxW_face[qp];
                         }
                     }
@@ -2615,22 +2615,22 @@ IBFEMethod::imposeJumpConditions(const int f_data_idx,
 
                     for (unsigned int k = 0; k < num_PK1_fcns; ++k)
                     {
-                        if (d_PK1_stress_fcn_data[part][k].fcn)
+                        if (d_PK1_stress_fcn_data[part][k].fcn || d_PK1_stress_fcn_data[part][k].batch_fcn)
                         {
                             // Compute the value of the first Piola-Kirchhoff
                             // stress tensor at the quadrature point and compute
                             // the corresponding force.
                             fe.setInterpolatedDataPointers(
                                 PK1_var_data[k], PK1_grad_var_data[k], PK1_fcn_system_idxs[k], elem, qp);
-                            d_PK1_stress_fcn_data[part][k].fcn(PP,
-                                                               FF,
-                                                               x,
-                                                               X,
-                                                               elem,
-                                                               PK1_var_data[k],
-                                                               PK1_grad_var_data[k],
-                                                               data_time,
-                                                               d_PK1_stress_fcn_data[part][k].ctx);
+                            evaluatePK1StressFunction(PP,
+                                                      d_PK1_stress_fcn_data[part][k],
+                                                      FF,
+                                                      x,
+                                                      X,
+                                                      elem,
+                                                      PK1_var_data[k],
+                                                      PK1_grad_var_data[k],
+                                                      data_time);
                             F -= PP * normal_face[qp];
                         }
                     }
@@ -18,6 +18,7 @@
 #include "ibamr/INSHierarchyIntegrator.h"
 #include "ibamr/ibamr_enums.h"
 
+#include "ibtk/AdaptiveWorkloadModel.h"
 #include "ibtk/CartCellRobinPhysBdryOp.h"
 #include "ibtk/CartExtrapPhysBdryOp.h"
 #include "ibtk/CartGridFunction.h"
@@ -32,7 +33,10 @@
 
 #include "BasePatchHierarchy.h"
 #include "BasePatchLevel.h"
+#include "Box.h"
+#include "BoxList.h"
 #include "CartesianGridGeometry.h"
+#include "CellData.h"
 #include "CellVariable.h"
 #include "CoarsenAlgorithm.h"
 #include "CoarsenOperator.h"
@@ -45,6 +49,7 @@
 #include "IntVector.h"
 #include "LoadBalancer.h"
 #include "MultiblockDataTranslator.h"
+#include "Patch.h"
 #include "PatchHierarchy.h"
 #include "PatchLevel.h"
 #include "RefineAlgorithm.h"
@@ -63,6 +68,7 @@
 #include "tbox/Utilities.h"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <memory>
 #include <ostream>
@@ -80,7 +86,7 @@ namespace IBAMR
 namespace
 {
 // Version of IBHierarchyIntegrator restart file data.
-static const int IB_HIERARCHY_INTEGRATOR_VERSION = 2;
+static const int IB_HIERARCHY_INTEGRATOR_VERSION = 3;
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -168,6 +174,10 @@ IBHierarchyIntegrator::preprocessIntegrateHierarchy(const double current_time,
                                                     const double new_time,
                                                     const int num_cycles)
 {
+    d_step_start_time = getLocalComputeTime();
+    d_eulerian_phase_time = 0.0;
+    d_eulerian_solve_timed = false;
+
     // preprocess our dependencies...
     HierarchyIntegrator::preprocessIntegrateHierarchy(current_time, new_time, num_cycles);
 
@@ -187,7 +197,9 @@ IBHierarchyIntegrator::preprocessIntegrateHierarchy(const double current_time,
                                         "use the same number of cycles,\n"
                                      << "  or that the IB solver use only a single cycle.\n");
         }
+        const double ins_preprocess_start = getLocalComputeTime();
         d_ins_hier_integrator->preprocessIntegrateHierarchy(current_time, new_time, ins_num_cycles);
+        d_eulerian_phase_time += getLocalComputeTime() - ins_preprocess_start;
     }
 
     // Allocate Eulerian scratch and new data.
@@ -240,8 +252,10 @@ IBHierarchyIntegrator::postprocessIntegrateHierarchy(const double current_time,
     // postprocess the objects this class manages...
     d_ib_method_ops->postprocessIntegrateData(current_time, new_time, num_cycles);
 
+    const double ins_postprocess_start = getLocalComputeTime();
     d_ins_hier_integrator->postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, d_ins_hier_integrator->getNumberOfCycles());
+    d_eulerian_phase_time += getLocalComputeTime() - ins_postprocess_start;
 
     const int coarsest_ln = 0;
     const int finest_ln = d_hierarchy->getFinestLevelNumber();
@@ -310,6 +324,19 @@ IBHierarchyIntegrator::postprocessIntegrateHierarchy(const double current_time,
         }
     }
 
+    // Record the timings of this time step. Everything that is not part of the
+    // fluid solver is attributed to the Lagrangian phases. Time spent in
+    // collective operations is excluded since it measures the slowest process
+    // rather than the local workload.
+    if (d_calibrate_workload_estimates && d_eulerian_solve_timed)
+    {
+        const double step_time = getLocalComputeTime() - d_step_start_time;
+        d_workload_model.addSample(d_eulerian_phase_time,
+                                   d_local_num_cells,
+                                   std::max(step_time - d_eulerian_phase_time, 0.0),
+                                   d_local_lagrangian_workload);
+    }
+
     // ... and postprocess our dependencies.
     HierarchyIntegrator::postprocessIntegrateHierarchy(
         current_time, new_time, skip_synchronize_new_state_data, num_cycles);
@@ -366,6 +393,19 @@ IBHierarchyIntegrator::initializeHierarchyIntegrator(Pointer<PatchHierarchy<NDIM
         registerVariable(d_mark_current_idx, d_mark_new_idx, d_mark_scratch_idx, d_mark_var, ghosts);
     }
 
+    if (d_rebin_lagrangian_data)
+    {
+        d_rebin_tag_var = new CellVariable<NDIM, int>(d_object_name + "::rebin_tags");
+        d_rebin_tag_idx = var_db->registerVariableAndContext(d_rebin_tag_var, d_ib_context, IntVector<NDIM>(0));
+    }
+
+    if (d_calibrate_workload_estimates)
+    {
+        d_lagrangian_workload_var = new CellVariable<NDIM, double>(d_object_name + "::lagrangian_workload");
+        d_lagrangian_workload_idx =
+            var_db->registerVariableAndContext(d_lagrangian_workload_var, d_ib_context, IntVector<NDIM>(0));
+    }
+
     // Initialize the fluid solver.
     if (d_ib_method_ops->hasFluidSources())
     {
@@ -542,16 +582,44 @@ IBHierarchyIntegrator::initializePatchHierarchy(Pointer<PatchHierarchy<NDIM> > h
         level->deallocatePatchData(d_scratch_data);
     }
 
+    // Count the local workload used to calibrate the workload estimates until
+    // the first regrid.
+    if (d_calibrate_workload_estimates) updateLocalWorkloadCounts();
+
     // Indicate that the hierarchy is initialized.
     d_hierarchy_is_initialized = true;
     return;
 } // initializePatchHierarchy
 
+void
+IBHierarchyIntegrator::regridHierarchy()
+{
+    if (canRebinLagrangianData())
+    {
+        rebinLagrangianData();
+    }
+    else
+    {
+        HierarchyIntegrator::regridHierarchy();
+    }
+    return;
+} // regridHierarchy
+
 /////////////////////////////// PROTECTED ////////////////////////////////////
 
 void
 IBHierarchyIntegrator::regridHierarchyBeginSpecialized()
 {
+    // Fit the weight of the Lagrangian workload to the timings measured since
+    // the last regrids.
+    if (d_calibrate_workload_estimates && d_workload_model.computeCosts())
+    {
+        d_lagrangian_workload_weight = d_workload_model.getRelativeParticleWeight();
+        if (d_enable_logging)
+            plog << d_object_name << "::regridHierarchy(): calibrated Lagrangian workload weight = "
+                 << d_lagrangian_workload_weight << "\n";
+    }
+
     // This must be done here since (if a load balancer is used) it effects
     // the distribution of patches.
     updateWorkloadEstimates();
@@ -588,6 +656,8 @@ IBHierarchyIntegrator::regridHierarchyEndSpecialized()
         updateWorkloadEstimates();
     }
 
+    if (d_calibrate_workload_estimates) updateLocalWorkloadCounts();
+
     // Reset the regrid CFL estimates.
     d_regrid_fluid_cfl_estimate = 0.0;
     d_regrid_structure_cfl_estimate = 0.0;
@@ -653,6 +723,155 @@ IBHierarchyIntegrator::atRegridPointSpecialized() const
     return false;
 } // atRegridPointSpecialized
 
+bool
+IBHierarchyIntegrator::canRebinLagrangianData()
+{
+    if (!d_rebin_lagrangian_data || !d_hierarchy_is_initialized) return false;
+    if (IBTK::rel_equal_eps(d_integrator_time, d_start_time)) return false;
+
+    // Only rebin when the structure CFL criterion is the sole reason to regrid.
+    const bool regrid_fluid =
+        d_regrid_fluid_cfl_interval == -1.0 ? false : d_regrid_fluid_cfl_estimate >= d_regrid_fluid_cfl_interval;
+    const bool regrid_structure = d_regrid_structure_cfl_interval == -1.0 ?
+                                      false :
+                                      d_regrid_structure_cfl_estimate >= d_regrid_structure_cfl_interval;
+    if (regrid_fluid || !regrid_structure) return false;
+    for (const auto& child_integrator : d_child_integrators)
+    {
+        if (child_integrator->atRegridPoint()) return false;
+    }
+
+    // Tag cells on the current patch hierarchy and check that each tagged
+    // cell, grown by the tag buffer, is already covered by the next finer
+    // level. Tagged cells on the finest level would create a new level.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const bool is_periodic = grid_geom->getPeriodicShift().max() > 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    const int max_finest_ln = d_gridding_alg->getMaxLevels() - 1;
+    for (int ln = 0; ln <= std::min(finest_ln, max_finest_ln - 1); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        level->allocatePatchData(d_rebin_tag_idx, d_integrator_time);
+        applyGradientDetector(d_hierarchy,
+                              ln,
+                              d_integrator_time,
+                              d_rebin_tag_idx,
+                              /*initial_time*/ false,
+                              /*uses_richardson_extrapolation_too*/ false);
+
+        BoxList<NDIM> refined_region_boxes;
+        if (ln < finest_ln)
+        {
+            Pointer<PatchLevel<NDIM> > finer_level = d_hierarchy->getPatchLevel(ln + 1);
+            refined_region_boxes = BoxList<NDIM>(finer_level->getBoxes());
+            refined_region_boxes.coarsen(finer_level->getRatioToCoarserLevel());
+        }
+        const BoxList<NDIM> domain_boxes(level->getPhysicalDomain());
+        const int tag_buffer = d_tag_buffer[ln];
+        int hierarchy_changes = 0;
+        for (PatchLevel<NDIM>::Iterator p(level); p && !hierarchy_changes; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, int> > tag_data = patch->getPatchData(d_rebin_tag_idx);
+            for (Box<NDIM>::Iterator b(patch->getBox()); b && !hierarchy_changes; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                if ((*tag_data)(i) == 0) continue;
+                const Box<NDIM> buffered_box = Box<NDIM>::grow(Box<NDIM>(i, i), IntVector<NDIM>(tag_buffer));
+                BoxList<NDIM> uncovered_boxes(buffered_box);
+                uncovered_boxes.intersectBoxes(domain_boxes);
+                uncovered_boxes.removeIntersections(refined_region_boxes);
+                // Buffers that wrap around periodic boundaries are not checked
+                // here, so we always regrid in that case.
+                BoxList<NDIM> exterior_boxes(buffered_box);
+                exterior_boxes.removeIntersections(domain_boxes);
+                hierarchy_changes = !uncovered_boxes.isEmpty() || (is_periodic && !exterior_boxes.isEmpty());
+            }
+        }
+        level->deallocatePatchData(d_rebin_tag_idx);
+        if (IBTK_MPI::maxReduction(hierarchy_changes)) return false;
+    }
+    return true;
+} // canRebinLagrangianData
+
+void
+IBHierarchyIntegrator::rebinLagrangianData()
+{
+    if (d_enable_logging)
+        plog << d_object_name << "::regridHierarchy(): rebinning Lagrangian data on the current patch hierarchy\n";
+
+    // Move the marker particles to the cells that contain them by collecting
+    // them on level 0 and refining them back onto the finer levels.
+    if (d_mark_var)
+    {
+        const int finest_ln = d_hierarchy->getFinestLevelNumber();
+        LMarkerUtilities::collectMarkersOnPatchHierarchy(d_mark_current_idx, d_hierarchy);
+        LMarkerUtilities::initializeMarkersOnLevel(
+            d_mark_current_idx, d_mark_init_posns, d_hierarchy, finest_ln, /*initial_time*/ false, nullptr);
+        LMarkerUtilities::pruneInvalidMarkers(d_mark_current_idx, d_hierarchy);
+    }
+
+    // Redistribute the Lagrangian data without changing the patch hierarchy.
+    d_ib_method_ops->beginDataRedistribution(d_hierarchy, d_gridding_alg);
+    d_ib_method_ops->endDataRedistribution(d_hierarchy, d_gridding_alg);
+    if (d_calibrate_workload_estimates) updateLocalWorkloadCounts();
+
+    // Only the structure has been accounted for: keep accumulating the fluid
+    // CFL estimate.
+    d_regrid_structure_cfl_estimate = 0.0;
+    return;
+} // rebinLagrangianData
+
+double
+IBHierarchyIntegrator::getLocalComputeTime()
+{
+    const double wall_time =
+        std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    return wall_time - IBTK_MPI::getCollectiveTime();
+} // getLocalComputeTime
+
+void
+IBHierarchyIntegrator::recordEulerianPhase(const double start)
+{
+    d_eulerian_phase_time += getLocalComputeTime() - start;
+    d_eulerian_solve_timed = true;
+    return;
+} // recordEulerianPhase
+
+void
+IBHierarchyIntegrator::updateLocalWorkloadCounts()
+{
+    const int coarsest_ln = 0;
+    const int finest_ln = d_hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        d_hierarchy->getPatchLevel(ln)->allocatePatchData(d_lagrangian_workload_idx);
+    }
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(d_hierarchy, coarsest_ln, finest_ln);
+    hier_cc_data_ops.setToScalar(d_lagrangian_workload_idx, 0.0);
+    d_ib_method_ops->addWorkloadEstimate(d_hierarchy, d_lagrangian_workload_idx);
+
+    d_local_num_cells = 0.0;
+    d_local_lagrangian_workload = 0.0;
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = d_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CellData<NDIM, double> > workload_data = patch->getPatchData(d_lagrangian_workload_idx);
+            d_local_num_cells += patch_box.size();
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                d_local_lagrangian_workload += (*workload_data)(b());
+            }
+        }
+        level->deallocatePatchData(d_lagrangian_workload_idx);
+    }
+    return;
+} // updateLocalWorkloadCounts
+
 void
 IBHierarchyIntegrator::initializeLevelDataSpecialized(const Pointer<BasePatchHierarchy<NDIM> > base_hierarchy,
                                                       const int level_number,
@@ -738,13 +957,35 @@ IBHierarchyIntegrator::putToDatabaseSpecialized(Pointer<Database> db)
     db->putString("d_time_stepping_type", enum_to_string<TimeSteppingType>(d_time_stepping_type));
     db->putDouble("d_regrid_fluid_cfl_estimate", d_regrid_fluid_cfl_estimate);
     db->putDouble("d_regrid_structure_cfl_estimate", d_regrid_structure_cfl_estimate);
+    db->putDouble("d_lagrangian_workload_weight", d_lagrangian_workload_weight);
     return;
 } // putToDatabaseSpecialized
 
 void
 IBHierarchyIntegrator::addWorkloadEstimate(Pointer<PatchHierarchy<NDIM> > hierarchy, const int workload_data_idx)
 {
-    d_ib_method_ops->addWorkloadEstimate(hierarchy, workload_data_idx);
+    if (!d_calibrate_workload_estimates)
+    {
+        d_ib_method_ops->addWorkloadEstimate(hierarchy, workload_data_idx);
+        return;
+    }
+
+    // Scale the Lagrangian workload estimate by the calibrated weight.
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        hierarchy->getPatchLevel(ln)->allocatePatchData(d_lagrangian_workload_idx);
+    }
+    HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
+    hier_cc_data_ops.setToScalar(d_lagrangian_workload_idx, 0.0);
+    d_ib_method_ops->addWorkloadEstimate(hierarchy, d_lagrangian_workload_idx);
+    hier_cc_data_ops.axpy(
+        workload_data_idx, d_lagrangian_workload_weight, d_lagrangian_workload_idx, workload_data_idx);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        hierarchy->getPatchLevel(ln)->deallocatePatchData(d_lagrangian_workload_idx);
+    }
     return;
 } // addWorkloadEstimate
 
@@ -775,6 +1016,20 @@ IBHierarchyIntegrator::getFromInput(Pointer<Database> db, bool /*is_from_restart
     else if (db->keyExists("timestepping_type"))
         d_time_stepping_type = string_to_enum<TimeSteppingType>(db->getString("timestepping_type"));
     if (db->keyExists("marker_file_name")) d_mark_file_name = db->getString("marker_file_name");
+    if (db->keyExists("rebin_lagrangian_data")) d_rebin_lagrangian_data = db->getBool("rebin_lagrangian_data");
+    if (db->keyExists("calibrate_workload_estimates"))
+        d_calibrate_workload_estimates = db->getBool("calibrate_workload_estimates");
+    if (db->keyExists("workload_calibration_window"))
+    {
+        const int window_size = db->getInteger("workload_calibration_window");
+        if (window_size < 1)
+        {
+            TBOX_ERROR(d_object_name << "::getFromInput():\n"
+                                     << "  workload_calibration_window must be positive, not " << window_size
+                                     << ".\n");
+        }
+        d_workload_model = AdaptiveWorkloadModel(window_size);
+    }
     return;
 } // getFromInput
 
@@ -800,6 +1055,7 @@ IBHierarchyIntegrator::getFromRestart()
     d_time_stepping_type = string_to_enum<TimeSteppingType>(db->getString("d_time_stepping_type"));
     d_regrid_fluid_cfl_estimate = db->getDouble("d_regrid_fluid_cfl_estimate");
     d_regrid_structure_cfl_estimate = db->getDouble("d_regrid_structure_cfl_estimate");
+    d_lagrangian_workload_weight = db->getDouble("d_lagrangian_workload_weight");
     return;
 } // getFromRestart
 
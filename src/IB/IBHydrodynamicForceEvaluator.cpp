@@ -62,6 +62,7 @@
 #include <array>
 #include <cmath>
 #include <fstream>
+#include <vector>
 
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
@@ -324,6 +325,8 @@ IBHydrodynamicForceEvaluator::computeLaggedMomentumIntegral(
     // Whether or not the simulation has adaptive mesh refinement
     const bool amr_case = (coarsest_ln != finest_ln);
 
+    // Sum the momentum integrals of all objects with a single reduction.
+    IBTK_MPI::SumReductionBatch momentum_sums;
     for (auto& hydro_obj : d_hydro_objs)
     {
         IBHydrodynamicForceObject& fobj = hydro_obj.second;
@@ -447,9 +450,10 @@ IBHydrodynamicForceEvaluator::computeLaggedMomentumIntegral(
             }
         }
 
-        IBTK_MPI::sumReduction(fobj.P_box_current.data(), 3);
-        IBTK_MPI::sumReduction(fobj.L_box_current.data(), 3);
+        momentum_sums.add(fobj.P_box_current.data(), 3);
+        momentum_sums.add(fobj.L_box_current.data(), 3);
     }
+    momentum_sums.wait();
 
     return;
 
@@ -493,6 +497,9 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
     // Whether or not the simulation has adaptive mesh refinement
     const bool amr_case = (coarsest_ln != finest_ln);
 
+    // The momentum integrals of all objects are summed over all processes
+    // while the surface integrals are computed.
+    IBTK_MPI::SumReductionBatch momentum_sums;
     for (auto& hydro_obj : d_hydro_objs)
     {
         IBHydrodynamicForceObject& fobj = hydro_obj.second;
@@ -614,13 +621,25 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
             }
         }
 
-        IBTK_MPI::sumReduction(fobj.P_box_new.data(), 3);
-        IBTK_MPI::sumReduction(fobj.L_box_new.data(), 3);
+        momentum_sums.add(fobj.P_box_new.data(), 3);
+        momentum_sums.add(fobj.L_box_new.data(), 3);
+    }
+    momentum_sums.start();
+
+    // Compute surface integral terms.
+    std::vector<IBTK::Vector3d> tracs(d_hydro_objs.size(), IBTK::Vector3d::Zero());
+    std::vector<IBTK::Vector3d> torque_tracs(d_hydro_objs.size(), IBTK::Vector3d::Zero());
+    IBTK_MPI::SumReductionBatch traction_sums;
+    std::size_t obj_no = 0;
+    for (auto& hydro_obj : d_hydro_objs)
+    {
+        IBHydrodynamicForceObject& fobj = hydro_obj.second;
+        IBTK::Vector3d& trac = tracs[obj_no];
+        IBTK::Vector3d& torque_trac = torque_tracs[obj_no];
+        ++obj_no;
 
-        // Compute surface integral term.
-        IBTK::Vector3d trac, torque_trac;
-        trac.setZero();
-        torque_trac.setZero();
+        // Coordinate of the side index and r vector needed for cross product
+        IBTK::Vector3d side_coord, r_vec;
 
         for (int ln = finest_ln; ln >= coarsest_ln; --ln)
         {
@@ -772,8 +791,19 @@ IBHydrodynamicForceEvaluator::computeHydrodynamicForce(int u_idx,
                 }
             }
         }
-        IBTK_MPI::sumReduction(trac.data(), 3);
-        IBTK_MPI::sumReduction(torque_trac.data(), 3);
+        traction_sums.add(trac.data(), 3);
+        traction_sums.add(torque_trac.data(), 3);
+    }
+    traction_sums.wait();
+    momentum_sums.wait();
+
+    obj_no = 0;
+    for (auto& hydro_obj : d_hydro_objs)
+    {
+        IBHydrodynamicForceObject& fobj = hydro_obj.second;
+        const IBTK::Vector3d& trac = tracs[obj_no];
+        const IBTK::Vector3d& torque_trac = torque_tracs[obj_no];
+        ++obj_no;
 
         // Compute hydrodynamic force on the body : -integral_{box_new} (rho du/dt) + d/dt(rho u)_body + trac
         fobj.F_new = -(fobj.P_box_new - fobj.P_box_current) / dt + (fobj.P_new - fobj.P_current) / dt + trac;
@@ -24,11 +24,12 @@
 #include "ibtk/LDataManager.h"
 #include "ibtk/LMesh.h"
 #include "ibtk/LNode.h"
+#include "ibtk/LSiloDataWriter.h"
 #include "ibtk/ibtk_utilities.h"
 
 #include "BasePatchLevel.h"
 #include "Box.h"
-#include "BoxArray.h"
+#include "BoxTree.h"
 #include "CartesianGridGeometry.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
@@ -66,6 +67,7 @@ IBTK_ENABLE_EXTRA_WARNINGS
 #include <cmath>
 #include <fstream>
 #include <limits>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -821,8 +823,8 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         init_meter_elements(d_X_web[m], d_dA_web[m], d_X_perimeter[m], d_X_centroid[m]);
     }
 
-    // Setup the mappings from cell indices to the web patch and web centroid
-    // data.
+    // Setup the lists of web patch and web centroid data located in each local
+    // patch.
     //
     // NOTE: Each meter web patch/centroid is assigned to precisely one
     // Cartesian grid cell in precisely one level.  In particular, each web
@@ -830,14 +832,24 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
     // the region of physical space in which the centroid of the web patch is
     // located.  Similarly, each web centroid is assigned to which ever grid
     // cell is the finest cell that contains the region of physical space in
-    // which the web centroid is located.
-    d_web_patch_map.clear();
-    d_web_patch_map.resize(finest_ln + 1);
-    d_web_centroid_map.clear();
-    d_web_centroid_map.resize(finest_ln + 1);
+    // which the web centroid is located.  Because the patches of a level do
+    // not overlap, that cell is owned by at most one local patch, which is
+    // found with the box tree of the level.
+    d_web_patches.clear();
+    d_web_patches.resize(finest_ln + 1);
+    d_web_centroids.clear();
+    d_web_centroids.resize(finest_ln + 1);
     for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
     {
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        d_web_patches[ln].resize(level->getNumberOfPatches());
+        d_web_centroids[ln].resize(level->getNumberOfPatches());
+        Pointer<BoxTree<NDIM> > box_tree = level->getBoxTree();
+        const auto find_local_patch = [&box_tree](const hier::Index<NDIM>& i) {
+            tbox::Array<int> local_patch_nums;
+            box_tree->findLocalOverlapIndices(local_patch_nums, Box<NDIM>(i, i));
+            return local_patch_nums.size() > 0 ? local_patch_nums[0] : -1;
+        };
         const IntVector<NDIM>& ratio = level->getRatio();
         const Box<NDIM> domain_box_level = Box<NDIM>::refine(domain_box, ratio);
         const hier::Index<NDIM>& domain_box_level_lower = domain_box_level.lower();
@@ -859,6 +871,14 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
         {
             finer_dx[d] = dx_coarsest[d] / static_cast<double>(finer_ratio(d));
         }
+        Pointer<BoxTree<NDIM> > finer_box_tree =
+            (ln < finest_ln ? finer_level->getBoxTree() : Pointer<BoxTree<NDIM> >(nullptr));
+        const auto covered_by_finer_level = [&](const hier::Index<NDIM>& finer_i) {
+            if (ln == finest_ln) return false;
+            tbox::Array<int> patch_nums;
+            finer_box_tree->findOverlapIndices(patch_nums, Box<NDIM>(finer_i, finer_i));
+            return patch_nums.size() > 0;
+        };
 
         for (unsigned int l = 0; l < d_num_meters; ++l)
         {
@@ -876,15 +896,14 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
                                                                                    finer_dx.data(),
                                                                                    finer_domain_box_level_lower,
                                                                                    finer_domain_box_level_upper);
-                    if (level->getBoxes().contains(i) &&
-                        (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
-                    {
-                        WebPatch p;
-                        p.meter_num = l;
-                        p.X = &d_X_web[l][m][n];
-                        p.dA = &d_dA_web[l][m][n];
-                        d_web_patch_map[ln].insert(std::make_pair(i, p));
-                    }
+                    const int patch_num = find_local_patch(i);
+                    if (patch_num < 0 || covered_by_finer_level(finer_i)) continue;
+                    WebPatch p;
+                    p.i = i;
+                    p.meter_num = l;
+                    p.X = &d_X_web[l][m][n];
+                    p.dA = &d_dA_web[l][m][n];
+                    d_web_patches[ln][patch_num].push_back(p);
                 }
             }
 
@@ -898,13 +917,13 @@ IBInstrumentPanel::initializeHierarchyDependentData(const Pointer<PatchHierarchy
                                                                            finer_dx.data(),
                                                                            finer_domain_box_level_lower,
                                                                            finer_domain_box_level_upper);
-            if (level->getBoxes().contains(i) && (ln == finest_ln || !finer_level->getBoxes().contains(finer_i)))
-            {
-                WebCentroid c;
-                c.meter_num = l;
-                c.X = &d_X_centroid[l];
-                d_web_centroid_map[ln].insert(std::make_pair(i, c));
-            }
+            const int patch_num = find_local_patch(i);
+            if (patch_num < 0 || covered_by_finer_level(finer_i)) continue;
+            WebCentroid c;
+            c.i = i;
+            c.meter_num = l;
+            c.X = &d_X_centroid[l];
+            d_web_centroids[ln][patch_num].push_back(c);
         }
     }
 
@@ -957,6 +976,10 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
         Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
         for (PatchLevel<NDIM>::Iterator p(level); p; p++)
         {
+            const std::vector<WebPatch>& web_patches = d_web_patches[ln][p()];
+            const std::vector<WebCentroid>& web_centroids = d_web_centroids[ln][p()];
+            if (web_patches.empty() && web_centroids.empty()) continue;
+
             Pointer<Patch<NDIM> > patch = level->getPatch(p());
             const Box<NDIM>& patch_box = patch->getBox();
             const hier::Index<NDIM>& patch_lower = patch_box.lower();
@@ -971,81 +994,54 @@ IBInstrumentPanel::readInstrumentData(const int U_data_idx,
             Pointer<SideData<NDIM, double> > U_sc_data = patch->getPatchData(U_data_idx);
             Pointer<CellData<NDIM, double> > P_cc_data = patch->getPatchData(P_data_idx);
 
-            for (Box<NDIM>::Iterator b(patch_box); b; b++)
-            {
-                const hier::Index<NDIM>& i = b();
-                std::pair<WebPatchMap::const_iterator, WebPatchMap::const_iterator> patch_range =
-                    d_web_patch_map[ln].equal_range(i);
-                if (patch_range.first != patch_range.second)
-                {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
+            const auto cell_center = [&](const hier::Index<NDIM>& i) {
+                return Point(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
+                             x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
 #if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
+                                 ,
+                             x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
 #endif
-                    );
-                    if (U_cc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U = linear_interp<NDIM>(
-                                X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (U_sc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            const Vector U =
-                                linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_flow_values[meter_num] += U.dot(dA);
-                        }
-                    }
-                    if (P_cc_data)
-                    {
-                        for (auto it = patch_range.first; it != patch_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const Vector& dA = *(it->second.dA);
-                            double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_mean_pres_values[meter_num] += P * dA.norm();
-                            A[meter_num] += dA.norm();
-                        }
-                    }
+                );
+            };
+
+            for (const WebPatch& web_patch : web_patches)
+            {
+                const hier::Index<NDIM>& i = web_patch.i;
+                const int meter_num = web_patch.meter_num;
+                const Point& X = *web_patch.X;
+                const Vector& dA = *web_patch.dA;
+                const Point X_cell = cell_center(i);
+                if (U_cc_data)
+                {
+                    const Vector U =
+                        linear_interp<NDIM>(X, i, X_cell, *U_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_flow_values[meter_num] += U.dot(dA);
                 }
+                if (U_sc_data)
+                {
+                    const Vector U =
+                        linear_interp(X, i, X_cell, *U_sc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_flow_values[meter_num] += U.dot(dA);
+                }
+                if (P_cc_data)
+                {
+                    const double P =
+                        linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_mean_pres_values[meter_num] += P * dA.norm();
+                    A[meter_num] += dA.norm();
+                }
+            }
 
-                std::pair<WebCentroidMap::const_iterator, WebCentroidMap::const_iterator> centroid_range =
-                    d_web_centroid_map[ln].equal_range(i);
-                if (centroid_range.first != centroid_range.second)
+            if (P_cc_data)
+            {
+                for (const WebCentroid& web_centroid : web_centroids)
                 {
-                    const Point X_cell(x_lower[0] + dx[0] * (static_cast<double>(i(0) - patch_lower(0)) + 0.5),
-                                       x_lower[1] + dx[1] * (static_cast<double>(i(1) - patch_lower(1)) + 0.5)
-#if (NDIM == 3)
-                                           ,
-                                       x_lower[2] + dx[2] * (static_cast<double>(i(2) - patch_lower(2)) + 0.5)
-#endif
-                    );
-                    if (P_cc_data)
-                    {
-                        for (auto it = centroid_range.first; it != centroid_range.second; ++it)
-                        {
-                            const int& meter_num = it->second.meter_num;
-                            const Point& X = *(it->second.X);
-                            const double P =
-                                linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
-                            d_point_pres_values[meter_num] = P;
-                        }
-                    }
+                    const hier::Index<NDIM>& i = web_centroid.i;
+                    const Point& X = *web_centroid.X;
+                    const Point X_cell = cell_center(i);
+                    const double P =
+                        linear_interp(X, i, X_cell, *P_cc_data, patch_lower, patch_upper, x_lower, x_upper, dx);
+                    d_point_pres_values[web_centroid.meter_num] = P;
                 }
             }
         }
@@ -1215,6 +1211,10 @@ IBInstrumentPanel::writePlotData(const int timestep_num, const double simulation
 
     Utilities::recursiveMkdir(dump_dirname);
 
+    // Silo may also be in use by an LSiloDataWriter that writes its data
+    // asynchronously.
+    std::lock_guard<std::mutex> silo_lock(LSiloDataWriter::getSiloMutex());
+
     // Create one local DBfile per MPI process.
     sprintf(temp_buf, "%04d", mpi_rank);
     current_file_name = dump_dirname + "/" + SILO_PROCESSOR_FILE_PREFIX;
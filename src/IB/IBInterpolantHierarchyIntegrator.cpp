@@ -149,7 +149,9 @@ IBInterpolantHierarchyIntegrator::integrateHierarchy(const double current_time,
     d_ib_interpolant_method_ops->spreadQ(new_time);
 
     // Solve the INS equations.
+    const double fluid_solve_start = getLocalComputeTime();
     d_ins_hier_integrator->integrateHierarchy(current_time, new_time, cycle_num);
+    recordEulerianPhase(fluid_solve_start);
 
     // Execute any registered callbacks.
     executeIntegrateHierarchyCallbackFcns(current_time, new_time, cycle_num);
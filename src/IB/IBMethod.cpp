@@ -168,6 +168,7 @@ IBMethod::IBMethod(std::string object_name, Pointer<Database> input_db, bool reg
                                                 d_ghosts,
                                                 d_registered_for_restart);
     d_ghosts = d_l_data_manager->getGhostCellWidth();
+    d_l_data_manager->setUseInteractionWeightCache(d_use_interaction_weight_cache);
 
     // Create the instrument panel object.
     d_instrument_panel =
@@ -317,6 +318,33 @@ IBMethod::getLagrangianStructureIsActivated(int structure_number, int level_numb
     return d_l_data_manager->getLagrangianStructureIsActivated(structure_number, level_number);
 } // activateLagrangianStructures
 
+double
+IBMethod::getMaxPointDisplacement() const
+{
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = d_hierarchy->getGridGeometry();
+    const double* const dx_coarsest = grid_geom->getDx();
+    double max_displacement = 0.0;
+    for (int ln = 0; ln < static_cast<int>(d_X_last_regrid.size()); ++ln)
+    {
+        if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
+        const IntVector<NDIM>& ratio = d_hierarchy->getPatchLevel(ln)->getRatio();
+        double dx_min = std::numeric_limits<double>::max();
+        for (unsigned int d = 0; d < NDIM; ++d) dx_min = std::min(dx_min, dx_coarsest[d] / ratio(d));
+
+        Pointer<LData> X_data = d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
+        const double* const X = X_data->getLocalFormVecArray()->data();
+        const std::vector<double>& X_last_regrid = d_X_last_regrid[ln];
+        double displacement = 0.0;
+        for (std::size_t k = 0; k < X_last_regrid.size(); ++k)
+        {
+            displacement = std::max(displacement, std::abs(X[k] - X_last_regrid[k]));
+        }
+        X_data->restoreArrays();
+        max_displacement = std::max(max_displacement, displacement / dx_min);
+    }
+    return IBTK_MPI::maxReduction(max_displacement);
+} // getMaxPointDisplacement
+
 void
 IBMethod::preprocessIntegrateData(double current_time, double new_time, int /*num_cycles*/)
 {
@@ -1508,15 +1536,18 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
         X_data[ln] = d_l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln);
     }
 
-    // Compute the set of local anchor points.
+    // Compute the set of local anchor points and store the positions from
+    // which the point displacement is measured.
     static const double eps = 2.0 * std::sqrt(std::numeric_limits<double>::epsilon());
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     const double* const grid_x_lower = grid_geom->getXLower();
     const double* const grid_x_upper = grid_geom->getXUpper();
     const IntVector<NDIM>& periodic_shift = grid_geom->getPeriodicShift();
+    d_X_last_regrid.resize(hierarchy->getFinestLevelNumber() + 1);
     for (int ln = 0; ln <= hierarchy->getFinestLevelNumber(); ++ln)
     {
         d_anchor_point_local_idxs[ln].clear();
+        d_X_last_regrid[ln].clear();
         if (!d_l_data_manager->levelContainsLagrangianData(ln)) continue;
 
         const Pointer<LMesh> mesh = d_l_data_manager->getLMesh(ln);
@@ -1543,6 +1574,7 @@ IBMethod::endDataRedistribution(Pointer<PatchHierarchy<NDIM> > hierarchy,
                 }
             }
         }
+        d_X_last_regrid[ln].assign(X_array.data(), X_array.data() + X_array.num_elements());
         X_data[ln]->restoreArrays();
     }
 
@@ -2026,6 +2058,8 @@ IBMethod::getFromInput(Pointer<Database> db, bool is_from_restart)
     if (db->keyExists("error_if_points_leave_domain"))
         d_error_if_points_leave_domain = db->getBool("error_if_points_leave_domain");
     if (db->keyExists("force_jac_mffd")) d_force_jac_mffd = db->getBool("force_jac_mffd");
+    if (db->keyExists("use_interaction_weight_cache"))
+        d_use_interaction_weight_cache = db->getBool("use_interaction_weight_cache");
     if (db->keyExists("do_log"))
         d_do_log = db->getBool("do_log");
     else if (db->keyExists("enable_logging"))
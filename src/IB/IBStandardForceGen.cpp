@@ -46,11 +46,13 @@ IBTK_DISABLE_EXTRA_WARNINGS
 IBTK_ENABLE_EXTRA_WARNINGS
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <set>
 #include <string>
 #include <utility>
@@ -118,7 +120,7 @@ resetLocalOrNonlocalPETScIndices(std::vector<int>& inds,
 IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
 {
     // Setup the default force generation functions.
-    registerSpringForceFunction(0, &default_spring_force, &default_spring_force_deriv);
+    registerSpringForceFunction(0, &default_spring_force, &default_spring_force_deriv, &default_spring_force_batch);
 
     // Set up force generator from input.
     if (input_db)
@@ -132,10 +134,12 @@ IBStandardForceGen::IBStandardForceGen(Pointer<Database> input_db)
 void
 IBStandardForceGen::registerSpringForceFunction(const int force_fcn_index,
                                                 const SpringForceFcnPtr spring_force_fcn_ptr,
-                                                const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr)
+                                                const SpringForceDerivFcnPtr spring_force_deriv_fcn_ptr,
+                                                const SpringForceBatchFcnPtr spring_force_batch_fcn_ptr)
 {
     d_spring_force_fcn_map[force_fcn_index] = spring_force_fcn_ptr;
     d_spring_force_deriv_fcn_map[force_fcn_index] = spring_force_deriv_fcn_ptr;
+    d_spring_force_batch_fcn_map[force_fcn_index] = spring_force_batch_fcn_ptr;
     return;
 } // registerSpringForceFunction
 
@@ -727,6 +731,7 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     std::vector<SpringForceFcnPtr>& force_fcns = d_spring_data[level_number].force_fcns;
     std::vector<SpringForceDerivFcnPtr>& force_deriv_fcns = d_spring_data[level_number].force_deriv_fcns;
     std::vector<const double*>& parameters = d_spring_data[level_number].parameters;
+    std::vector<SpringData::ForceFcnGroup>& force_fcn_groups = d_spring_data[level_number].force_fcn_groups;
 
     // The LMesh object provides the set of local Lagrangian nodes.
     const Pointer<LMesh> mesh = l_data_manager->getLMesh(level_number);
@@ -752,7 +757,42 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
     force_deriv_fcns.resize(total_num_springs);
     parameters.resize(total_num_springs);
 
-    // Setup the data structures used to compute spring forces.
+    // Setup the data structures used to compute spring forces. Springs are
+    // stored grouped by force function index (and otherwise in the order in
+    // which they are encountered) so that the forces of each group can be
+    // computed in batches.
+    std::vector<int> force_fcn_idxs;
+    force_fcn_idxs.reserve(total_num_springs);
+    for (const auto& node_idx : local_nodes)
+    {
+        const IBSpringForceSpec* const force_spec = node_idx->getNodeDataItem<IBSpringForceSpec>();
+        if (!force_spec) continue;
+        const std::vector<int>& fcn = force_spec->getForceFunctionIndices();
+        force_fcn_idxs.insert(force_fcn_idxs.end(), fcn.begin(), fcn.end());
+    }
+    std::vector<int> spring_order(total_num_springs);
+    std::iota(spring_order.begin(), spring_order.end(), 0);
+    std::stable_sort(spring_order.begin(), spring_order.end(), [&force_fcn_idxs](const int a, const int b) {
+        return force_fcn_idxs[a] < force_fcn_idxs[b];
+    });
+    std::vector<int> spring_posn(total_num_springs);
+    for (unsigned int k = 0; k < total_num_springs; ++k) spring_posn[spring_order[k]] = k;
+
+    force_fcn_groups.clear();
+    for (unsigned int k = 0; k < total_num_springs; ++k)
+    {
+        const int fcn_idx = force_fcn_idxs[spring_order[k]];
+        if (k == 0 || fcn_idx != force_fcn_idxs[spring_order[k - 1]])
+        {
+            SpringData::ForceFcnGroup group;
+            group.begin = k;
+            group.force_fcn = d_spring_force_fcn_map[fcn_idx];
+            group.force_batch_fcn = d_spring_force_batch_fcn_map[fcn_idx];
+            force_fcn_groups.push_back(group);
+        }
+        force_fcn_groups.back().end = k + 1;
+    }
+
     int current_spring = 0;
     for (const auto& node_idx : local_nodes)
     {
@@ -775,12 +815,13 @@ IBStandardForceGen::initializeSpringLevelData(std::set<int>& nonlocal_petsc_idx_
 #endif
         for (unsigned int k = 0; k < num_springs; ++k)
         {
-            lag_mastr_node_idxs[current_spring] = lag_idx;
-            lag_slave_node_idxs[current_spring] = slv[k];
-            petsc_mastr_node_idxs[current_spring] = petsc_idx;
-            force_fcns[current_spring] = d_spring_force_fcn_map[fcn[k]];
-            force_deriv_fcns[current_spring] = d_spring_force_deriv_fcn_map[fcn[k]];
-            parameters[current_spring] = params.empty() ? nullptr : &params[k][0];
+            const int posn = spring_posn[current_spring];
+            lag_mastr_node_idxs[posn] = lag_idx;
+            lag_slave_node_idxs[posn] = slv[k];
+            petsc_mastr_node_idxs[posn] = petsc_idx;
+            force_fcns[posn] = d_spring_force_fcn_map[fcn[k]];
+            force_deriv_fcns[posn] = d_spring_force_deriv_fcn_map[fcn[k]];
+            parameters[posn] = params.empty() ? nullptr : &params[k][0];
             ++current_spring;
         }
     }
@@ -817,111 +858,71 @@ IBStandardForceGen::computeLagrangianSpringForce(Pointer<LData> F_data,
                                                  const double /*data_time*/,
                                                  LDataManager* const /*l_data_manager*/)
 {
-    const int num_springs = static_cast<int>(d_spring_data[level_number].lag_mastr_node_idxs.size());
-    const bool uses_springs = (num_springs > 0);
-    const int* const lag_mastr_node_idxs = uses_springs ? &d_spring_data[level_number].lag_mastr_node_idxs[0] : nullptr;
-    const int* const lag_slave_node_idxs = uses_springs ? &d_spring_data[level_number].lag_slave_node_idxs[0] : nullptr;
-    const int* const petsc_mastr_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_mastr_node_idxs[0] : nullptr;
-    const int* const petsc_slave_node_idxs =
-        uses_springs ? &d_spring_data[level_number].petsc_slave_node_idxs[0] : nullptr;
-    const SpringForceFcnPtr* const force_fcns = uses_springs ? &d_spring_data[level_number].force_fcns[0] : nullptr;
-    const double** const parameters = uses_springs ? &d_spring_data[level_number].parameters[0] : nullptr;
+    const SpringData& spring_data = d_spring_data[level_number];
     double* const F_node = F_data->getLocalFormVecArray()->data();
     const double* const X_node = X_data->getGhostedLocalFormVecArray()->data();
 
-    static const int BLOCKSIZE = 16; // this parameter needs to be tuned
-    int k, kblock, kunroll, mastr_idx, slave_idx;
-    double F[NDIM], D[NDIM], R, T_over_R;
-    kblock = 0;
-    for (; kblock < (num_springs - 1) / BLOCKSIZE;
-         ++kblock) // ensure that the last block is NOT handled by this first loop
+    // Springs that share a force function are processed in batches: first the
+    // displacements of all springs in the batch are computed, then their
+    // tensions are evaluated (with a single call if a batched force function
+    // is available), and finally the resulting forces are accumulated.
+    static const int BATCH_SIZE = 64;
+    std::array<std::array<double, BATCH_SIZE>, NDIM> D;
+    std::array<double, BATCH_SIZE> R, T;
+    for (const auto& group : spring_data.force_fcn_groups)
     {
-        PREFETCH_READ_NTA_BLOCK(lag_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(lag_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_mastr_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(petsc_slave_node_idxs + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(force_fcns + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        PREFETCH_READ_NTA_BLOCK(parameters + BLOCKSIZE * (kblock + 1), BLOCKSIZE);
-        for (kunroll = 0; kunroll < BLOCKSIZE; ++kunroll)
+        for (int batch_begin = group.begin; batch_begin < group.end; batch_begin += BATCH_SIZE)
         {
-            k = kblock * BLOCKSIZE + kunroll;
-            mastr_idx = petsc_mastr_node_idxs[k];
-            slave_idx = petsc_slave_node_idxs[k];
+            const int batch_size = std::min(BATCH_SIZE, group.end - batch_begin);
+            const int* const lag_mastr_idxs = &spring_data.lag_mastr_node_idxs[batch_begin];
+            const int* const lag_slave_idxs = &spring_data.lag_slave_node_idxs[batch_begin];
+            const int* const mastr_idxs = &spring_data.petsc_mastr_node_idxs[batch_begin];
+            const int* const slave_idxs = &spring_data.petsc_slave_node_idxs[batch_begin];
+            const double* const* const params = &spring_data.parameters[batch_begin];
+            for (int k = 0; k < batch_size; ++k)
+            {
 #if !defined(NDEBUG)
-            TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(F_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_mastr_node_idxs[k + 1]);
-            PREFETCH_READ_NTA_NDIM_BLOCK(X_node + petsc_slave_node_idxs[k + 1]);
-            PREFETCH_READ_NTA(parameters[k + 1]);
-            D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-            D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-            D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
+                TBOX_ASSERT(mastr_idxs[k] != slave_idxs[k]);
 #endif
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    D[d][k] = X_node[slave_idxs[k] + d] - X_node[mastr_idxs[k] + d];
+                }
+            }
+            for (int k = 0; k < batch_size; ++k)
+            {
 #if (NDIM == 2)
-            R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-            R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
+                R[k] = std::sqrt(D[0][k] * D[0][k] + D[1][k] * D[1][k]);
 #endif
-            if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-            T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-            F[0] = T_over_R * D[0];
-            F[1] = T_over_R * D[1];
 #if (NDIM == 3)
-            F[2] = T_over_R * D[2];
-#endif
-            F_node[mastr_idx + 0] += F[0];
-            F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-            F_node[mastr_idx + 2] += F[2];
-#endif
-            F_node[slave_idx + 0] -= F[0];
-            F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-            F_node[slave_idx + 2] -= F[2];
+                R[k] = std::sqrt(D[0][k] * D[0][k] + D[1][k] * D[1][k] + D[2][k] * D[2][k]);
 #endif
+            }
+            if (group.force_batch_fcn)
+            {
+                group.force_batch_fcn(batch_size, R.data(), params, lag_mastr_idxs, lag_slave_idxs, T.data());
+            }
+            else
+            {
+                for (int k = 0; k < batch_size; ++k)
+                {
+                    if (UNLIKELY(R[k] < std::numeric_limits<double>::epsilon())) continue;
+                    T[k] = (group.force_fcn)(R[k], params[k], lag_mastr_idxs[k], lag_slave_idxs[k]);
+                }
+            }
+            for (int k = 0; k < batch_size; ++k)
+            {
+                if (UNLIKELY(R[k] < std::numeric_limits<double>::epsilon())) continue;
+                const double T_over_R = T[k] / R[k];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    const double F = T_over_R * D[d][k];
+                    F_node[mastr_idxs[k] + d] += F;
+                    F_node[slave_idxs[k] + d] -= F;
+                }
+            }
         }
     }
-    for (k = kblock * BLOCKSIZE; k < num_springs; ++k)
-    {
-        mastr_idx = petsc_mastr_node_idxs[k];
-        slave_idx = petsc_slave_node_idxs[k];
-#if !defined(NDEBUG)
-        TBOX_ASSERT(mastr_idx != slave_idx);
-#endif
-        D[0] = X_node[slave_idx + 0] - X_node[mastr_idx + 0];
-        D[1] = X_node[slave_idx + 1] - X_node[mastr_idx + 1];
-#if (NDIM == 3)
-        D[2] = X_node[slave_idx + 2] - X_node[mastr_idx + 2];
-#endif
-#if (NDIM == 2)
-        R = std::sqrt(D[0] * D[0] + D[1] * D[1]);
-#endif
-#if (NDIM == 3)
-        R = std::sqrt(D[0] * D[0] + D[1] * D[1] + D[2] * D[2]);
-#endif
-        if (UNLIKELY(R < std::numeric_limits<double>::epsilon())) continue;
-        T_over_R = (force_fcns[k])(R, parameters[k], lag_mastr_node_idxs[k], lag_slave_node_idxs[k]) / R;
-        F[0] = T_over_R * D[0];
-        F[1] = T_over_R * D[1];
-#if (NDIM == 3)
-        F[2] = T_over_R * D[2];
-#endif
-        F_node[mastr_idx + 0] += F[0];
-        F_node[mastr_idx + 1] += F[1];
-#if (NDIM == 3)
-        F_node[mastr_idx + 2] += F[2];
-#endif
-        F_node[slave_idx + 0] -= F[0];
-        F_node[slave_idx + 1] -= F[1];
-#if (NDIM == 3)
-        F_node[slave_idx + 2] -= F[2];
-#endif
-    }
 
     F_data->restoreArrays();
     X_data->restoreArrays();
@@ -22,6 +22,7 @@
 #include "ibamr/IBSpringForceSpec.h"
 #include "ibamr/IBStandardInitializer.h"
 #include "ibamr/IBStandardSourceGen.h"
+#include "ibamr/IBStructureBinaryFile.h"
 #include "ibamr/IBTargetPointForceSpec.h"
 
 #include "ibtk/IBTK_MPI.h"
@@ -85,6 +86,53 @@ discard_comments(const std::string& input_string)
     string_stream.clear();
     return output_string;
 } // discard_comments
+
+// Read the records of a section of a binary structure file.  Each MPI process
+// reads only its own contiguous range of records from the file, and the records
+// are then exchanged among all processes.
+//
+// The exchange uses an MPI datatype spanning one record so that the counts and
+// displacements are given in records rather than in bytes, which would
+// overflow an int for sections larger than 2 GiB.
+template <typename RecordType>
+std::vector<RecordType>
+gather_records(const IBStructureBinaryFile& file, const IBStructureBinaryFile::SectionType type)
+{
+    const std::size_t num_records = file.getNumberOfRecords(type);
+    std::vector<RecordType> records(num_records);
+    if (num_records == 0) return records;
+    if (num_records > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+    {
+        TBOX_ERROR("IBStandardInitializer::gather_records():\n"
+                   << "  binary structure file section has " << num_records << " records, but at most "
+                   << std::numeric_limits<int>::max() << " records are supported" << std::endl);
+    }
+    // Each process contributes the records of IBStructureBinaryFile::getLocalRecordRange().
+    const int nodes = IBTK_MPI::getNodes();
+    std::vector<int> rcounts(nodes), disps(nodes);
+    for (int rank = 0; rank < nodes; ++rank)
+    {
+        const std::size_t first = num_records * rank / nodes;
+        const std::size_t last = num_records * (rank + 1) / nodes;
+        rcounts[rank] = static_cast<int>(last - first);
+        disps[rank] = static_cast<int>(first);
+    }
+    const std::pair<std::size_t, std::size_t> range = IBStructureBinaryFile::getLocalRecordRange(num_records);
+    const RecordType* const local_records = file.getRecords<RecordType>(type) + range.first;
+    MPI_Datatype record_type;
+    MPI_Type_contiguous(static_cast<int>(sizeof(RecordType)), MPI_BYTE, &record_type);
+    MPI_Type_commit(&record_type);
+    MPI_Allgatherv(local_records,
+                   static_cast<int>(range.second - range.first),
+                   record_type,
+                   records.data(),
+                   rcounts.data(),
+                   disps.data(),
+                   record_type,
+                   IBTK_MPI::getCommunicator());
+    MPI_Type_free(&record_type);
+    return records;
+} // gather_records
 } // namespace
 
 /////////////////////////////// PUBLIC ///////////////////////////////////////
@@ -136,26 +184,35 @@ IBStandardInitializer::init()
     }
     else
     {
-        // Process the vertex information.
-        readVertexFiles(".vertex");
+        // Process the vertex information, and when binary structure files are
+        // used, also the spring, beam, target point, and anchor point
+        // information.
+        if (d_use_binary_structure_files)
+        {
+            readBinaryStructureFiles(".ibstruct");
+        }
+        else
+        {
+            readVertexFiles(".vertex");
+        }
 
         // Process the spring information.
-        readSpringFiles(".spring", /*input_uses_global_idxs*/ false);
+        if (!d_use_binary_structure_files) readSpringFiles(".spring", /*input_uses_global_idxs*/ false);
 
         // Process the crosslink spring ("x-spring") information.
         readXSpringFiles(".xspring", /*input_uses_global_idxs*/ true);
 
         // Process the beam information.
-        readBeamFiles(".beam", /*input_uses_global_idxs*/ false);
+        if (!d_use_binary_structure_files) readBeamFiles(".beam", /*input_uses_global_idxs*/ false);
 
         // Process the rod information.
         readRodFiles(".rod", /*input_uses_global_idxs*/ false);
 
         // Process the target point information.
-        readTargetPointFiles(".target");
+        if (!d_use_binary_structure_files) readTargetPointFiles(".target");
 
         // Process the anchor point information.
-        readAnchorPointFiles(".anchor");
+        if (!d_use_binary_structure_files) readAnchorPointFiles(".anchor");
 
         // Process the mass information.
         readBoundaryMassFiles(".mass");
@@ -435,72 +492,7 @@ IBStandardInitializer::readSpringFiles(const std::string& extension, const bool
                         }
                     }
 
-                    // Modify kappa and length according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_spring_stiffness[ln][j])
-                    {
-                        parameters[0] = d_uniform_spring_stiffness[ln][j];
-                    }
-                    if (d_using_uniform_spring_rest_length[ln][j])
-                    {
-                        parameters[1] = d_uniform_spring_rest_length[ln][j];
-                    }
-                    if (d_using_uniform_spring_force_fcn_idx[ln][j])
-                    {
-                        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
-                    }
-
-                    // Check to see if the spring constant is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_springs[ln][j] &&
-                        (parameters[0] == 0.0 || IBTK::abs_equal_eps(parameters[0], 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant "
-                                                      "encountered in ASCII input file named "
-                                                   << spring_filename << "." << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the edge numbers to be in the global Lagrangian indexing
-                    // scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        e.first += d_vertex_offset[ln][j];
-                        e.second += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present edge.
-                    //
-                    // Note that in the edge map, each edge is associated with only the
-                    // first vertex.
-                    if (e.first > e.second)
-                    {
-                        std::swap<int>(e.first, e.second);
-                    }
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
-                        d_spring_edge_map[ln][j].equal_range(e.first);
-                    for (auto it = range.first; it != range.second; ++it)
-                    {
-                        if (it->second == e) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate spring connection between nodes "
-                                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
-                                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << spring_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
-                        SpringSpec spec_data;
-                        spec_data.parameters = parameters;
-                        spec_data.force_fcn_idx = force_fcn_idx;
-                        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
-                    }
+                    addSpring(ln, j, e, parameters, force_fcn_idx, input_uses_global_idxs, spring_filename, warned);
                 }
 
                 // Close the input file.
@@ -914,67 +906,16 @@ IBStandardInitializer::readBeamFiles(const std::string& extension, const bool in
                         }
                     }
 
-                    // Modify bend and curvature according to whether uniform
-                    // values are to be employed for this particular structure.
-                    if (d_using_uniform_beam_bend_rigidity[ln][j])
-                    {
-                        bend = d_uniform_beam_bend_rigidity[ln][j];
-                    }
-                    if (d_using_uniform_beam_curvature[ln][j])
-                    {
-                        curv = d_uniform_beam_curvature[ln][j];
-                    }
-
-                    // Check to see if the bending rigidity is zero and, if so,
-                    // emit a warning.
-                    if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || IBTK::abs_equal_eps(bend, 0.0)))
-                    {
-                        TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity "
-                                                      "encountered in ASCII input file named "
-                                                   << beam_filename << "." << std::endl);
-                        warned = true;
-                    }
-
-                    // Correct the node numbers to be in the global Lagrangian
-                    // indexing scheme.
-                    if (!input_uses_global_idxs)
-                    {
-                        prev_idx += d_vertex_offset[ln][j];
-                        curr_idx += d_vertex_offset[ln][j];
-                        next_idx += d_vertex_offset[ln][j];
-                    }
-
-                    // Initialize the map data corresponding to the present
-                    // beam.
-                    //
-                    // Note that in the beam property map, each edge is
-                    // associated with only the "current" vertex.
-                    bool found_connection = false;
-                    std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> range =
-                        d_beam_spec_data[ln][j].equal_range(curr_idx);
-                    for (auto it = range.first; it != range.second; ++it)
-                    {
-                        const BeamSpec& spec_data = it->second;
-                        if (spec_data.neighbor_idxs == std::make_pair(next_idx, prev_idx)) found_connection = true;
-                    }
-                    if (found_connection)
-                    {
-                        TBOX_WARNING(d_object_name
-                                     << ":\n  Duplicate beam connection between nodes "
-                                     << (prev_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ",  "
-                                     << (curr_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ", and "
-                                     << (next_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
-                                     << " encountered in ASCII input file named " << beam_filename << ".\n"
-                                     << "  Skipping duplicated connection." << std::endl);
-                    }
-                    else
-                    {
-                        BeamSpec spec_data;
-                        spec_data.neighbor_idxs = std::make_pair(next_idx, prev_idx);
-                        spec_data.bend_rigidity = bend;
-                        spec_data.curvature = curv;
-                        d_beam_spec_data[ln][j].insert(std::make_pair(curr_idx, spec_data));
-                    }
+                    addBeam(ln,
+                            j,
+                            prev_idx,
+                            curr_idx,
+                            next_idx,
+                            bend,
+                            curv,
+                            input_uses_global_idxs,
+                            beam_filename,
+                            warned);
                 }
 
                 // Close the input file.
@@ -1480,31 +1421,7 @@ IBStandardInitializer::readTargetPointFiles(const std::string& extension)
             // Modify the target point stiffness constants according to whether
             // target point penalty forces are enabled, or whether uniform
             // values are to be employed, for this particular structure.
-            if (!d_enable_target_points[ln][j])
-            {
-                for (int k = 0; k < d_num_vertex[ln][j]; ++k)
-                {
-                    d_target_spec_data[ln][j][k].stiffness = 0.0;
-                    d_target_spec_data[ln][j][k].damping = 0.0;
-                }
-            }
-            else
-            {
-                if (d_using_uniform_target_stiffness[ln][j])
-                {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
-                    {
-                        d_target_spec_data[ln][j][k].stiffness = d_uniform_target_stiffness[ln][j];
-                    }
-                }
-                if (d_using_uniform_target_damping[ln][j])
-                {
-                    for (int k = 0; k < d_num_vertex[ln][j]; ++k)
-                    {
-                        d_target_spec_data[ln][j][k].damping = d_uniform_target_damping[ln][j];
-                    }
-                }
-            }
+            resetTargetPointSpecs(ln, j);
 
             // Free the next MPI process to start reading the current file.
             if (d_use_file_batons && rank != nodes - 1) IBTK_MPI::send(&flag, sz, rank + 1, false, j);
@@ -2392,6 +2309,383 @@ IBStandardInitializer::readSourceFiles(const std::string& extension)
     return;
 } // readSourceFiles
 
+void
+IBStandardInitializer::readBinaryStructureFiles(const std::string& extension)
+{
+    for (int ln = 0; ln < d_max_levels; ++ln)
+    {
+        const size_t num_base_filename = d_base_filename[ln].size();
+        d_num_vertex[ln].resize(num_base_filename, 0);
+        d_vertex_offset[ln].resize(num_base_filename, std::numeric_limits<int>::max());
+        d_vertex_posn[ln].resize(num_base_filename);
+        d_spring_edge_map[ln].resize(num_base_filename);
+        d_spring_spec_data[ln].resize(num_base_filename);
+        d_beam_spec_data[ln].resize(num_base_filename);
+        d_target_spec_data[ln].resize(num_base_filename);
+        d_anchor_spec_data[ln].resize(num_base_filename);
+        for (unsigned int j = 0; j < num_base_filename; ++j)
+        {
+            const std::string filename = d_base_filename[ln][j] + extension;
+            plog << d_object_name << ":  "
+                 << "processing structure data from binary input file named " << filename << std::endl
+                 << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+            const IBStructureBinaryFile file(filename);
+
+            // Process the vertex information.
+            if (j == 0)
+            {
+                d_vertex_offset[ln][j] = 0;
+            }
+            else
+            {
+                d_vertex_offset[ln][j] = d_vertex_offset[ln][j - 1] + d_num_vertex[ln][j - 1];
+            }
+            const std::vector<IBStructureBinaryFile::VertexRecord> vertices =
+                gather_records<IBStructureBinaryFile::VertexRecord>(file, IBStructureBinaryFile::VERTEX_SECTION);
+            d_num_vertex[ln][j] = static_cast<int>(vertices.size());
+            d_vertex_posn[ln][j].resize(d_num_vertex[ln][j]);
+            for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+            {
+                Point& X = d_vertex_posn[ln][j][k];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = d_length_scale_factor * (vertices[k].X[d] + d_posn_shift[d]);
+                }
+            }
+            const int num_vertex = d_num_vertex[ln][j];
+            auto check_idx = [this, &filename, num_vertex](const int idx, const char* const record_type, const int k) {
+                if (idx < 0 || idx >= num_vertex)
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Invalid " << record_type << " " << k << " in input file "
+                                             << filename << std::endl
+                                             << "  vertex index " << idx << " is out of range" << std::endl);
+                }
+            };
+
+            // Process the spring information.
+            const std::vector<IBStructureBinaryFile::SpringRecord> springs =
+                gather_records<IBStructureBinaryFile::SpringRecord>(file, IBStructureBinaryFile::SPRING_SECTION);
+            const std::vector<double> spring_parameters =
+                gather_records<double>(file, IBStructureBinaryFile::SPRING_PARAMETER_SECTION);
+            bool warned = false;
+            for (int k = 0; k < static_cast<int>(springs.size()); ++k)
+            {
+                const IBStructureBinaryFile::SpringRecord& spring = springs[k];
+                check_idx(spring.idx[0], "spring", k);
+                check_idx(spring.idx[1], "spring", k);
+                if (spring.num_parameters < 2 ||
+                    spring.parameter_offset + spring.num_parameters > spring_parameters.size())
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Invalid spring " << k << " in input file " << filename
+                                             << std::endl
+                                             << "  invalid spring parameters" << std::endl);
+                }
+                std::vector<double> parameters(spring_parameters.begin() + spring.parameter_offset,
+                                               spring_parameters.begin() + spring.parameter_offset +
+                                                   spring.num_parameters);
+                if (parameters[0] < 0.0)
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Invalid spring " << k << " in input file " << filename
+                                             << std::endl
+                                             << "  spring constant is negative" << std::endl);
+                }
+                if (parameters[1] < 0.0)
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Invalid spring " << k << " in input file " << filename
+                                             << std::endl
+                                             << "  spring resting length is negative" << std::endl);
+                }
+                parameters[1] *= d_length_scale_factor;
+                addSpring(ln,
+                          j,
+                          Edge(spring.idx[0], spring.idx[1]),
+                          parameters,
+                          spring.force_fcn_idx,
+                          /*input_uses_global_idxs*/ false,
+                          filename,
+                          warned);
+            }
+
+            // Process the beam information.
+            const std::vector<IBStructureBinaryFile::BeamRecord> beams =
+                gather_records<IBStructureBinaryFile::BeamRecord>(file, IBStructureBinaryFile::BEAM_SECTION);
+            warned = false;
+            for (int k = 0; k < static_cast<int>(beams.size()); ++k)
+            {
+                const IBStructureBinaryFile::BeamRecord& beam = beams[k];
+                check_idx(beam.prev_idx, "beam", k);
+                check_idx(beam.curr_idx, "beam", k);
+                check_idx(beam.next_idx, "beam", k);
+                if (beam.bend_rigidity < 0.0)
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Invalid beam " << k << " in input file " << filename << std::endl
+                                             << "  beam constant is negative" << std::endl);
+                }
+                Vector curv;
+                for (unsigned int d = 0; d < NDIM; ++d) curv[d] = beam.curvature[d];
+                addBeam(ln,
+                        j,
+                        beam.prev_idx,
+                        beam.curr_idx,
+                        beam.next_idx,
+                        beam.bend_rigidity,
+                        curv,
+                        /*input_uses_global_idxs*/ false,
+                        filename,
+                        warned);
+            }
+
+            // Process the target point information.
+            const std::vector<IBStructureBinaryFile::TargetPointRecord> target_points =
+                gather_records<IBStructureBinaryFile::TargetPointRecord>(file,
+                                                                         IBStructureBinaryFile::TARGET_POINT_SECTION);
+            TargetSpec default_target_spec;
+            default_target_spec.stiffness = 0.0;
+            default_target_spec.damping = 0.0;
+            d_target_spec_data[ln][j].resize(num_vertex, default_target_spec);
+            std::vector<bool> is_target_point(num_vertex, false);
+            warned = false;
+            for (int k = 0; k < static_cast<int>(target_points.size()); ++k)
+            {
+                const IBStructureBinaryFile::TargetPointRecord& target_point = target_points[k];
+                const int n = target_point.idx;
+                check_idx(n, "target point", k);
+                if (is_target_point[n])
+                {
+                    TBOX_WARNING(d_object_name << ":\n  Duplicate target point node " << n
+                                               << " encountered in input file named " << filename << ".\n"
+                                               << "  Skipping duplicated point." << std::endl);
+                    continue;
+                }
+                is_target_point[n] = true;
+                if (target_point.stiffness < 0.0 || target_point.damping < 0.0)
+                {
+                    TBOX_ERROR(d_object_name << ":\n  Invalid target point " << k << " in input file " << filename
+                                             << std::endl
+                                             << "  target point spring constant or damping factor is negative"
+                                             << std::endl);
+                }
+                d_target_spec_data[ln][j][n].stiffness = target_point.stiffness;
+                d_target_spec_data[ln][j][n].damping = target_point.damping;
+                if (!warned && d_enable_target_points[ln][j] &&
+                    (target_point.stiffness == 0.0 || IBTK::abs_equal_eps(target_point.stiffness, 0.0)))
+                {
+                    TBOX_WARNING(d_object_name << ":\n  Target point with zero penalty spring constant encountered "
+                                                  "in input file named "
+                                               << filename << "." << std::endl);
+                    warned = true;
+                }
+            }
+            resetTargetPointSpecs(ln, j);
+
+            // Process the anchor point information.
+            const std::vector<IBStructureBinaryFile::AnchorPointRecord> anchor_points =
+                gather_records<IBStructureBinaryFile::AnchorPointRecord>(file,
+                                                                         IBStructureBinaryFile::ANCHOR_POINT_SECTION);
+            AnchorSpec default_anchor_spec;
+            default_anchor_spec.is_anchor_point = false;
+            d_anchor_spec_data[ln][j].resize(num_vertex, default_anchor_spec);
+            for (int k = 0; k < static_cast<int>(anchor_points.size()); ++k)
+            {
+                const int n = anchor_points[k].idx;
+                check_idx(n, "anchor point", k);
+                if (d_anchor_spec_data[ln][j][n].is_anchor_point)
+                {
+                    TBOX_WARNING(d_object_name << ":\n  Duplicate anchor point node " << n
+                                               << " encountered in input file named " << filename << ".\n"
+                                               << "  Skipping duplicated point." << std::endl);
+                }
+                d_anchor_spec_data[ln][j][n].is_anchor_point = true;
+            }
+
+            plog << d_object_name << ":  "
+                 << "read " << num_vertex << " vertices, " << springs.size() << " edges, " << beams.size()
+                 << " beams, " << target_points.size() << " target points, and " << anchor_points.size()
+                 << " anchor points from binary input file named " << filename << std::endl
+                 << "  on MPI process " << IBTK_MPI::getRank() << std::endl;
+        }
+    }
+    return;
+} // readBinaryStructureFiles
+
+void
+IBStandardInitializer::addSpring(const int ln,
+                                 const int j,
+                                 Edge e,
+                                 std::vector<double> parameters,
+                                 int force_fcn_idx,
+                                 const bool input_uses_global_idxs,
+                                 const std::string& filename,
+                                 bool& warned)
+{
+    // Modify kappa and length according to whether uniform values are to be
+    // employed for this particular structure.
+    if (d_using_uniform_spring_stiffness[ln][j])
+    {
+        parameters[0] = d_uniform_spring_stiffness[ln][j];
+    }
+    if (d_using_uniform_spring_rest_length[ln][j])
+    {
+        parameters[1] = d_uniform_spring_rest_length[ln][j];
+    }
+    if (d_using_uniform_spring_force_fcn_idx[ln][j])
+    {
+        force_fcn_idx = d_uniform_spring_force_fcn_idx[ln][j];
+    }
+
+    // Check to see if the spring constant is zero and, if so, emit a warning.
+    if (!warned && d_enable_springs[ln][j] && (parameters[0] == 0.0 || IBTK::abs_equal_eps(parameters[0], 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Spring with zero spring constant encountered in input file named "
+                                   << filename << "." << std::endl);
+        warned = true;
+    }
+
+    // Correct the edge numbers to be in the global Lagrangian indexing scheme.
+    if (!input_uses_global_idxs)
+    {
+        e.first += d_vertex_offset[ln][j];
+        e.second += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present edge.
+    //
+    // Note that in the edge map, each edge is associated with only the first
+    // vertex.
+    if (e.first > e.second)
+    {
+        std::swap<int>(e.first, e.second);
+    }
+    bool found_connection = false;
+    std::pair<std::multimap<int, Edge>::iterator, std::multimap<int, Edge>::iterator> range =
+        d_spring_edge_map[ln][j].equal_range(e.first);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == e) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate spring connection between nodes "
+                     << (e.first + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << " and "
+                     << (e.second + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in input file named " << filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        d_spring_edge_map[ln][j].insert(std::make_pair(e.first, e));
+        SpringSpec spec_data;
+        spec_data.parameters = parameters;
+        spec_data.force_fcn_idx = force_fcn_idx;
+        d_spring_spec_data[ln][j].insert(std::make_pair(e, spec_data));
+    }
+    return;
+} // addSpring
+
+void
+IBStandardInitializer::addBeam(const int ln,
+                               const int j,
+                               int prev_idx,
+                               int curr_idx,
+                               int next_idx,
+                               double bend,
+                               Vector curv,
+                               const bool input_uses_global_idxs,
+                               const std::string& filename,
+                               bool& warned)
+{
+    // Modify bend and curvature according to whether uniform values are to be
+    // employed for this particular structure.
+    if (d_using_uniform_beam_bend_rigidity[ln][j])
+    {
+        bend = d_uniform_beam_bend_rigidity[ln][j];
+    }
+    if (d_using_uniform_beam_curvature[ln][j])
+    {
+        curv = d_uniform_beam_curvature[ln][j];
+    }
+
+    // Check to see if the bending rigidity is zero and, if so, emit a warning.
+    if (!warned && d_enable_beams[ln][j] && (bend == 0.0 || IBTK::abs_equal_eps(bend, 0.0)))
+    {
+        TBOX_WARNING(d_object_name << ":\n  Beam with zero bending rigidity encountered in input file named "
+                                   << filename << "." << std::endl);
+        warned = true;
+    }
+
+    // Correct the node numbers to be in the global Lagrangian indexing scheme.
+    if (!input_uses_global_idxs)
+    {
+        prev_idx += d_vertex_offset[ln][j];
+        curr_idx += d_vertex_offset[ln][j];
+        next_idx += d_vertex_offset[ln][j];
+    }
+
+    // Initialize the map data corresponding to the present beam.
+    //
+    // Note that in the beam property map, each edge is associated with only
+    // the "current" vertex.
+    bool found_connection = false;
+    std::pair<std::multimap<int, BeamSpec>::iterator, std::multimap<int, BeamSpec>::iterator> range =
+        d_beam_spec_data[ln][j].equal_range(curr_idx);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const BeamSpec& spec_data = it->second;
+        if (spec_data.neighbor_idxs == std::make_pair(next_idx, prev_idx)) found_connection = true;
+    }
+    if (found_connection)
+    {
+        TBOX_WARNING(d_object_name
+                     << ":\n  Duplicate beam connection between nodes "
+                     << (prev_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ",  "
+                     << (curr_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j])) << ", and "
+                     << (next_idx + (input_uses_global_idxs ? 0 : -d_vertex_offset[ln][j]))
+                     << " encountered in input file named " << filename << ".\n"
+                     << "  Skipping duplicated connection." << std::endl);
+    }
+    else
+    {
+        BeamSpec spec_data;
+        spec_data.neighbor_idxs = std::make_pair(next_idx, prev_idx);
+        spec_data.bend_rigidity = bend;
+        spec_data.curvature = curv;
+        d_beam_spec_data[ln][j].insert(std::make_pair(curr_idx, spec_data));
+    }
+    return;
+} // addBeam
+
+void
+IBStandardInitializer::resetTargetPointSpecs(const int ln, const int j)
+{
+    if (!d_enable_target_points[ln][j])
+    {
+        for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+        {
+            d_target_spec_data[ln][j][k].stiffness = 0.0;
+            d_target_spec_data[ln][j][k].damping = 0.0;
+        }
+    }
+    else
+    {
+        if (d_using_uniform_target_stiffness[ln][j])
+        {
+            for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+            {
+                d_target_spec_data[ln][j][k].stiffness = d_uniform_target_stiffness[ln][j];
+            }
+        }
+        if (d_using_uniform_target_damping[ln][j])
+        {
+            for (int k = 0; k < d_num_vertex[ln][j]; ++k)
+            {
+                d_target_spec_data[ln][j][k].damping = d_uniform_target_damping[ln][j];
+            }
+        }
+    }
+    return;
+} // resetTargetPointSpecs
+
 std::vector<Pointer<Streamable> >
 IBStandardInitializer::initializeNodeData(const std::pair<int, int>& point_index,
                                           const unsigned int global_index_offset,
@@ -2578,6 +2872,11 @@ IBStandardInitializer::getFromInput(Pointer<Database> db)
     // reading the same file at once.
     if (db->keyExists("use_file_batons")) d_use_file_batons = db->getBool("use_file_batons");
 
+    // Determine whether to read the structure data from binary structure files
+    // instead of ASCII input files.
+    if (db->keyExists("use_binary_structure_files"))
+        d_use_binary_structure_files = db->getBool("use_binary_structure_files");
+
     // Determine the (maximum) number of levels in the locally refined grid.
     // Note that each piece of the Lagrangian structure must be assigned to a
     // particular level of the grid.
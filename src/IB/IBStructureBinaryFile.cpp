@@ -0,0 +1,416 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+/////////////////////////////// INCLUDES /////////////////////////////////////
+
+#include "ibamr/IBStructureBinaryFile.h"
+
+#include "ibtk/IBTK_MPI.h"
+
+#include "tbox/Utilities.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "ibamr/namespaces.h" // IWYU pragma: keep
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+namespace IBAMR
+{
+/////////////////////////////// STATIC ///////////////////////////////////////
+
+namespace
+{
+const char MAGIC[8] = { 'I', 'B', 'S', 'T', 'R', 'U', 'C', 'T' };
+const std::uint32_t VERSION = 1;
+const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+const std::size_t HEADER_SIZE = sizeof(MAGIC) + 4 * sizeof(std::uint32_t);
+const std::size_t ALIGNMENT = 8;
+
+inline std::size_t
+align(const std::size_t offset)
+{
+    return ALIGNMENT * ((offset + ALIGNMENT - 1) / ALIGNMENT);
+} // align
+
+inline std::string
+discard_comments(const std::string& input_string)
+{
+    // Discard any text following a '!', '#', or '%' character.
+    return input_string.substr(0, input_string.find_first_of("!#%"));
+} // discard_comments
+
+// Read the next line of an ASCII input file into a string stream, with any
+// comments removed.
+void
+get_line(std::ifstream& file_stream, std::istringstream& line_stream, const std::string& filename, const int line_num)
+{
+    std::string line_string;
+    if (!std::getline(file_stream, line_string))
+    {
+        TBOX_ERROR("IBStructureBinaryFile::convertASCIIFiles():\n  Premature end to input file encountered before line "
+                   << line_num << " of file " << filename << std::endl);
+    }
+    line_stream.clear();
+    line_stream.str(discard_comments(line_string));
+    return;
+} // get_line
+
+// Read the number of entries in an ASCII input file from its first line.
+int
+get_num_entries(std::ifstream& file_stream, const std::string& filename)
+{
+    std::istringstream line_stream;
+    get_line(file_stream, line_stream, filename, 1);
+    int num_entries = -1;
+    if (!(line_stream >> num_entries) || num_entries <= 0)
+    {
+        TBOX_ERROR("IBStructureBinaryFile::convertASCIIFiles():\n  Invalid entry in input file encountered on line 1 "
+                   "of file "
+                   << filename << std::endl);
+    }
+    return num_entries;
+} // get_num_entries
+
+void
+invalid_entry_error(const std::string& filename, const int line_num)
+{
+    TBOX_ERROR("IBStructureBinaryFile::convertASCIIFiles():\n  Invalid entry in input file encountered on line "
+               << line_num << " of file " << filename << std::endl);
+    return;
+} // invalid_entry_error
+} // namespace
+
+/////////////////////////////// PUBLIC ///////////////////////////////////////
+
+IBStructureBinaryFile::IBStructureBinaryFile(std::string filename) : d_filename(std::move(filename))
+{
+    d_fd = open(d_filename.c_str(), O_RDONLY);
+    if (d_fd < 0)
+    {
+        TBOX_ERROR("IBStructureBinaryFile::IBStructureBinaryFile():\n  Cannot open binary structure file: "
+                   << d_filename << std::endl);
+    }
+    struct stat file_stat;
+    if (fstat(d_fd, &file_stat) != 0 || static_cast<std::size_t>(file_stat.st_size) < HEADER_SIZE)
+    {
+        TBOX_ERROR("IBStructureBinaryFile::IBStructureBinaryFile():\n  Invalid binary structure file: " << d_filename
+                                                                                                         << std::endl);
+    }
+    d_size = static_cast<std::size_t>(file_stat.st_size);
+    void* data = mmap(nullptr, d_size, PROT_READ, MAP_SHARED, d_fd, 0);
+    if (data == MAP_FAILED)
+    {
+        TBOX_ERROR("IBStructureBinaryFile::IBStructureBinaryFile():\n  Cannot memory map binary structure file: "
+                   << d_filename << std::endl);
+    }
+    d_data = static_cast<const char*>(data);
+
+    // Check the file header.
+    std::uint32_t header[4];
+    std::memcpy(header, d_data + sizeof(MAGIC), sizeof(header));
+    if (std::memcmp(d_data, MAGIC, sizeof(MAGIC)) != 0 || header[0] != VERSION)
+    {
+        TBOX_ERROR("IBStructureBinaryFile::IBStructureBinaryFile():\n  File "
+                   << d_filename << " is not a version " << VERSION << " binary structure file" << std::endl);
+    }
+    if (header[1] != NDIM)
+    {
+        TBOX_ERROR("IBStructureBinaryFile::IBStructureBinaryFile():\n  File "
+                   << d_filename << " contains a " << header[1] << "D structure" << std::endl);
+    }
+    if (header[2] != BYTE_ORDER_MARK)
+    {
+        TBOX_ERROR("IBStructureBinaryFile::IBStructureBinaryFile():\n  File "
+                   << d_filename << " was written on a machine with a different byte order" << std::endl);
+    }
+
+    // Read the section descriptors.
+    const std::uint32_t num_sections = header[3];
+    if (HEADER_SIZE + num_sections * sizeof(SectionDescriptor) > d_size)
+    {
+        TBOX_ERROR("IBStructureBinaryFile::IBStructureBinaryFile():\n  Invalid binary structure file: " << d_filename
+                                                                                                         << std::endl);
+    }
+    for (std::uint32_t k = 0; k < num_sections; ++k)
+    {
+        SectionDescriptor section;
+        std::memcpy(&section, d_data + HEADER_SIZE + k * sizeof(SectionDescriptor), sizeof(SectionDescriptor));
+        if (section.type > ANCHOR_POINT_SECTION) continue;
+        const auto type = static_cast<SectionType>(section.type);
+        if (section.record_size != getRecordSize(type) || section.offset % ALIGNMENT != 0 ||
+            section.offset + section.num_records * section.record_size > d_size)
+        {
+            TBOX_ERROR("IBStructureBinaryFile::IBStructureBinaryFile():\n  Invalid section "
+                       << section.type << " in binary structure file: " << d_filename << std::endl);
+        }
+        d_sections[type] = section;
+    }
+    if (!hasSection(VERTEX_SECTION))
+    {
+        TBOX_ERROR("IBStructureBinaryFile::IBStructureBinaryFile():\n  Binary structure file "
+                   << d_filename << " does not contain vertex data" << std::endl);
+    }
+    return;
+} // IBStructureBinaryFile
+
+IBStructureBinaryFile::~IBStructureBinaryFile()
+{
+    if (d_data) munmap(const_cast<char*>(d_data), d_size);
+    if (d_fd >= 0) close(d_fd);
+    return;
+} // ~IBStructureBinaryFile
+
+const std::string&
+IBStructureBinaryFile::getFilename() const
+{
+    return d_filename;
+} // getFilename
+
+bool
+IBStructureBinaryFile::hasSection(const SectionType type) const
+{
+    return d_sections.count(type) > 0;
+} // hasSection
+
+std::size_t
+IBStructureBinaryFile::getNumberOfRecords(const SectionType type) const
+{
+    const auto it = d_sections.find(type);
+    return it == d_sections.end() ? 0 : it->second.num_records;
+} // getNumberOfRecords
+
+std::pair<std::size_t, std::size_t>
+IBStructureBinaryFile::getLocalRecordRange(const std::size_t num_records)
+{
+    const std::size_t rank = IBTK_MPI::getRank();
+    const std::size_t nodes = IBTK_MPI::getNodes();
+    return std::make_pair(num_records * rank / nodes, num_records * (rank + 1) / nodes);
+} // getLocalRecordRange
+
+void
+IBStructureBinaryFile::convertASCIIFiles(const std::string& base_filename, const std::string& output_filename)
+{
+    std::istringstream line_stream;
+
+    // Read the vertex file.
+    std::vector<VertexRecord> vertices;
+    {
+        const std::string filename = base_filename + ".vertex";
+        std::ifstream file_stream(filename);
+        if (!file_stream.is_open())
+        {
+            TBOX_ERROR("IBStructureBinaryFile::convertASCIIFiles():\n  Cannot find required vertex file: "
+                       << filename << std::endl);
+        }
+        vertices.resize(get_num_entries(file_stream, filename));
+        for (std::size_t k = 0; k < vertices.size(); ++k)
+        {
+            get_line(file_stream, line_stream, filename, k + 2);
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                if (!(line_stream >> vertices[k].X[d])) invalid_entry_error(filename, k + 2);
+            }
+        }
+    }
+
+    // Read the optional spring file.
+    std::vector<SpringRecord> springs;
+    std::vector<double> spring_parameters;
+    {
+        const std::string filename = base_filename + ".spring";
+        std::ifstream file_stream(filename);
+        if (file_stream.is_open())
+        {
+            springs.resize(get_num_entries(file_stream, filename));
+            for (std::size_t k = 0; k < springs.size(); ++k)
+            {
+                get_line(file_stream, line_stream, filename, k + 2);
+                SpringRecord& spring = springs[k];
+                double kappa, rest_length;
+                if (!(line_stream >> spring.idx[0] >> spring.idx[1] >> kappa >> rest_length))
+                {
+                    invalid_entry_error(filename, k + 2);
+                }
+                spring.parameter_offset = spring_parameters.size();
+                spring_parameters.push_back(kappa);
+                spring_parameters.push_back(rest_length);
+                if (!(line_stream >> spring.force_fcn_idx)) spring.force_fcn_idx = 0;
+                double param;
+                while (line_stream >> param) spring_parameters.push_back(param);
+                spring.num_parameters = static_cast<std::int32_t>(spring_parameters.size() - spring.parameter_offset);
+            }
+        }
+    }
+
+    // Read the optional beam file.
+    std::vector<BeamRecord> beams;
+    {
+        const std::string filename = base_filename + ".beam";
+        std::ifstream file_stream(filename);
+        if (file_stream.is_open())
+        {
+            beams.resize(get_num_entries(file_stream, filename));
+            for (std::size_t k = 0; k < beams.size(); ++k)
+            {
+                get_line(file_stream, line_stream, filename, k + 2);
+                BeamRecord& beam = beams[k];
+                beam.padding = 0;
+                if (!(line_stream >> beam.prev_idx >> beam.curr_idx >> beam.next_idx >> beam.bend_rigidity))
+                {
+                    invalid_entry_error(filename, k + 2);
+                }
+                bool curv_found_in_input = false;
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    beam.curvature[d] = 0.0;
+                    if (line_stream >> beam.curvature[d])
+                    {
+                        curv_found_in_input = true;
+                    }
+                    else if (curv_found_in_input)
+                    {
+                        invalid_entry_error(filename, k + 2);
+                    }
+                }
+            }
+        }
+    }
+
+    // Read the optional target point file.
+    std::vector<TargetPointRecord> target_points;
+    {
+        const std::string filename = base_filename + ".target";
+        std::ifstream file_stream(filename);
+        if (file_stream.is_open())
+        {
+            target_points.resize(get_num_entries(file_stream, filename));
+            for (std::size_t k = 0; k < target_points.size(); ++k)
+            {
+                get_line(file_stream, line_stream, filename, k + 2);
+                TargetPointRecord& target_point = target_points[k];
+                target_point.padding = 0;
+                if (!(line_stream >> target_point.idx >> target_point.stiffness))
+                {
+                    invalid_entry_error(filename, k + 2);
+                }
+                if (!(line_stream >> target_point.damping)) target_point.damping = 0.0;
+            }
+        }
+    }
+
+    // Read the optional anchor point file.
+    std::vector<AnchorPointRecord> anchor_points;
+    {
+        const std::string filename = base_filename + ".anchor";
+        std::ifstream file_stream(filename);
+        if (file_stream.is_open())
+        {
+            anchor_points.resize(get_num_entries(file_stream, filename));
+            for (std::size_t k = 0; k < anchor_points.size(); ++k)
+            {
+                get_line(file_stream, line_stream, filename, k + 2);
+                if (!(line_stream >> anchor_points[k].idx)) invalid_entry_error(filename, k + 2);
+            }
+        }
+    }
+
+    // Lay out the sections.
+    std::vector<std::pair<SectionDescriptor, const char*> > sections;
+    auto add_section = [&sections](const SectionType type, const std::size_t num_records, const void* data) {
+        if (num_records == 0) return;
+        SectionDescriptor section;
+        section.type = type;
+        section.record_size = static_cast<std::uint32_t>(getRecordSize(type));
+        section.num_records = num_records;
+        section.offset = 0;
+        sections.push_back(std::make_pair(section, static_cast<const char*>(data)));
+    };
+    add_section(VERTEX_SECTION, vertices.size(), vertices.data());
+    add_section(SPRING_SECTION, springs.size(), springs.data());
+    add_section(SPRING_PARAMETER_SECTION, spring_parameters.size(), spring_parameters.data());
+    add_section(BEAM_SECTION, beams.size(), beams.data());
+    add_section(TARGET_POINT_SECTION, target_points.size(), target_points.data());
+    add_section(ANCHOR_POINT_SECTION, anchor_points.size(), anchor_points.data());
+    std::size_t offset = align(HEADER_SIZE + sections.size() * sizeof(SectionDescriptor));
+    for (auto& section : sections)
+    {
+        section.first.offset = offset;
+        offset = align(offset + section.first.num_records * section.first.record_size);
+    }
+
+    // Write the file.
+    std::ofstream file_stream(output_filename, std::ios::binary);
+    if (!file_stream.is_open())
+    {
+        TBOX_ERROR("IBStructureBinaryFile::convertASCIIFiles():\n  Cannot open output file: " << output_filename
+                                                                                               << std::endl);
+    }
+    const std::uint32_t header[4] = { VERSION, NDIM, BYTE_ORDER_MARK, static_cast<std::uint32_t>(sections.size()) };
+    file_stream.write(MAGIC, sizeof(MAGIC));
+    file_stream.write(reinterpret_cast<const char*>(header), sizeof(header));
+    for (const auto& section : sections)
+    {
+        file_stream.write(reinterpret_cast<const char*>(&section.first), sizeof(SectionDescriptor));
+    }
+    static const char padding[ALIGNMENT] = { 0 };
+    for (const auto& section : sections)
+    {
+        file_stream.write(padding, section.first.offset - static_cast<std::size_t>(file_stream.tellp()));
+        file_stream.write(section.second, section.first.num_records * section.first.record_size);
+    }
+    file_stream.write(padding, offset - static_cast<std::size_t>(file_stream.tellp()));
+    if (!file_stream.good())
+    {
+        TBOX_ERROR("IBStructureBinaryFile::convertASCIIFiles():\n  Error writing output file: " << output_filename
+                                                                                                << std::endl);
+    }
+    return;
+} // convertASCIIFiles
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+std::size_t
+IBStructureBinaryFile::getRecordSize(const SectionType type)
+{
+    switch (type)
+    {
+    case VERTEX_SECTION:
+        return sizeof(VertexRecord);
+    case SPRING_SECTION:
+        return sizeof(SpringRecord);
+    case SPRING_PARAMETER_SECTION:
+        return sizeof(double);
+    case BEAM_SECTION:
+        return sizeof(BeamRecord);
+    case TARGET_POINT_SECTION:
+        return sizeof(TargetPointRecord);
+    case ANCHOR_POINT_SECTION:
+        return sizeof(AnchorPointRecord);
+    }
+    return 0;
+} // getRecordSize
+
+/////////////////////////////// NAMESPACE ////////////////////////////////////
+
+} // namespace IBAMR
+
+//////////////////////////////////////////////////////////////////////////////
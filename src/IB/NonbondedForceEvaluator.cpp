@@ -40,8 +40,10 @@
 #include <assert.h>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <string>
+#include <vector>
 
 #include "ibamr/app_namespaces.h" // IWYU pragma: keep
 
@@ -82,6 +84,14 @@ NonbondedForceEvaluator::NonbondedForceEvaluator(Pointer<Database> input_db,
 
     // get parameters for force function
     d_parameters = input_db->getDoubleArray("parameters");
+
+    // get neighbor list settings
+    if (input_db->keyExists("use_neighbor_list")) d_use_neighbor_list = input_db->getBool("use_neighbor_list");
+    if (input_db->keyExists("neighbor_list_skin")) d_neighbor_list_skin = input_db->getDouble("neighbor_list_skin");
+    if (d_use_neighbor_list && d_neighbor_list_skin <= 0.0)
+    {
+        TBOX_ERROR("neighbor_list_skin must be positive for NonbondedForceEvaluator.");
+    }
 }
 
 void
@@ -131,16 +141,46 @@ NonbondedForceEvaluator::evaluateForces(int mstr_petsc_idx,
     R = std::sqrt(R);
 
     double nonbdd_force[NDIM];
-    (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
+    if (d_force_fcn_ptr)
+    {
+        (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
+    }
+    else
+    {
+        std::array<const double*, NDIM> D_comps;
+        std::array<double*, NDIM> force_comps;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            D_comps[k] = &D[k];
+            force_comps[k] = &nonbdd_force[k];
+        }
+        (d_batch_force_fcn_ptr)(1, D_comps.data(), d_parameters, force_comps.data());
+    }
     for (int k = 0; k < NDIM; ++k)
     {
         force[mstr_petsc_idx * NDIM + k] += nonbdd_force[k];
         force[search_petsc_idx * NDIM + k] += -1.0 * nonbdd_force[k];
     }
     VecRestoreArray(F_data->getVec(), &force);
+    VecRestoreArray(X_data->getVec(), &position);
     return;
 } // evaluateForces
 
+void
+NonbondedForceEvaluator::initializeLevelData(const Pointer<PatchHierarchy<NDIM> > /*hierarchy*/,
+                                             const int level_number,
+                                             const double /*init_data_time*/,
+                                             const bool /*initial_time*/,
+                                             LDataManager* const /*l_data_manager*/)
+{
+    // The local PETSc indices stored in the neighbor list are no longer valid.
+    if (level_number < static_cast<int>(d_neighbor_lists.size()))
+    {
+        d_neighbor_lists[level_number].is_valid = false;
+    }
+    return;
+} // initializeLevelData
+
 void
 NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 Pointer<LData> X_data,
@@ -150,6 +190,12 @@ NonbondedForceEvaluator::computeLagrangianForce(Pointer<LData> F_data,
                                                 const double /*data_time*/,
                                                 LDataManager* const l_data_manager)
 {
+    if (d_use_neighbor_list)
+    {
+        computeLagrangianForceWithNeighborList(F_data, X_data, hierarchy, level_number, l_data_manager);
+        return;
+    }
+
     // Get grid geometry and relevant lower and upper limits.
     Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
@@ -242,6 +288,213 @@ NonbondedForceEvaluator::registerForceFcnPtr(NonBddForceFcnPtr force_fcn_ptr)
     return;
 } // registerForceFcnPtr
 
+void
+NonbondedForceEvaluator::registerBatchForceFcnPtr(NonBddBatchForceFcnPtr batch_force_fcn_ptr)
+{
+    d_batch_force_fcn_ptr = batch_force_fcn_ptr;
+    return;
+} // registerBatchForceFcnPtr
+
+/////////////////////////////// PRIVATE //////////////////////////////////////
+
+void
+NonbondedForceEvaluator::buildNeighborList(Pointer<LData> X_data,
+                                           const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                           const int level_number,
+                                           LDataManager* const l_data_manager)
+{
+    if (level_number >= static_cast<int>(d_neighbor_lists.size())) d_neighbor_lists.resize(level_number + 1);
+    NeighborList& neighbor_list = d_neighbor_lists[level_number];
+    neighbor_list.mstr_idxs.clear();
+    neighbor_list.search_idxs.clear();
+    for (int k = 0; k < NDIM; ++k) neighbor_list.search_shifts[k].clear();
+
+    // Get grid geometry and relevant lower and upper limits.
+    Pointer<CartesianGridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
+    if (!grid_geom->getDomainIsSingleBox()) TBOX_ERROR("physical domain must be a single box...\n");
+    const double* const x_lower = grid_geom->getXLower();
+    const double* const x_upper = grid_geom->getXUpper();
+    Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_number);
+    for (int k = 0; k < NDIM; ++k)
+    {
+        neighbor_list.dx[k] = grid_geom->getDx()[k] / static_cast<double>(level->getRatio()(k));
+    }
+
+    // Pairs are kept if they are within interaction_radius + skin (in units of
+    // the grid spacing) of each other, and they are searched for in the same
+    // way as without a neighbor list, using a search box that is also grown by
+    // the skin.
+    const double list_radius = d_interaction_radius + d_neighbor_list_skin;
+    IntVector<NDIM> grow_amount(static_cast<int>(ceil(list_radius + 2.0 * d_regrid_alpha)));
+    const int lag_node_idx_current_idx = l_data_manager->getLNodePatchDescriptorIndex();
+
+    const boost::multi_array_ref<double, 2>& X_array = *X_data->getGhostedLocalFormVecArray();
+    const double* const X = X_array.data();
+    neighbor_list.X_build.assign(X, X + X_array.num_elements());
+
+    double shift[NDIM];
+    for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+    {
+        Pointer<Patch<NDIM> > patch = level->getPatch(p());
+        Pointer<LNodeSetData> current_idx_data = patch->getPatchData(lag_node_idx_current_idx);
+        const Box<NDIM>& patch_box = patch->getBox();
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* const patch_dx = patch_geom->getDx();
+
+        for (LNodeSetData::CellIterator cit(patch_box); cit; cit++)
+        {
+            const hier::Index<NDIM>& first_cell_idx = *cit;
+            LNodeSet* const mstr_node_set = current_idx_data->getItem(first_cell_idx);
+            if (!mstr_node_set) continue;
+
+            Box<NDIM> search_box(first_cell_idx, first_cell_idx);
+            for (LNodeSetData::CellIterator scit(Box<NDIM>::grow(search_box, grow_amount)); scit; scit++)
+            {
+                const hier::Index<NDIM>& search_cell_idx = *scit;
+                LNodeSet* const search_node_set = current_idx_data->getItem(search_cell_idx);
+                if (!search_node_set) continue;
+
+                // Periodic offset of this cell.
+                for (int k = 0; k < NDIM; ++k)
+                {
+                    const double absolute_diff = search_cell_idx[k] * patch_dx[k];
+                    shift[k] = floor(absolute_diff / (x_upper[k] - x_lower[k])) * (x_upper[k] - x_lower[k]);
+                }
+
+                for (const auto& mstr_node_idx : *mstr_node_set)
+                {
+                    const int mstr_lag_idx = mstr_node_idx->getLagrangianIndex();
+                    const int mstr_petsc_idx = mstr_node_idx->getLocalPETScIndex();
+                    for (const auto& search_node_idx : *search_node_set)
+                    {
+                        const int search_lag_idx = search_node_idx->getLagrangianIndex();
+                        const int search_petsc_idx = search_node_idx->getLocalPETScIndex();
+                        if (mstr_lag_idx >= search_lag_idx) continue;
+
+                        double R_sq = 0.0;
+                        for (int k = 0; k < NDIM; ++k)
+                        {
+                            const double D =
+                                (X[mstr_petsc_idx * NDIM + k] - X[search_petsc_idx * NDIM + k] - shift[k]) /
+                                neighbor_list.dx[k];
+                            R_sq += D * D;
+                        }
+                        if (R_sq >= list_radius * list_radius) continue;
+
+                        neighbor_list.mstr_idxs.push_back(mstr_petsc_idx);
+                        neighbor_list.search_idxs.push_back(search_petsc_idx);
+                        for (int k = 0; k < NDIM; ++k) neighbor_list.search_shifts[k].push_back(shift[k]);
+                    }
+                }
+            }
+        }
+    }
+    X_data->restoreArrays();
+    neighbor_list.is_valid = true;
+    return;
+} // buildNeighborList
+
+void
+NonbondedForceEvaluator::computeLagrangianForceWithNeighborList(Pointer<LData> F_data,
+                                                                Pointer<LData> X_data,
+                                                                const Pointer<PatchHierarchy<NDIM> > hierarchy,
+                                                                const int level_number,
+                                                                LDataManager* const l_data_manager)
+{
+    // The list remains valid as long as no node has moved more than half of
+    // the skin distance since it was built: no pair can then have come closer
+    // than the interaction radius without already being in the list.
+    bool needs_rebuild =
+        level_number >= static_cast<int>(d_neighbor_lists.size()) || !d_neighbor_lists[level_number].is_valid;
+    if (!needs_rebuild)
+    {
+        const NeighborList& neighbor_list = d_neighbor_lists[level_number];
+        const boost::multi_array_ref<double, 2>& X_array = *X_data->getGhostedLocalFormVecArray();
+        const double* const X = X_array.data();
+        const auto num_values = static_cast<int>(X_array.num_elements());
+        needs_rebuild = num_values != static_cast<int>(neighbor_list.X_build.size());
+        const double max_displacement_sq = 0.25 * d_neighbor_list_skin * d_neighbor_list_skin;
+        for (int i = 0; !needs_rebuild && i < num_values; i += NDIM)
+        {
+            double displacement_sq = 0.0;
+            for (int k = 0; k < NDIM; ++k)
+            {
+                const double dX = (X[i + k] - neighbor_list.X_build[i + k]) / neighbor_list.dx[k];
+                displacement_sq += dX * dX;
+            }
+            needs_rebuild = displacement_sq > max_displacement_sq;
+        }
+        X_data->restoreArrays();
+    }
+    if (needs_rebuild) buildNeighborList(X_data, hierarchy, level_number, l_data_manager);
+
+    const NeighborList& neighbor_list = d_neighbor_lists[level_number];
+    const int num_pairs = static_cast<int>(neighbor_list.mstr_idxs.size());
+    const double* const X = X_data->getGhostedLocalFormVecArray()->data();
+    double* const F = F_data->getGhostedLocalFormVecArray()->data();
+
+    if (!d_batch_force_fcn_ptr)
+    {
+        double D[NDIM], nonbdd_force[NDIM];
+        for (int l = 0; l < num_pairs; ++l)
+        {
+            const int mstr_idx = neighbor_list.mstr_idxs[l];
+            const int search_idx = neighbor_list.search_idxs[l];
+            for (int k = 0; k < NDIM; ++k)
+            {
+                D[k] = X[mstr_idx * NDIM + k] - X[search_idx * NDIM + k] - neighbor_list.search_shifts[k][l];
+            }
+            (d_force_fcn_ptr)(D, d_parameters, nonbdd_force);
+            for (int k = 0; k < NDIM; ++k)
+            {
+                F[mstr_idx * NDIM + k] += nonbdd_force[k];
+                F[search_idx * NDIM + k] -= nonbdd_force[k];
+            }
+        }
+    }
+    else
+    {
+        // Process the pairs in batches: pack the displacements of all pairs in
+        // the batch into contiguous arrays, evaluate all of their forces with
+        // one call, and then accumulate them.
+        static const int BATCH_SIZE = 64;
+        std::array<std::array<double, BATCH_SIZE>, NDIM> D_batch, F_batch;
+        std::array<const double*, NDIM> D_comps;
+        std::array<double*, NDIM> F_comps;
+        for (int k = 0; k < NDIM; ++k)
+        {
+            D_comps[k] = D_batch[k].data();
+            F_comps[k] = F_batch[k].data();
+        }
+        for (int batch_begin = 0; batch_begin < num_pairs; batch_begin += BATCH_SIZE)
+        {
+            const int batch_size = std::min(BATCH_SIZE, num_pairs - batch_begin);
+            const int* const mstr_idxs = &neighbor_list.mstr_idxs[batch_begin];
+            const int* const search_idxs = &neighbor_list.search_idxs[batch_begin];
+            for (int k = 0; k < NDIM; ++k)
+            {
+                const double* const search_shifts = &neighbor_list.search_shifts[k][batch_begin];
+                for (int l = 0; l < batch_size; ++l)
+                {
+                    D_batch[k][l] = X[mstr_idxs[l] * NDIM + k] - X[search_idxs[l] * NDIM + k] - search_shifts[l];
+                }
+            }
+            (d_batch_force_fcn_ptr)(batch_size, D_comps.data(), d_parameters, F_comps.data());
+            for (int l = 0; l < batch_size; ++l)
+            {
+                for (int k = 0; k < NDIM; ++k)
+                {
+                    F[mstr_idxs[l] * NDIM + k] += F_batch[k][l];
+                    F[search_idxs[l] * NDIM + k] -= F_batch[k][l];
+                }
+            }
+        }
+    }
+    F_data->restoreArrays();
+    X_data->restoreArrays();
+    return;
+} // computeLagrangianForceWithNeighborList
+
 //////////////////////////////////////////////////////////////////////////////
 
 } // namespace IBAMR
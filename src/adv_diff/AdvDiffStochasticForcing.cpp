@@ -97,6 +97,9 @@ AdvDiffStochasticForcing::AdvDiffStochasticForcing(std::string object_name,
     {
         if (input_db->keyExists("std")) d_std = input_db->getDouble("std");
         if (input_db->keyExists("num_rand_vals")) d_num_rand_vals = input_db->getInteger("num_rand_vals");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("rng_seed")) d_rng_seed = input_db->getInteger("rng_seed");
         int k = 0;
         std::string key_name = "weights_0";
         while (input_db->keyExists(key_name))
@@ -236,6 +239,7 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            const unsigned int step = d_adv_diff_solver->getIntegratorStep();
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
@@ -245,6 +249,11 @@ AdvDiffStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<SideData<NDIM, double> > F_sc_data = patch->getPatchData(d_F_sc_idxs[k]);
+                        if (d_use_counter_based_rng)
+                        {
+                            RNG::genrandn(*F_sc_data, d_rng_seed, step, level_num, k);
+                            continue;
+                        }
                         for (int d = 0; d < NDIM; ++d)
                         {
                             genrandn(F_sc_data->getArrayData(d), SideGeometry<NDIM>::toSideBox(F_sc_data->getBox(), d));
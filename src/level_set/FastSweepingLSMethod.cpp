@@ -19,14 +19,17 @@
 
 #include "ibtk/HierarchyGhostCellInterpolation.h"
 #include "ibtk/HierarchyMathOps.h"
+#include "ibtk/IBTK_MPI.h"
 
 #include "BasePatchLevel.h"
 #include "Box.h"
 #include "BoxArray.h"
 #include "CartesianPatchGeometry.h"
 #include "CellData.h"
+#include "CellIndex.h"
 #include "CellVariable.h"
 #include "HierarchyCellDataOpsReal.h"
+#include "Index.h"
 #include "IntVector.h"
 #include "Patch.h"
 #include "PatchHierarchy.h"
@@ -40,6 +43,11 @@
 #include "tbox/Pointer.h"
 #include "tbox/Utilities.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -50,10 +58,12 @@
 // FORTRAN ROUTINES
 #if (NDIM == 2)
 #define FAST_SWEEP_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweep1storder2d, FASTSWEEP1STORDER2D)
+#define FAST_SWEEP_1ST_ORDER_LIST_FC IBAMR_FC_FUNC(fastsweep1storderlist2d, FASTSWEEP1STORDERLIST2D)
 #endif
 
 #if (NDIM == 3)
 #define FAST_SWEEP_1ST_ORDER_FC IBAMR_FC_FUNC(fastsweep1storder3d, FASTSWEEP1STORDER3D)
+#define FAST_SWEEP_1ST_ORDER_LIST_FC IBAMR_FC_FUNC(fastsweep1storderlist3d, FASTSWEEP1STORDERLIST3D)
 #endif
 
 extern "C"
@@ -80,6 +90,31 @@ extern "C"
                                  const double* dx,
                                  const int& patch_touches_bdry,
                                  const int* touches_wall_loc_idx);
+
+    void FAST_SWEEP_1ST_ORDER_LIST_FC(double* U,
+                                      const int& U_gcw,
+                                      const int& ilower0,
+                                      const int& iupper0,
+                                      const int& ilower1,
+                                      const int& iupper1,
+#if (NDIM == 3)
+                                      const int& ilower2,
+                                      const int& iupper2,
+#endif
+                                      const int& dlower0,
+                                      const int& dupper0,
+                                      const int& dlower1,
+                                      const int& dupper1,
+#if (NDIM == 3)
+                                      const int& dlower2,
+                                      const int& dupper2,
+#endif
+                                      const double* dx,
+                                      const int& patch_touches_bdry,
+                                      const int* touches_wall_loc_idx,
+                                      const int* cell_idxs,
+                                      const int& ncells,
+                                      double& max_change);
 }
 
 /////////////////////////////// NAMESPACE ////////////////////////////////////
@@ -88,6 +123,82 @@ namespace IBAMR
 {
 /////////////////////////////// STATIC ///////////////////////////////////////
 
+namespace
+{
+// The cells of a patch that are in the narrow band around the interface.
+struct NarrowBand
+{
+    // Flags indicating whether each cell of the patch box is in the band.
+    std::vector<char> in_band;
+
+    // The indices of the cells in the band (NDIM entries per cell).
+    std::vector<int> cell_idxs;
+
+    // The indices of the cells in the band, ordered for each of the 2^NDIM
+    // sweeping directions.
+    std::array<std::vector<int>, (1 << NDIM)> sweep_cell_idxs;
+
+    // The values in the face-adjacent ghost cells at the previous iteration.
+    std::vector<double> ghost_vals;
+
+    // Whether the patch needs to be swept during the present iteration.
+    bool active = true;
+
+    // Whether cells have been added to the band since the sweep orderings
+    // were built.
+    bool modified = true;
+};
+
+inline int
+cell_offset(const Box<NDIM>& box, const hier::Index<NDIM>& i)
+{
+    int offset = 0;
+    for (int d = NDIM - 1; d >= 0; --d) offset = offset * box.numberCells(d) + (i(d) - box.lower(d));
+    return offset;
+} // cell_offset
+
+bool
+add_to_band(NarrowBand& band, const Box<NDIM>& patch_box, const hier::Index<NDIM>& i)
+{
+    char& flag = band.in_band[cell_offset(patch_box, i)];
+    if (flag) return false;
+    flag = 1;
+    for (int d = 0; d < NDIM; ++d) band.cell_idxs.push_back(i(d));
+    band.modified = true;
+    return true;
+} // add_to_band
+
+void
+build_sweep_orderings(NarrowBand& band)
+{
+    const int n_cells = static_cast<int>(band.cell_idxs.size()) / NDIM;
+    std::vector<int> perm(n_cells);
+    for (int dir = 0; dir < (1 << NDIM); ++dir)
+    {
+        // Order the cells lexicographically with axis NDIM - 1 varying
+        // slowest, reversing the order along axis d when bit d of dir is set.
+        std::iota(perm.begin(), perm.end(), 0);
+        std::sort(perm.begin(), perm.end(), [&band, dir](const int a, const int b) {
+            for (int d = NDIM - 1; d >= 0; --d)
+            {
+                const int i_a = band.cell_idxs[NDIM * a + d];
+                const int i_b = band.cell_idxs[NDIM * b + d];
+                if (i_a != i_b) return (dir & (1 << d)) ? i_a > i_b : i_a < i_b;
+            }
+            return false;
+        });
+        std::vector<int>& sweep_cell_idxs = band.sweep_cell_idxs[dir];
+        sweep_cell_idxs.resize(band.cell_idxs.size());
+        for (int k = 0; k < n_cells; ++k)
+        {
+            for (int d = 0; d < NDIM; ++d) sweep_cell_idxs[NDIM * k + d] = band.cell_idxs[NDIM * perm[k] + d];
+        }
+    }
+    band.modified = false;
+    return;
+} // build_sweep_orderings
+} // namespace
+
 /////////////////////////////// PUBLIC ///////////////////////////////////////
 
 FastSweepingLSMethod::FastSweepingLSMethod(std::string object_name, Pointer<Database> db, bool register_for_restart)
@@ -161,46 +272,55 @@ FastSweepingLSMethod::initializeLSData(int D_idx,
     fill_op->initializeOperatorState(D_transaction, hierarchy);
     HierarchyCellDataOpsReal<NDIM, double> hier_cc_data_ops(hierarchy, coarsest_ln, finest_ln);
 
-    // Carry out iterations
-    double diff_L2_norm = 1.0e12;
-    int outer_iter = 0;
-    const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
-
-    while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
+    // Carry out iterations, either on the narrow band around the interface or
+    // on the entire patch hierarchy.
+    if (d_use_narrow_band)
     {
-        hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
-        fill_op->fillData(time);
+        narrowBandFastSweep(hier_math_ops, D_scratch_idx, fill_op, time);
+    }
+    else
+    {
+        double diff_L2_norm = 1.0e12;
+        int outer_iter = 0;
+        const int cc_wgt_idx = hier_math_ops->getCellWeightPatchDescriptorIndex();
 
-        fastSweep(hier_math_ops, D_scratch_idx);
+        while (diff_L2_norm > d_abs_tol && outer_iter < d_max_its)
+        {
+            hier_cc_data_ops.copyData(D_iter_idx, D_scratch_idx);
+            fill_op->fillData(time);
 
-        hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_scratch_idx);
-        diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
+            fastSweep(hier_math_ops, D_scratch_idx);
 
-        outer_iter += 1;
+            hier_cc_data_ops.axmy(D_iter_idx, 1.0, D_iter_idx, D_scratch_idx);
+            diff_L2_norm = hier_cc_data_ops.L2Norm(D_iter_idx, cc_wgt_idx);
 
-        if (d_enable_logging)
-        {
-            plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
-            plog << d_object_name << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm
-                 << std::endl;
-        }
+            outer_iter += 1;
 
-        if (diff_L2_norm <= d_abs_tol)
-        {
-            plog << d_object_name
-                 << "::initializeLSData(): Fast sweeping algorithm "
-                    "converged for entire domain"
-                 << std::endl;
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::initializeLSData(): After iteration # " << outer_iter << std::endl;
+                plog << d_object_name
+                     << "::initializeLSData(): L2-norm between successive iterations = " << diff_L2_norm << std::endl;
+            }
+
+            if (diff_L2_norm <= d_abs_tol)
+            {
+                plog << d_object_name
+                     << "::initializeLSData(): Fast sweeping algorithm "
+                        "converged for entire domain"
+                     << std::endl;
+            }
         }
-    }
 
-    if (outer_iter >= d_max_its)
-    {
-        if (d_enable_logging)
+        if (outer_iter >= d_max_its)
         {
-            plog << d_object_name << "::initializeLSData(): Reached maximum allowable outer iterations" << std::endl;
-            plog << d_object_name << "::initializeLSData(): ||distance_new - distance_old||_2 = " << diff_L2_norm
-                 << std::endl;
+            if (d_enable_logging)
+            {
+                plog << d_object_name << "::initializeLSData(): Reached maximum allowable outer iterations"
+                     << std::endl;
+                plog << d_object_name << "::initializeLSData(): ||distance_new - distance_old||_2 = " << diff_L2_norm
+                     << std::endl;
+            }
         }
     }
 
@@ -260,21 +380,8 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
 
     // Check if the patch touches physical domain.
     int touches_wall_loc_idx[NDIM * 2] = { 0 };
+    const bool patch_touches_bdry = getWallLocations(patch, touches_wall_loc_idx);
     Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
-    const bool patch_touches_bdry = pgeom->getTouchesRegularBoundary() || pgeom->getTouchesPeriodicBoundary();
-    if (patch_touches_bdry)
-    {
-        int loc_idx = 0;
-        for (unsigned int axis = 0; axis < NDIM; ++axis)
-        {
-            for (int upperlower = 0; upperlower < 2; ++upperlower, ++loc_idx)
-            {
-                touches_wall_loc_idx[loc_idx] = d_consider_phys_bdry_wall &&
-                                                pgeom->getTouchesRegularBoundary(axis, upperlower) &&
-                                                d_wall_location_idx[loc_idx];
-            }
-        }
-    }
 
 #if !defined(NDEBUG)
     TBOX_ASSERT(dist_data->getDepth() == 1);
@@ -315,6 +422,249 @@ FastSweepingLSMethod::fastSweep(Pointer<CellData<NDIM, double> > dist_data,
     return;
 } // fastSweep
 
+void
+FastSweepingLSMethod::narrowBandFastSweep(Pointer<HierarchyMathOps> hier_math_ops,
+                                          const int dist_idx,
+                                          Pointer<HierarchyGhostCellInterpolation> fill_op,
+                                          const double time) const
+{
+    Pointer<PatchHierarchy<NDIM> > hierarchy = hier_math_ops->getPatchHierarchy();
+    const int coarsest_ln = 0;
+    const int finest_ln = hierarchy->getFinestLevelNumber();
+
+#if !defined(NDEBUG)
+    if (d_ls_order != FIRST_ORDER_LS)
+    {
+        TBOX_ERROR("FastSweepingLSMethod does not support " << enum_to_string(d_ls_order) << std::endl);
+    }
+#endif
+
+    // The band width on a patch in terms of its smallest grid spacing.
+    auto get_band_width = [this](const Pointer<Patch<NDIM> >& patch) {
+        Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+        const double* const dx = pgeom->getDx();
+        return d_narrow_band_width * *std::min_element(dx, dx + NDIM);
+    };
+
+    // Initialize the band on each patch with the cells that are already within
+    // the band width of the interface.
+    std::vector<std::vector<NarrowBand> > bands(finest_ln + 1);
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        bands[ln].resize(level->getNumberOfPatches());
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            const Box<NDIM>& patch_box = patch->getBox();
+            const double band_width = get_band_width(patch);
+            NarrowBand& band = bands[ln][p()];
+            band.in_band.assign(patch_box.size(), 0);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                if (std::abs((*dist_data)(i)) < band_width) add_to_band(band, patch_box, i);
+            }
+        }
+    }
+
+    // Sweep the bands until the distance values and the bands themselves stop
+    // changing.  Sweeping directions are visited in Gray code order so that
+    // consecutive sweeps differ in only one axis.
+    double max_change = std::numeric_limits<double>::max();
+    int num_grown = 1;
+    int outer_iter = 0;
+    std::vector<double> ghost_vals;
+    while ((max_change > d_abs_tol || num_grown > 0) && outer_iter < d_max_its)
+    {
+        fill_op->fillData(time);
+
+        max_change = 0.0;
+        num_grown = 0;
+        int num_swept = 0;
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+            const BoxArray<NDIM>& domain_boxes = level->getPhysicalDomain();
+#if !defined(NDEBUG)
+            TBOX_ASSERT(domain_boxes.size() == 1);
+#endif
+            const Box<NDIM>& domain_box = domain_boxes[0];
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+                const Box<NDIM>& patch_box = patch->getBox();
+                const double band_width = get_band_width(patch);
+                NarrowBand& band = bands[ln][p()];
+                bool grown = false;
+
+                // Extend the band across the patch boundary and determine
+                // whether any of the face-adjacent ghost cell values changed.
+                ghost_vals.clear();
+                for (int axis = 0; axis < NDIM; ++axis)
+                {
+                    for (int upperlower = 0; upperlower < 2; ++upperlower)
+                    {
+                        Box<NDIM> ghost_box = patch_box;
+                        const int ghost_idx = upperlower ? patch_box.upper(axis) + 1 : patch_box.lower(axis) - 1;
+                        ghost_box.lower(axis) = ghost_idx;
+                        ghost_box.upper(axis) = ghost_idx;
+                        for (Box<NDIM>::Iterator b(ghost_box); b; b++)
+                        {
+                            const CellIndex<NDIM> g(b());
+                            const double D_ghost = (*dist_data)(g);
+                            ghost_vals.push_back(D_ghost);
+                            if (std::abs(D_ghost) >= band_width) continue;
+                            hier::Index<NDIM> i = g;
+                            i(axis) += upperlower ? -1 : 1;
+                            grown = add_to_band(band, patch_box, i) || grown;
+                        }
+                    }
+                }
+                if (ghost_vals != band.ghost_vals) band.active = true;
+                band.ghost_vals.swap(ghost_vals);
+                if (!band.active && !grown) continue;
+
+                // Sweep the cells in the band.
+                if (band.modified) build_sweep_orderings(band);
+                int touches_wall_loc_idx[NDIM * 2] = { 0 };
+                const int patch_touches_bdry = getWallLocations(patch, touches_wall_loc_idx);
+                Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const dx = pgeom->getDx();
+                double* const D = dist_data->getPointer(0);
+                const int D_ghosts = (dist_data->getGhostCellWidth()).max();
+                const int n_cells = static_cast<int>(band.cell_idxs.size()) / NDIM;
+                double patch_change = 0.0;
+                for (int k = 0; k < (1 << NDIM); ++k)
+                {
+                    if (n_cells == 0) break;
+                    const int dir = k ^ (k >> 1);
+                    FAST_SWEEP_1ST_ORDER_LIST_FC(D,
+                                                 D_ghosts,
+                                                 patch_box.lower(0),
+                                                 patch_box.upper(0),
+                                                 patch_box.lower(1),
+                                                 patch_box.upper(1),
+#if (NDIM == 3)
+                                                 patch_box.lower(2),
+                                                 patch_box.upper(2),
+#endif
+                                                 domain_box.lower(0),
+                                                 domain_box.upper(0),
+                                                 domain_box.lower(1),
+                                                 domain_box.upper(1),
+#if (NDIM == 3)
+                                                 domain_box.lower(2),
+                                                 domain_box.upper(2),
+#endif
+                                                 dx,
+                                                 patch_touches_bdry,
+                                                 touches_wall_loc_idx,
+                                                 band.sweep_cell_idxs[dir].data(),
+                                                 n_cells,
+                                                 patch_change);
+                }
+
+                // Add the neighbors of cells whose distance values are now
+                // within the band width to the band.
+                for (int k = 0; k < n_cells; ++k)
+                {
+                    hier::Index<NDIM> i;
+                    for (int d = 0; d < NDIM; ++d) i(d) = band.cell_idxs[NDIM * k + d];
+                    if (std::abs((*dist_data)(CellIndex<NDIM>(i))) >= band_width) continue;
+                    for (int axis = 0; axis < NDIM; ++axis)
+                    {
+                        for (int shift = -1; shift <= 1; shift += 2)
+                        {
+                            hier::Index<NDIM> j = i;
+                            j(axis) += shift;
+                            if (patch_box.contains(j)) grown = add_to_band(band, patch_box, j) || grown;
+                        }
+                    }
+                }
+
+                band.active = patch_change > d_abs_tol || grown;
+                max_change = std::max(max_change, patch_change);
+                if (grown) ++num_grown;
+                ++num_swept;
+            }
+        }
+        max_change = IBTK_MPI::maxReduction(max_change);
+        num_grown = IBTK_MPI::sumReduction(num_grown);
+        num_swept = IBTK_MPI::sumReduction(num_swept);
+        outer_iter += 1;
+
+        if (d_enable_logging)
+        {
+            plog << d_object_name << "::narrowBandFastSweep(): After iteration # " << outer_iter << std::endl;
+            plog << d_object_name << "::narrowBandFastSweep(): swept " << num_swept
+                 << " patches; max-norm between successive iterations = " << max_change << "; " << num_grown
+                 << " bands grew" << std::endl;
+        }
+    }
+
+    if (d_enable_logging)
+    {
+        if (max_change <= d_abs_tol && num_grown == 0)
+        {
+            plog << d_object_name << "::narrowBandFastSweep(): Fast sweeping algorithm converged on the narrow band"
+                 << std::endl;
+        }
+        else
+        {
+            plog << d_object_name << "::narrowBandFastSweep(): Reached maximum allowable outer iterations"
+                 << std::endl;
+        }
+    }
+
+    // Values outside of the band are set to plus or minus the band width.
+    for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            Pointer<CellData<NDIM, double> > dist_data = patch->getPatchData(dist_idx);
+            const Box<NDIM>& patch_box = patch->getBox();
+            const double band_width = get_band_width(patch);
+            const NarrowBand& band = bands[ln][p()];
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                double& D = (*dist_data)(i);
+                if (!band.in_band[cell_offset(patch_box, i)] || std::abs(D) > band_width)
+                {
+                    D = D < 0.0 ? -band_width : (D > 0.0 ? band_width : 0.0);
+                }
+            }
+        }
+    }
+    return;
+} // narrowBandFastSweep
+
+bool
+FastSweepingLSMethod::getWallLocations(const Pointer<Patch<NDIM> > patch, int touches_wall_loc_idx[2 * NDIM]) const
+{
+    Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+    const bool patch_touches_bdry = pgeom->getTouchesRegularBoundary() || pgeom->getTouchesPeriodicBoundary();
+    if (patch_touches_bdry)
+    {
+        int loc_idx = 0;
+        for (unsigned int axis = 0; axis < NDIM; ++axis)
+        {
+            for (int upperlower = 0; upperlower < 2; ++upperlower, ++loc_idx)
+            {
+                touches_wall_loc_idx[loc_idx] = d_consider_phys_bdry_wall &&
+                                                pgeom->getTouchesRegularBoundary(axis, upperlower) &&
+                                                d_wall_location_idx[loc_idx];
+            }
+        }
+    }
+    return patch_touches_bdry;
+} // getWallLocations
+
 void
 FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 {
@@ -331,6 +681,13 @@ FastSweepingLSMethod::getFromInput(Pointer<Database> input_db)
 
     d_reinit_interval = input_db->getIntegerWithDefault("reinit_interval", d_reinit_interval);
 
+    d_use_narrow_band = input_db->getBoolWithDefault("use_narrow_band", d_use_narrow_band);
+    d_narrow_band_width = input_db->getDoubleWithDefault("narrow_band_width", d_narrow_band_width);
+    if (d_narrow_band_width <= 0.0)
+    {
+        TBOX_ERROR(d_object_name << "::getFromInput(): narrow_band_width must be positive" << std::endl);
+    }
+
     d_consider_phys_bdry_wall = input_db->getBoolWithDefault("physical_bdry_wall", d_consider_phys_bdry_wall);
     Array<int> wall_loc_idices;
     if (input_db->keyExists("physical_bdry_wall_loc_idx"))
@@ -233,6 +233,71 @@ c     Do the four sweeping directions.
       return
       end
 
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+c     Carry out a single first-order accurate sweep over a list of cells in
+c     the order given by the list, and return the maximum change
+c
+ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
+c
+      subroutine fastsweep1storderlist2d(
+     &     U,U_gcw,
+     &     ilower0,iupper0,
+     &     ilower1,iupper1,
+     &     dlower0,dupper0,
+     &     dlower1,dupper1,
+     &     dx,
+     &     patch_touches_bdry,
+     &     touches_wall_loc_idx,
+     &     cell_idxs,ncells,
+     &     max_change)
+c
+      implicit none
+include(TOP_SRCDIR/src/fortran/const.i)dnl
+c
+c     Input.
+c
+      INTEGER ilower0,iupper0
+      INTEGER ilower1,iupper1
+      INTEGER dlower0,dupper0
+      INTEGER dlower1,dupper1
+      INTEGER U_gcw
+      INTEGER patch_touches_bdry
+      INTEGER ncells
+      INTEGER cell_idxs(0:NDIM-1,0:ncells-1)
+
+c
+c     Input/Output.
+c
+      REAL U(CELL2d(ilower,iupper,U_gcw))
+      REAL dx(0:NDIM-1)
+      INTEGER touches_wall_loc_idx(0:2*NDIM - 1)
+      REAL max_change
+c
+c     Local variables.
+c
+      INTEGER n,i0,i1
+      REAL    U_old
+
+      do n = 0,ncells-1
+         i0 = cell_idxs(0,n)
+         i1 = cell_idxs(1,n)
+         U_old = U(i0,i1)
+         call evalsweep1storder2d(U,U_gcw,
+     &                            ilower0,iupper0,
+     &                            ilower1,iupper1,
+     &                            i0,i1,
+     &                            dlower0,dupper0,
+     &                            dlower1,dupper1,
+     &                            dx,
+     &                            patch_touches_bdry,
+     &                            touches_wall_loc_idx)
+         max_change = dmax1(max_change,dabs(U(i0,i1)-U_old))
+      enddo
+
+      return
+      end
+
 ccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccccc
 c
 c     Compute fast sweep solution at a given grid cell
@@ -178,6 +178,9 @@ INSStaggeredStochasticForcing::INSStaggeredStochasticForcing(std::string object_
                 string_to_enum<StochasticStressTensorType>(input_db->getString("stress_tensor_type"));
         if (input_db->keyExists("std")) d_std = input_db->getDouble("std");
         if (input_db->keyExists("num_rand_vals")) d_num_rand_vals = input_db->getInteger("num_rand_vals");
+        if (input_db->keyExists("use_counter_based_rng"))
+            d_use_counter_based_rng = input_db->getBool("use_counter_based_rng");
+        if (input_db->keyExists("rng_seed")) d_rng_seed = input_db->getInteger("rng_seed");
         int k = 0;
         std::string key_name = "weights_0";
         while (input_db->keyExists(key_name))
@@ -266,8 +269,13 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
         // Generate random components.
         if (cycle_num == 0)
         {
+            // When using the counter-based generator, each random field uses
+            // its own stream: (NDIM + 1) * k for the cell-centered values and
+            // (NDIM + 1) * k + 1 + d for the node- or edge-centered values.
+            const unsigned int step = d_fluid_solver->getIntegratorStep();
             for (int k = 0; k < d_num_rand_vals; ++k)
             {
+                const unsigned int stream = (NDIM + 1) * k;
                 for (int level_num = coarsest_ln; level_num <= finest_ln; ++level_num)
                 {
                     Pointer<PatchLevel<NDIM> > level = hierarchy->getPatchLevel(level_num);
@@ -275,16 +283,28 @@ INSStaggeredStochasticForcing::setDataOnPatchHierarchy(const int data_idx,
                     {
                         Pointer<Patch<NDIM> > patch = level->getPatch(p());
                         Pointer<CellData<NDIM, double> > W_cc_data = patch->getPatchData(d_W_cc_idxs[k]);
-                        genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
+                        if (d_use_counter_based_rng)
+                            RNG::genrandn(*W_cc_data, d_rng_seed, step, level_num, stream);
+                        else
+                            genrandn(W_cc_data->getArrayData(), W_cc_data->getBox());
 #if (NDIM == 2)
                         Pointer<NodeData<NDIM, double> > W_nc_data = patch->getPatchData(d_W_nc_idxs[k]);
-                        genrandn(W_nc_data->getArrayData(), NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox()));
+                        const Box<NDIM> nc_box = NodeGeometry<NDIM>::toNodeBox(W_nc_data->getBox());
+                        if (d_use_counter_based_rng)
+                            RNG::genrandn(W_nc_data->getArrayData(), nc_box, d_rng_seed, step, level_num, stream + 1);
+                        else
+                            genrandn(W_nc_data->getArrayData(), nc_box);
 #endif
 #if (NDIM == 3)
                         Pointer<EdgeData<NDIM, double> > W_ec_data = patch->getPatchData(d_W_ec_idxs[k]);
                         for (int d = 0; d < NDIM; ++d)
                         {
-                            genrandn(W_ec_data->getArrayData(d), EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d));
+                            const Box<NDIM> ec_box = EdgeGeometry<NDIM>::toEdgeBox(W_ec_data->getBox(), d);
+                            if (d_use_counter_based_rng)
+                                RNG::genrandn(
+                                    W_ec_data->getArrayData(d), ec_box, d_rng_seed, step, level_num, stream + 1 + d);
+                            else
+                                genrandn(W_ec_data->getArrayData(d), ec_box);
                         }
 #endif
                     }
@@ -15,12 +15,19 @@
 
 #include "ibamr/RNG.h"
 
+#include "ArrayData.h"
+#include "Box.h"
+#include "CellData.h"
+#include "SideData.h"
+#include "SideGeometry.h"
 #include "tbox/PIO.h"
 #include "tbox/Utilities.h"
 
 #include <mpi.h>
 
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
@@ -320,6 +327,156 @@ RNG::parallel_seed(int global_seed)
     return;
 } // parallel_seed
 
+/*
+** Counter-based generation based on the Philox4x32-10 generator of Salmon et
+** al., "Parallel Random Numbers: As Easy as 1, 2, 3", Proceedings of SC11,
+** 2011.
+*/
+namespace
+{
+static const std::uint32_t PHILOX_M0 = 0xD2511F53;
+static const std::uint32_t PHILOX_M1 = 0xCD9E8D57;
+static const std::uint32_t PHILOX_W0 = 0x9E3779B9;
+static const std::uint32_t PHILOX_W1 = 0xBB67AE85;
+
+inline void
+philox_round(std::uint32_t& c0,
+             std::uint32_t& c1,
+             std::uint32_t& c2,
+             std::uint32_t& c3,
+             const std::uint32_t k0,
+             const std::uint32_t k1)
+{
+    const std::uint64_t p0 = static_cast<std::uint64_t>(PHILOX_M0) * c0;
+    const std::uint64_t p1 = static_cast<std::uint64_t>(PHILOX_M1) * c2;
+    const std::uint32_t hi0 = static_cast<std::uint32_t>(p0 >> 32), lo0 = static_cast<std::uint32_t>(p0);
+    const std::uint32_t hi1 = static_cast<std::uint32_t>(p1 >> 32), lo1 = static_cast<std::uint32_t>(p1);
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    return;
+} // philox_round
+
+inline void
+philox4x32_10(std::uint32_t& c0,
+              std::uint32_t& c1,
+              std::uint32_t& c2,
+              std::uint32_t& c3,
+              std::uint32_t k0,
+              std::uint32_t k1)
+{
+    for (int r = 0; r < 10; ++r)
+    {
+        if (r > 0)
+        {
+            k0 += PHILOX_W0;
+            k1 += PHILOX_W1;
+        }
+        philox_round(c0, c1, c2, c3, k0, k1);
+    }
+    return;
+} // philox4x32_10
+
+// Map 53 bits taken from two 32-bit words to a double in the open interval
+// (0,1).
+inline double
+uniform_open(const std::uint32_t hi, const std::uint32_t lo)
+{
+    return ((hi >> 5) * 67108864.0 + (lo >> 6) + 0.5) * (1.0 / 9007199254740992.0);
+} // uniform_open
+} // namespace
+
+std::array<std::uint32_t, 4>
+RNG::philox4x32(std::array<std::uint32_t, 4> ctr, const std::array<std::uint32_t, 2> key)
+{
+    philox4x32_10(ctr[0], ctr[1], ctr[2], ctr[3], key[0], key[1]);
+    return ctr;
+} // philox4x32
+
+void
+RNG::genrandn(ArrayData<NDIM, double>& data,
+              const Box<NDIM>& box,
+              const unsigned int seed,
+              const unsigned int step,
+              const unsigned int level_number,
+              const unsigned int stream)
+{
+    const Box<NDIM> fill_box = box * data.getBox();
+    if (fill_box.empty()) return;
+
+    // The counter is (i_0, i_1, i_2, component), in which i_2 = 0 in 2D and
+    // the component word packs together the stream, level, and depth.
+    const Box<NDIM>& data_box = data.getBox();
+    const int width0 = data_box.numberCells(0);
+    const int lower0 = fill_box.lower(0), upper0 = fill_box.upper(0);
+#if (NDIM == 3)
+    const int width1 = data_box.numberCells(1);
+#endif
+    for (int depth = 0; depth < data.getDepth(); ++depth)
+    {
+        const std::uint32_t component = ((stream & 0xffffu) << 16) | ((level_number & 0xffu) << 8) |
+                                        (static_cast<unsigned int>(depth) & 0xffu);
+        double* const data_ptr = data.getPointer(depth);
+#if (NDIM == 3)
+        for (int i2 = fill_box.lower(2); i2 <= fill_box.upper(2); ++i2)
+#endif
+        {
+            for (int i1 = fill_box.lower(1); i1 <= fill_box.upper(1); ++i1)
+            {
+#if (NDIM == 2)
+                const std::uint32_t c2 = 0;
+                const int row_offset = (i1 - data_box.lower(1)) * width0 - data_box.lower(0);
+#endif
+#if (NDIM == 3)
+                const std::uint32_t c2 = static_cast<std::uint32_t>(i2);
+                const int row_offset =
+                    ((i2 - data_box.lower(2)) * width1 + (i1 - data_box.lower(1))) * width0 - data_box.lower(0);
+#endif
+                for (int i0 = lower0; i0 <= upper0; ++i0)
+                {
+                    std::uint32_t r0 = static_cast<std::uint32_t>(i0), r1 = static_cast<std::uint32_t>(i1), r2 = c2,
+                                  r3 = component;
+                    philox4x32_10(r0, r1, r2, r3, seed, step);
+                    data_ptr[row_offset + i0] = InvNormDist(uniform_open(r0, r1));
+                }
+            }
+        }
+    }
+    return;
+} // genrandn
+
+void
+RNG::genrandn(CellData<NDIM, double>& data,
+              const unsigned int seed,
+              const unsigned int step,
+              const unsigned int level_number,
+              const unsigned int stream)
+{
+    genrandn(data.getArrayData(), data.getBox(), seed, step, level_number, stream);
+    return;
+} // genrandn
+
+void
+RNG::genrandn(SideData<NDIM, double>& data,
+              const unsigned int seed,
+              const unsigned int step,
+              const unsigned int level_number,
+              const unsigned int stream)
+{
+    for (unsigned int axis = 0; axis < NDIM; ++axis)
+    {
+        if (!data.getDirectionVector()(axis)) continue;
+        genrandn(data.getArrayData(axis),
+                 SideGeometry<NDIM>::toSideBox(data.getBox(), axis),
+                 seed,
+                 step,
+                 level_number,
+                 NDIM * stream + axis);
+    }
+    return;
+} // genrandn
+
 /////////////////////////////// NAMESPACE ////////////////////////////////////
 
 } // namespace IBAMR
@@ -29,6 +29,7 @@
 #include <ibamr/IBMethod.h>
 #include <ibamr/IBStandardForceGen.h>
 #include <ibamr/IBStandardInitializer.h>
+#include <ibamr/IBStructureBinaryFile.h>
 #include <ibamr/INSCollocatedHierarchyIntegrator.h>
 #include <ibamr/INSStaggeredHierarchyIntegrator.h>
 
@@ -158,6 +159,17 @@ main(int argc, char* argv[])
                                         box_generator,
                                         load_balancer);
 
+        // Optionally convert the structure to a binary structure file.
+        if (app_initializer->getComponentDatabase("IBStandardInitializer")
+                ->getBoolWithDefault("use_binary_structure_files", false))
+        {
+            if (IBTK_MPI::getRank() == 0)
+            {
+                IBStructureBinaryFile::convertASCIIFiles("curve2d_64", "curve2d_64.ibstruct");
+            }
+            IBTK_MPI::barrier();
+        }
+
         // Configure the IB solver.
         Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
             "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
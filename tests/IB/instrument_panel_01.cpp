@@ -0,0 +1,249 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Print the flow through a planar polygonal meter and the pressure on it
+// computed by IBInstrumentPanel, which are exact when the velocity and
+// pressure are linear functions. The grid is refined near the meter
+// perimeter, so the web of the meter is split between the levels of the patch
+// hierarchy.
+
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBInstrumentPanel.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// The meter is a regular polygon in the plane z = Z_METER.
+static const int NUM_PERIMETER_NODES = 16;
+static const double X_CENTER = 0.5, Y_CENTER = 0.5, Z_METER = 0.45, RADIUS = 0.2;
+
+// The velocity is linear and only its z-component, which is constant, is
+// normal to the meter.
+static const double W0 = 2.0;
+double
+velocity(const unsigned int axis, const double* const X)
+{
+    switch (axis)
+    {
+    case 0:
+        return 1.0 + X[1];
+    case 1:
+        return 2.0 - X[0];
+    default:
+        return W0;
+    }
+} // velocity
+
+double
+pressure(const double* const X)
+{
+    return 1.0 + 2.0 * X[0] - 3.0 * X[1] + 4.0 * X[2];
+} // pressure
+
+// Write the vertex and instrumentation files describing the meter perimeter.
+void
+generate_structure_file(const std::string& base_name)
+{
+    std::ofstream file(base_name + ".vertex");
+    file.precision(16);
+    file << NUM_PERIMETER_NODES << "\n";
+    for (int k = 0; k < NUM_PERIMETER_NODES; ++k)
+    {
+        const double theta = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(NUM_PERIMETER_NODES);
+        file << X_CENTER + RADIUS * std::cos(theta) << " " << Y_CENTER + RADIUS * std::sin(theta) << " " << Z_METER
+             << "\n";
+    }
+    file.close();
+
+    file.open(base_name + ".inst");
+    file << "1\n";
+    file << "meter\n";
+    file << NUM_PERIMETER_NODES << "\n";
+    for (int k = 0; k < NUM_PERIMETER_NODES; ++k) file << k << " 0 " << k << "\n";
+    file.close();
+    return;
+} // generate_structure_file
+
+// Set the velocity and pressure everywhere in the patch data, including the
+// ghost cells, so that the interpolation does not depend on ghost cell
+// filling.
+void
+fill_data(Pointer<PatchHierarchy<NDIM> > patch_hierarchy, const int u_idx, const int p_idx)
+{
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const hier::Index<NDIM>& patch_lower = patch->getBox().lower();
+            const Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+
+            Pointer<SideData<NDIM, double> > u_data = patch->getPatchData(u_idx);
+            for (unsigned int axis = 0; axis < NDIM; ++axis)
+            {
+                for (Box<NDIM>::Iterator b(SideGeometry<NDIM>::toSideBox(u_data->getGhostBox(), axis)); b; b++)
+                {
+                    const hier::Index<NDIM>& i = b();
+                    double X[NDIM];
+                    for (unsigned int d = 0; d < NDIM; ++d)
+                    {
+                        X[d] = x_lower[d] +
+                               dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + (d == axis ? 0.0 : 0.5));
+                    }
+                    (*u_data)(SideIndex<NDIM>(i, axis, SideIndex<NDIM>::Lower)) = velocity(axis, X);
+                }
+            }
+
+            Pointer<CellData<NDIM, double> > p_data = patch->getPatchData(p_idx);
+            for (Box<NDIM>::Iterator b(p_data->getGhostBox()); b; b++)
+            {
+                const hier::Index<NDIM>& i = b();
+                double X[NDIM];
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    X[d] = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_lower(d)) + 0.5);
+                }
+                (*p_data)(i) = pressure(X);
+            }
+        }
+    }
+    return;
+} // fill_data
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "instrument_panel_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        if (IBTK_MPI::getRank() == 0) generate_structure_file("meter");
+        IBTK_MPI::barrier();
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Create the velocity and pressure data read by the instrument panel.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<SideVariable<NDIM, double> > u_var = new SideVariable<NDIM, double>("u");
+        Pointer<CellVariable<NDIM, double> > p_var = new CellVariable<NDIM, double>("p");
+        const int u_idx = var_db->registerVariableAndContext(u_var, ctx, IntVector<NDIM>(1));
+        const int p_idx = var_db->registerVariableAndContext(p_var, ctx, IntVector<NDIM>(1));
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_idx, 0.0);
+            level->allocatePatchData(p_idx, 0.0);
+        }
+        fill_data(patch_hierarchy, u_idx, p_idx);
+
+        // Read the instruments.
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        Pointer<IBInstrumentPanel> instrument_panel = ib_method_ops->getIBInstrumentPanel();
+        instrument_panel->initializeHierarchyDependentData(patch_hierarchy, l_data_manager, 0, 0.0);
+        instrument_panel->readInstrumentData(u_idx, p_idx, patch_hierarchy, l_data_manager, 0, 0.0);
+
+        // The web of the meter exactly covers the polygon, so the flow is the
+        // normal velocity times the area of the polygon. The web is symmetric
+        // about the centroid, so the mean pressure of the linear pressure is
+        // its value at the centroid.
+        const double area =
+            0.5 * NUM_PERIMETER_NODES * RADIUS * RADIUS * std::sin(2.0 * M_PI / NUM_PERIMETER_NODES);
+        const double flow = W0 * area;
+        const double X_centroid[NDIM] = { X_CENTER, Y_CENTER, Z_METER };
+        const double pres = pressure(X_centroid);
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out.precision(12);
+            const std::vector<std::string>& names = instrument_panel->getInstrumentNames();
+            out << "number of levels: " << patch_hierarchy->getFinestLevelNumber() + 1 << "\n";
+            out << "number of meters: " << names.size() << "\n";
+            for (unsigned int m = 0; m < names.size(); ++m)
+            {
+                out << "meter " << m << ": " << names[m] << "\n";
+                out << "  flow:           " << instrument_panel->getFlowValues()[m] << " (exact: " << flow << ")\n";
+                out << "  mean pressure:  " << instrument_panel->getMeanPressureValues()[m] << " (exact: " << pres
+                    << ")\n";
+                out << "  point pressure: " << instrument_panel->getPointwisePressureValues()[m] << " (exact: " << pres
+                    << ")\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,223 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Check that streaming the nodes of an LIndexSetData object in bulk (via
+// LNodeTransferBuffer) produces the same nodes as the node-by-node
+// implementation provided by SAMRAI::pdat::IndexData.
+
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <Box.h>
+#include <BoxList.h>
+#include <CellOverlap.h>
+#include <IntVector.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBAnchorPointSpec.h>
+
+#include <ibtk/FixedSizedStream.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LIndexSetData.h>
+#include <ibtk/LNode.h>
+#include <ibtk/LNodeIndex.h>
+#include <ibtk/LSet.h>
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Create a node with some data that depends on the Lagrangian index.
+template <class T>
+Pointer<T> create_node(int lag_idx);
+
+template <>
+Pointer<LNodeIndex>
+create_node<LNodeIndex>(const int lag_idx)
+{
+    IntVector<NDIM> offset(0);
+    offset(0) = lag_idx % 3 - 1;
+    IBTK::Vector displacement = IBTK::Vector::Zero();
+    displacement[0] = 0.5 * static_cast<double>(offset(0));
+    return new LNodeIndex(lag_idx, 2 * lag_idx, lag_idx + 7, offset, offset, displacement, displacement);
+} // create_node
+
+template <>
+Pointer<LNode>
+create_node<LNode>(const int lag_idx)
+{
+    IntVector<NDIM> offset(0);
+    offset(NDIM - 1) = lag_idx % 2;
+    IBTK::Vector displacement = IBTK::Vector::Zero();
+    displacement[NDIM - 1] = 0.25 * static_cast<double>(offset(NDIM - 1));
+    std::vector<Pointer<Streamable> > node_data;
+    if (lag_idx % 4 == 0) node_data.push_back(new IBAnchorPointSpec(lag_idx));
+    return new LNode(
+        lag_idx, 2 * lag_idx, lag_idx + 7, IntVector<NDIM>(0), offset, IBTK::Vector::Zero(), displacement, node_data);
+} // create_node
+
+// Check that two nodes are identical.
+bool
+nodes_match(const LNodeIndex& a, const LNodeIndex& b)
+{
+    return a.getLagrangianIndex() == b.getLagrangianIndex() && a.getGlobalPETScIndex() == b.getGlobalPETScIndex() &&
+           a.getLocalPETScIndex() == b.getLocalPETScIndex() &&
+           a.getInitialPeriodicOffset() == b.getInitialPeriodicOffset() &&
+           a.getPeriodicOffset() == b.getPeriodicOffset() &&
+           a.getInitialPeriodicDisplacement() == b.getInitialPeriodicDisplacement() &&
+           a.getPeriodicDisplacement() == b.getPeriodicDisplacement();
+} // nodes_match
+
+bool
+nodes_match(const LNode& a, const LNode& b)
+{
+    if (!nodes_match(static_cast<const LNodeIndex&>(a), static_cast<const LNodeIndex&>(b))) return false;
+    if (a.getNodeData().size() != b.getNodeData().size()) return false;
+    const IBAnchorPointSpec* const a_spec = a.getNodeDataItem<IBAnchorPointSpec>();
+    const IBAnchorPointSpec* const b_spec = b.getNodeDataItem<IBAnchorPointSpec>();
+    if (!a_spec || !b_spec) return !a_spec && !b_spec;
+    return a_spec->getNodeIndex() == b_spec->getNodeIndex();
+} // nodes_match
+
+// Count the nodes in a and the nodes that are not stored identically in the
+// same cells of a and b.
+template <class T>
+int
+count_mismatches(const LIndexSetData<T>& a, const LIndexSetData<T>& b, int& num_nodes)
+{
+    num_nodes = 0;
+    int num_mismatches = 0;
+    for (Box<NDIM>::Iterator bi(a.getGhostBox()); bi; bi++)
+    {
+        const hier::Index<NDIM>& i = bi();
+        const LSet<T>* const a_set = a.getItem(i);
+        const LSet<T>* const b_set = b.getItem(i);
+        const int a_size = a_set ? static_cast<int>(a_set->size()) : 0;
+        const int b_size = b_set ? static_cast<int>(b_set->size()) : 0;
+        num_nodes += a_size;
+        if (a_size != b_size || (a_set && b_set && a_set->getPeriodicOffset() != b_set->getPeriodicOffset()))
+        {
+            num_mismatches += std::max(a_size, b_size);
+            continue;
+        }
+        for (int k = 0; k < a_size; ++k)
+        {
+            if (!nodes_match(*(*a_set)[k], *(*b_set)[k])) ++num_mismatches;
+        }
+    }
+    return num_mismatches;
+} // count_mismatches
+
+// Fill a patch data object with a varying number of nodes per cell, leaving
+// some cells empty.
+template <class T>
+void
+fill_data(LIndexSetData<T>& data)
+{
+    int lag_idx = 0, cell = 0;
+    for (Box<NDIM>::Iterator bi(data.getGhostBox()); bi; bi++, ++cell)
+    {
+        const int num_nodes = cell % 4;
+        if (num_nodes == 0) continue;
+        auto node_set = new LSet<T>();
+        for (int k = 0; k < num_nodes; ++k) node_set->push_back(create_node<T>(lag_idx++));
+        data.appendItemPointer(bi(), node_set);
+    }
+    return;
+} // fill_data
+
+// Stream the nodes in the overlaps from src to two destination objects, one
+// using LIndexSetData and the other the default implementation of IndexData.
+// As in a SAMRAI communication schedule, the stream sizes of all of the
+// overlaps are computed before any of them are packed.
+template <class T>
+void
+test_round_trip(std::ofstream& out, const std::string& name)
+{
+    const IntVector<NDIM> ghosts(1);
+    const Box<NDIM> src_box(hier::Index<NDIM>(0), hier::Index<NDIM>(7));
+    IntVector<NDIM> src_offset(0);
+    src_offset(0) = 16;
+    const Box<NDIM> dst_box = Box<NDIM>::shift(src_box, src_offset);
+
+    LIndexSetData<T> src_data(src_box, ghosts);
+    fill_data(src_data);
+
+    std::vector<Pointer<BoxOverlap<NDIM> > > overlaps;
+    for (int k = 0; k < 2; ++k)
+    {
+        Box<NDIM> overlap_box = dst_box;
+        overlap_box.lower(0) = dst_box.lower(0) + 4 * k;
+        overlap_box.upper(0) = dst_box.lower(0) + 4 * k + 3;
+        overlaps.push_back(new CellOverlap<NDIM>(BoxList<NDIM>(overlap_box), src_offset));
+    }
+
+    int bulk_size = 0, reference_size = 0;
+    for (const auto& overlap : overlaps)
+    {
+        bulk_size += src_data.getDataStreamSize(*overlap);
+        reference_size += src_data.LSetData<T>::getDataStreamSize(*overlap);
+    }
+
+    FixedSizedStream bulk_stream(bulk_size), reference_stream(reference_size);
+    for (const auto& overlap : overlaps)
+    {
+        src_data.packStream(bulk_stream, *overlap);
+        src_data.LSetData<T>::packStream(reference_stream, *overlap);
+    }
+
+    LIndexSetData<T> bulk_data(dst_box, ghosts), reference_data(dst_box, ghosts);
+    FixedSizedStream bulk_unpack_stream(bulk_stream.getBufferStart(), bulk_stream.getCurrentSize());
+    FixedSizedStream reference_unpack_stream(reference_stream.getBufferStart(), reference_stream.getCurrentSize());
+    for (const auto& overlap : overlaps)
+    {
+        bulk_data.unpackStream(bulk_unpack_stream, *overlap);
+        reference_data.LSetData<T>::unpackStream(reference_unpack_stream, *overlap);
+    }
+
+    int num_nodes = 0;
+    const int num_mismatches = count_mismatches(bulk_data, reference_data, num_nodes);
+    out << name << ": nodes transferred: " << num_nodes << "\n";
+    out << name << ": nodes differing from node-by-node transfer: " << num_mismatches << "\n";
+
+    // Packing without first computing the stream size must gather the nodes
+    // again and produce the same data.
+    FixedSizedStream repack_stream(bulk_size);
+    for (const auto& overlap : overlaps) src_data.packStream(repack_stream, *overlap);
+    LIndexSetData<T> repack_data(dst_box, ghosts);
+    FixedSizedStream repack_unpack_stream(repack_stream.getBufferStart(), repack_stream.getCurrentSize());
+    for (const auto& overlap : overlaps) repack_data.unpackStream(repack_unpack_stream, *overlap);
+    const int num_repack_mismatches = count_mismatches(repack_data, reference_data, num_nodes);
+    out << name << ": nodes differing from node-by-node transfer when packed again: " << num_repack_mismatches
+        << "\n";
+    return;
+} // test_round_trip
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    IBAnchorPointSpec::registerWithStreamableManager();
+
+    if (IBTK_MPI::getRank() == 0)
+    {
+        std::ofstream out("output");
+        test_round_trip<LNodeIndex>(out, "LNodeIndex");
+        test_round_trip<LNode>(out, "LNode");
+    }
+} // main
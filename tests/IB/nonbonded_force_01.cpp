@@ -0,0 +1,232 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+#include <ibamr/NonbondedForceEvaluator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+#include <algorithm>
+#include <cmath>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that NonbondedForceEvaluator computes the same forces with a neighbor
+// list, using either the pointwise or the batched force function, as it does
+// by searching all pairs of nearby nodes. The nodes are moved twice: first by
+// less than half of the neighbor list skin, so that the list is reused, and
+// then by more, so that it has to be rebuilt.
+
+// A soft repulsive force that vanishes at distances larger than params[1].
+void
+soft_repulsion(double* D, const Array<double> params, double* out_force)
+{
+    double r = 0.0;
+    for (int k = 0; k < NDIM; ++k) r += D[k] * D[k];
+    r = std::sqrt(r);
+    const double f = (r > 0.0 && r < params[1]) ? params[0] * (1.0 - r / params[1]) / r : 0.0;
+    for (int k = 0; k < NDIM; ++k) out_force[k] = f * D[k];
+}
+
+void
+soft_repulsion_batch(const int num_pairs,
+                     const double* const* D,
+                     const Array<double>& params,
+                     double* const* out_force)
+{
+    for (int l = 0; l < num_pairs; ++l)
+    {
+        double r = 0.0;
+        for (int k = 0; k < NDIM; ++k) r += D[k][l] * D[k][l];
+        r = std::sqrt(r);
+        const double f = (r > 0.0 && r < params[1]) ? params[0] * (1.0 - r / params[1]) / r : 0.0;
+        for (int k = 0; k < NDIM; ++k) out_force[k][l] = f * D[k][l];
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    {
+        std::ifstream structure_vertex_stream(SOURCE_DIR "/curve2d_64.vertex");
+        std::ofstream structure_vertex_cwd("curve2d_64.vertex");
+        structure_vertex_cwd << structure_vertex_stream.rdbuf();
+        std::ifstream structure_spring_stream(SOURCE_DIR "/curve2d_64.spring");
+        std::ofstream structure_spring_cwd("curve2d_64.spring");
+        structure_spring_cwd << structure_spring_stream.rdbuf();
+    }
+
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+#ifndef IBTK_HAVE_SILO
+    // Suppress warnings caused by running without silo
+    SAMRAI::tbox::Logger::getInstance()->setWarning(false);
+#endif
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Set up one force evaluator that searches all nearby pairs and two
+        // that use neighbor lists.
+        Pointer<NonbondedForceEvaluator> all_pairs_evaluator = new NonbondedForceEvaluator(
+            app_initializer->getComponentDatabase("AllPairsForceEvaluator"), grid_geometry);
+        all_pairs_evaluator->registerForceFcnPtr(&soft_repulsion);
+        Pointer<NonbondedForceEvaluator> pointwise_evaluator = new NonbondedForceEvaluator(
+            app_initializer->getComponentDatabase("NeighborListForceEvaluator"), grid_geometry);
+        pointwise_evaluator->registerForceFcnPtr(&soft_repulsion);
+        Pointer<NonbondedForceEvaluator> batch_evaluator = new NonbondedForceEvaluator(
+            app_initializer->getComponentDatabase("NeighborListForceEvaluator"), grid_geometry);
+        batch_evaluator->registerBatchForceFcnPtr(&soft_repulsion_batch);
+        std::vector<Pointer<NonbondedForceEvaluator> > evaluators = { all_pairs_evaluator,
+                                                                      pointwise_evaluator,
+                                                                      batch_evaluator };
+        const std::vector<std::string> evaluator_names = { "all pairs", "neighbor list", "batched neighbor list" };
+
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<LData> X_data = l_data_manager->getLData("X", ln);
+        Pointer<LData> U_data;
+        std::vector<Pointer<LData> > F_data(evaluators.size());
+        for (unsigned int i = 0; i < evaluators.size(); ++i)
+        {
+            evaluators[i]->initializeLevelData(patch_hierarchy, ln, 0.0, true, l_data_manager);
+            F_data[i] = l_data_manager->createLData("F_" + std::to_string(i), ln, NDIM);
+        }
+
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+        const double dx = grid_geometry->getDx()[0];
+        const std::vector<double> displacements = { 0.0, 0.2 * dx, 0.8 * dx };
+        for (const double displacement : displacements)
+        {
+            // Move the nodes. Ghost copies of the nodes move in the same way
+            // since the displacement only depends on the original position.
+            {
+                boost::multi_array_ref<double, 2>& X_array = *X_data->getGhostedLocalFormVecArray();
+                double* const X = X_array.data();
+                for (std::size_t i = 0; i < X_array.num_elements(); i += NDIM)
+                {
+                    const double X0 = X[i], X1 = X[i + 1];
+                    X[i] += displacement * std::sin(2.0 * M_PI * X1);
+                    X[i + 1] += displacement * std::cos(2.0 * M_PI * X0);
+                }
+                X_data->restoreArrays();
+            }
+
+            for (unsigned int i = 0; i < evaluators.size(); ++i)
+            {
+                boost::multi_array_ref<double, 2>& F_array = *F_data[i]->getGhostedLocalFormVecArray();
+                std::fill(F_array.data(), F_array.data() + F_array.num_elements(), 0.0);
+                F_data[i]->restoreArrays();
+                evaluators[i]->computeLagrangianForce(
+                    F_data[i], X_data, U_data, patch_hierarchy, ln, 0.0, l_data_manager);
+            }
+
+            // Compare the forces (including the contributions to ghost nodes,
+            // which are accumulated in the same way by all evaluators). The
+            // relative differences are not finite if the forces vanish.
+            const boost::multi_array_ref<double, 2>& F_ref_array = *F_data[0]->getGhostedLocalFormVecArray();
+            const double* const F_ref = F_ref_array.data();
+            double max_force = 0.0;
+            for (std::size_t j = 0; j < F_ref_array.num_elements(); ++j)
+            {
+                max_force = std::max(max_force, std::abs(F_ref[j]));
+            }
+            max_force = IBTK_MPI::maxReduction(max_force);
+            pout << "displacement = " << displacement / dx << " dx: max |F| = " << max_force << "\n";
+            out << "displacement = " << displacement / dx << " dx\n";
+            for (unsigned int i = 1; i < evaluators.size(); ++i)
+            {
+                const double* const F = F_data[i]->getGhostedLocalFormVecArray()->data();
+                double max_error = 0.0;
+                for (std::size_t j = 0; j < F_ref_array.num_elements(); ++j)
+                {
+                    max_error = std::max(max_error, std::abs(F[j] - F_ref[j]));
+                }
+                max_error = IBTK_MPI::maxReduction(max_error);
+                F_data[i]->restoreArrays();
+                out << "|F_" << evaluator_names[i] << " - F_" << evaluator_names[0] << "|_oo / |F_"
+                    << evaluator_names[0] << "|_oo = " << max_error / max_force << "\n";
+            }
+            F_data[0]->restoreArrays();
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,271 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Advect a block of force-free IB points with a uniform flow on a locally
+// refined patch hierarchy twice: once fully regridding the patch hierarchy
+// whenever the points have moved far enough and once only rebinning the
+// Lagrangian data, which redistributes the LNodeSetData of the points on the
+// unchanged patch hierarchy. Print the number of regrids and rebins, the
+// bounding box of the final points, and the difference between the final
+// positions of both runs.
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Write the vertex file of a uniform lattice of points filling a rectangle.
+// The points are not connected by any springs, so they move with the flow.
+void
+generate_structure_file(Pointer<Database> input_db, const std::string& base_name)
+{
+    const double x_lo = input_db->getDouble("BLOCK_X_LO"), x_up = input_db->getDouble("BLOCK_X_UP");
+    const double y_lo = input_db->getDouble("BLOCK_Y_LO"), y_up = input_db->getDouble("BLOCK_Y_UP");
+    const int n_points = input_db->getInteger("BLOCK_N_POINTS");
+    std::ofstream file(base_name + ".vertex");
+    file.precision(16);
+    file << n_points * n_points << "\n";
+    for (int j = 0; j < n_points; ++j)
+    {
+        for (int i = 0; i < n_points; ++i)
+        {
+            file << x_lo + (x_up - x_lo) * static_cast<double>(i) / static_cast<double>(n_points - 1) << " "
+                 << y_lo + (y_up - y_lo) * static_cast<double>(j) / static_cast<double>(n_points - 1) << "\n";
+        }
+    }
+    return;
+} // generate_structure_file
+
+// An integrator that records whether each regrid rebins the Lagrangian data
+// or regrids the patch hierarchy.
+class CountingIBHierarchyIntegrator : public IBExplicitHierarchyIntegrator
+{
+public:
+    using IBExplicitHierarchyIntegrator::IBExplicitHierarchyIntegrator;
+
+    void regridHierarchy() override
+    {
+        if (canRebinLagrangianData())
+            ++d_num_rebins;
+        else
+            ++d_num_regrids;
+        IBExplicitHierarchyIntegrator::regridHierarchy();
+    }
+
+    int d_num_regrids = 0;
+    int d_num_rebins = 0;
+};
+
+struct RunResult
+{
+    std::vector<double> X;
+    std::array<double, NDIM> X_lower, X_upper;
+    int num_regrids = 0;
+    int num_rebins = 0;
+};
+
+// Run the simulation with the specified rebinning option. All objects are
+// given names with the specified prefix so that both runs can coexist in the
+// variable database.
+RunResult
+run_simulation(Pointer<AppInitializer> app_initializer, const std::string& prefix, const bool rebin_lagrangian_data)
+{
+    Pointer<Database> ib_hierarchy_integrator_db = app_initializer->getComponentDatabase("IBHierarchyIntegrator");
+    ib_hierarchy_integrator_db->putBool("rebin_lagrangian_data", rebin_lagrangian_data);
+
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        prefix + "::CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>(prefix + "::PatchHierarchy", grid_geometry, false);
+    Pointer<LoadBalancer<NDIM> > load_balancer = new LoadBalancer<NDIM>(
+        prefix + "::LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator =
+        new INSStaggeredHierarchyIntegrator(prefix + "::INSStaggeredHierarchyIntegrator",
+                                            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+                                            /*register_for_restart*/ false);
+    Pointer<IBMethod> ib_method_ops = new IBMethod(prefix + "::IBMethod",
+                                                   app_initializer->getComponentDatabase("IBMethod"),
+                                                   /*register_for_restart*/ false);
+    Pointer<CountingIBHierarchyIntegrator> time_integrator =
+        new CountingIBHierarchyIntegrator(prefix + "::IBHierarchyIntegrator",
+                                          ib_hierarchy_integrator_db,
+                                          ib_method_ops,
+                                          navier_stokes_integrator,
+                                          /*register_for_restart*/ false);
+    time_integrator->registerLoadBalancer(load_balancer);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>(prefix + "::StandardTagAndInitialize",
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>(prefix + "::GriddingAlgorithm",
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+
+    // Configure the IB solver.
+    Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+        prefix + "::IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+    ib_method_ops->registerLInitStrategy(ib_initializer);
+
+    // The domain is periodic, so only the initial velocity is needed.
+    Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+        "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+    navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+    // Initialize hierarchy configuration and data on all patches.
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+    ib_method_ops->freeLInitStrategy();
+    ib_initializer.setNull();
+
+    // Main time step loop.
+    double loop_time = time_integrator->getIntegratorTime();
+    const double loop_time_end = time_integrator->getEndTime();
+    while (!IBTK::rel_equal_eps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+    {
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+        loop_time += dt;
+    }
+
+    // Gather the positions in Lagrangian index order, which does not depend on
+    // how the points are distributed.
+    RunResult result;
+    LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+    const int ln = patch_hierarchy->getFinestLevelNumber();
+    Vec X_petsc_vec = l_data_manager->getLData(LDataManager::POSN_DATA_NAME, ln)->getVec();
+    Vec X_lag_vec, X_all_vec;
+    int ierr = VecDuplicate(X_petsc_vec, &X_lag_vec);
+    IBTK_CHKERRQ(ierr);
+    l_data_manager->scatterPETScToLagrangian(X_petsc_vec, X_lag_vec, ln);
+    for (unsigned int d = 0; d < NDIM; ++d)
+    {
+        ierr = VecStrideMin(X_lag_vec, d, nullptr, &result.X_lower[d]);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecStrideMax(X_lag_vec, d, nullptr, &result.X_upper[d]);
+        IBTK_CHKERRQ(ierr);
+    }
+    VecScatter ctx;
+    ierr = VecScatterCreateToAll(X_lag_vec, &ctx, &X_all_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterBegin(ctx, X_lag_vec, X_all_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterEnd(ctx, X_lag_vec, X_all_vec, INSERT_VALUES, SCATTER_FORWARD);
+    IBTK_CHKERRQ(ierr);
+    PetscInt size;
+    ierr = VecGetSize(X_all_vec, &size);
+    IBTK_CHKERRQ(ierr);
+    const PetscScalar* X_all;
+    ierr = VecGetArrayRead(X_all_vec, &X_all);
+    IBTK_CHKERRQ(ierr);
+    result.X.assign(X_all, X_all + size);
+    ierr = VecRestoreArrayRead(X_all_vec, &X_all);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecScatterDestroy(&ctx);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&X_all_vec);
+    IBTK_CHKERRQ(ierr);
+    ierr = VecDestroy(&X_lag_vec);
+    IBTK_CHKERRQ(ierr);
+
+    result.num_regrids = time_integrator->d_num_regrids;
+    result.num_rebins = time_integrator->d_num_rebins;
+    return result;
+} // run_simulation
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    PetscOptionsSetValue(nullptr, "-stokes_ksp_atol", "1e-14");
+    PetscOptionsSetValue(nullptr, "-stokes_ksp_rtol", "1e-14");
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "rebin_lagrangian_data_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        if (IBTK_MPI::getRank() == 0) generate_structure_file(input_db, "block");
+        IBTK_MPI::barrier();
+
+        const RunResult regrid_result = run_simulation(app_initializer, "regrid", false);
+        const RunResult rebin_result = run_simulation(app_initializer, "rebin", true);
+
+        // Compare the final point positions.
+        double max_diff = regrid_result.X.size() == rebin_result.X.size() ? 0.0 : 1.0;
+        for (std::size_t i = 0; i < std::min(regrid_result.X.size(), rebin_result.X.size()); ++i)
+        {
+            max_diff = std::max(max_diff, std::abs(regrid_result.X[i] - rebin_result.X[i]));
+        }
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            const std::array<std::pair<std::string, const RunResult*>, 2> results = {
+                std::make_pair(std::string("full regrid run"), &regrid_result),
+                std::make_pair(std::string("rebinning run"), &rebin_result)
+            };
+            for (const auto& result : results)
+            {
+                out << result.first << ":\n";
+                out << "  number of regrids: " << result.second->num_regrids << "\n";
+                out << "  number of rebins:  " << result.second->num_rebins << "\n";
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    out << "  structure extent in direction " << d << ": [" << result.second->X_lower[d] << ", "
+                        << result.second->X_upper[d] << "]\n";
+                }
+            }
+            out << "max difference between the structure positions: " << max_diff << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,242 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBMethod.h>
+#include <ibamr/IBStandardForceGen.h>
+#include <ibamr/IBStandardInitializer.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LDataManager.h>
+
+#include <cmath>
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Verify that IBStandardForceGen computes the same spring forces when springs
+// with several different force functions are evaluated in batches as when
+// every spring is evaluated by its pointwise force function. The structure is
+// a stretched ring whose consecutive springs cycle through the default linear
+// force function (which has a built-in batched version), a user-defined force
+// function without a batched version, and a user-defined force function with
+// a batched version. The norms of the forces and the difference between the
+// two evaluations are printed.
+
+// The ring is a regular polygon whose springs are stretched.
+static const int NUM_NODES = 64;
+static const double X_CENTER = 0.5, Y_CENTER = 0.5, RADIUS = 0.25;
+static const double STIFFNESS = 1.0, REST_LENGTH_FRACTION = 0.8, CUBIC_STIFFNESS = 1.0e4;
+
+// A spring with an additional cubic term whose coefficient is params[2].
+double
+cubic_spring_force(double R, const double* params, int /*lag_mastr_idx*/, int /*lag_slave_idx*/)
+{
+    const double dR = R - params[1];
+    return params[0] * dR + params[2] * dR * dR * dR;
+} // cubic_spring_force
+
+// A spring whose tension grows logarithmically with its length.
+double
+log_spring_force(double R, const double* params, int /*lag_mastr_idx*/, int /*lag_slave_idx*/)
+{
+    return params[0] * params[1] * std::log(R / params[1]);
+} // log_spring_force
+
+void
+log_spring_force_batch(const int n,
+                       const double* const R,
+                       const double* const* const params,
+                       const int* const /*lag_mastr_idxs*/,
+                       const int* const /*lag_slave_idxs*/,
+                       double* const T)
+{
+    for (int k = 0; k < n; ++k)
+    {
+        // Springs of zero length may be passed in; their tensions are
+        // discarded.
+        T[k] = R[k] > 0.0 ? params[k][0] * params[k][1] * std::log(R[k] / params[k][1]) : 0.0;
+    }
+    return;
+} // log_spring_force_batch
+
+// Write the vertex and spring files describing the ring. Spring k connects
+// nodes k and k + 1 and uses force function k % 3.
+void
+generate_structure_file(const std::string& base_name)
+{
+    const double chord = 2.0 * RADIUS * std::sin(M_PI / static_cast<double>(NUM_NODES));
+    std::ofstream file(base_name + ".vertex");
+    file.precision(16);
+    file << NUM_NODES << "\n";
+    for (int k = 0; k < NUM_NODES; ++k)
+    {
+        const double theta = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(NUM_NODES);
+        file << X_CENTER + RADIUS * std::cos(theta) << " " << Y_CENTER + RADIUS * std::sin(theta) << "\n";
+    }
+    file.close();
+
+    file.open(base_name + ".spring");
+    file.precision(16);
+    file << NUM_NODES << "\n";
+    for (int k = 0; k < NUM_NODES; ++k)
+    {
+        file << k << " " << (k + 1) % NUM_NODES << " " << STIFFNESS << " " << REST_LENGTH_FRACTION * chord << " "
+             << k % 3;
+        if (k % 3 == 1) file << " " << CUBIC_STIFFNESS;
+        file << "\n";
+    }
+    file.close();
+    return;
+} // generate_structure_file
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+#ifndef IBTK_HAVE_SILO
+    // Suppress warnings caused by running without silo
+    SAMRAI::tbox::Logger::getInstance()->setWarning(false);
+#endif
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"));
+        Pointer<IBMethod> ib_method_ops = new IBMethod("IBMethod", app_initializer->getComponentDatabase("IBMethod"));
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator);
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Configure the IB solver.
+        if (IBTK_MPI::getRank() == 0) generate_structure_file("ring");
+        IBTK_MPI::barrier();
+        Pointer<IBStandardInitializer> ib_initializer = new IBStandardInitializer(
+            "IBStandardInitializer", app_initializer->getComponentDatabase("IBStandardInitializer"));
+        ib_method_ops->registerLInitStrategy(ib_initializer);
+
+        // Initialize hierarchy configuration and data on all patches.
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Deallocate initialization objects.
+        ib_method_ops->freeLInitStrategy();
+        ib_initializer.setNull();
+
+        // Set up one force generator that evaluates the springs in batches
+        // wherever a batched force function is available and one that
+        // evaluates every spring by its pointwise force function.
+        Pointer<IBStandardForceGen> batched_force_gen = new IBStandardForceGen();
+        batched_force_gen->registerSpringForceFunction(1, &cubic_spring_force);
+        batched_force_gen->registerSpringForceFunction(2, &log_spring_force, nullptr, &log_spring_force_batch);
+        Pointer<IBStandardForceGen> pointwise_force_gen = new IBStandardForceGen();
+        pointwise_force_gen->registerSpringForceFunction(0, &default_spring_force);
+        pointwise_force_gen->registerSpringForceFunction(1, &cubic_spring_force);
+        pointwise_force_gen->registerSpringForceFunction(2, &log_spring_force);
+        const std::vector<Pointer<IBStandardForceGen> > force_gens = { batched_force_gen, pointwise_force_gen };
+        const std::vector<std::string> force_gen_names = { "batched", "pointwise" };
+
+        LDataManager* l_data_manager = ib_method_ops->getLDataManager();
+        const int ln = patch_hierarchy->getFinestLevelNumber();
+        Pointer<LData> X_data = l_data_manager->getLData("X", ln);
+        Pointer<LData> U_data = l_data_manager->createLData("U", ln, NDIM);
+        std::vector<Pointer<LData> > F_data(force_gens.size());
+        int ierr;
+        for (unsigned int i = 0; i < force_gens.size(); ++i)
+        {
+            force_gens[i]->initializeLevelData(patch_hierarchy, ln, 0.0, true, l_data_manager);
+            F_data[i] = l_data_manager->createLData("F_" + std::to_string(i), ln, NDIM);
+            ierr = VecSet(F_data[i]->getVec(), 0.0);
+            IBTK_CHKERRQ(ierr);
+            force_gens[i]->computeLagrangianForce(F_data[i], X_data, U_data, patch_hierarchy, ln, 0.0, l_data_manager);
+        }
+
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+        out.precision(10);
+        for (unsigned int i = 0; i < force_gens.size(); ++i)
+        {
+            double F_norm_2, F_norm_max;
+            ierr = VecNorm(F_data[i]->getVec(), NORM_2, &F_norm_2);
+            IBTK_CHKERRQ(ierr);
+            ierr = VecNorm(F_data[i]->getVec(), NORM_INFINITY, &F_norm_max);
+            IBTK_CHKERRQ(ierr);
+            out << force_gen_names[i] << " spring forces:\n";
+            out << "  L2 norm:  " << F_norm_2 << "\n";
+            out << "  max norm: " << F_norm_max << "\n";
+        }
+
+        // The batched and pointwise forces agree up to roundoff.
+        Vec diff_vec;
+        ierr = VecDuplicate(F_data[0]->getVec(), &diff_vec);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecWAXPY(diff_vec, -1.0, F_data[1]->getVec(), F_data[0]->getVec());
+        IBTK_CHKERRQ(ierr);
+        double diff_norm_max, F_norm_max;
+        ierr = VecNorm(diff_vec, NORM_INFINITY, &diff_norm_max);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecNorm(F_data[1]->getVec(), NORM_INFINITY, &F_norm_max);
+        IBTK_CHKERRQ(ierr);
+        ierr = VecDestroy(&diff_vec);
+        IBTK_CHKERRQ(ierr);
+        out << "relative max norm of the difference: " << diff_norm_max / F_norm_max << "\n";
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
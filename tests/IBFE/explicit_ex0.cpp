@@ -94,6 +94,35 @@ PK1_stress_function(TensorValue<double>& PP,
     }
     return;
 } // PK1_stress_function
+
+// Batched version of the same stress tensor function.  The data of each
+// tensor component are stored contiguously for all quadrature points.
+void
+PK1_stress_batch_function(double* PP,
+                          const double* FF,
+                          const double* /*x*/,
+                          const double* /*X*/,
+                          const unsigned int n_qp,
+                          Elem* const /*elem*/,
+                          const std::vector<const double*>& /*var_data*/,
+                          const std::vector<const double*>& /*grad_var_data*/,
+                          double /*time*/,
+                          void* /*ctx*/)
+{
+    for (unsigned int k = 0; k < NDIM * NDIM * n_qp; ++k)
+    {
+        PP[k] = (mu / w) * FF[k];
+    }
+    if (smooth_case)
+    {
+        for (unsigned int qp = 0; qp < n_qp; ++qp)
+        {
+            PP[(0 * NDIM + 1) * n_qp + qp] = 0.0;
+            PP[(1 * NDIM + 1) * n_qp + qp] = 0.0;
+        }
+    }
+    return;
+} // PK1_stress_batch_function
 } // namespace ModelData
 using namespace ModelData;
 
@@ -265,7 +294,14 @@ main(int argc, char** argv)
         ib_method_ops->initializeFEEquationSystems();
         FEDataManager* fe_data_manager = ib_method_ops->getFEDataManager();
         ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
-        ib_method_ops->registerPK1StressFunction(PK1_stress_function);
+        if (input_db->getBoolWithDefault("USE_BATCHED_PK1_STRESS", false))
+        {
+            ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData::batched(PK1_stress_batch_function));
+        }
+        else
+        {
+            ib_method_ops->registerPK1StressFunction(PK1_stress_function);
+        }
         if (input_db->getBoolWithDefault("ELIMINATE_PRESSURE_JUMPS", false))
         {
             ib_method_ops->registerStressNormalizationPart();
@@ -0,0 +1,285 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Advect a stress-free elastic block with a uniform flow on a locally refined
+// patch hierarchy twice: once fully regridding the patch hierarchy whenever
+// the structure has moved far enough and once only rebinning the Lagrangian
+// data. Print the number of regrids and rebins, the bounding box of the final
+// structure, and the difference between the final positions of both runs.
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+#include <libmesh/node.h>
+#include <libmesh/numeric_vector.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/StableCentroidPartitioner.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Elasticity model data.
+namespace ModelData
+{
+static double c1_s = 0.05;
+static double p0_s = 0.0;
+static double beta_s = 0.0;
+
+void
+PK1_dev_stress_function(TensorValue<double>& PP,
+                        const TensorValue<double>& FF,
+                        const libMesh::Point& /*X*/,
+                        const libMesh::Point& /*s*/,
+                        Elem* const /*elem*/,
+                        const vector<const vector<double>*>& /*var_data*/,
+                        const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                        double /*time*/,
+                        void* /*ctx*/)
+{
+    PP = 2.0 * c1_s * FF;
+    return;
+} // PK1_dev_stress_function
+
+void
+PK1_dil_stress_function(TensorValue<double>& PP,
+                        const TensorValue<double>& FF,
+                        const libMesh::Point& /*X*/,
+                        const libMesh::Point& /*s*/,
+                        Elem* const /*elem*/,
+                        const vector<const vector<double>*>& /*var_data*/,
+                        const vector<const vector<VectorValue<double> >*>& /*grad_var_data*/,
+                        double /*time*/,
+                        void* /*ctx*/)
+{
+    PP = 2.0 * (-p0_s + beta_s * log(FF.det())) * tensor_inverse_transpose(FF, NDIM);
+    return;
+} // PK1_dil_stress_function
+} // namespace ModelData
+using namespace ModelData;
+
+// An integrator that records whether each regrid rebins the Lagrangian data
+// or regrids the patch hierarchy.
+class CountingIBHierarchyIntegrator : public IBExplicitHierarchyIntegrator
+{
+public:
+    using IBExplicitHierarchyIntegrator::IBExplicitHierarchyIntegrator;
+
+    void regridHierarchy() override
+    {
+        if (canRebinLagrangianData())
+            ++d_num_rebins;
+        else
+            ++d_num_regrids;
+        IBExplicitHierarchyIntegrator::regridHierarchy();
+    }
+
+    int d_num_regrids = 0;
+    int d_num_rebins = 0;
+};
+
+struct RunResult
+{
+    std::vector<double> X;
+    std::array<double, NDIM> X_lower, X_upper;
+    int num_regrids = 0;
+    int num_rebins = 0;
+};
+
+// Run the simulation with the specified rebinning option. All objects are
+// given names with the specified prefix so that both runs can coexist in the
+// variable database.
+RunResult
+run_simulation(Pointer<AppInitializer> app_initializer,
+               const LibMeshInit& init,
+               const std::string& prefix,
+               const bool rebin_lagrangian_data)
+{
+    Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+    // Create a block discretized by triangles.
+    ReplicatedMesh mesh(init.comm(), NDIM);
+    const double x_lo = input_db->getDouble("BLOCK_X_LO"), x_up = input_db->getDouble("BLOCK_X_UP");
+    const double y_lo = input_db->getDouble("BLOCK_Y_LO"), y_up = input_db->getDouble("BLOCK_Y_UP");
+    const int n_elems = input_db->getInteger("BLOCK_N_ELEMS");
+    MeshTools::Generation::build_square(mesh, n_elems, n_elems, x_lo, x_up, y_lo, y_up, libMesh::TRI3);
+    IBTK::StableCentroidPartitioner partitioner;
+    partitioner.partition(mesh);
+
+    Pointer<Database> ib_hierarchy_integrator_db = app_initializer->getComponentDatabase("IBHierarchyIntegrator");
+    ib_hierarchy_integrator_db->putBool("rebin_lagrangian_data", rebin_lagrangian_data);
+
+    Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+        prefix + "::CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+        new PatchHierarchy<NDIM>(prefix + "::PatchHierarchy", grid_geometry, false);
+    Pointer<LoadBalancer<NDIM> > load_balancer = new LoadBalancer<NDIM>(
+        prefix + "::LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+    Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+    Pointer<INSHierarchyIntegrator> navier_stokes_integrator =
+        new INSStaggeredHierarchyIntegrator(prefix + "::INSStaggeredHierarchyIntegrator",
+                                            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+                                            /*register_for_restart*/ false);
+    Pointer<IBFEMethod> ib_method_ops =
+        new IBFEMethod(prefix + "::IBFEMethod",
+                       app_initializer->getComponentDatabase("IBFEMethod"),
+                       &mesh,
+                       app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                       /*register_for_restart*/ false);
+    Pointer<CountingIBHierarchyIntegrator> time_integrator =
+        new CountingIBHierarchyIntegrator(prefix + "::IBHierarchyIntegrator",
+                                          ib_hierarchy_integrator_db,
+                                          ib_method_ops,
+                                          navier_stokes_integrator,
+                                          /*register_for_restart*/ false);
+    time_integrator->registerLoadBalancer(load_balancer);
+    Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+        new StandardTagAndInitialize<NDIM>(prefix + "::StandardTagAndInitialize",
+                                           time_integrator,
+                                           app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+    Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+        new GriddingAlgorithm<NDIM>(prefix + "::GriddingAlgorithm",
+                                    app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                    error_detector,
+                                    box_generator,
+                                    load_balancer,
+                                    false);
+
+    // Configure the IBFE solver.
+    ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_dev_stress_function));
+    ib_method_ops->registerPK1StressFunction(IBFEMethod::PK1StressFcnData(PK1_dil_stress_function));
+    ib_method_ops->initializeFEEquationSystems();
+    EquationSystems* equation_systems = ib_method_ops->getFEDataManager()->getEquationSystems();
+
+    // The domain is periodic, so only the initial velocity is needed.
+    Pointer<CartGridFunction> u_init = new muParserCartGridFunction(
+        "u_init", app_initializer->getComponentDatabase("VelocityInitialConditions"), grid_geometry);
+    navier_stokes_integrator->registerVelocityInitialConditions(u_init);
+
+    // Initialize hierarchy configuration and data on all patches.
+    ib_method_ops->initializeFEData();
+    time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+    // Main time step loop.
+    double loop_time = time_integrator->getIntegratorTime();
+    const double loop_time_end = time_integrator->getEndTime();
+    while (!IBTK::rel_equal_eps(loop_time, loop_time_end) && time_integrator->stepsRemaining())
+    {
+        const double dt = time_integrator->getMaximumTimeStepSize();
+        time_integrator->advanceHierarchy(dt);
+        loop_time += dt;
+    }
+
+    RunResult result;
+    System& X_system = equation_systems->get_system<System>(ib_method_ops->getCurrentCoordinatesSystemName());
+    X_system.solution->localize(result.X);
+    result.X_lower.fill(std::numeric_limits<double>::max());
+    result.X_upper.fill(-std::numeric_limits<double>::max());
+    for (auto it = mesh.nodes_begin(); it != mesh.nodes_end(); ++it)
+    {
+        const Node* const node = *it;
+        for (unsigned int d = 0; d < NDIM; ++d)
+        {
+            const double X = result.X[node->dof_number(X_system.number(), d, 0)];
+            result.X_lower[d] = std::min(result.X_lower[d], X);
+            result.X_upper[d] = std::max(result.X_upper[d], X);
+        }
+    }
+    result.num_regrids = time_integrator->d_num_regrids;
+    result.num_rebins = time_integrator->d_num_rebins;
+    return result;
+} // run_simulation
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    PetscOptionsSetValue(nullptr, "-stokes_ksp_atol", "1e-14");
+    PetscOptionsSetValue(nullptr, "-stokes_ksp_rtol", "1e-14");
+
+    { // cleanup dynamically allocated objects prior to shutdown
+        // prevent a warning about timer initializations
+        TimerManager::createManager(nullptr);
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "rebin_lagrangian_data_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+        c1_s = input_db->getDouble("C1_S");
+        p0_s = input_db->getDouble("P0_S");
+        beta_s = input_db->getDouble("BETA_S");
+
+        const RunResult regrid_result = run_simulation(app_initializer, init, "regrid", false);
+        const RunResult rebin_result = run_simulation(app_initializer, init, "rebin", true);
+
+        // Compare the final structure positions.
+        double max_diff = regrid_result.X.size() == rebin_result.X.size() ? 0.0 : 1.0;
+        for (std::size_t i = 0; i < std::min(regrid_result.X.size(), rebin_result.X.size()); ++i)
+        {
+            max_diff = std::max(max_diff, std::abs(regrid_result.X[i] - rebin_result.X[i]));
+        }
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            const std::array<std::pair<std::string, const RunResult*>, 2> results = {
+                std::make_pair(std::string("full regrid run"), &regrid_result),
+                std::make_pair(std::string("rebinning run"), &rebin_result)
+            };
+            for (const auto& result : results)
+            {
+                out << result.first << ":\n";
+                out << "  number of regrids: " << result.second->num_regrids << "\n";
+                out << "  number of rebins:  " << result.second->num_rebins << "\n";
+                for (unsigned int d = 0; d < NDIM; ++d)
+                {
+                    out << "  structure extent in direction " << d << ": [" << result.second->X_lower[d] << ", "
+                        << result.second->X_upper[d] << "]\n";
+                }
+            }
+            out << "max difference between the structure positions: " << max_diff << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
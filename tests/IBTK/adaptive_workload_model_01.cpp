@@ -0,0 +1,143 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Check that AdaptiveWorkloadModel::computeCosts() recovers the costs used to
+// generate synthetic timings on every process.
+
+#include <ibtk/AdaptiveWorkloadModel.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <fstream>
+#include <ostream>
+
+#include <ibtk/app_namespaces.h>
+
+// Print the fitted costs.
+void
+print_costs(std::ostream& out, const AdaptiveWorkloadModel& model)
+{
+    out << "  cell cost:                " << model.getCellCost() << "\n";
+    out << "  particle cost:            " << model.getParticleCost() << "\n";
+    out << "  relative particle weight: " << model.getRelativeParticleWeight() << "\n";
+    return;
+} // print_costs
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBTK
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    const int rank = IBTK_MPI::getRank();
+    std::ofstream out;
+    if (!rank) out.open("output");
+
+    // Every process owns a different amount of work and every sample uses
+    // different amounts, so that the timings are exactly proportional to the
+    // work only for the specified costs.
+    const double cell_cost = 2.0e-6, particle_cost = 5.0e-6;
+    auto num_cells = [&](const int k) { return 100.0 * (rank + 1) + 7.0 * k; };
+    auto num_particles = [&](const int k) { return 10.0 * (rank + 2) + 3.0 * k; };
+
+    // No costs have been fitted yet.
+    {
+        AdaptiveWorkloadModel model;
+        if (!rank)
+        {
+            out << "unfitted model:\n";
+            print_costs(out, model);
+        }
+    }
+
+    // Recover the costs from exact timings.
+    {
+        AdaptiveWorkloadModel model;
+        for (int k = 0; k < 5; ++k)
+        {
+            model.addSample(cell_cost * num_cells(k), num_cells(k), particle_cost * num_particles(k), num_particles(k));
+        }
+        const bool fitted = model.computeCosts();
+        if (!rank)
+        {
+            out << "exact timings:\n";
+            out << "  fitted: " << fitted << "\n";
+            print_costs(out, model);
+        }
+    }
+
+    // Samples that fall out of the window must not affect the fit.
+    {
+        AdaptiveWorkloadModel model(3);
+        for (int k = 0; k < 2; ++k)
+        {
+            model.addSample(10.0 * cell_cost * num_cells(k),
+                            num_cells(k),
+                            0.1 * particle_cost * num_particles(k),
+                            num_particles(k));
+        }
+        for (int k = 2; k < 5; ++k)
+        {
+            model.addSample(cell_cost * num_cells(k), num_cells(k), particle_cost * num_particles(k), num_particles(k));
+        }
+        const bool fitted = model.computeCosts();
+        if (!rank)
+        {
+            out << "samples outside of the window:\n";
+            out << "  fitted: " << fitted << "\n";
+            out << "  number of samples: " << model.getNumberOfSamples() << "\n";
+            print_costs(out, model);
+        }
+    }
+
+    // Without particle work the costs cannot be determined and the previous
+    // costs must be kept.
+    {
+        AdaptiveWorkloadModel model(2);
+        model.addSample(cell_cost * num_cells(0), num_cells(0), particle_cost * num_particles(0), num_particles(0));
+        model.computeCosts();
+        model.addSample(3.0 * cell_cost * num_cells(1), num_cells(1), 0.0, 0.0);
+        model.addSample(3.0 * cell_cost * num_cells(2), num_cells(2), 0.0, 0.0);
+        const bool fitted = model.computeCosts();
+        if (!rank)
+        {
+            out << "no particle work:\n";
+            out << "  fitted: " << fitted << "\n";
+            print_costs(out, model);
+        }
+    }
+
+    // Inexact timings give the least-squares fit: with the samples (n, t) =
+    // (1, 1) and (2, 3) on the first process and no work elsewhere, the cost
+    // is (1 * 1 + 2 * 3) / (1 * 1 + 2 * 2) = 1.4.
+    {
+        AdaptiveWorkloadModel model;
+        if (!rank)
+        {
+            model.addSample(1.0, 1.0, 2.0, 1.0);
+            model.addSample(3.0, 2.0, 6.0, 2.0);
+        }
+        else
+        {
+            model.addSample(0.0, 0.0, 0.0, 0.0);
+            model.addSample(0.0, 0.0, 0.0, 0.0);
+        }
+        const bool fitted = model.computeCosts();
+        if (!rank)
+        {
+            out << "inexact timings:\n";
+            out << "  fitted: " << fitted << "\n";
+            print_costs(out, model);
+        }
+    }
+} // main
@@ -0,0 +1,209 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Check that the hypre level solvers give the same results when they reuse
+// their hypre data after being reinitialized as freshly initialized solvers.
+
+#include <SAMRAI_config.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCPoissonHypreLevelSolver.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/SCPoissonHypreLevelSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+// Initialize the solver for the specified damping factor, solve the system,
+// and deallocate the solver state.
+void
+solve(PoissonSolver& solver,
+      const double C,
+      SAMRAIVectorReal<NDIM, double>& x_vec,
+      SAMRAIVectorReal<NDIM, double>& b_vec)
+{
+    PoissonSpecifications poisson_spec("poisson_spec");
+    poisson_spec.setCConstant(C);
+    poisson_spec.setDConstant(-1.0);
+    solver.setPoissonSpecifications(poisson_spec);
+    solver.setPhysicalBcCoef(nullptr);
+    solver.initializeSolverState(x_vec, b_vec);
+    x_vec.setToScalar(0.0);
+    solver.solveSystem(x_vec, b_vec);
+    solver.deallocateSolverState();
+    return;
+} // solve
+
+// Compare the solutions obtained by a solver that reuses its hypre data with
+// those obtained by freshly initialized solvers.
+template <class SolverType>
+void
+test_reuse(const std::string& solver_name,
+           Pointer<Database> solver_db,
+           SAMRAIVectorReal<NDIM, double>& x_reuse_vec,
+           SAMRAIVectorReal<NDIM, double>& x_fresh_vec,
+           SAMRAIVectorReal<NDIM, double>& b_vec,
+           const double C_old,
+           const double C_new,
+           std::ostream& out)
+{
+    solver_db->putBool("reuse_hypre_data", true);
+    SolverType reuse_solver(solver_name + "::reuse_solver", solver_db, "");
+    solver_db->putBool("reuse_hypre_data", false);
+    SolverType fresh_solver(solver_name + "::fresh_solver", solver_db, "");
+
+    // The first reinitialization changes the matrix coefficients and the
+    // second one keeps them.
+    solve(reuse_solver, C_old, x_reuse_vec, b_vec);
+    const double C_vals[2] = { C_new, C_new };
+    const std::string cases[2] = { "new coefficients", "same coefficients" };
+    for (int k = 0; k < 2; ++k)
+    {
+        solve(reuse_solver, C_vals[k], x_reuse_vec, b_vec);
+        solve(fresh_solver, C_vals[k], x_fresh_vec, b_vec);
+        const double x_norm = x_fresh_vec.maxNorm();
+        x_reuse_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&x_reuse_vec, false),
+                             Pointer<SAMRAIVectorReal<NDIM, double> >(&x_fresh_vec, false));
+        const double rel_diff_norm = x_reuse_vec.maxNorm() / x_norm;
+        if (IBTK_MPI::getRank() == 0)
+        {
+            out << solver_name << " reinitialized with " << cases[k]
+                << ": |x_reuse - x_fresh|_oo / |x_fresh|_oo = " << rel_diff_norm << "\n";
+        }
+    }
+    return;
+} // test_reuse
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "hypre_reuse_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > x_reuse_cc_var = new CellVariable<NDIM, double>("x_reuse_cc");
+        Pointer<CellVariable<NDIM, double> > x_fresh_cc_var = new CellVariable<NDIM, double>("x_fresh_cc");
+        Pointer<CellVariable<NDIM, double> > b_cc_var = new CellVariable<NDIM, double>("b_cc");
+        Pointer<SideVariable<NDIM, double> > x_reuse_sc_var = new SideVariable<NDIM, double>("x_reuse_sc");
+        Pointer<SideVariable<NDIM, double> > x_fresh_sc_var = new SideVariable<NDIM, double>("x_fresh_sc");
+        Pointer<SideVariable<NDIM, double> > b_sc_var = new SideVariable<NDIM, double>("b_sc");
+
+        const int x_reuse_cc_idx = var_db->registerVariableAndContext(x_reuse_cc_var, ctx, IntVector<NDIM>(1));
+        const int x_fresh_cc_idx = var_db->registerVariableAndContext(x_fresh_cc_var, ctx, IntVector<NDIM>(1));
+        const int b_cc_idx = var_db->registerVariableAndContext(b_cc_var, ctx, IntVector<NDIM>(1));
+        const int x_reuse_sc_idx = var_db->registerVariableAndContext(x_reuse_sc_var, ctx, IntVector<NDIM>(1));
+        const int x_fresh_sc_idx = var_db->registerVariableAndContext(x_fresh_sc_var, ctx, IntVector<NDIM>(1));
+        const int b_sc_idx = var_db->registerVariableAndContext(b_sc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the patch hierarchy, which has a single level.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(0);
+        level->allocatePatchData(x_reuse_cc_idx, 0.0);
+        level->allocatePatchData(x_fresh_cc_idx, 0.0);
+        level->allocatePatchData(b_cc_idx, 0.0);
+        level->allocatePatchData(x_reuse_sc_idx, 0.0);
+        level->allocatePatchData(x_fresh_sc_idx, 0.0);
+        level->allocatePatchData(b_sc_idx, 0.0);
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+        const int h_sc_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> x_reuse_cc_vec("x_reuse_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> x_fresh_cc_vec("x_fresh_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> b_cc_vec("b_cc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> x_reuse_sc_vec("x_reuse_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> x_fresh_sc_vec("x_fresh_sc", patch_hierarchy, 0, 0);
+        SAMRAIVectorReal<NDIM, double> b_sc_vec("b_sc", patch_hierarchy, 0, 0);
+
+        x_reuse_cc_vec.addComponent(x_reuse_cc_var, x_reuse_cc_idx, h_cc_idx);
+        x_fresh_cc_vec.addComponent(x_fresh_cc_var, x_fresh_cc_idx, h_cc_idx);
+        b_cc_vec.addComponent(b_cc_var, b_cc_idx, h_cc_idx);
+        x_reuse_sc_vec.addComponent(x_reuse_sc_var, x_reuse_sc_idx, h_sc_idx);
+        x_fresh_sc_vec.addComponent(x_fresh_sc_var, x_fresh_sc_idx, h_sc_idx);
+        b_sc_vec.addComponent(b_sc_var, b_sc_idx, h_sc_idx);
+
+        muParserCartGridFunction b_cc_fcn("b_cc", app_initializer->getComponentDatabase("b_cc"), grid_geometry);
+        muParserCartGridFunction b_sc_fcn("b_sc", app_initializer->getComponentDatabase("b_sc"), grid_geometry);
+        b_cc_fcn.setDataOnPatchHierarchy(b_cc_idx, b_cc_var, patch_hierarchy, 0.0);
+        b_sc_fcn.setDataOnPatchHierarchy(b_sc_idx, b_sc_var, patch_hierarchy, 0.0);
+
+        // The solvers perform a fixed number of iterations, so that any
+        // difference in the matrix or in the solver setup shows up in the
+        // solutions.
+        const double C_old = input_db->getDouble("C_old");
+        const double C_new = input_db->getDouble("C_new");
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+        test_reuse<CCPoissonHypreLevelSolver>("CCPoissonHypreLevelSolver",
+                                              app_initializer->getComponentDatabase("cc_solver_db"),
+                                              x_reuse_cc_vec,
+                                              x_fresh_cc_vec,
+                                              b_cc_vec,
+                                              C_old,
+                                              C_new,
+                                              out);
+        test_reuse<SCPoissonHypreLevelSolver>("SCPoissonHypreLevelSolver",
+                                              app_initializer->getComponentDatabase("sc_solver_db"),
+                                              x_reuse_sc_vec,
+                                              x_fresh_sc_vec,
+                                              b_sc_vec,
+                                              C_old,
+                                              C_new,
+                                              out);
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,191 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Check that the fused side-centered Laplace + gradient operator
+// HierarchyMathOps::laplaceGrad() agrees with computing the gradient and then
+// the Laplacian with separate calls. The norms of the difference e between the
+// two results are printed relative to the norms of the result f of the
+// separate calls.
+
+#include <SAMRAI_config.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <HierarchyDataOpsManager.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyGhostCellInterpolation.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <fstream>
+#include <vector>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "laplace_04.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<SideVariable<NDIM, double> > u_side_var = new SideVariable<NDIM, double>("u_side");
+        Pointer<CellVariable<NDIM, double> > p_cell_var = new CellVariable<NDIM, double>("p_cell");
+        Pointer<SideVariable<NDIM, double> > g_side_var = new SideVariable<NDIM, double>("g_side");
+        Pointer<SideVariable<NDIM, double> > f_side_var = new SideVariable<NDIM, double>("f_side");
+        Pointer<SideVariable<NDIM, double> > e_side_var = new SideVariable<NDIM, double>("e_side");
+
+        const int u_side_idx = var_db->registerVariableAndContext(u_side_var, ctx, IntVector<NDIM>(1));
+        const int p_cell_idx = var_db->registerVariableAndContext(p_cell_var, ctx, IntVector<NDIM>(1));
+        const int g_side_idx = var_db->registerVariableAndContext(g_side_var, ctx, IntVector<NDIM>(0));
+        const int f_side_idx = var_db->registerVariableAndContext(f_side_var, ctx, IntVector<NDIM>(0));
+        const int e_side_idx = var_db->registerVariableAndContext(e_side_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Set the simulation time to be zero.
+        const double data_time = 0.0;
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_side_idx, data_time);
+            level->allocatePatchData(p_cell_idx, data_time);
+            level->allocatePatchData(g_side_idx, data_time);
+            level->allocatePatchData(f_side_idx, data_time);
+            level->allocatePatchData(e_side_idx, data_time);
+        }
+
+        // Setup the input data.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        muParserCartGridFunction p_fcn("p", app_initializer->getComponentDatabase("p"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(u_side_idx, u_side_var, patch_hierarchy, data_time);
+        p_fcn.setDataOnPatchHierarchy(p_cell_idx, p_cell_var, patch_hierarchy, data_time);
+
+        // Create objects to communicate ghost cell data.
+        using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        std::vector<InterpolationTransactionComponent> u_transactions = { InterpolationTransactionComponent(
+            u_side_idx, "CONSERVATIVE_LINEAR_REFINE", true, "CONSERVATIVE_COARSEN", "LINEAR", false) };
+        std::vector<InterpolationTransactionComponent> p_transactions = { InterpolationTransactionComponent(
+            p_cell_idx, "CONSERVATIVE_LINEAR_REFINE", false, "CONSERVATIVE_COARSEN", "LINEAR", false) };
+        Pointer<HierarchyGhostCellInterpolation> u_bdry_fill_op = new HierarchyGhostCellInterpolation();
+        u_bdry_fill_op->initializeOperatorState(u_transactions, patch_hierarchy);
+        Pointer<HierarchyGhostCellInterpolation> p_bdry_fill_op = new HierarchyGhostCellInterpolation();
+        p_bdry_fill_op->initializeOperatorState(p_transactions, patch_hierarchy);
+
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int dx_side_idx = hier_math_ops.getSideWeightPatchDescriptorIndex();
+
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCConstant(input_db->getDouble("C"));
+        poisson_spec.setDConstant(input_db->getDouble("D"));
+        const double gamma = input_db->getDouble("gamma");
+
+        // Compute g := gamma grad p and f := C u + D L u + g with separate
+        // calls.
+        static const bool dst_cf_bdry_synch = false;
+        hier_math_ops.grad(
+            g_side_idx, g_side_var, dst_cf_bdry_synch, gamma, p_cell_idx, p_cell_var, p_bdry_fill_op, data_time);
+        hier_math_ops.laplace(f_side_idx,
+                              f_side_var,
+                              poisson_spec,
+                              u_side_idx,
+                              u_side_var,
+                              u_bdry_fill_op,
+                              data_time,
+                              1.0,
+                              g_side_idx,
+                              g_side_var);
+
+        // Compute e := C u + D L u + gamma grad p with the fused operator.
+        hier_math_ops.laplaceGrad(e_side_idx,
+                                  e_side_var,
+                                  poisson_spec,
+                                  u_side_idx,
+                                  u_side_var,
+                                  u_bdry_fill_op,
+                                  data_time,
+                                  gamma,
+                                  p_cell_idx,
+                                  p_cell_var,
+                                  p_bdry_fill_op,
+                                  data_time);
+
+        // Compare the results. The differences are printed relative to the
+        // norms of the result of the separate calls; they are due to roundoff.
+        Pointer<HierarchyDataOpsReal<NDIM, double> > hier_side_data_ops =
+            HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(u_side_var, patch_hierarchy, true);
+        const double f_max_norm = hier_side_data_ops->maxNorm(f_side_idx, dx_side_idx);
+        const double f_l2_norm = hier_side_data_ops->L2Norm(f_side_idx, dx_side_idx);
+        const double f_l1_norm = hier_side_data_ops->L1Norm(f_side_idx, dx_side_idx);
+        hier_side_data_ops->subtract(e_side_idx, e_side_idx, f_side_idx);
+        const double e_max_norm = hier_side_data_ops->maxNorm(e_side_idx, dx_side_idx);
+        const double e_l2_norm = hier_side_data_ops->L2Norm(e_side_idx, dx_side_idx);
+        const double e_l1_norm = hier_side_data_ops->L1Norm(e_side_idx, dx_side_idx);
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "|e|_oo / |f|_oo = " << e_max_norm / f_max_norm << "\n";
+            out << "|e|_2  / |f|_2  = " << e_l2_norm / f_l2_norm << "\n";
+            out << "|e|_1  / |f|_1  = " << e_l1_norm / f_l1_norm << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
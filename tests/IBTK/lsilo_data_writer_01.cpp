@@ -0,0 +1,185 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Write marker clouds with LSiloDataWriter, both synchronously with one file
+// per process and asynchronously with several processes per file, and print
+// the data that were written to the Silo files.
+
+#include <SAMRAI_config.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/IBTK_CHKERRQ.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LData.h>
+#include <ibtk/LSiloDataWriter.h>
+
+#include <petscao.h>
+
+#include <boost/multi_array.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <silo.h>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Set the values of the coordinates and of the plotted variable.
+void
+set_values(LData& X_data, LData& U_data, const std::vector<int>& lag_idxs, const double shift)
+{
+    boost::multi_array_ref<double, 2>& X = *X_data.getLocalFormVecArray();
+    boost::multi_array_ref<double, 1>& U = *U_data.getLocalFormArray();
+    for (unsigned int k = 0; k < lag_idxs.size(); ++k)
+    {
+        for (unsigned int d = 0; d < NDIM; ++d) X[k][d] = (d + 1) * lag_idxs[k] + shift;
+        U[k] = 0.5 * lag_idxs[k] + shift;
+    }
+    X_data.restoreArrays();
+    U_data.restoreArrays();
+    return;
+} // set_values
+
+// Print the coordinates and the variable values of a marker cloud written in
+// the specified dump.
+void
+print_cloud(std::ostream& out, const std::string& dump_dirname, const int cycle, const std::string& cloud_name)
+{
+    out << dump_dirname << ", cycle " << cycle << ", " << cloud_name << ":\n";
+    char temp_buf[128];
+    std::snprintf(temp_buf, sizeof(temp_buf), "%06d", cycle);
+    const std::string dirname = dump_dirname + "/lag_data.cycle_" + temp_buf;
+    const std::string summary_file_name = dirname + "/lag_data.cycle_" + temp_buf + ".summary.silo";
+    DBfile* summary_file = DBOpen(summary_file_name.c_str(), DB_UNKNOWN, DB_READ);
+    if (!summary_file)
+    {
+        out << "  unable to open " << summary_file_name << "\n";
+        return;
+    }
+
+    // Open the file and return the path of the single block of a multimesh or
+    // multivar object.
+    auto open_block = [&](const std::string& block_name, std::string& path) -> DBfile* {
+        const std::size_t colon = block_name.find(':');
+        path = block_name.substr(colon + 1);
+        return DBOpen((dirname + "/" + block_name.substr(0, colon)).c_str(), DB_UNKNOWN, DB_READ);
+    };
+
+    DBmultimesh* multimesh = DBGetMultimesh(summary_file, cloud_name.c_str());
+    DBmultivar* multivar = DBGetMultivar(summary_file, (cloud_name + "/U").c_str());
+    out << "  number of mesh blocks: " << (multimesh ? multimesh->nblocks : 0) << "\n";
+    out << "  number of variable blocks: " << (multivar ? multivar->nvars : 0) << "\n";
+    if (multimesh && multivar && multimesh->nblocks == 1 && multivar->nvars == 1)
+    {
+        std::string mesh_path, var_path;
+        DBfile* mesh_file = open_block(multimesh->meshnames[0], mesh_path);
+        DBpointmesh* mesh = mesh_file ? DBGetPointmesh(mesh_file, mesh_path.c_str()) : nullptr;
+        DBfile* var_file = open_block(multivar->varnames[0], var_path);
+        DBmeshvar* var = var_file ? DBGetPointvar(var_file, var_path.c_str()) : nullptr;
+        out << "  number of markers: " << (mesh ? mesh->nels : 0) << "\n";
+        out << "  number of values: " << (var ? var->nels : 0) << "\n";
+        for (int k = 0; mesh && var && k < mesh->nels && k < var->nels; ++k)
+        {
+            out << "  X =";
+            for (unsigned int d = 0; d < NDIM; ++d) out << " " << static_cast<float*>(mesh->coords[d])[k];
+            out << ", U = " << static_cast<float*>(var->vals[0])[k] << "\n";
+        }
+        if (var) DBFreeMeshvar(var);
+        if (var_file) DBClose(var_file);
+        if (mesh) DBFreePointmesh(mesh);
+        if (mesh_file) DBClose(mesh_file);
+    }
+    if (multivar) DBFreeMultivar(multivar);
+    if (multimesh) DBFreeMultimesh(multimesh);
+    DBClose(summary_file);
+    return;
+} // print_cloud
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    const int rank = IBTK_MPI::getRank();
+    const int nodes = IBTK_MPI::getNodes();
+
+    // Give each process a different number of nodes and number the Lagrangian
+    // indices in the reverse of the PETSc ordering.
+    const int num_local_nodes = 4 + rank;
+    const int first_petsc_idx = 4 * rank + (rank * (rank - 1)) / 2;
+    const int num_nodes = IBTK_MPI::sumReduction(num_local_nodes);
+    std::vector<int> petsc_idxs(num_local_nodes), lag_idxs(num_local_nodes);
+    for (int k = 0; k < num_local_nodes; ++k)
+    {
+        petsc_idxs[k] = first_petsc_idx + k;
+        lag_idxs[k] = num_nodes - 1 - petsc_idxs[k];
+    }
+    AO ao;
+    int ierr = AOCreateBasic(PETSC_COMM_WORLD, num_local_nodes, lag_idxs.data(), petsc_idxs.data(), &ao);
+    IBTK_CHKERRQ(ierr);
+
+    Pointer<LData> X_data = new LData("X", num_local_nodes, NDIM);
+    Pointer<LData> U_data = new LData("U", num_local_nodes, 1);
+
+    // Write the same data with both output modes.  The first cloud is
+    // registered on the first process and the second one on the last process.
+    const std::vector<std::string> dump_dirnames = { "viz_per_process", "viz_async_aggregated" };
+    std::vector<std::unique_ptr<LSiloDataWriter> > writers;
+    for (const std::string& dump_dirname : dump_dirnames)
+    {
+        writers.emplace_back(new LSiloDataWriter("LSiloDataWriter", dump_dirname, false));
+        LSiloDataWriter& writer = *writers.back();
+        writer.registerLagrangianAO(ao, 0);
+        writer.registerCoordsData(X_data, 0);
+        writer.registerVariableData("U", U_data, 0);
+        if (rank == 0) writer.registerMarkerCloud("cloud_a", num_nodes / 2, 0, 0);
+        if (rank == nodes - 1) writer.registerMarkerCloud("cloud_b", num_nodes - num_nodes / 2, num_nodes / 2, 0);
+    }
+    writers[1]->setNumberOfProcessorsPerFile(3);
+    writers[1]->setAsynchronousOutput(true);
+
+    // Change the data while the previous dump may still be in progress.
+    const std::vector<double> shifts = { 0.0, 1.0 };
+    for (int cycle = 0; cycle < static_cast<int>(shifts.size()); ++cycle)
+    {
+        set_values(*X_data, *U_data, lag_idxs, shifts[cycle]);
+        for (const auto& writer : writers) writer->writePlotData(cycle, static_cast<double>(cycle));
+    }
+    set_values(*X_data, *U_data, lag_idxs, -1.0);
+    LSiloDataWriter::waitForAllPendingOutput();
+    IBTK_MPI::barrier();
+
+    if (rank == 0)
+    {
+        std::ofstream out("output");
+        for (const std::string& dump_dirname : dump_dirnames)
+        {
+            for (int cycle = 0; cycle < static_cast<int>(shifts.size()); ++cycle)
+            {
+                print_cloud(out, dump_dirname, cycle, "cloud_a");
+                print_cloud(out, dump_dirname, cycle, "cloud_b");
+            }
+        }
+    }
+
+    writers.clear();
+    ierr = AODestroy(&ao);
+    IBTK_CHKERRQ(ierr);
+} // main
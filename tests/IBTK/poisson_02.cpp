@@ -0,0 +1,198 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Solve the same Poisson problem with an FAC preconditioner that does not use
+// coarsened levels below level 0, with one that does, and with one that also
+// agglomerates the coarsest coarsened level onto num_coarsest_level_procs
+// processors. Print the number of coarsened levels and the relative residual
+// norm of each solve. The numbers of Krylov iterations are written to the log
+// file.
+
+#include <SAMRAI_config.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/FACPreconditioner.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/KrylovLinearSolver.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "poisson_02.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > v_cc_var = new CellVariable<NDIM, double>("v_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int v_cc_idx = var_db->registerVariableAndContext(v_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(v_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(r_cc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> v_vec("v", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        v_vec.addComponent(v_cc_var, v_cc_idx, h_cc_idx);
+        f_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        r_vec.addComponent(r_cc_var, r_cc_idx, h_cc_idx);
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+
+        // Setup the Poisson problem with homogeneous Dirichlet boundary
+        // conditions.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        CCLaplaceOperator laplace_op("laplace_op");
+        laplace_op.setPoissonSpecifications(poisson_spec);
+        laplace_op.setPhysicalBcCoef(bc_coef);
+        laplace_op.initializeOperatorState(u_vec, f_vec);
+
+        // Solve -L*u = f without coarsened levels and -L*v = f with them,
+        // first without and then with agglomeration.
+        const string solver_type = input_db->getString("solver_type");
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+        const string precond_type = input_db->getString("precond_type");
+        Pointer<Database> precond_db = input_db->getDatabase("precond_db");
+        const int max_num_coarsened_levels = input_db->getInteger("max_num_coarsened_levels");
+        const int num_coarsest_level_procs = input_db->getIntegerWithDefault("num_coarsest_level_procs", 0);
+
+        const int num_solves = 3;
+        const std::string suffixes[num_solves] = { "_fine", "_coarsened", "_agglomerated" };
+        int num_coarsened_levels[num_solves] = { 0, 0, 0 };
+        double rel_residual_norm[num_solves] = { 0.0, 0.0, 0.0 };
+        for (int k = 0; k < num_solves; ++k)
+        {
+            precond_db->putInteger("max_num_coarsened_levels", k == 0 ? 0 : max_num_coarsened_levels);
+            precond_db->putInteger("num_coarsest_level_procs", k == 2 ? num_coarsest_level_procs : 0);
+            Pointer<PoissonSolver> poisson_solver = CCPoissonSolverManager::getManager()->allocateSolver(
+                solver_type, "poisson_solver" + suffixes[k], solver_db, "", precond_type,
+                "poisson_precond" + suffixes[k], precond_db, "");
+            SAMRAIVectorReal<NDIM, double>& sol_vec = k == 0 ? u_vec : v_vec;
+            poisson_solver->setPoissonSpecifications(poisson_spec);
+            poisson_solver->setPhysicalBcCoef(bc_coef);
+            poisson_solver->initializeSolverState(sol_vec, f_vec);
+
+            Pointer<KrylovLinearSolver> krylov_solver = poisson_solver;
+            Pointer<FACPreconditioner> fac_precond = krylov_solver->getPreconditioner();
+            num_coarsened_levels[k] = fac_precond->getNumCoarsenedLevels();
+
+            sol_vec.setToScalar(0.0);
+            poisson_solver->solveSystem(sol_vec, f_vec);
+            pout << "poisson_solver" << suffixes[k] << ": " << krylov_solver->getNumIterations() << " iterations\n";
+            poisson_solver->deallocateSolverState();
+
+            laplace_op.apply(sol_vec, r_vec);
+            r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false));
+            rel_residual_norm[k] = r_vec.L2Norm() / f_vec.L2Norm();
+        }
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            const std::string names[num_solves] = {
+                "without coarsened levels",
+                "with coarsened levels",
+                "with coarsened levels and num_coarsest_level_procs = " + std::to_string(num_coarsest_level_procs)
+            };
+            for (int k = 0; k < num_solves; ++k)
+            {
+                out << "solve " << names[k] << ":\n";
+                out << "  number of coarsened levels: " << num_coarsened_levels[k] << "\n";
+                out << "  relative residual norm: " << rel_residual_norm[k] << "\n";
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
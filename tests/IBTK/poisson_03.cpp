@@ -0,0 +1,185 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Solve the same Poisson problem with FAC preconditioners whose smoothers work
+// in double and in single precision. Print the relative residual norm of each
+// solve and the number of iterations by which the single-precision smoother
+// exceeds the allowed number of extra iterations. The numbers of iterations
+// themselves are written to the log file.
+
+#include <SAMRAI_config.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/CCLaplaceOperator.h>
+#include <ibtk/CCPoissonSolverManager.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+// Set up application namespace declarations
+#include <ibtk/app_namespaces.h>
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "poisson_03.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc");
+        Pointer<CellVariable<NDIM, double> > v_cc_var = new CellVariable<NDIM, double>("v_cc");
+        Pointer<CellVariable<NDIM, double> > f_cc_var = new CellVariable<NDIM, double>("f_cc");
+        Pointer<CellVariable<NDIM, double> > r_cc_var = new CellVariable<NDIM, double>("r_cc");
+
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(1));
+        const int v_cc_idx = var_db->registerVariableAndContext(v_cc_var, ctx, IntVector<NDIM>(1));
+        const int f_cc_idx = var_db->registerVariableAndContext(f_cc_var, ctx, IntVector<NDIM>(1));
+        const int r_cc_idx = var_db->registerVariableAndContext(r_cc_var, ctx, IntVector<NDIM>(1));
+
+        // Initialize the AMR patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+            level->allocatePatchData(v_cc_idx, 0.0);
+            level->allocatePatchData(f_cc_idx, 0.0);
+            level->allocatePatchData(r_cc_idx, 0.0);
+        }
+
+        // Setup vector objects.
+        HierarchyMathOps hier_math_ops("hier_math_ops", patch_hierarchy);
+        const int h_cc_idx = hier_math_ops.getCellWeightPatchDescriptorIndex();
+
+        SAMRAIVectorReal<NDIM, double> u_vec("u", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> v_vec("v", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> f_vec("f", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+        SAMRAIVectorReal<NDIM, double> r_vec("r", patch_hierarchy, 0, patch_hierarchy->getFinestLevelNumber());
+
+        u_vec.addComponent(u_cc_var, u_cc_idx, h_cc_idx);
+        v_vec.addComponent(v_cc_var, v_cc_idx, h_cc_idx);
+        f_vec.addComponent(f_cc_var, f_cc_idx, h_cc_idx);
+        r_vec.addComponent(r_cc_var, r_cc_idx, h_cc_idx);
+
+        muParserCartGridFunction f_fcn("f", app_initializer->getComponentDatabase("f"), grid_geometry);
+        f_fcn.setDataOnPatchHierarchy(f_cc_idx, f_cc_var, patch_hierarchy, 0.0);
+
+        // Setup the Poisson problem with homogeneous Dirichlet boundary
+        // conditions.
+        PoissonSpecifications poisson_spec("poisson_spec");
+        poisson_spec.setCZero();
+        poisson_spec.setDConstant(-1.0);
+        RobinBcCoefStrategy<NDIM>* bc_coef = NULL;
+        CCLaplaceOperator laplace_op("laplace_op");
+        laplace_op.setPoissonSpecifications(poisson_spec);
+        laplace_op.setPhysicalBcCoef(bc_coef);
+        laplace_op.initializeOperatorState(u_vec, f_vec);
+
+        // Solve -L*u = f with the double-precision smoother and -L*v = f with
+        // the single-precision one.
+        const string solver_type = input_db->getString("solver_type");
+        Pointer<Database> solver_db = input_db->getDatabase("solver_db");
+        const string precond_type = input_db->getString("precond_type");
+        Pointer<Database> precond_db = input_db->getDatabase("precond_db");
+        const int max_extra_iterations = input_db->getInteger("max_extra_iterations");
+
+        int num_iterations[2] = { 0, 0 };
+        double rel_residual_norm[2] = { 0.0, 0.0 };
+        SAMRAIVectorReal<NDIM, double>* sol_vecs[2] = { &u_vec, &v_vec };
+        for (int k = 0; k < 2; ++k)
+        {
+            precond_db->putBool("use_single_precision_smoother", k == 1);
+            const std::string suffix = k == 0 ? "_dp" : "_sp";
+            Pointer<PoissonSolver> poisson_solver = CCPoissonSolverManager::getManager()->allocateSolver(
+                solver_type, "poisson_solver" + suffix, solver_db, "", precond_type, "poisson_precond" + suffix,
+                precond_db, "");
+            poisson_solver->setPoissonSpecifications(poisson_spec);
+            poisson_solver->setPhysicalBcCoef(bc_coef);
+            poisson_solver->initializeSolverState(*sol_vecs[k], f_vec);
+
+            sol_vecs[k]->setToScalar(0.0);
+            poisson_solver->solveSystem(*sol_vecs[k], f_vec);
+            num_iterations[k] = poisson_solver->getNumIterations();
+            poisson_solver->deallocateSolverState();
+            plog << "number of iterations with the " << (k == 0 ? "double" : "single")
+                 << "-precision smoother: " << num_iterations[k] << "\n";
+
+            laplace_op.apply(*sol_vecs[k], r_vec);
+            r_vec.subtract(Pointer<SAMRAIVectorReal<NDIM, double> >(&f_vec, false),
+                           Pointer<SAMRAIVectorReal<NDIM, double> >(&r_vec, false));
+            rel_residual_norm[k] = r_vec.L2Norm() / f_vec.L2Norm();
+        }
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "relative residual norm with the double-precision smoother: " << rel_residual_norm[0] << "\n";
+            out << "relative residual norm with the single-precision smoother: " << rel_residual_norm[1] << "\n";
+            const int excess_iterations = std::max(num_iterations[1] - num_iterations[0] - max_extra_iterations, 0);
+            out << "iterations beyond " << max_extra_iterations
+                << " extra iterations with the single-precision smoother: " << excess_iterations << "\n";
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
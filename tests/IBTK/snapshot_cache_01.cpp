@@ -39,6 +39,7 @@ std::unique_ptr<SnapshotCache> fill_data(const std::string& test_name,
                                          Pointer<PatchHierarchy<NDIM> > hierarchy,
                                          Pointer<muParserCartGridFunction> fcn,
                                          const std::set<double>& time_pts,
+                                         Pointer<Database> cache_db,
                                          bool register_for_restart);
 
 void test_data(Pointer<Variable<NDIM> > var,
@@ -125,6 +126,8 @@ main(int argc, char* argv[])
             interp_pts.insert(t_start + (static_cast<double>(i) + 0.5) * dt);
 
         bool register_for_restart = input_db->getBool("register_for_restart");
+        Pointer<Database> cache_db =
+            input_db->isDatabase("SnapshotCache") ? input_db->getDatabase("SnapshotCache") : nullptr;
 
         // First fill in the data
         Pointer<CellVariable<NDIM, double> > c_var = new CellVariable<NDIM, double>("c_var");
@@ -156,24 +159,29 @@ main(int argc, char* argv[])
             // Read data from restart.
             // Generate the cache directly
             c_cache.reset(
-                new SnapshotCache("cell::SnapshotCache", c_var, nullptr, grid_geometry, register_for_restart));
+                new SnapshotCache("cell::SnapshotCache", c_var, cache_db, grid_geometry, register_for_restart));
             n_cache.reset(
-                new SnapshotCache("node::SnapshotCache", n_var, nullptr, grid_geometry, register_for_restart));
+                new SnapshotCache("node::SnapshotCache", n_var, cache_db, grid_geometry, register_for_restart));
             s_cache.reset(
-                new SnapshotCache("side::SnapshotCache", s_var, nullptr, grid_geometry, register_for_restart));
+                new SnapshotCache("side::SnapshotCache", s_var, cache_db, grid_geometry, register_for_restart));
             e_cache.reset(
-                new SnapshotCache("edge::SnapshotCache", e_var, nullptr, grid_geometry, register_for_restart));
+                new SnapshotCache("edge::SnapshotCache", e_var, cache_db, grid_geometry, register_for_restart));
             f_cache.reset(
-                new SnapshotCache("face::SnapshotCache", f_var, nullptr, grid_geometry, register_for_restart));
+                new SnapshotCache("face::SnapshotCache", f_var, cache_db, grid_geometry, register_for_restart));
         }
         else
         {
             // Allocate data as normal.
-            c_cache = std::move(fill_data("cell", c_var, old_patch_hierarchy, fcn, time_pts, register_for_restart));
-            n_cache = std::move(fill_data("node", n_var, old_patch_hierarchy, fcn, time_pts, register_for_restart));
-            s_cache = std::move(fill_data("side", s_var, old_patch_hierarchy, fcn, time_pts, register_for_restart));
-            e_cache = std::move(fill_data("edge", e_var, old_patch_hierarchy, fcn, time_pts, register_for_restart));
-            f_cache = std::move(fill_data("face", f_var, old_patch_hierarchy, fcn, time_pts, register_for_restart));
+            c_cache = std::move(
+                fill_data("cell", c_var, old_patch_hierarchy, fcn, time_pts, cache_db, register_for_restart));
+            n_cache = std::move(
+                fill_data("node", n_var, old_patch_hierarchy, fcn, time_pts, cache_db, register_for_restart));
+            s_cache = std::move(
+                fill_data("side", s_var, old_patch_hierarchy, fcn, time_pts, cache_db, register_for_restart));
+            e_cache = std::move(
+                fill_data("edge", e_var, old_patch_hierarchy, fcn, time_pts, cache_db, register_for_restart));
+            f_cache = std::move(
+                fill_data("face", f_var, old_patch_hierarchy, fcn, time_pts, cache_db, register_for_restart));
         }
 
         // Write restart files if we need to
@@ -203,6 +211,7 @@ fill_data(const std::string& test_name,
           Pointer<PatchHierarchy<NDIM> > hierarchy,
           Pointer<muParserCartGridFunction> fcn,
           const std::set<double>& time_pts,
+          Pointer<Database> cache_db,
           bool register_for_restart)
 {
     // Actually do the test.
@@ -213,7 +222,7 @@ fill_data(const std::string& test_name,
     // Create a SnapshotCache to store snapshots on the "old" hierarchy.
     Pointer<GridGeometry<NDIM> > grid_geom = hierarchy->getGridGeometry();
     std::unique_ptr<SnapshotCache> snapshot_cache(
-        new SnapshotCache(test_name + "::SnapshotCache", var, nullptr, grid_geom, register_for_restart));
+        new SnapshotCache(test_name + "::SnapshotCache", var, cache_db, grid_geom, register_for_restart));
 
     // Fill in snapshot cache with several values.
     for (const auto& t : time_pts)
@@ -0,0 +1,142 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Check that IBTK_MPI::SumReductionBatch computes the same sums as separate
+// blocking reductions, both when it is waited on directly and when several
+// batches are started and overlap with other work.
+
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <ostream>
+#include <vector>
+
+#include <ibtk/app_namespaces.h>
+
+// Fill the arrays with values that differ between processes and between
+// entries. All values are integers, so the sums are exact.
+void
+fill(std::vector<std::vector<double> >& arrays, const int shift)
+{
+    const int rank = IBTK_MPI::getRank();
+    for (unsigned int k = 0; k < arrays.size(); ++k)
+    {
+        for (unsigned int i = 0; i < arrays[k].size(); ++i) arrays[k][i] = (rank + 1) * (i + 1) + 10 * k + shift;
+    }
+    return;
+} // fill
+
+// Print the largest difference between the arrays and separate blocking
+// reductions of the same values, followed by the arrays themselves.
+void
+print(std::ostream& out, const std::vector<std::vector<double> >& arrays, const int shift)
+{
+    std::vector<std::vector<double> > exact(arrays);
+    fill(exact, shift);
+    double max_diff = 0.0;
+    for (unsigned int k = 0; k < arrays.size(); ++k)
+    {
+        if (!exact[k].empty()) IBTK_MPI::sumReduction(exact[k].data(), static_cast<int>(exact[k].size()));
+        for (unsigned int i = 0; i < arrays[k].size(); ++i)
+        {
+            max_diff = std::max(max_diff, std::abs(arrays[k][i] - exact[k][i]));
+        }
+    }
+    max_diff = IBTK_MPI::maxReduction(max_diff);
+    if (IBTK_MPI::getRank() != 0) return;
+    out << "  max difference from separate reductions: " << max_diff << "\n";
+    for (unsigned int k = 0; k < arrays.size(); ++k)
+    {
+        out << "  array " << k << ":";
+        for (const double val : arrays[k]) out << " " << val;
+        out << "\n";
+    }
+    return;
+} // print
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBTK
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    const int rank = IBTK_MPI::getRank();
+    std::ofstream out;
+    if (!rank) out.open("output");
+
+    // Arrays of different lengths, including an empty one.
+    std::vector<std::vector<double> > a = { std::vector<double>(3), std::vector<double>(1), std::vector<double>(0),
+                                            std::vector<double>(5) };
+    std::vector<std::vector<double> > b = { std::vector<double>(2), std::vector<double>(4) };
+
+    // Blocking use: wait() starts the reduction.
+    {
+        fill(a, 0);
+        IBTK_MPI::SumReductionBatch sums;
+        for (auto& array : a) sums.add(array.data(), static_cast<int>(array.size()));
+        sums.wait();
+        if (!rank) out << "blocking batch:\n";
+        print(out, a, 0);
+
+        // The batch can be reused once it has been waited on.
+        fill(a, 7);
+        for (auto& array : a) sums.add(array.data(), static_cast<int>(array.size()));
+        sums.wait();
+        if (!rank) out << "reused batch:\n";
+        print(out, a, 7);
+    }
+
+    // Non-blocking use: two batches are pending at the same time, other
+    // reductions are performed while they are pending, and they are waited on
+    // in the opposite order in which they were started.
+    {
+        fill(a, 1);
+        fill(b, 2);
+        IBTK_MPI::SumReductionBatch a_sums, b_sums;
+        for (auto& array : a) a_sums.add(array.data(), static_cast<int>(array.size()));
+        a_sums.start();
+        for (auto& array : b) b_sums.add(array.data(), static_cast<int>(array.size()));
+        b_sums.start();
+        const int num_nodes = IBTK_MPI::sumReduction(1);
+        b_sums.wait();
+        a_sums.wait();
+        if (!rank) out << "number of processes summed while the batches are pending: " << num_nodes << "\n";
+        if (!rank) out << "first overlapping batch:\n";
+        print(out, a, 1);
+        if (!rank) out << "second overlapping batch:\n";
+        print(out, b, 2);
+    }
+
+    // The destructor completes a pending reduction.
+    {
+        fill(b, 3);
+        {
+            IBTK_MPI::SumReductionBatch sums;
+            for (auto& array : b) sums.add(array.data(), static_cast<int>(array.size()));
+            sums.start();
+        }
+        if (!rank) out << "batch completed by the destructor:\n";
+        print(out, b, 3);
+    }
+
+    // An empty batch does nothing.
+    {
+        IBTK_MPI::SumReductionBatch sums;
+        sums.start();
+        sums.wait();
+        if (!rank) out << "empty batch completed\n";
+    }
+} // main
@@ -0,0 +1,221 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc objects
+#include <petscsys.h>
+
+// Headers for major SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianCellDoubleLinearRefine.h>
+#include <CartesianGridGeometry.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/muParserCartGridFunction.h>
+
+// Set up application namespace declarations
+#include <random>
+
+#include <ibtk/app_namespaces.h>
+
+// test stuff
+#include "../tests.h"
+
+// Verify that threaded interpolation and spreading with the Fortran kernel
+// backend reproduce the single-threaded results for every spreading summation
+// order. Two sets of points are used: one scattered over the patch and one
+// straddling the lower face of the patch normal to the slab axis, so that
+// points handled by different threads spread to the same ghost cells. The
+// differences are printed: interpolation and INPUT-ordered spreading must
+// agree exactly, and SLAB-ordered spreading must agree up to roundoff.
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "interpolate.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+
+        // we don't want to use a conservative refinement scheme
+        Pointer<RefineOperator<NDIM> > linear_refine = new CartesianCellDoubleLinearRefine<NDIM>();
+        grid_geometry->addSpatialRefineOperator(linear_refine);
+
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database. The
+        // ghost width has to accommodate the widest kernel centered at points
+        // one cell outside of the patch.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+
+        const std::array<std::string, 2> kernels = { "IB_4", "BSPLINE_6" };
+        const int n_ghosts = LEInteractor::getMinimumGhostWidth("BSPLINE_6") + 1;
+        Pointer<CellVariable<NDIM, double> > u_cc_var = new CellVariable<NDIM, double>("u_cc", NDIM);
+        const int u_cc_idx = var_db->registerVariableAndContext(u_cc_var, ctx, IntVector<NDIM>(n_ghosts));
+
+        // Initialize the AMR patch hierarchy.
+        const int tag_buffer = 1;
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+        // Allocate data on each level of the patch hierarchy.
+        for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(u_cc_idx, 0.0);
+        }
+
+        // Setup exact solutions, including the values in the ghost cells.
+        muParserCartGridFunction u_fcn("u", app_initializer->getComponentDatabase("u"), grid_geometry);
+        u_fcn.setDataOnPatchHierarchy(u_cc_idx, u_cc_var, patch_hierarchy, 0.0);
+
+        // Here comes the actual test: avoid problems with filling boundary
+        // ghost data (which isn't relevant to this test) by picking the sole
+        // patch on level 1. Points are interpolated and spread in the patch box
+        // grown by one cell so that points in the first layer of ghost cells
+        // are included.
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(1);
+        const Pointer<Patch<NDIM> > patch = level->getPatch(0);
+        Pointer<CellData<NDIM, double> > q_data = patch->getPatchData(u_cc_idx);
+        const Box<NDIM> interaction_box = Box<NDIM>::grow(patch->getBox(), IntVector<NDIM>(1));
+
+        // populate coordinates randomly:
+        const std::size_t n_points = 400;
+        const int Q_depth = NDIM;
+        const int X_depth = NDIM;
+        const unsigned int slab_axis = NDIM - 1;
+        std::vector<double> X_interior(X_depth * n_points), X_face(X_depth * n_points);
+        std::mt19937 std_seq(42u);
+        const Pointer<CartesianPatchGeometry<NDIM> > patch_geom = patch->getPatchGeometry();
+        const double* const patch_x_lower = patch_geom->getXLower();
+        const double* const patch_x_upper = patch_geom->getXUpper();
+        const double* const patch_dx = patch_geom->getDx();
+        for (std::size_t point_n = 0; point_n < n_points; ++point_n)
+        {
+            for (unsigned int d = 0; d < NDIM; ++d)
+            {
+                std::uniform_real_distribution<double> distribution(patch_x_lower[d], patch_x_upper[d]);
+                X_interior[point_n * NDIM + d] = distribution(std_seq);
+                if (d == slab_axis)
+                {
+                    std::uniform_real_distribution<double> face_distribution(patch_x_lower[d] - patch_dx[d],
+                                                                             patch_x_lower[d] + patch_dx[d]);
+                    X_face[point_n * NDIM + d] = face_distribution(std_seq);
+                }
+                else
+                {
+                    X_face[point_n * NDIM + d] = distribution(std_seq);
+                }
+            }
+        }
+
+        const std::array<LEInteractorSummationOrder, 2> orders = { SLAB_SUMMATION_ORDER, INPUT_SUMMATION_ORDER };
+        const std::array<std::pair<std::string, const std::vector<double>*>, 2> point_sets = {
+            std::make_pair(std::string("interior"), &X_interior), std::make_pair(std::string("face"), &X_face)
+        };
+        const int num_threads = input_db->getIntegerWithDefault("num_threads", 4);
+        LEInteractor::s_kernel_backend = FORTRAN_KERNEL_BACKEND;
+        LEInteractor::s_min_threaded_batch_size = 1;
+        std::ofstream out("output");
+        out.precision(6);
+        for (const std::string& kernel : kernels)
+        {
+            for (const LEInteractorSummationOrder order : orders)
+            {
+                for (const auto& point_set : point_sets)
+                {
+                    const std::vector<double>& X = *point_set.second;
+                    std::array<std::vector<double>, 2> Q_data;
+                    std::array<Pointer<CellData<NDIM, double> >, 2> f_data;
+                    const std::array<int, 2> thread_counts = { 1, num_threads };
+                    for (unsigned int k = 0; k < 2; ++k)
+                    {
+                        LEInteractor::s_num_threads = thread_counts[k];
+                        LEInteractor::s_spread_summation_order = order;
+                        Q_data[k].resize(Q_depth * n_points);
+                        LEInteractor::interpolate(
+                            Q_data[k], Q_depth, X, X_depth, q_data, patch, interaction_box, kernel);
+
+                        f_data[k] = new CellData<NDIM, double>(patch->getBox(), Q_depth, IntVector<NDIM>(n_ghosts));
+                        f_data[k]->fillAll(0.0);
+                        LEInteractor::spread(f_data[k], Q_data[0], Q_depth, X, X_depth, patch, interaction_box, kernel);
+                    }
+                    LEInteractor::s_num_threads = 1;
+
+                    // spread values are scaled by the inverse cell volume, so
+                    // report the spreading difference relative to the largest
+                    // spread value
+                    double max_interp_value = 0.0, max_interp_diff = 0.0;
+                    for (std::size_t i = 0; i < Q_depth * n_points; ++i)
+                    {
+                        max_interp_value = std::max(max_interp_value, std::abs(Q_data[0][i]));
+                        max_interp_diff = std::max(max_interp_diff, std::abs(Q_data[0][i] - Q_data[1][i]));
+                    }
+                    double max_spread_value = 0.0, max_spread_diff = 0.0, max_ghost_value = 0.0;
+                    for (CellIterator<NDIM> it(f_data[0]->getGhostBox()); it; it++)
+                    {
+                        for (int d = 0; d < Q_depth; ++d)
+                        {
+                            const double value = std::abs((*f_data[0])(it(), d));
+                            max_spread_value = std::max(max_spread_value, value);
+                            max_spread_diff =
+                                std::max(max_spread_diff, std::abs((*f_data[0])(it(), d) - (*f_data[1])(it(), d)));
+                            if (!patch->getBox().contains(it())) max_ghost_value = std::max(max_ghost_value, value);
+                        }
+                    }
+                    const std::string name =
+                        kernel + ", " + enum_to_string(order) + " summation order, " + point_set.first + " points";
+                    pout << name << ": max |f| = " << max_spread_value
+                         << ", max |f| in ghost cells = " << max_ghost_value << "\n";
+                    out << name << ":\n";
+                    out << "  max interpolation difference: " << max_interp_diff / max_interp_value << '\n';
+                    out << "  max spreading difference: " << max_spread_diff / max_spread_value << '\n';
+                }
+            }
+        }
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
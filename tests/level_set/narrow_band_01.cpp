@@ -0,0 +1,220 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Check that the narrow band mode of FastSweepingLSMethod reproduces the
+// distance function computed by sweeping the whole hierarchy within the band.
+
+#include <SAMRAI_config.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <CartesianPatchGeometry.h>
+#include <CellData.h>
+#include <CellVariable.h>
+#include <GriddingAlgorithm.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/FastSweepingLSMethod.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/HierarchyMathOps.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/ibtk_utilities.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// Struct to maintain the properties of the circular interface
+struct CircularInterface
+{
+    IBTK::Vector X0;
+    double R;
+};
+
+// Set the exact distance in the cells next to the interface and large
+// positive/negative values everywhere else.
+void
+circular_interface_neighborhood(int D_idx,
+                                Pointer<HierarchyMathOps> hier_math_ops,
+                                double /*time*/,
+                                bool /*initial_time*/,
+                                void* ctx)
+{
+    const CircularInterface* const circle = static_cast<CircularInterface*>(ctx);
+    Pointer<PatchHierarchy<NDIM> > patch_hierarchy = hier_math_ops->getPatchHierarchy();
+    for (int ln = 0; ln <= patch_hierarchy->getFinestLevelNumber(); ++ln)
+    {
+        Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+        for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+        {
+            Pointer<Patch<NDIM> > patch = level->getPatch(p());
+            const Box<NDIM>& patch_box = patch->getBox();
+            Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+            const double* const x_lower = pgeom->getXLower();
+            const double* const dx = pgeom->getDx();
+            Pointer<CellData<NDIM, double> > D_data = patch->getPatchData(D_idx);
+            for (Box<NDIM>::Iterator b(patch_box); b; b++)
+            {
+                const CellIndex<NDIM> i(b());
+                double r_sq = 0.0;
+                for (int d = 0; d < NDIM; ++d)
+                {
+                    const double X = x_lower[d] + dx[d] * (static_cast<double>(i(d) - patch_box.lower(d)) + 0.5);
+                    r_sq += (X - circle->X0[d]) * (X - circle->X0[d]);
+                }
+                const double dist = std::sqrt(r_sq) - circle->R;
+                if (std::abs(dist) < 1.5 * dx[0])
+                {
+                    (*D_data)(i) = dist;
+                }
+                else
+                {
+                    (*D_data)(i) = dist < 0.0 ? -1.0e8 : 1.0e8;
+                }
+            }
+        }
+    }
+    return;
+} // circular_interface_neighborhood
+
+int
+main(int argc, char* argv[])
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    { // cleanup dynamically allocated objects prior to shutdown
+
+        // Parse command line options, set some standard options from the input
+        // file, and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "narrow_band_01.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"));
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy = new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector = new StandardTagAndInitialize<NDIM>(
+            "StandardTagAndInitialize", NULL, app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer);
+
+        // Create variables and register them with the variable database.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        Pointer<VariableContext> ctx = var_db->getContext("context");
+        Pointer<CellVariable<NDIM, double> > D_full_var = new CellVariable<NDIM, double>("D_full");
+        Pointer<CellVariable<NDIM, double> > D_band_var = new CellVariable<NDIM, double>("D_band");
+        const int D_full_idx = var_db->registerVariableAndContext(D_full_var, ctx, IntVector<NDIM>(0));
+        const int D_band_idx = var_db->registerVariableAndContext(D_band_var, ctx, IntVector<NDIM>(0));
+
+        // Initialize the patch hierarchy.
+        gridding_algorithm->makeCoarsestLevel(patch_hierarchy, 0.0);
+        int tag_buffer = 1;
+        int level_number = 0;
+        bool done = false;
+        while (!done && (gridding_algorithm->levelCanBeRefined(level_number)))
+        {
+            gridding_algorithm->makeFinerLevel(patch_hierarchy, 0.0, 0.0, tag_buffer);
+            done = !patch_hierarchy->finerLevelExists(level_number);
+            ++level_number;
+        }
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(D_full_idx, 0.0);
+            level->allocatePatchData(D_band_idx, 0.0);
+        }
+        Pointer<HierarchyMathOps> hier_math_ops =
+            new HierarchyMathOps("HierarchyMathOps", patch_hierarchy, 0, finest_ln);
+
+        CircularInterface circle;
+        circle.R = input_db->getDoubleWithDefault("R", 0.25);
+        for (int d = 0; d < NDIM; ++d) circle.X0[d] = 0.5;
+
+        // Compute the distance function by sweeping the whole hierarchy and by
+        // sweeping only the narrow band.
+        Pointer<Database> ls_db = app_initializer->getComponentDatabase("LevelSet");
+        ls_db->putBool("use_narrow_band", false);
+        FastSweepingLSMethod full_ls_method("FullLSMethod", ls_db, false);
+        full_ls_method.registerInterfaceNeighborhoodLocatingFcn(&circular_interface_neighborhood, &circle);
+        full_ls_method.initializeLSData(D_full_idx, hier_math_ops, 0, 0.0, true);
+
+        ls_db->putBool("use_narrow_band", true);
+        FastSweepingLSMethod band_ls_method("BandLSMethod", ls_db, false);
+        band_ls_method.registerInterfaceNeighborhoodLocatingFcn(&circular_interface_neighborhood, &circle);
+        band_ls_method.initializeLSData(D_band_idx, hier_math_ops, 0, 0.0, true);
+
+        // Inside of the band both methods must agree; outside of it the narrow
+        // band values are clipped to plus or minus the band width.
+        const double narrow_band_width = ls_db->getDouble("narrow_band_width");
+        double max_band_diff = 0.0, max_clipping_error = 0.0;
+        int num_sign_changes = 0;
+        for (int ln = 0; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            for (PatchLevel<NDIM>::Iterator p(level); p; p++)
+            {
+                Pointer<Patch<NDIM> > patch = level->getPatch(p());
+                Pointer<CartesianPatchGeometry<NDIM> > pgeom = patch->getPatchGeometry();
+                const double* const dx = pgeom->getDx();
+                const double band_width = narrow_band_width * *std::min_element(dx, dx + NDIM);
+                Pointer<CellData<NDIM, double> > D_full_data = patch->getPatchData(D_full_idx);
+                Pointer<CellData<NDIM, double> > D_band_data = patch->getPatchData(D_band_idx);
+                for (Box<NDIM>::Iterator b(patch->getBox()); b; b++)
+                {
+                    const CellIndex<NDIM> i(b());
+                    const double D_full = (*D_full_data)(i);
+                    const double D_band = (*D_band_data)(i);
+                    if (std::abs(D_full) < band_width)
+                    {
+                        max_band_diff = std::max(max_band_diff, std::abs(D_full - D_band));
+                    }
+                    else
+                    {
+                        max_clipping_error = std::max(max_clipping_error, std::abs(std::abs(D_band) - band_width));
+                        if (D_band * D_full < 0.0) ++num_sign_changes;
+                    }
+                }
+            }
+        }
+        max_band_diff = IBTK_MPI::maxReduction(max_band_diff);
+        max_clipping_error = IBTK_MPI::maxReduction(max_clipping_error);
+        num_sign_changes = IBTK_MPI::sumReduction(num_sign_changes);
+
+        if (IBTK_MPI::getRank() == 0)
+        {
+            std::ofstream out("output");
+            out << "max |D_band - D_full| inside of the band: " << max_band_diff << "\n";
+            out << "max ||D_band| - band width| outside of the band: " << max_clipping_error << "\n";
+            out << "number of sign changes outside of the band: " << num_sign_changes << "\n";
+        }
+
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main
@@ -0,0 +1,123 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Test the counter-based random number generator of class RNG: print the
+// Philox4x32-10 known-answer vectors, the difference between the values
+// generated on a box and on the patches into which it is split, some of the
+// generated values, and the first two moments of the generated values.
+
+#include <ibamr/RNG.h>
+
+#include <ibtk/IBTKInit.h>
+
+#include <Box.h>
+#include <CellData.h>
+#include <CellIndex.h>
+#include <Index.h>
+#include <IntVector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+#include <ibamr/app_namespaces.h>
+
+int
+main(int argc, char* argv[])
+{
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+
+    std::ofstream out("output");
+
+    // Known-answer tests from the Random123 distribution.
+    const std::vector<std::array<std::uint32_t, 4> > ctrs = {
+        { 0x00000000, 0x00000000, 0x00000000, 0x00000000 },
+        { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+        { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }
+    };
+    const std::vector<std::array<std::uint32_t, 2> > keys = { { 0x00000000, 0x00000000 },
+                                                              { 0xffffffff, 0xffffffff },
+                                                              { 0xa4093822, 0x299f31d0 } };
+    for (unsigned int k = 0; k < ctrs.size(); ++k)
+    {
+        const std::array<std::uint32_t, 4> result = RNG::philox4x32(ctrs[k], keys[k]);
+        out << "philox4x32-10 test " << k << ":";
+        for (const std::uint32_t r : result) out << ' ' << std::hex << std::setw(8) << std::setfill('0') << r;
+        out << std::dec << '\n';
+    }
+
+    // Fill a box all at once and patch-by-patch.
+    const int n = NDIM == 2 ? 32 : 16;
+    const int depth = 2;
+    const unsigned int seed = 42, step = 7, level_number = 1, stream = 3;
+    const Box<NDIM> domain_box(hier::Index<NDIM>(0), hier::Index<NDIM>(n - 1));
+    CellData<NDIM, double> domain_data(domain_box, depth, IntVector<NDIM>(1));
+    domain_data.fillAll(0.0);
+    RNG::genrandn(domain_data, seed, step, level_number, stream);
+
+    double max_layout_diff = 0.0;
+    for (int patch_num = 0; patch_num < (1 << NDIM); ++patch_num)
+    {
+        hier::Index<NDIM> lower(0), upper(n / 2 - 1);
+        for (int d = 0; d < NDIM; ++d)
+        {
+            if (patch_num & (1 << d))
+            {
+                lower(d) += n / 2;
+                upper(d) += n / 2;
+            }
+        }
+        const Box<NDIM> patch_box(lower, upper);
+        CellData<NDIM, double> patch_data(patch_box, depth, IntVector<NDIM>(2));
+        patch_data.fillAll(0.0);
+        RNG::genrandn(patch_data, seed, step, level_number, stream);
+        for (Box<NDIM>::Iterator b(patch_box); b; b++)
+        {
+            const CellIndex<NDIM> i(b());
+            for (int k = 0; k < depth; ++k)
+            {
+                max_layout_diff = std::max(max_layout_diff, std::abs(patch_data(i, k) - domain_data(i, k)));
+            }
+        }
+    }
+    out << "max difference between the patch and box values: " << max_layout_diff << '\n';
+
+    // Values differ between time steps and between depths.
+    CellData<NDIM, double> next_step_data(domain_box, depth, IntVector<NDIM>(0));
+    RNG::genrandn(next_step_data, seed, step + 1, level_number, stream);
+    const CellIndex<NDIM> i0(hier::Index<NDIM>(0));
+    out.precision(12);
+    out << "value at step " << step << ", depth 0: " << domain_data(i0, 0) << '\n';
+    out << "value at step " << step << ", depth 1: " << domain_data(i0, 1) << '\n';
+    out << "value at step " << step + 1 << ", depth 0: " << next_step_data(i0, 0) << '\n';
+
+    // Print the sample mean and variance.
+    double sum = 0.0, sum_sq = 0.0;
+    int count = 0;
+    for (Box<NDIM>::Iterator b(domain_box); b; b++)
+    {
+        const CellIndex<NDIM> i(b());
+        for (int k = 0; k < depth; ++k)
+        {
+            sum += domain_data(i, k);
+            sum_sq += domain_data(i, k) * domain_data(i, k);
+            ++count;
+        }
+    }
+    const double mean = sum / count;
+    const double var = sum_sq / count - mean * mean;
+    out << "sample mean: " << mean << '\n';
+    out << "sample variance: " << var << '\n';
+} // main
@@ -0,0 +1,266 @@
+// ---------------------------------------------------------------------
+//
+// Copyright (c) 2026 - 2026 by the IBAMR developers
+// All rights reserved.
+//
+// This file is part of IBAMR.
+//
+// IBAMR is free software and is distributed under the 3-clause BSD
+// license. The full text of the license can be found in the file
+// COPYRIGHT at the top level directory of IBAMR.
+//
+// ---------------------------------------------------------------------
+
+// Config files
+#include <SAMRAI_config.h>
+
+// Headers for basic PETSc functions
+#include <petscsys.h>
+
+// Headers for basic SAMRAI objects
+#include <BergerRigoutsos.h>
+#include <CartesianGridGeometry.h>
+#include <LoadBalancer.h>
+#include <StandardTagAndInitialize.h>
+
+// other samrai stuff
+#include <HierarchyDataOpsManager.h>
+
+// Headers for basic libMesh objects
+#include <libmesh/equation_systems.h>
+#include <libmesh/linear_partitioner.h>
+#include <libmesh/mesh.h>
+#include <libmesh/mesh_generation.h>
+
+// Headers for application-specific algorithm/data structure objects
+#include <ibamr/IBExplicitHierarchyIntegrator.h>
+#include <ibamr/IBFEMethod.h>
+#include <ibamr/INSStaggeredHierarchyIntegrator.h>
+
+#include <ibtk/AppInitializer.h>
+#include <ibtk/IBTKInit.h>
+#include <ibtk/IBTK_MPI.h>
+#include <ibtk/LEInteractor.h>
+#include <ibtk/libmesh_utilities.h>
+
+#include <fstream>
+
+// Set up application namespace declarations
+#include <ibamr/app_namespaces.h>
+
+// This test checks that the quadrature data cached by FEDataManager::spread()
+// and FEDataManager::interpWeighted() give the same results as quadrature data
+// that are computed from scratch, i.e., right after reinitElementMappings().
+// The cached data are exercised by repeated calls, by passing position vectors
+// with different ghost layouts, and by moving the mesh so that the keys of the
+// adaptive quadrature rules change.
+
+// Coordinate mapping function.
+void
+coordinate_mapping_function(libMesh::Point& X, const libMesh::Point& s, void* /*ctx*/)
+{
+    // See spread_01.cpp for why these shifts are used.
+    X(0) = s(0) + 0.612345;
+    X(1) = s(1) + 0.512345;
+#if (NDIM == 3)
+    X(2) = s(2) + 0.512345;
+#endif
+    return;
+} // coordinate_mapping_function
+
+static constexpr double R = 0.2;
+
+int
+main(int argc, char** argv)
+{
+    // Initialize IBAMR and libraries. Deinitialization is handled by this object as well.
+    IBTKInit ibtk_init(argc, argv, MPI_COMM_WORLD);
+    const LibMeshInit& init = ibtk_init.getLibMeshInit();
+
+    // prevent a warning about timer initializations
+    TimerManager::createManager(nullptr);
+    {
+        // Parse command line options, set some standard options from the input
+        // file, initialize the restart database (if this is a restarted run),
+        // and enable file logging.
+        Pointer<AppInitializer> app_initializer = new AppInitializer(argc, argv, "IB.log");
+        Pointer<Database> input_db = app_initializer->getInputDatabase();
+
+        // Create a simple FE mesh.
+        ReplicatedMesh mesh(init.comm(), NDIM);
+        const double dx = input_db->getDouble("DX");
+        const double ds = input_db->getDouble("MFAC") * dx;
+        const std::string elem_str = input_db->getString("ELEM_TYPE");
+        const auto elem_type = Utility::string_to_enum<ElemType>(elem_str);
+        const double num_circum_segments = 2.0 * M_PI * R / ds;
+        const int r = log2(0.25 * num_circum_segments);
+        MeshTools::Generation::build_sphere(mesh, R, r, elem_type);
+        mesh.prepare_for_use();
+        LinearPartitioner partitioner;
+        partitioner.partition(mesh);
+
+        // Create major algorithm and data objects that comprise the
+        // application.  These objects are configured from the input database.
+        Pointer<CartesianGridGeometry<NDIM> > grid_geometry = new CartesianGridGeometry<NDIM>(
+            "CartesianGeometry", app_initializer->getComponentDatabase("CartesianGeometry"), false);
+        Pointer<PatchHierarchy<NDIM> > patch_hierarchy =
+            new PatchHierarchy<NDIM>("PatchHierarchy", grid_geometry, false);
+        Pointer<LoadBalancer<NDIM> > load_balancer =
+            new LoadBalancer<NDIM>("LoadBalancer", app_initializer->getComponentDatabase("LoadBalancer"));
+        Pointer<BergerRigoutsos<NDIM> > box_generator = new BergerRigoutsos<NDIM>();
+        Pointer<INSHierarchyIntegrator> navier_stokes_integrator = new INSStaggeredHierarchyIntegrator(
+            "INSStaggeredHierarchyIntegrator",
+            app_initializer->getComponentDatabase("INSStaggeredHierarchyIntegrator"),
+            false);
+        Pointer<IBFEMethod> ib_method_ops =
+            new IBFEMethod("IBFEMethod",
+                           app_initializer->getComponentDatabase("IBFEMethod"),
+                           &mesh,
+                           app_initializer->getComponentDatabase("GriddingAlgorithm")->getInteger("max_levels"),
+                           false);
+        Pointer<IBHierarchyIntegrator> time_integrator =
+            new IBExplicitHierarchyIntegrator("IBHierarchyIntegrator",
+                                              app_initializer->getComponentDatabase("IBHierarchyIntegrator"),
+                                              ib_method_ops,
+                                              navier_stokes_integrator,
+                                              false);
+        Pointer<StandardTagAndInitialize<NDIM> > error_detector =
+            new StandardTagAndInitialize<NDIM>("StandardTagAndInitialize",
+                                               time_integrator,
+                                               app_initializer->getComponentDatabase("StandardTagAndInitialize"));
+        Pointer<GriddingAlgorithm<NDIM> > gridding_algorithm =
+            new GriddingAlgorithm<NDIM>("GriddingAlgorithm",
+                                        app_initializer->getComponentDatabase("GriddingAlgorithm"),
+                                        error_detector,
+                                        box_generator,
+                                        load_balancer,
+                                        false);
+
+        // Configure the IBFE solver.
+        ib_method_ops->registerInitialCoordinateMappingFunction(coordinate_mapping_function);
+        ib_method_ops->initializeFEEquationSystems();
+        ib_method_ops->initializeFEData();
+        time_integrator->initializePatchHierarchy(patch_hierarchy, gridding_algorithm);
+
+        // Set up Eulerian data: two fields to spread into, the first of which
+        // is also used as the field to interpolate, and their difference.
+        VariableDatabase<NDIM>* var_db = VariableDatabase<NDIM>::getDatabase();
+        const Pointer<SAMRAI::hier::Variable<NDIM> > f_var = time_integrator->getBodyForceVariable();
+        const int n_ghosts = LEInteractor::getMinimumGhostWidth(input_db->getString("IB_DELTA_FUNCTION"));
+        const int f_0_idx = var_db->registerVariableAndContext(f_var, var_db->getContext("f_0"), n_ghosts);
+        const int f_1_idx = var_db->registerVariableAndContext(f_var, var_db->getContext("f_1"), n_ghosts);
+        const int f_diff_idx = var_db->registerVariableAndContext(f_var, var_db->getContext("f_diff"), n_ghosts);
+        const int coarsest_ln = 0;
+        const int finest_ln = patch_hierarchy->getFinestLevelNumber();
+        for (int ln = coarsest_ln; ln <= finest_ln; ++ln)
+        {
+            Pointer<PatchLevel<NDIM> > level = patch_hierarchy->getPatchLevel(ln);
+            level->allocatePatchData(f_0_idx);
+            level->allocatePatchData(f_1_idx);
+            level->allocatePatchData(f_diff_idx);
+        }
+        Pointer<HierarchyDataOpsReal<NDIM, double> > f_ops =
+            HierarchyDataOpsManager<NDIM>::getManager()->getOperationsDouble(f_var, patch_hierarchy, true);
+        f_ops->resetLevels(coarsest_ln, finest_ln);
+
+        // Set up Lagrangian data.
+        FEDataManager& fe_data_manager = *ib_method_ops->getFEDataManager();
+        EquationSystems& equation_systems = *fe_data_manager.getEquationSystems();
+        const std::string& F_system_name = ib_method_ops->getForceSystemName();
+        const std::string& U_system_name = ib_method_ops->getVelocitySystemName();
+        const std::string& X_system_name = ib_method_ops->getCurrentCoordinatesSystemName();
+        System& X_system = equation_systems.get_system(X_system_name);
+        std::unique_ptr<PetscVector<double> > F_vec = fe_data_manager.buildIBGhostedVector(F_system_name);
+        for (unsigned int i = F_vec->first_local_index(); i < F_vec->last_local_index(); ++i)
+        {
+            F_vec->set(i, i % 10);
+        }
+        F_vec->close();
+        std::unique_ptr<PetscVector<double> > U_0_vec = fe_data_manager.buildIBGhostedVector(U_system_name);
+        std::unique_ptr<PetscVector<double> > U_1_vec = fe_data_manager.buildIBGhostedVector(U_system_name);
+
+        // Two position vectors with different ghost layouts: one with libMesh's
+        // ghost entries and one with the IB ghost entries.
+        auto& X_libmesh_vec = dynamic_cast<PetscVector<double>&>(*X_system.current_local_solution);
+        std::unique_ptr<PetscVector<double> > X_ib_vec = fe_data_manager.buildIBGhostedVector(X_system_name);
+        auto update_positions = [&]() {
+            X_system.solution->close();
+            X_system.update();
+            *X_ib_vec = *X_system.solution;
+            X_ib_vec->close();
+        };
+        update_positions();
+
+        using InterpolationTransactionComponent = HierarchyGhostCellInterpolation::InterpolationTransactionComponent;
+        InterpolationTransactionComponent f_transaction(
+            f_0_idx, "CONSERVATIVE_LINEAR_REFINE", false, "CONSERVATIVE_COARSEN", "LINEAR", false);
+        HierarchyGhostCellInterpolation f_fill_op;
+        f_fill_op.initializeOperatorState(f_transaction, patch_hierarchy);
+
+        auto spread = [&](const int f_idx, PetscVector<double>& X_vec) {
+            f_ops->setToScalar(f_idx, 0.0, false);
+            fe_data_manager.spread(f_idx, *F_vec, X_vec, F_system_name);
+        };
+        auto spread_diff = [&]() {
+            f_ops->subtract(f_diff_idx, f_0_idx, f_1_idx);
+            return f_ops->maxNorm(f_diff_idx) / f_ops->maxNorm(f_0_idx);
+        };
+        const std::vector<Pointer<RefineSchedule<NDIM> > > no_fill;
+        auto interp = [&](PetscVector<double>& U_vec, PetscVector<double>& X_vec) {
+            U_vec.zero();
+            fe_data_manager.interpWeighted(f_0_idx, U_vec, X_vec, U_system_name, no_fill, 0.0, false, false);
+            const std::vector<PetscVector<double>*> U_vecs = { &U_vec };
+            batch_vec_ghost_update(U_vecs, ADD_VALUES, SCATTER_REVERSE);
+        };
+        auto interp_diff = [&]() {
+            std::unique_ptr<NumericVector<double> > U_diff_vec = U_0_vec->clone();
+            U_diff_vec->add(-1.0, *U_1_vec);
+            return U_diff_vec->linfty_norm() / U_0_vec->linfty_norm();
+        };
+
+        std::ofstream out;
+        if (IBTK_MPI::getRank() == 0) out.open("output");
+        auto report = [&](const std::string& description, const double diff) {
+            if (IBTK_MPI::getRank() == 0)
+            {
+                out << description << ": relative max norm of the difference: " << diff << "\n";
+            }
+        };
+
+        // Repeated calls reuse the cached data.
+        spread(f_0_idx, X_libmesh_vec);
+        spread(f_1_idx, X_libmesh_vec);
+        report("repeated spread", spread_diff());
+        f_fill_op.fillData(0.0);
+        interp(*U_0_vec, X_libmesh_vec);
+        interp(*U_1_vec, X_libmesh_vec);
+        report("repeated interp", interp_diff());
+
+        // Switching between ghost layouts recomputes the cached local indices.
+        spread(f_1_idx, *X_ib_vec);
+        report("spread with IB ghosted positions", spread_diff());
+        interp(*U_1_vec, *X_ib_vec);
+        report("interp with IB ghosted positions", interp_diff());
+
+        // Enlarge the mesh so that the keys of the adaptive quadrature rules
+        // change. Since the hierarchy consists of a single patch the element to
+        // patch association does not change.
+        const double scale = input_db->getDoubleWithDefault("scale", 1.25);
+        NumericVector<double>& X_vec = *X_system.solution;
+        for (unsigned int i = X_vec.first_local_index(); i < X_vec.last_local_index(); ++i)
+        {
+            X_vec.set(i, 0.5 + scale * (X_vec(i) - 0.5));
+        }
+        update_positions();
+        spread(f_0_idx, *X_ib_vec);
+        f_fill_op.fillData(0.0);
+        interp(*U_0_vec, *X_ib_vec);
+
+        // Recompute all quadrature data from scratch.
+        fe_data_manager.reinitElementMappings();
+        spread(f_1_idx, *X_ib_vec);
+        report("spread with updated quadrature keys vs. recomputed data", spread_diff());
+        interp(*U_1_vec, *X_ib_vec);
+        report("interp with updated quadrature keys vs. recomputed data", interp_diff());
+    } // cleanup dynamically allocated objects prior to shutdown
+} // main